@@ -7,6 +7,7 @@ enum PredictorError: Error {
     case invalidArgument
     case outOfMemory
     case internalError
+    case cancelled
     case unknown(code: Int32)
     
     init(status: PredictorStatus) {
@@ -15,6 +16,7 @@ enum PredictorError: Error {
             case PREDICTOR_ERROR_INVALID_ARGUMENT: self = .invalidArgument
             case PREDICTOR_ERROR_OUT_OF_MEMORY: self = .outOfMemory
             case PREDICTOR_ERROR_INTERNAL: self = .internalError
+            case PREDICTOR_ERROR_CANCELLED: self = .cancelled
             default: self = .unknown(code: status.rawValue)
         }
     }
@@ -98,6 +100,33 @@ public struct PredictionResult {
     }
 }
 
+// The handler of an asynchronous request, passed through the C callback's
+// context and released by it
+private final class AsyncCompletion {
+    let handler: (Result<[PredictionResult], Error>) -> Void
+    
+    init(_ handler: @escaping (Result<[PredictionResult], Error>) -> Void) {
+        self.handler = handler
+    }
+}
+
+private let asyncCallback: PredictorCompletionCallback = { context, completion in
+    guard let context = context, let completion = completion?.pointee else { return }
+    let box = Unmanaged<AsyncCompletion>.fromOpaque(context).takeRetainedValue()
+    
+    if completion.status != PREDICTOR_SUCCESS {
+        box.handler(.failure(PredictorError(status: completion.status)))
+        return
+    }
+    // The results are only valid during the callback, so they are copied here
+    guard let resultPtr = completion.results else {
+        box.handler(.success([]))
+        return
+    }
+    box.handler(.success(Array(UnsafeBufferPointer(start: resultPtr, count: completion.count))
+        .map(PredictionResult.init)))
+}
+
 // Main wrapper class
 class Predictor {
     private var handle: PredictorRef? {
@@ -109,6 +138,11 @@ class Predictor {
         }
     }
     
+    // The synchronous predictions go to the handle's own memory, which holds
+    // every result however long and stays valid until its next prediction
+    // call, so each call is made and copied out under resultLock
+    private let resultLock = NSLock()
+    
     init(debugMode: Bool = false) throws {
         var status = PREDICTOR_SUCCESS
         guard let ptr = Predictor_Create(debugMode ? 1 : 0, &status) else {
@@ -123,6 +157,23 @@ class Predictor {
         }
     }
     
+    // Run one of the Predictor_Get*PredictionsInto calls, which get a NULL
+    // buffer, and copy the results out
+    private func predictions(_ call: (inout UnsafeMutablePointer<PredictorResult>?, inout size_t) -> PredictorStatus) throws -> [PredictionResult] {
+        resultLock.lock()
+        defer { resultLock.unlock() }
+        
+        var results: UnsafeMutablePointer<PredictorResult>?
+        var count: size_t = 0
+        let status = call(&results, &count)
+        if status != PREDICTOR_SUCCESS {
+            throw PredictorError(status: status)
+        }
+        
+        guard let resultPtr = results else { return [] }
+        return Array(UnsafeBufferPointer(start: resultPtr, count: count)).map(PredictionResult.init)
+    }
+    
     func initialize(triePath: String) throws {
         guard let handle = handle else { throw PredictorError.initializationFailed }
         
@@ -147,43 +198,121 @@ class Predictor {
         }
     }
     
+    func flushUserDictionary() throws {
+        guard let handle = handle else { throw PredictorError.initializationFailed }
+        
+        let status = Predictor_FlushUserDictionary(handle)
+        if status != PREDICTOR_SUCCESS {
+            throw PredictorError(status: status)
+        }
+    }
+    
+    func loadNgramModel(path: String) throws {
+        guard let handle = handle else { throw PredictorError.initializationFailed }
+        
+        let status = path.withCString { cPath in
+            Predictor_LoadNgramModel(handle, cPath)
+        }
+        
+        if status != PREDICTOR_SUCCESS {
+            throw PredictorError(status: status)
+        }
+    }
+    
+    func loadAnnotations(path: String) throws {
+        guard let handle = handle else { throw PredictorError.initializationFailed }
+        
+        let status = path.withCString { cPath in
+            Predictor_LoadAnnotations(handle, cPath)
+        }
+        
+        if status != PREDICTOR_SUCCESS {
+            throw PredictorError(status: status)
+        }
+    }
+    
     func getWordPredictions(prefix: String, targetScript: TargetScript, annotationType: AnnotationDataType, maxResults: Int) throws -> [PredictionResult] {
         guard let handle = handle else { throw PredictorError.initializationFailed }
         
         print("Getting word predictions for prefix: '\(prefix)', targetScript: '\(targetScript)', annotationType: '\(annotationType)', maxResuts: \(maxResults)")
         
-        var results: UnsafeMutablePointer<PredictorResult>?
-        var count: size_t = 0
+        let resultsArray = try predictions { results, count in
+            Array(prefix.utf16 + [0]).withUnsafeBufferPointer { prefixBuf in
+                prefixBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: prefixBuf.count) { prefixPtr in
+                    Predictor_GetWordPredictionsInto(
+                        handle,
+                        prefixPtr,
+                        targetScript,
+                        annotationType,
+                        size_t(maxResults),
+                        nil,
+                        0,
+                        &results,
+                        &count
+                    )
+                }
+            }
+        }
+        print("   Results: \(resultsArray)")
+        return resultsArray
+    }
+    
+    // aspectRatio is the keyboard's height over its width, 0 for a portrait phone's
+    func loadKeyLayout(path: String, aspectRatio: Float = 0) throws {
+        guard let handle = handle else { throw PredictorError.initializationFailed }
+        
+        let status = path.withCString { cPath in
+            Predictor_LoadKeyLayout(handle, cPath, aspectRatio)
+        }
         
-        let status = Array(prefix.utf16 + [0]).withUnsafeBufferPointer { prefixBuf in
-            prefixBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: prefixBuf.count) { prefixPtr in
-                Predictor_GetWordPredictions(
+        if status != PREDICTOR_SUCCESS {
+            throw PredictorError(status: status)
+        }
+    }
+    
+    // Completions of the prefix as typed with slips, within 'tolerance' edits
+    func getFuzzyPredictions(prefix: String, tolerance: Float = 1, targetScript: TargetScript, annotationType: AnnotationDataType, maxResults: Int) throws -> [PredictionResult] {
+        guard let handle = handle else { throw PredictorError.initializationFailed }
+        
+        return try predictions { results, count in
+            Array(prefix.utf16 + [0]).withUnsafeBufferPointer { prefixBuf in
+                prefixBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: prefixBuf.count) { prefixPtr in
+                    Predictor_GetFuzzyPredictionsInto(
+                        handle,
+                        prefixPtr,
+                        tolerance,
+                        targetScript,
+                        annotationType,
+                        size_t(maxResults),
+                        nil,
+                        0,
+                        &results,
+                        &count
+                    )
+                }
+            }
+        }
+    }
+    
+    // Completions of the Tamil words the Anjal keystrokes may stand for
+    func getAnjalPredictions(keystrokes: String, targetScript: TargetScript, annotationType: AnnotationDataType, maxResults: Int) throws -> [PredictionResult] {
+        guard let handle = handle else { throw PredictorError.initializationFailed }
+        
+        return try predictions { results, count in
+            keystrokes.withCString { cKeystrokes in
+                Predictor_GetAnjalPredictionsInto(
                     handle,
-                    prefixPtr,
+                    cKeystrokes,
                     targetScript,
                     annotationType,
                     size_t(maxResults),
+                    nil,
+                    0,
                     &results,
                     &count
                 )
             }
         }
-        
-        defer {
-            if let results = results {
-                Predictor_FreeResults(results)
-            }
-        }
-        
-        if status != PREDICTOR_SUCCESS {
-            throw PredictorError(status: status)
-        }
-        
-        guard let resultPtr = results else { return [] }
-        let resultsArray =  Array(UnsafeBufferPointer(start: resultPtr, count: count))
-            .map(PredictionResult.init)
-        print("   Results: \(resultsArray)")
-        return resultsArray
     }
     
     // Not very useful. See the C++ implementation for more info
@@ -199,56 +328,121 @@ class Predictor {
         }
     }
     
-    func getNgramPredictions(baseWord: String, secondWord: String, prefix: String, targetScript: TargetScript, annotationType: AnnotationDataType, maxResults: Int) throws -> [PredictionResult] {
+    // Bytes the prediction cache may hold, 0 to turn it off
+    func setCacheBudget(bytes: Int) throws {
         guard let handle = handle else { throw PredictorError.initializationFailed }
         
-        var results: UnsafeMutablePointer<PredictorResult>?
-        var count: size_t = 0
+        let status = Predictor_SetCacheBudget(handle, size_t(bytes))
+        if status != PREDICTOR_SUCCESS {
+            throw PredictorError(status: status)
+        }
+    }
+    
+    // Hits, misses and what the prediction cache holds
+    func cacheStats() throws -> PredictorCacheStats {
+        guard let handle = handle else { throw PredictorError.initializationFailed }
+        
+        var stats = PredictorCacheStats()
+        let status = Predictor_GetCacheStats(handle, &stats)
+        if status != PREDICTOR_SUCCESS {
+            throw PredictorError(status: status)
+        }
+        return stats
+    }
+    
+    func getNgramPredictions(baseWord: String, secondWord: String, prefix: String, targetScript: TargetScript, annotationType: AnnotationDataType, maxResults: Int) throws -> [PredictionResult] {
+        guard let handle = handle else { throw PredictorError.initializationFailed }
         
         // Convert all words to null-terminated UTF-16
         let baseWordUTF16 = Array(baseWord.utf16 + [0])
         let secondWordUTF16 = Array(secondWord.utf16 + [0])
         let prefixUTF16 = Array(prefix.utf16 + [0])
         
-        // Rebind the pointers to wchar_t
+        return try predictions { results, count in
+            // Rebind the pointers to wchar_t
+            baseWordUTF16.withUnsafeBufferPointer { baseWordBuf in
+                secondWordUTF16.withUnsafeBufferPointer { secondWordBuf in
+                    prefixUTF16.withUnsafeBufferPointer { prefixBuf in
+                        let baseWordPtr = baseWordBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: baseWordBuf.count) { $0 }
+                        let secondWordPtr = secondWordBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: secondWordBuf.count) { $0 }
+                        let prefixPtr = prefixBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: prefixBuf.count) { $0 }
+                        
+                        return Predictor_GetNgramPredictionsInto(
+                            handle,
+                            baseWordPtr,
+                            secondWordPtr,
+                            prefixPtr,
+                            targetScript,
+                            annotationType,
+                            size_t(maxResults),
+                            nil,
+                            0,
+                            &results,
+                            &count
+                        )
+                    }
+                }
+            }
+        }
+    }
+    
+    // Word predictions off the calling thread (see Predictor_SubmitAsync). A
+    // later request of the same session supersedes this one, which then
+    // completes with PredictorError.cancelled. 'completion' is called once,
+    // on the predictor's thread. Returns the ticket for cancel(ticket:).
+    @discardableResult
+    func submitWordPredictions(prefix: String, session: UInt32 = 0, targetScript: TargetScript, annotationType: AnnotationDataType, maxResults: Int, completion: @escaping (Result<[PredictionResult], Error>) -> Void) throws -> UInt64 {
+        return try submit(kind: PREDICTOR_REQUEST_WORDS, baseWord: "", secondWord: "", prefix: prefix, session: session, targetScript: targetScript, annotationType: annotationType, maxResults: maxResults, completion: completion)
+    }
+    
+    // The same for next-word predictions
+    @discardableResult
+    func submitNgramPredictions(baseWord: String, secondWord: String, prefix: String, session: UInt32 = 0, targetScript: TargetScript, annotationType: AnnotationDataType, maxResults: Int, completion: @escaping (Result<[PredictionResult], Error>) -> Void) throws -> UInt64 {
+        return try submit(kind: PREDICTOR_REQUEST_NGRAMS, baseWord: baseWord, secondWord: secondWord, prefix: prefix, session: session, targetScript: targetScript, annotationType: annotationType, maxResults: maxResults, completion: completion)
+    }
+    
+    // Cancel a submitted request; false if it already completed
+    @discardableResult
+    func cancel(ticket: UInt64) -> Bool {
+        guard let handle = handle else { return false }
+        return Predictor_CancelAsync(handle, ticket) == PREDICTOR_SUCCESS
+    }
+    
+    private func submit(kind: PredictorRequestKind, baseWord: String, secondWord: String, prefix: String, session: UInt32, targetScript: TargetScript, annotationType: AnnotationDataType, maxResults: Int, completion: @escaping (Result<[PredictionResult], Error>) -> Void) throws -> UInt64 {
+        guard let handle = handle else { throw PredictorError.initializationFailed }
+        
+        // The strings are copied by the call, so they need only outlive it
+        let baseWordUTF16 = Array(baseWord.utf16 + [0])
+        let secondWordUTF16 = Array(secondWord.utf16 + [0])
+        let prefixUTF16 = Array(prefix.utf16 + [0])
+        
+        let context = Unmanaged.passRetained(AsyncCompletion(completion))
+        var ticket: UInt64 = 0
         var status: PredictorStatus = PREDICTOR_SUCCESS
         baseWordUTF16.withUnsafeBufferPointer { baseWordBuf in
             secondWordUTF16.withUnsafeBufferPointer { secondWordBuf in
                 prefixUTF16.withUnsafeBufferPointer { prefixBuf in
-                    let baseWordPtr = baseWordBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: baseWordBuf.count) { $0 }
-                    let secondWordPtr = secondWordBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: secondWordBuf.count) { $0 }
-                    let prefixPtr = prefixBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: prefixBuf.count) { $0 }
+                    var request = PredictorRequest()
+                    request.kind = kind
+                    request.session = session
+                    request.prefix = prefixBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: prefixBuf.count) { UnsafePointer($0) }
+                    request.base_word = baseWordBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: baseWordBuf.count) { UnsafePointer($0) }
+                    request.second_word = secondWordBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: secondWordBuf.count) { UnsafePointer($0) }
+                    request.target_script = targetScript
+                    request.annotation_type = annotationType
+                    request.max_results = size_t(maxResults)
                     
-                    // Call the C function and capture the return value
-                    status = Predictor_GetNgramPredictions(
-                        handle,
-                        baseWordPtr,
-                        secondWordPtr,
-                        prefixPtr,
-                        targetScript,
-                        annotationType,
-                        size_t(maxResults),
-                        &results,
-                        &count
-                    )
+                    status = Predictor_SubmitAsync(handle, &request, asyncCallback, context.toOpaque(), &ticket)
                 }
             }
         }
         
-        defer {
-            if let results = results {
-                Predictor_FreeResults(results)
-            }
-        }
-        
-        // Check the status
         if status != PREDICTOR_SUCCESS {
+            // Not accepted, so the callback will not release it
+            context.release()
             throw PredictorError(status: status)
         }
-        
-        guard let resultPtr = results else { return [] }
-        return Array(UnsafeBufferPointer(start: resultPtr, count: count))
-            .map(PredictionResult.init)
+        return ticket
     }
     
     func addWord(_ word: String) throws {
@@ -342,6 +536,23 @@ class Predictor {
         return Int(count)  // Convert back to Int for Swift API
     }
 
+    // The annotation of a displayed result, for results asked for with .notrequired
+    func annotation(wordId: Int32, annotationType: AnnotationDataType) throws -> String? {
+        guard let handle = handle else { throw PredictorError.initializationFailed }
+        
+        var output: UnsafePointer<wchar_t>?
+        let status = Predictor_GetAnnotation(handle, wordId, annotationType, &output)
+        if status != PREDICTOR_SUCCESS {
+            throw PredictorError(status: status)
+        }
+        guard let ptr = output else { return nil }
+        
+        let uint16Ptr = UnsafeRawPointer(ptr).assumingMemoryBound(to: UInt16.self)
+        var length = 0
+        while uint16Ptr[length] != 0 { length += 1 }
+        return String(decoding: UnsafeBufferPointer(start: uint16Ptr, count: length), as: UTF16.self)
+    }
+    
     func importAnnotations(fromTextFile: String) throws -> Int {
         guard let handle else { return 0 }
         
@@ -439,6 +650,31 @@ class Predictor {
         return String(decoding: utf16CodeUnits, as: UTF16.self)
     }
     
+    // Tamil text, a word or a whole document, in another script
+    static func convert(_ text: String, to targetScript: TargetScript) throws -> String {
+        let units = Array(text.utf16 + [0])
+        // Two UTF-16 code units to an element, wchar_t aligned
+        var buffer = [UInt32](repeating: 0, count: units.count + 1)
+        var output: UnsafePointer<wchar_t>?
+        var length: size_t = 0
+        
+        let status = units.withUnsafeBufferPointer { textBuf in
+            textBuf.baseAddress!.withMemoryRebound(to: wchar_t.self, capacity: textBuf.count) { textPtr in
+                buffer.withUnsafeMutableBytes { bufferBytes in
+                    Predictor_ConvertTextInto(textPtr, targetScript, bufferBytes.baseAddress, bufferBytes.count, &output, &length)
+                }
+            }
+        }
+        
+        guard status == PREDICTOR_SUCCESS, output != nil else {
+            throw PredictorError(status: status)
+        }
+        
+        return buffer.withUnsafeBytes { bufferBytes in
+            String(decoding: bufferBytes.bindMemory(to: UInt16.self).prefix(length), as: UTF16.self)
+        }
+    }
+    
     func setDebugMode(_ enable: Bool) {
         if let handle = handle {
             Predictor_SetDebugMode(handle, enable ? 1 : 0)
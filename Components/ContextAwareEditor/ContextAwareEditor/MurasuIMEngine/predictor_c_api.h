@@ -3,6 +3,7 @@
 
 #include <stddef.h>  // for size_t
 #include <stdbool.h>
+#include <stdint.h>
 #include "ScriptConverterStructs.h"
 
 #ifdef _WIN32
@@ -29,7 +30,8 @@ typedef enum PredictorStatus {
     PREDICTOR_ERROR_INVALID_ARGUMENT = -1,
     PREDICTOR_ERROR_OUT_OF_MEMORY = -2,
     PREDICTOR_ERROR_INITIALIZATION = -3,
-    PREDICTOR_ERROR_INTERNAL = -4
+    PREDICTOR_ERROR_INTERNAL = -4,
+    PREDICTOR_ERROR_CANCELLED = -5      // an asynchronous request dropped
 } PredictorStatus;
 
 // Opaque type for predictor handle
@@ -43,6 +45,8 @@ typedef struct {
 } PredictorOptions;
 
 // Result structure
+// All wchar_t strings in this API, in and out, are NUL terminated UTF-16
+// code units, whatever the platform's width of wchar_t.
 typedef struct {
     const wchar_t* word;    // Points to internal buffer, don't free
     const wchar_t* annotation; // Points to annotation text, don't free
@@ -62,14 +66,67 @@ PREDICTOR_API PredictorStatus Predictor_Initialize(
     PredictorRef predictor,
     const char* trie_path);
 
+// db_path is the snapshot (anjaluser.data); changes since go to db_path
+// with ".log" appended
 PREDICTOR_API PredictorStatus Predictor_SetUserDictionary(
     PredictorRef predictor,
     const char* db_path);
 
+// Learned words, bigrams and removals are saved in batches off the calling
+// thread; call this when the keyboard is dismissed to have them on disk now
+PREDICTOR_API PredictorStatus Predictor_FlushUserDictionary(PredictorRef predictor);
+
+// Next-word probabilities for Predictor_GetNgramPredictions, built against
+// the dictionary given to Predictor_Initialize (tools/build_ngram_model).
+// Optional: without it next words come from learned sequences only.
+PREDICTOR_API PredictorStatus Predictor_LoadNgramModel(
+    PredictorRef predictor,
+    const char* model_path);
+
+// Meanings and transliterations built against the dictionary given to
+// Predictor_Initialize (tools/build_annotations). The file is mapped, not
+// read: nothing is parsed at startup and a word's annotation is read in
+// when it is first looked up. Annotations imported with
+// Predictor_ImportAnnotationsFromTextFile take precedence over it.
+PREDICTOR_API PredictorStatus Predictor_LoadAnnotations(
+    PredictorRef predictor,
+    const char* annotations_path);
+
+// The keyboard layout JSON (mn_tamil99.json and the like) whose key
+// positions price slips in Predictor_GetFuzzyPredictionsInto: a letter
+// typed for one on a neighbouring key costs about a third of an edit.
+// aspect_ratio is the keyboard's height over its width as shown, 0 for a
+// portrait phone's. Optional: without a layout every slip is a whole edit.
+PREDICTOR_API PredictorStatus Predictor_LoadKeyLayout(
+    PredictorRef predictor,
+    const char* layout_path,
+    float aspect_ratio);
+
 PREDICTOR_API PredictorStatus Predictor_Configure(
     PredictorRef predictor,
     const PredictorOptions* options);
 
+// Word and cursor predictions of recent prefixes are cached, keyed by
+// prefix, script, annotation type and max_results, and an entry is dropped
+// when a word learned, removed or blacklisted could reorder it. The budget
+// is in bytes, 512 KiB by default; 0 turns the cache off.
+typedef struct {
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t invalidated;   // entries dropped as their ranking changed
+    uint64_t evicted;       // entries dropped for room
+    size_t entries;
+    size_t bytes;
+} PredictorCacheStats;
+
+PREDICTOR_API PredictorStatus Predictor_SetCacheBudget(
+    PredictorRef predictor,
+    size_t bytes);
+
+PREDICTOR_API PredictorStatus Predictor_GetCacheStats(
+    PredictorRef predictor,
+    PredictorCacheStats* out_stats);
+
 // Core prediction functionality
 PREDICTOR_API PredictorStatus Predictor_GetWordPredictions(
     PredictorRef predictor,
@@ -91,6 +148,182 @@ PREDICTOR_API PredictorStatus Predictor_GetNgramPredictions(
     PredictorResult** out_results,
     size_t* out_count);
 
+// The same, without allocating, for the keystroke path. The results array is
+// written at the start of 'buffer', which must be aligned for
+// PredictorResult, with the strings after it; lower ranked results that do
+// not fit are left out. The pointers stay valid as long as the buffer and
+// nothing is freed.
+// With a NULL buffer all the results go to memory owned by the handle, grown
+// to fit, valid until its next prediction call.
+#define PREDICTOR_RESULT_BUFFER_SIZE(max_results) ((max_results) * (sizeof(PredictorResult) + 256))
+
+PREDICTOR_API PredictorStatus Predictor_GetWordPredictionsInto(
+    PredictorRef predictor,
+    const wchar_t* prefix,
+    enum TargetScript target_script,
+    enum AnnotationDataType annotation_type,
+    size_t max_results,
+    void* buffer,
+    size_t buffer_size,
+    PredictorResult** out_results,
+    size_t* out_count);
+
+PREDICTOR_API PredictorStatus Predictor_GetNgramPredictionsInto(
+    PredictorRef predictor,
+    const wchar_t* base_word,
+    const wchar_t* second_word,
+    const wchar_t* next_word_prefix,
+    enum TargetScript target_script,
+    enum AnnotationDataType annotation_type,
+    size_t max_results,
+    void* buffer,
+    size_t buffer_size,
+    PredictorResult** out_results,
+    size_t* out_count);
+
+// Completions of words whose start is within 'tolerance' edits of the
+// prefix as typed, for a prefix with slips: a letter left out or typed too
+// many costs 1, one typed for another 1 or less as their keys are nearer.
+// Short prefixes are held to 0.4 per code unit typed. Dictionary words
+// only, each scored with its frequency less a penalty for the edits; the
+// search reads a bounded number of trie nodes, so a query takes a few
+// milliseconds at worst. Returned as by Predictor_GetWordPredictionsInto.
+PREDICTOR_API PredictorStatus Predictor_GetFuzzyPredictionsInto(
+    PredictorRef predictor,
+    const wchar_t* prefix,
+    float tolerance,
+    enum TargetScript target_script,
+    enum AnnotationDataType annotation_type,
+    size_t max_results,
+    void* buffer,
+    size_t buffer_size,
+    PredictorResult** out_results,
+    size_t* out_count);
+
+// Completions of the Tamil words the Latin keys typed on the Anjal keyboard
+// may stand for: every reading of the keys by the Anjal tables, with the
+// letters people type alike (n for ந, ன and ண; l for ல, ள and ழ; r for ர
+// and ற) read each way and the last keys possibly the start of a letter.
+// Dictionary words only, ranked on frequency; the search reads a bounded
+// number of trie nodes, so a query takes a few milliseconds at worst
+// however many keys. Returned as by Predictor_GetWordPredictionsInto.
+PREDICTOR_API PredictorStatus Predictor_GetAnjalPredictionsInto(
+    PredictorRef predictor,
+    const char* keystrokes,
+    enum TargetScript target_script,
+    enum AnnotationDataType annotation_type,
+    size_t max_results,
+    void* buffer,
+    size_t buffer_size,
+    PredictorResult** out_results,
+    size_t* out_count);
+
+// Incremental predictions for the word being typed. A cursor keeps the trie
+// position and the candidate search of its text between keystrokes, so
+// each key costs about the work for what it changed, and it predicts what
+// Predictor_GetWordPredictions predicts for the same text. A cursor belongs
+// to one predictor and is destroyed before it.
+typedef struct PredictorCursorHandle* PredictorCursorRef;
+
+PREDICTOR_API PredictorCursorRef Predictor_CreateCursor(
+    PredictorRef predictor,
+    PredictorStatus* status);
+
+PREDICTOR_API void Predictor_DestroyCursor(PredictorCursorRef cursor);
+
+// Append typed text
+PREDICTOR_API PredictorStatus Predictor_CursorExtend(
+    PredictorCursorRef cursor,
+    const wchar_t* text);
+
+// Remove the last 'count' code points, for backspace; 'out_removed', which
+// may be NULL, gets how many there were to remove
+PREDICTOR_API PredictorStatus Predictor_CursorRetract(
+    PredictorCursorRef cursor,
+    size_t count,
+    size_t* out_removed);
+
+// Back to empty text, for the next word
+PREDICTOR_API PredictorStatus Predictor_CursorReset(PredictorCursorRef cursor);
+
+// Completions of the cursor's text, returned as by
+// Predictor_GetWordPredictionsInto (a NULL buffer uses the predictor's)
+PREDICTOR_API PredictorStatus Predictor_GetCursorPredictions(
+    PredictorCursorRef cursor,
+    enum TargetScript target_script,
+    enum AnnotationDataType annotation_type,
+    size_t max_results,
+    void* buffer,
+    size_t buffer_size,
+    PredictorResult** out_results,
+    size_t* out_count);
+
+// Predictions off the calling thread, for an input thread that must not
+// wait on a search. Requests run one at a time on a thread of the
+// predictor's own, started by the first of them. A request supersedes the
+// earlier ones of its session (one per text field, say): those not started
+// are dropped and the one running stops at its next check inside the trie
+// search, so a burst of keystrokes costs about one search.
+//
+// Every accepted request completes exactly once: with PREDICTOR_SUCCESS
+// and its results, or with PREDICTOR_ERROR_CANCELLED and none when it was
+// superseded, cancelled, or the predictor destroyed first. Completions go
+// to the callback, called on the predictor's thread with results valid
+// until it returns; the callback may submit and make synchronous calls, but
+// not destroy the predictor. With a NULL callback they go to a queue that
+// Predictor_PollCompletion empties without taking a lock, and their results
+// are freed with Predictor_FreeResults. While the queue holds
+// PREDICTOR_COMPLETION_QUEUE_SIZE completions, requests wait to complete.
+//
+// Synchronous calls on the predictor wait for the request running, if any.
+typedef enum PredictorRequestKind {
+    PREDICTOR_REQUEST_WORDS = 0,    // as Predictor_GetWordPredictions
+    PREDICTOR_REQUEST_NGRAMS = 1    // as Predictor_GetNgramPredictions
+} PredictorRequestKind;
+
+typedef struct {
+    PredictorRequestKind kind;
+    uint32_t session;
+    const wchar_t* prefix;          // the word's prefix, or next_word_prefix
+    const wchar_t* base_word;       // for PREDICTOR_REQUEST_NGRAMS
+    const wchar_t* second_word;     // may be NULL
+    enum TargetScript target_script;
+    enum AnnotationDataType annotation_type;
+    size_t max_results;
+} PredictorRequest;
+
+typedef struct {
+    uint64_t ticket;
+    uint32_t session;
+    PredictorStatus status;
+    PredictorResult* results;
+    size_t count;
+} PredictorCompletion;
+
+typedef void (*PredictorCompletionCallback)(void* context, const PredictorCompletion* completion);
+
+#define PREDICTOR_COMPLETION_QUEUE_SIZE 64
+
+// The request's strings are copied before this returns. 'out_ticket', which
+// may be NULL, gets the ticket its completion carries.
+PREDICTOR_API PredictorStatus Predictor_SubmitAsync(
+    PredictorRef predictor,
+    const PredictorRequest* request,
+    PredictorCompletionCallback callback,
+    void* context,
+    uint64_t* out_ticket);
+
+// PREDICTOR_ERROR_INVALID_ARGUMENT if the request already completed
+PREDICTOR_API PredictorStatus Predictor_CancelAsync(
+    PredictorRef predictor,
+    uint64_t ticket);
+
+// Take the oldest queued completion; returns 0 if there is none. One
+// thread at a time may poll.
+PREDICTOR_API int Predictor_PollCompletion(
+    PredictorRef predictor,
+    PredictorCompletion* out_completion);
+
 // Dictionary management
 PREDICTOR_API PredictorStatus Predictor_AddWord(
     PredictorRef predictor,
@@ -111,6 +344,16 @@ PREDICTOR_API PredictorStatus Predictor_GetAnnotationsCount(
     PredictorRef predictor,
     size_t* out_count);
 
+// The annotation of the word with dictionary id word_id, for a keyboard
+// that asks for NotRequired results and looks up only the candidates it
+// shows. *out_annotation is NULL if the word has none; otherwise it is
+// valid until annotations are next loaded or imported, and is not freed.
+PREDICTOR_API PredictorStatus Predictor_GetAnnotation(
+    PredictorRef predictor,
+    int32_t word_id,
+    enum AnnotationDataType annotation_type,
+    const wchar_t** out_annotation);
+
 PREDICTOR_API PredictorStatus Predictor_ImportAnnotationsFromTextFile(
     PredictorRef predictor,
     const char* fileName,
@@ -121,6 +364,8 @@ PREDICTOR_API PredictorStatus Predictor_ImportShortcutsFromTextFile(
     const char* fileName,
     size_t* out_count);
 
+// One word per line; a line ending in '*' blacklists every word starting
+// with what comes before it
 PREDICTOR_API PredictorStatus Predictor_ImportBlacklistFromTextFile(
     PredictorRef predictor,
     const char* fileName,
@@ -135,6 +380,34 @@ PREDICTOR_API PredictorStatus Predictor_ConvertToBrahmi(
     const wchar_t* word,
     wchar_t** out_result);
 
+// Tamil text, a word or a whole document, in 'target_script', written to
+// the caller's buffer, which is aligned for wchar_t, NUL terminated.
+// *out_length is the converted length in code units, without the NUL; the
+// result is at most twice the length of the text, so a buffer of
+// (2 * length + 1) * sizeof(char16_t) bytes always does. With a NULL buffer
+// only *out_length is set; with one too small, nothing is written and
+// PREDICTOR_ERROR_INVALID_ARGUMENT is returned.
+PREDICTOR_API PredictorStatus Predictor_ConvertTextInto(
+    const wchar_t* text,
+    enum TargetScript target_script,
+    void* buffer,
+    size_t buffer_size,
+    const wchar_t** out_text,
+    size_t* out_length);
+
+// The words of 'count' results, as returned in Tamil, converted to
+// 'target_script' in one call: each converted word is written to the
+// caller's buffer, aligned for wchar_t, and the result's word pointed at
+// it. Results are converted in order while the buffer has room, and
+// *out_count is how many were; the rest keep their Tamil words.
+PREDICTOR_API PredictorStatus Predictor_ConvertResults(
+    PredictorResult* results,
+    size_t count,
+    enum TargetScript target_script,
+    void* buffer,
+    size_t buffer_size,
+    size_t* out_count);
+
 // Memory management
 PREDICTOR_API void Predictor_FreeResults(PredictorResult* results);
 
@@ -122,6 +122,11 @@ public class TextEditorCore: ObservableObject {
             sangamTranslator?.setLayout(kbdAnjal)
             //sangamTranslator?.setLayout(kbdTWNew)
         }
+        
+        // English words typed on Anjal stay in English when a lexicon is bundled
+        if let lexiconPath = Bundle.main.path(forResource: "en_lexicon", ofType: "data") {
+            sangamTranslator?.setEnglishLexicon(path: lexiconPath)
+        }
     }
     
     private func setupTextStorage() {
@@ -410,11 +415,17 @@ public class TextEditorCore: ObservableObject {
     }
     
     private func commitComposition() {
-        guard isComposing, let range = compositionRange else { return }
+        guard isComposing, var range = compositionRange else { return }
         
         // Cancel any pending prediction updates since composition is ending
         cancelPendingUpdates()
         
+        // An English word typed on Anjal is committed as typed
+        if let englishWord = sangamTranslator?.englishWordForComposition() {
+            updateCompositionDisplay(englishWord)
+            range = compositionRange ?? range
+        }
+        
         // Remove composition styling and apply normal text attributes
         let normalAttributes = getNormalTextAttributes()
         //textStorage.addAttributes(normalAttributes, range: range)
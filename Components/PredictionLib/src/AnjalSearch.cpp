@@ -0,0 +1,259 @@
+#include "AnjalSearch.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <string>
+
+namespace predictor {
+
+namespace {
+
+// The Anjal rows of kbdTable in Libraries/KeyTanslatorLib/include/AnjalKeyMapLookup.h,
+// which this library does not link. Column i of the consonant rows is typed
+// as kConsonantKeys[0][i], then [1][i], then [2][i] ('*' where it ends), and
+// after each key reads as the letter in the same place of kConsonantLetters.
+const char* const kConsonantKeys[3] = {
+    "RvlnnWyNztdtkgmpbtnwrLcsnnSSsjhsssxdtnnnnkk\\",
+    "****=******h******-***h*gj*hh**rrR*rrtddjss*",
+    "********************************ii**hh*rj*h*",
+};
+const char* const kConsonantLetters[3] = {
+    "RvlnnnyNztdtkkmppdwwrLccgGSSsjhWWWxR12347kk^",
+    "****n******t******w***ccgG*Hs**WWW*R1234788*",
+    "*******************************WWW***2*47*9*",
+};
+const char* const kVowelKeys[2] = { "aAiIuUeaEaooOaq", "a*i*u*ee*ioa*u*" };
+const char* const kVowelLetters[2] = { "aAiIuUeeEXooOQq", "A*I*U*EE*XOO*Q*" };
+
+struct Consonant {
+    char letter;
+    const char16_t* text;
+    bool takesSign;     // ஸ்ரீ is whole as it is
+};
+
+// A cluster is its leading dead consonants and the one that takes the sign
+const Consonant kConsonants[] = {
+    { 'k', u"க", true },  { 'c', u"ச", true },  { 'd', u"ட", true },  { 't', u"த", true },
+    { 'p', u"ப", true },  { 'R', u"ற", true },  { 'y', u"ய", true },  { 'r', u"ர", true },
+    { 'l', u"ல", true },  { 'v', u"வ", true },  { 'z', u"ழ", true },  { 'L', u"ள", true },
+    { 'g', u"ங", true },  { 'G', u"ஞ", true },  { 'N', u"ண", true },  { 'w', u"ந", true },
+    { 'm', u"ம", true },  { 'n', u"ன", true },  { 'j', u"ஜ", true },  { 's', u"ஷ", true },
+    { 'S', u"ஸ", true },  { 'h', u"ஹ", true },  { 'H', u"ஶ", true },  { 'x', u"க்ஷ", true },
+    { 'W', u"ஸ்ரீ", false }, { '1', u"ற்ற", true }, { '2', u"ந்த", true }, { '3', u"ண்ட", true },
+    { '4', u"ன்ற", true }, { '7', u"ஞ்ச", true }, { '8', u"க்ச", true }, { '9', u"க்‌ஷ", true },
+};
+
+struct Vowel {
+    char letter;
+    const char16_t* sign;       // empty for the inherent a
+    const char16_t* letterText; // standing alone
+};
+
+const Vowel kVowels[] = {
+    { 'a', u"", u"அ" },  { 'A', u"ா", u"ஆ" }, { 'i', u"ி", u"இ" }, { 'I', u"ீ", u"ஈ" }, { 'u', u"ு", u"உ" },
+    { 'U', u"ூ", u"ஊ" }, { 'e', u"ெ", u"எ" }, { 'E', u"ே", u"ஏ" }, { 'X', u"ை", u"ஐ" }, { 'o', u"ொ", u"ஒ" },
+    { 'O', u"ோ", u"ஓ" }, { 'Q', u"ௌ", u"ஔ" }, { 'q', u"்", u"ஃ" },
+};
+
+constexpr const char16_t* kPulli = u"்";
+
+// Letters typed alike, each read as all of its group
+const char* const kAlike[] = { "nNw", "lLz", "rR" };
+
+struct Reading {
+    std::string keys;
+    std::vector<const Consonant*> consonants;
+    const Vowel* vowel;
+};
+
+struct Readings {
+    std::vector<Reading> consonants;
+    std::vector<Reading> vowels;
+};
+
+const Consonant* consonantOf(char letter)
+{
+    for (const Consonant& consonant : kConsonants) {
+        if (consonant.letter == letter)
+            return &consonant;
+    }
+    return nullptr;
+}
+
+const Vowel* vowelOf(char letter)
+{
+    for (const Vowel& vowel : kVowels) {
+        if (vowel.letter == letter)
+            return &vowel;
+    }
+    return nullptr;
+}
+
+// Each key sequence of the table and its letter; of two columns with the
+// same sequence the first is what the keyboard types
+std::vector<std::pair<std::string, char>> sequences(const char* const* keys, const char* const* letters, size_t rows)
+{
+    std::vector<std::pair<std::string, char>> found;
+    size_t columns = std::strlen(keys[0]);
+    for (size_t column = 0; column < columns; column++) {
+        std::string sequence;
+        for (size_t row = 0; row < rows && column < std::strlen(keys[row]) && keys[row][column] != '*'; row++) {
+            sequence += keys[row][column];
+            char letter = column < std::strlen(letters[row]) ? letters[row][column] : '*';
+            bool known = std::any_of(found.begin(), found.end(),
+                                     [&](const auto& other) { return other.first == sequence; });
+            if (letter != '*' && !known)
+                found.emplace_back(sequence, letter);
+        }
+    }
+    return found;
+}
+
+Readings buildReadings()
+{
+    Readings readings;
+    for (const auto& [keys, letter] : sequences(kConsonantKeys, kConsonantLetters, 3)) {
+        // '^' is the escape key, which types no letter
+        if (!consonantOf(letter))
+            continue;
+        Reading reading{ keys, {}, nullptr };
+        const char* alike = nullptr;
+        for (const char* group : kAlike) {
+            if (std::strchr(group, letter))
+                alike = group;
+        }
+        // The letter typed first, then the others of its group
+        reading.consonants.push_back(consonantOf(letter));
+        for (const char* other = alike; other && *other; other++) {
+            if (*other != letter)
+                reading.consonants.push_back(consonantOf(*other));
+        }
+        readings.consonants.push_back(std::move(reading));
+    }
+    for (const auto& [keys, letter] : sequences(kVowelKeys, kVowelLetters, 2)) {
+        if (const Vowel* vowel = vowelOf(letter))
+            readings.vowels.push_back({ keys, {}, vowel });
+    }
+    return readings;
+}
+
+const Readings& anjalReadings()
+{
+    static const Readings readings = buildReadings();
+    return readings;
+}
+
+// Whether 'reading' is typed at 'keys', or, 'partly', begun by all that is left
+bool typedAt(const std::string& reading, std::string_view keys, bool& partly)
+{
+    partly = keys.size() < reading.size();
+    return reading.compare(0, std::min(reading.size(), keys.size()), keys.substr(0, reading.size())) == 0;
+}
+
+} // namespace
+
+void AnjalSearch::start(std::string_view keys)
+{
+    merged_.clear();
+    heap_.clear();
+    anchored_.clear();
+    walked_ = 0;
+    if (!dictionary_->isOpen() || keys.empty())
+        return;
+
+    bestFirst_ = dictionary_->hasSubtreeMaxima();
+    push(Dictionary::kRoot, 0, 0);
+    size_t allowance = kNodeBudget / 2;
+    while (!heap_.empty() && walked_ < allowance && !cancelled()) {
+        State state = heap_.front();
+        std::pop_heap(heap_.begin(), heap_.end(), lowerPriority);
+        heap_.pop_back();
+        walked_++;
+        if (state.position < keys.size()) {
+            expand(state, keys);
+            continue;
+        }
+        // Every key read; the same node may be reached by two readings
+        if (std::find(anchored_.begin(), anchored_.end(), state.node) != anchored_.end())
+            continue;
+        anchored_.push_back(state.node);
+        merged_.add(state.node, static_cast<float>(state.others));
+        if (anchored_.size() == MergedSearch::kMaxAnchors)
+            break;
+    }
+    merged_.start(kOtherPenalty);
+}
+
+// The states after the syllable that starts at the state's position: a
+// consonant with the vowel after it, dead before another consonant, bare
+// at the end of the keys, or a vowel alone
+void AnjalSearch::expand(const State& state, std::string_view keys)
+{
+    const Readings& readings = anjalReadings();
+    std::string_view left = keys.substr(state.position);
+    uint32_t end = static_cast<uint32_t>(keys.size());
+    bool partly;
+    for (const Reading& consonant : readings.consonants) {
+        if (!typedAt(consonant.keys, left, partly))
+            continue;
+        uint32_t after = partly ? end : state.position + static_cast<uint32_t>(consonant.keys.size());
+        std::string_view rest = keys.substr(after);
+        for (const Consonant* letter : consonant.consonants) {
+            bool other = letter != consonant.consonants.front();
+            if (after == end || !letter->takesSign) {
+                emit(state, letter->text, u"", after, other);
+                continue;
+            }
+            bool vowelFollows = false;
+            for (const Reading& vowel : readings.vowels) {
+                if (!typedAt(vowel.keys, rest, partly))
+                    continue;
+                vowelFollows = true;
+                emit(state, letter->text, vowel.vowel->sign,
+                     partly ? end : after + static_cast<uint32_t>(vowel.keys.size()), other);
+            }
+            if (!vowelFollows)
+                emit(state, letter->text, kPulli, after, other);
+        }
+    }
+    for (const Reading& vowel : readings.vowels) {
+        if (typedAt(vowel.keys, left, partly))
+            emit(state, vowel.vowel->letterText, u"",
+                 partly ? end : state.position + static_cast<uint32_t>(vowel.keys.size()), false);
+    }
+}
+
+// Follow 'first' then 'second' down the trie from the state's node, and
+// queue the state reached at 'position' if the dictionary spells words so
+void AnjalSearch::emit(const State& from, TextView first, TextView second, uint32_t position, bool other)
+{
+    uint32_t node = from.node;
+    for (TextView text : { first, second }) {
+        for (char16_t unit : text) {
+            node = dictionary_->child(node, unit);
+            walked_++;
+            if (node == Dictionary::kNoNode)
+                return;
+        }
+    }
+    push(node, position, from.others + (other ? 1 : 0));
+}
+
+// Queued by the best word below the node, as MergedSearch will rank it;
+// without subtree maxima, by the letters read as others alone
+void AnjalSearch::push(uint32_t node, uint32_t position, uint32_t others)
+{
+    float penalty = kOtherPenalty * static_cast<float>(others);
+    float priority = bestFirst_ ? std::log2(1.0f + static_cast<float>(dictionary_->subtreeMaximum(node))) - penalty
+                                : -penalty;
+    heap_.push_back({ priority, node, position, others });
+    std::push_heap(heap_.begin(), heap_.end(), lowerPriority);
+}
+
+bool AnjalSearch::next(uint32_t& wordId, float& cost)
+{
+    return !cancelled() && merged_.next(wordId, cost, kNodeBudget - std::min(walked_, kNodeBudget));
+}
+
+} // namespace predictor
@@ -0,0 +1,103 @@
+#ifndef PREDICTOR_ANJAL_SEARCH_H
+#define PREDICTOR_ANJAL_SEARCH_H
+
+// Completions of a word typed on the Anjal keyboard, from its Latin keys
+// rather than the one Tamil reading the keyboard committed to.
+//
+// The keys are read with the Anjal tables (kbdTable of KeyTranslatorLib):
+// a consonant of one to three keys, then a vowel of one or two, which
+// makes the vowel sign, or none, which makes the consonant dead (pulli),
+// or a vowel alone, which stands as a letter. Each consonant key sequence
+// the table knows is a reading, and where a key stands for one of several
+// letters people type alike, all of them are: n for ந, ன and ண, l for ல,
+// ள and ழ, r for ர and ற. The keys also split into sequences every way
+// the table allows, and the last sequence may be the start of a longer one
+// still being typed. Together the readings form a lattice.
+//
+// The lattice is searched jointly with the trie, so a reading is only
+// followed while the dictionary has words spelled that way: a state is a
+// position in the keys and a trie node, and states are taken best first
+// by the node's subtree maximum, so readings of frequent words come first
+// and rare ones are pruned. A letter read as another of its group costs
+// kOtherPenalty. A state with every key read is an anchor, and the
+// anchors' completions are merged by a MergedSearch on frequency less the
+// cost.
+//
+// Every trie node read counts against kNodeBudget, of which the lattice
+// may take half, so a query takes a bounded time however long the word.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+#include "Dictionary.h"
+#include "MergedSearch.h"
+#include "Utf16.h"
+
+namespace predictor {
+
+class AnjalSearch {
+public:
+    static constexpr size_t kNodeBudget = 20000;
+    // Cost, in log2 of frequency, of each letter read as another of its
+    // group, so that a word spelled as typed outranks one a little more
+    // frequent spelled otherwise
+    static constexpr float kOtherPenalty = 1.0f;
+
+    explicit AnjalSearch(const Dictionary& dictionary) : dictionary_(&dictionary), merged_(dictionary) {}
+
+    // Search for words starting with a reading of 'keys'
+    void start(std::string_view keys);
+
+    // The next word id and how many of its letters were read as others of
+    // their group, best first, or false when there are no more or the
+    // budget is spent
+    bool next(uint32_t& wordId, float& cost);
+
+    void setCancellation(const std::atomic<bool>* cancelled)
+    {
+        cancelled_ = cancelled;
+        merged_.setCancellation(cancelled);
+    }
+    void setBlacklist(const Blacklist* blacklist) { merged_.setBlacklist(blacklist); }
+
+    // For measuring: trie nodes read since start(), how many anchors the
+    // lattice gave, and whether the budget ran out
+    size_t expanded() const { return walked_ + merged_.expanded(); }
+    size_t anchorCount() const { return merged_.anchorCount(); }
+    bool budgetSpent() const { return expanded() >= kNodeBudget; }
+
+private:
+    struct State {
+        float priority;         // the key of the node's best word
+        uint32_t node;
+        uint32_t position;      // keys read
+        uint32_t others;        // letters read as another of their group
+    };
+
+    static bool lowerPriority(const State& a, const State& b)
+    {
+        if (a.priority != b.priority)
+            return a.priority < b.priority;
+        return a.position < b.position;
+    }
+
+    void expand(const State& state, std::string_view keys);
+    void push(uint32_t node, uint32_t position, uint32_t others);
+    void emit(const State& from, TextView first, TextView second, uint32_t position, bool other);
+    bool cancelled() const { return cancelled_ && cancelled_->load(std::memory_order_relaxed); }
+
+    const Dictionary* dictionary_;
+    MergedSearch merged_;
+    std::vector<State> heap_;
+    std::vector<uint32_t> anchored_;
+    size_t walked_ = 0;
+    bool bestFirst_ = false;
+    const std::atomic<bool>* cancelled_ = nullptr;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_ANJAL_SEARCH_H
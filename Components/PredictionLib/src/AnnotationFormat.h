@@ -0,0 +1,56 @@
+#ifndef PREDICTOR_ANNOTATION_FORMAT_H
+#define PREDICTOR_ANNOTATION_FORMAT_H
+
+// On-disk layout of the annotations (ta_annotations.data), written by
+// tools/build_annotations and memory-mapped as is by AnnotationStore. It
+// uses the header, section table and alignment rules of DictionaryFormat.h
+// and is keyed by the word ids of the dictionary it was built against.
+//
+//   words    the ids of the annotated words, sorted, so a word is found by
+//            binary search
+//   entries  one AnnotationEntry per annotated word, in the same order
+//   text     UTF-16 code units: every meaning and transliteration, each
+//            ending in a NUL and starting on an even unit, so that it can be
+//            handed to the C API in place as a wchar_t string. Unit 0 is a
+//            NUL, the empty text; the section ends in a NUL.
+//
+// Texts used by more than one word, common among meanings, are stored once.
+
+#include <cstdint>
+
+#include "DictionaryFormat.h"
+
+namespace predictor {
+
+constexpr char     kAnnotationMagic[4] = { 'M', 'P', 'A', 'N' };
+constexpr uint32_t kAnnotationVersion = 1;
+
+enum AnnotationSectionId : uint32_t {
+    kAnnotationSectionWords   = 1,  // uint32_t[annotatedCount]
+    kAnnotationSectionEntries = 2,  // AnnotationEntry[annotatedCount]
+    kAnnotationSectionText    = 3,  // char16_t[textUnits]
+};
+
+struct AnnotationHeader {
+    char     magic[4];
+    uint32_t version;
+    uint32_t byteOrder;         // kByteOrderMark as written
+    uint32_t headerSize;        // sizeof(AnnotationHeader)
+    uint32_t wordCount;         // of the dictionary, the bound of every word id
+    uint32_t sectionCount;
+    uint32_t annotatedCount;
+    uint32_t textUnits;
+};
+
+// Where a word's texts start in the text section, 0 where it has none
+struct AnnotationEntry {
+    uint32_t meaning;
+    uint32_t transliteration;
+};
+
+static_assert(sizeof(AnnotationHeader) == 32, "AnnotationHeader layout");
+static_assert(sizeof(AnnotationEntry) == 8, "AnnotationEntry layout");
+
+} // namespace predictor
+
+#endif // PREDICTOR_ANNOTATION_FORMAT_H
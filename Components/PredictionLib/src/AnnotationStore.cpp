@@ -0,0 +1,111 @@
+#include "AnnotationStore.h"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+
+namespace predictor {
+
+bool AnnotationStore::open(const char* path, uint32_t wordCount)
+{
+    close();
+    error_ = nullptr;
+    if (!file_.open(path))
+        return fail("cannot map file");
+
+    const uint8_t* data = file_.data();
+    size_t size = file_.size();
+
+    AnnotationHeader header;
+    if (size < sizeof(header))
+        return fail("truncated header");
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kAnnotationMagic, sizeof(header.magic)) != 0)
+        return fail("not an annotation file");
+    if (header.byteOrder != kByteOrderMark)
+        return fail("wrong byte order");
+    if (header.version != kAnnotationVersion)
+        return fail("unsupported version");
+    if (header.headerSize < sizeof(header))
+        return fail("bad header");
+    if (header.wordCount != wordCount)
+        return fail("built for another dictionary");
+
+    uint64_t tableEnd = uint64_t(header.headerSize) + uint64_t(header.sectionCount) * sizeof(SectionEntry);
+    if (tableEnd > size)
+        return fail("truncated section table");
+
+    for (uint32_t i = 0; i < header.sectionCount; i++) {
+        SectionEntry entry;
+        std::memcpy(&entry, data + header.headerSize + i * sizeof(SectionEntry), sizeof(entry));
+        if (entry.offset % 8 != 0 || entry.offset > size || entry.size > size - entry.offset)
+            return fail("section out of range");
+
+        const uint8_t* section = data + entry.offset;
+        switch (entry.id) {
+        case kAnnotationSectionWords:
+            if (entry.size < uint64_t(header.annotatedCount) * sizeof(uint32_t))
+                return fail("bad word section");
+            words_ = reinterpret_cast<const uint32_t*>(section);
+            break;
+        case kAnnotationSectionEntries:
+            if (entry.size < uint64_t(header.annotatedCount) * sizeof(AnnotationEntry))
+                return fail("bad entry section");
+            entries_ = reinterpret_cast<const AnnotationEntry*>(section);
+            break;
+        case kAnnotationSectionText:
+            // Every text ends before the end of the section
+            text_ = reinterpret_cast<const char16_t*>(section);
+            if (header.textUnits == 0 || entry.size < uint64_t(header.textUnits) * sizeof(char16_t) ||
+                text_[header.textUnits - 1] != 0)
+                return fail("bad text section");
+            break;
+        default:
+            break;      // a newer minor addition
+        }
+    }
+    if (!words_ || !entries_ || !text_)
+        return fail("missing section");
+
+    textUnits_ = header.textUnits;
+    annotatedCount_ = header.annotatedCount;
+    wordCount_ = header.wordCount;
+    return true;
+}
+
+void AnnotationStore::close()
+{
+    file_.close();
+    words_ = nullptr;
+    entries_ = nullptr;
+    text_ = nullptr;
+    textUnits_ = 0;
+    annotatedCount_ = 0;
+    wordCount_ = 0;
+}
+
+bool AnnotationStore::fail(const char* reason)
+{
+    close();
+    error_ = reason;
+    return false;
+}
+
+TextView AnnotationStore::lookup(uint32_t wordId, AnnotationDataType type) const
+{
+    if (!isOpen() || (type != Meaning && type != Transliteration))
+        return TextView();
+    const uint32_t* end = words_ + annotatedCount_;
+    const uint32_t* found = std::lower_bound(words_, end, wordId);
+    if (found == end || *found != wordId)
+        return TextView();
+
+    const AnnotationEntry& entry = entries_[found - words_];
+    uint32_t start = type == Meaning ? entry.meaning : entry.transliteration;
+    if (start >= textUnits_)
+        return TextView();
+    const char16_t* text = text_ + start;
+    return TextView(text, std::char_traits<char16_t>::length(text));
+}
+
+} // namespace predictor
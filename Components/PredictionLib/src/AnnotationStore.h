@@ -0,0 +1,58 @@
+#ifndef PREDICTOR_ANNOTATION_STORE_H
+#define PREDICTOR_ANNOTATION_STORE_H
+
+// The annotations of dictionary words, read in place from a mapped file in
+// the format of AnnotationFormat.h. Like Dictionary, open() checks the
+// header and section table only, so opening costs the same for any number
+// of annotations; a word's entry is found, and bounds checked, when it is
+// looked up, and only the pages of the words looked up are ever read in.
+
+#include <cstddef>
+#include <cstdint>
+
+#include "AnnotationFormat.h"
+#include "MappedFile.h"
+#include "ScriptConverterStructs.h"
+#include "Utf16.h"
+
+namespace predictor {
+
+class AnnotationStore {
+public:
+    AnnotationStore() = default;
+    AnnotationStore(const AnnotationStore&) = delete;
+    AnnotationStore& operator=(const AnnotationStore&) = delete;
+
+    // Map and validate 'path', which must have been built against a
+    // dictionary of 'wordCount' words. On failure the store is left closed
+    // and error() says why.
+    bool open(const char* path, uint32_t wordCount);
+    void close();
+
+    bool isOpen() const { return file_.isOpen(); }
+    const char* error() const { return error_; }
+    size_t fileSize() const { return file_.size(); }
+
+    uint32_t wordCount() const { return wordCount_; }
+    uint32_t annotatedCount() const { return annotatedCount_; }
+
+    // The word's meaning or transliteration, empty if it has none. The view
+    // is NUL terminated in the mapping and stays valid until close().
+    TextView lookup(uint32_t wordId, AnnotationDataType type) const;
+
+private:
+    bool fail(const char* reason);
+
+    MappedFile file_;
+    const uint32_t* words_ = nullptr;
+    const AnnotationEntry* entries_ = nullptr;
+    const char16_t* text_ = nullptr;
+    uint32_t textUnits_ = 0;
+    uint32_t annotatedCount_ = 0;
+    uint32_t wordCount_ = 0;
+    const char* error_ = nullptr;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_ANNOTATION_STORE_H
@@ -0,0 +1,81 @@
+#include "AnnotationStoreBuilder.h"
+
+#include <cstring>
+#include <unordered_map>
+
+#include "AnnotationFormat.h"
+#include "Dictionary.h"
+#include "FileImage.h"
+
+namespace predictor {
+
+bool AnnotationStoreBuilder::add(TextView word, TextView meaning, TextView transliteration)
+{
+    int32_t id = dictionary_.lookup(word);
+    if (id < 0)
+        return false;
+    Entry& entry = entries_[static_cast<uint32_t>(id)];
+    entry.meaning = Text(meaning);
+    entry.transliteration = Text(transliteration);
+    return true;
+}
+
+std::vector<uint8_t> AnnotationStoreBuilder::build()
+{
+    std::vector<uint32_t> words;
+    std::vector<AnnotationEntry> entries;
+    words.reserve(entries_.size());
+    entries.reserve(entries_.size());
+
+    // Unit 0 is the empty text, and every text starts on an even unit
+    Text text(2, u'\0');
+    std::unordered_map<Text, uint32_t> stored;
+    auto store = [&](const Text& value) -> uint64_t {
+        if (value.empty())
+            return 0;
+        auto found = stored.find(value);
+        if (found != stored.end())
+            return found->second;
+        uint64_t start = text.size();
+        text += value;
+        text.append(2 - value.size() % 2, u'\0');
+        if (start <= UINT32_MAX)
+            stored.emplace(value, static_cast<uint32_t>(start));
+        return start;
+    };
+    for (const auto& [id, entry] : entries_) {
+        uint64_t meaning = store(entry.meaning);
+        uint64_t transliteration = store(entry.transliteration);
+        if (meaning == 0 && transliteration == 0)
+            continue;
+        if (text.size() > UINT32_MAX)
+            return std::vector<uint8_t>();     // beyond the 32-bit offsets of AnnotationEntry
+        words.push_back(id);
+        entries.push_back({ static_cast<uint32_t>(meaning), static_cast<uint32_t>(transliteration) });
+    }
+
+    std::vector<SectionData> sections = {
+        { kAnnotationSectionWords, words.data(), words.size() * sizeof(uint32_t) },
+        { kAnnotationSectionEntries, entries.data(), entries.size() * sizeof(AnnotationEntry) },
+        { kAnnotationSectionText, text.data(), text.size() * sizeof(char16_t) },
+    };
+
+    AnnotationHeader header = {};
+    std::memcpy(header.magic, kAnnotationMagic, sizeof(header.magic));
+    header.version = kAnnotationVersion;
+    header.byteOrder = kByteOrderMark;
+    header.headerSize = sizeof(header);
+    header.wordCount = dictionary_.wordCount();
+    header.sectionCount = static_cast<uint32_t>(sections.size());
+    header.annotatedCount = static_cast<uint32_t>(words.size());
+    header.textUnits = static_cast<uint32_t>(text.size());
+    return buildFileImage(&header, sizeof(header), sections);
+}
+
+bool AnnotationStoreBuilder::write(const std::string& path)
+{
+    std::vector<uint8_t> image = build();
+    return !image.empty() && writeFileImage(path, image);
+}
+
+} // namespace predictor
@@ -0,0 +1,49 @@
+#ifndef PREDICTOR_ANNOTATION_STORE_BUILDER_H
+#define PREDICTOR_ANNOTATION_STORE_BUILDER_H
+
+// Builds an annotation file (AnnotationFormat.h) from the meanings and
+// transliterations of the words of a dictionary. Used by
+// tools/build_annotations and the benchmarks; the keyboard only reads.
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <vector>
+
+#include "Utf16.h"
+
+namespace predictor {
+
+class Dictionary;
+
+class AnnotationStoreBuilder {
+public:
+    explicit AnnotationStoreBuilder(const Dictionary& dictionary) : dictionary_(dictionary) {}
+
+    // Annotate 'word', replacing what it had. Returns false if it is not in
+    // the dictionary.
+    bool add(TextView word, TextView meaning, TextView transliteration);
+
+    size_t size() const { return entries_.size(); }
+
+    // The complete file image, or nothing if the texts take more than 2^32
+    // code units
+    std::vector<uint8_t> build();
+
+    // build() and write it to 'path' through a temporary file
+    bool write(const std::string& path);
+
+private:
+    struct Entry {
+        Text meaning;
+        Text transliteration;
+    };
+
+    const Dictionary& dictionary_;
+    std::map<uint32_t, Entry> entries_;     // by word id, in the file's order
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_ANNOTATION_STORE_BUILDER_H
@@ -0,0 +1,93 @@
+#include "AsyncRunner.h"
+
+#include <utility>
+
+namespace predictor {
+
+uint64_t AsyncRunner::submit(uint32_t session, std::unique_ptr<AsyncJob> job)
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!worker_.joinable()) {
+        stopping_ = false;
+        worker_ = std::thread(&AsyncRunner::workerLoop, this);
+    }
+
+    for (Queued& queued : queue_) {
+        if (queued.session == session)
+            queued.cancelled = true;
+    }
+    if (runningTicket_ != 0 && runningSession_ == session)
+        runningCancelled_ = true;
+
+    uint64_t ticket = nextTicket_++;
+    queue_.push_back({ ticket, session, false, std::move(job) });
+    // A busy worker finds the job when it is done; one waiting is woken
+    // after the lock is let go, so that it does not wake to wait for it
+    bool idle = idle_;
+    lock.unlock();
+    if (idle)
+        wake_.notify_one();
+    return ticket;
+}
+
+bool AsyncRunner::cancel(uint64_t ticket)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (ticket != 0 && ticket == runningTicket_) {
+        runningCancelled_ = true;
+        return true;
+    }
+    for (Queued& queued : queue_) {
+        if (queued.ticket == ticket) {
+            queued.cancelled = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+void AsyncRunner::stop()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (!worker_.joinable())
+            return;
+        stopping_ = true;
+        for (Queued& queued : queue_)
+            queued.cancelled = true;
+        runningCancelled_ = true;
+        wake_.notify_one();
+    }
+    worker_.join();
+    worker_ = std::thread();
+}
+
+void AsyncRunner::workerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        idle_ = true;
+        wake_.wait(lock, [this] { return !queue_.empty() || stopping_; });
+        idle_ = false;
+        if (queue_.empty())
+            return;
+
+        Queued queued = std::move(queue_.front());
+        queue_.pop_front();
+        runningTicket_ = queued.ticket;
+        runningSession_ = queued.session;
+        runningCancelled_ = queued.cancelled;
+        lock.unlock();
+
+        if (queued.cancelled)
+            queued.job->cancel(queued.ticket);
+        else
+            queued.job->run(queued.ticket, runningCancelled_);
+        queued.job.reset();
+
+        lock.lock();
+        runningTicket_ = 0;
+    }
+}
+
+} // namespace predictor
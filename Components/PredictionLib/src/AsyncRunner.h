@@ -0,0 +1,81 @@
+#ifndef PREDICTOR_ASYNC_RUNNER_H
+#define PREDICTOR_ASYNC_RUNNER_H
+
+// Jobs run one at a time on a worker thread of their own, started with the
+// first job, so that the thread submitting them never waits for one.
+//
+// Each job belongs to a session, typically one text field, and only the
+// newest job of a session is worth finishing: submitting a job cancels the
+// session's earlier ones, a queued job before it starts and a running one
+// through the flag it is handed, which it checks as it goes. Every job is
+// either run or cancelled exactly once, always on the worker thread, so a
+// job can report its outcome from there whichever way it ends.
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace predictor {
+
+class AsyncJob {
+public:
+    virtual ~AsyncJob() = default;
+
+    // Do the work, stopping early once 'cancelled' turns true
+    virtual void run(uint64_t ticket, const std::atomic<bool>& cancelled) = 0;
+
+    // Report the job cancelled without having run it
+    virtual void cancel(uint64_t ticket) = 0;
+};
+
+class AsyncRunner {
+public:
+    AsyncRunner() = default;
+    AsyncRunner(const AsyncRunner&) = delete;
+    AsyncRunner& operator=(const AsyncRunner&) = delete;
+    ~AsyncRunner() { stop(); }
+
+    // Queue 'job' behind the other sessions' jobs, superseding those of
+    // 'session'. Returns its ticket, never 0.
+    uint64_t submit(uint32_t session, std::unique_ptr<AsyncJob> job);
+
+    // Cancel the job of 'ticket'. Returns false if it already finished.
+    bool cancel(uint64_t ticket);
+
+    // Cancel every job not finished and wait for the worker to end. Jobs
+    // submitted afterwards start it again.
+    void stop();
+
+    // Whether stop() is waiting for the worker, for jobs that would
+    // otherwise wait on their caller
+    bool stopping() const { return stopping_.load(std::memory_order_relaxed); }
+
+private:
+    struct Queued {
+        uint64_t ticket;
+        uint32_t session;
+        bool cancelled;
+        std::unique_ptr<AsyncJob> job;
+    };
+
+    void workerLoop();
+
+    std::mutex mutex_;
+    std::condition_variable wake_;
+    std::deque<Queued> queue_;
+    uint64_t nextTicket_ = 1;
+    uint64_t runningTicket_ = 0;        // 0 while none runs
+    uint32_t runningSession_ = 0;
+    bool idle_ = false;                 // the worker waits for a job
+    std::atomic<bool> runningCancelled_{ false };
+    std::atomic<bool> stopping_{ false };
+    std::thread worker_;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_ASYNC_RUNNER_H
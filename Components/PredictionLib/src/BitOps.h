@@ -0,0 +1,50 @@
+#ifndef PREDICTOR_BIT_OPS_H
+#define PREDICTOR_BIT_OPS_H
+
+// Word-level bit counting shared by the succinct structures, with the MSVC
+// intrinsics where the GCC/Clang builtins are missing.
+
+#include <cstdint>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+namespace predictor {
+
+inline unsigned popcount(uint64_t w)
+{
+#ifdef _MSC_VER
+    return static_cast<unsigned>(__popcnt64(w));
+#else
+    return static_cast<unsigned>(__builtin_popcountll(w));
+#endif
+}
+
+// w must not be 0
+inline unsigned countTrailingZeros(uint64_t w)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanForward64(&index, w);
+    return static_cast<unsigned>(index);
+#else
+    return static_cast<unsigned>(__builtin_ctzll(w));
+#endif
+}
+
+// w must not be 0
+inline unsigned floorLog2(uint64_t w)
+{
+#ifdef _MSC_VER
+    unsigned long index;
+    _BitScanReverse64(&index, w);
+    return static_cast<unsigned>(index);
+#else
+    return 63 - static_cast<unsigned>(__builtin_clzll(w));
+#endif
+}
+
+} // namespace predictor
+
+#endif // PREDICTOR_BIT_OPS_H
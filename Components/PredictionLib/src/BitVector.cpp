@@ -0,0 +1,193 @@
+#include "BitVector.h"
+
+#include <cstring>
+
+#include "BitOps.h"
+
+namespace predictor {
+
+namespace {
+
+// Position of the k-th one in w, which has more than k ones
+inline unsigned selectInWord(uint64_t w, unsigned k)
+{
+    unsigned shift = 0;
+    for (;;) {
+        unsigned c = popcount(w & 0xFF);
+        if (k < c)
+            break;
+        k -= c;
+        w >>= 8;
+        shift += 8;
+    }
+    for (; k > 0; k--)
+        w &= w - 1;
+    return shift + countTrailingZeros(w);
+}
+
+inline size_t align8(size_t n) { return (n + 7) & ~size_t(7); }
+
+} // namespace
+
+bool BitVector::attach(const uint8_t* data, size_t size)
+{
+    if (size < sizeof(BitVectorHeader) || reinterpret_cast<uintptr_t>(data) % 8 != 0)
+        return false;
+
+    BitVectorHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    uint64_t blocks = (header.wordCount + kWordsPerBlock - 1) / kWordsPerBlock;
+    if (header.bitCount > uint64_t(header.wordCount) * 64 || header.oneCount > header.bitCount ||
+        header.rankCount != blocks + 1 ||
+        header.select1Count != (header.oneCount + kSelectSampleRate - 1) / kSelectSampleRate ||
+        header.select0Count != (header.bitCount - header.oneCount + kSelectSampleRate - 1) / kSelectSampleRate)
+        return false;
+
+    size_t offset = sizeof(BitVectorHeader);
+    size_t wordsOffset = offset;
+    offset += size_t(header.wordCount) * 8;
+    size_t rankOffset = offset;
+    offset = align8(offset + size_t(header.rankCount) * 4);
+    size_t select1Offset = offset;
+    offset = align8(offset + size_t(header.select1Count) * 4);
+    size_t select0Offset = offset;
+    offset = align8(offset + size_t(header.select0Count) * 4);
+    if (offset > size)
+        return false;
+
+    words_ = reinterpret_cast<const uint64_t*>(data + wordsOffset);
+    rank_ = reinterpret_cast<const uint32_t*>(data + rankOffset);
+    select1_ = reinterpret_cast<const uint32_t*>(data + select1Offset);
+    select0_ = reinterpret_cast<const uint32_t*>(data + select0Offset);
+    bitCount_ = header.bitCount;
+    oneCount_ = header.oneCount;
+    wordCount_ = header.wordCount;
+    blockCount_ = static_cast<uint32_t>(blocks);
+    return rank_[blockCount_] == oneCount_;
+}
+
+uint64_t BitVector::rank1(uint64_t i) const
+{
+    uint64_t block = i / kBitsPerBlock;
+    uint64_t r = rank_[block];
+    uint64_t word = i >> 6;
+    for (uint64_t w = block * kWordsPerBlock; w < word; w++)
+        r += popcount(words_[w]);
+    if (i & 63)
+        r += popcount(words_[word] & ((uint64_t(1) << (i & 63)) - 1));
+    return r;
+}
+
+uint64_t BitVector::select1(uint64_t k) const
+{
+    uint32_t block = select1_[k / kSelectSampleRate];
+    while (block + 1 < blockCount_ && rank_[block + 1] <= k)
+        block++;
+
+    uint64_t remaining = k - rank_[block];
+    for (uint64_t w = uint64_t(block) * kWordsPerBlock;; w++) {
+        unsigned c = popcount(words_[w]);
+        if (remaining < c)
+            return w * 64 + selectInWord(words_[w], static_cast<unsigned>(remaining));
+        remaining -= c;
+    }
+}
+
+uint64_t BitVector::select0(uint64_t k) const
+{
+    uint32_t block = select0_[k / kSelectSampleRate];
+    while (block + 1 < blockCount_ && uint64_t(block + 1) * kBitsPerBlock - rank_[block + 1] <= k)
+        block++;
+
+    uint64_t remaining = k - (uint64_t(block) * kBitsPerBlock - rank_[block]);
+    for (uint64_t w = uint64_t(block) * kWordsPerBlock;; w++) {
+        uint64_t zeros = ~words_[w];
+        unsigned c = popcount(zeros);
+        if (remaining < c)
+            return w * 64 + selectInWord(zeros, static_cast<unsigned>(remaining));
+        remaining -= c;
+    }
+}
+
+uint64_t BitVector::nextZero(uint64_t i) const
+{
+    uint64_t w = i >> 6;
+    uint64_t zeros = ~words_[w] >> (i & 63);
+    if (zeros)
+        return i + countTrailingZeros(zeros);
+    for (w++;; w++) {
+        if (~words_[w])
+            return w * 64 + countTrailingZeros(~words_[w]);
+    }
+}
+
+void BitVectorBuilder::push(bool bit)
+{
+    if ((bitCount_ & 63) == 0)
+        words_.push_back(0);
+    if (bit)
+        words_.back() |= uint64_t(1) << (bitCount_ & 63);
+    bitCount_++;
+}
+
+void BitVectorBuilder::pushOnes(uint64_t count)
+{
+    for (uint64_t i = 0; i < count; i++)
+        push(true);
+}
+
+std::vector<uint8_t> BitVectorBuilder::serialize() const
+{
+    uint32_t wordCount = static_cast<uint32_t>(words_.size());
+    uint32_t blocks = (wordCount + kWordsPerBlock - 1) / kWordsPerBlock;
+
+    std::vector<uint32_t> rank(blocks + 1);
+    std::vector<uint32_t> select1, select0;
+    uint64_t ones = 0;
+    for (uint32_t b = 0; b < blocks; b++) {
+        rank[b] = static_cast<uint32_t>(ones);
+        for (uint32_t w = b * kWordsPerBlock; w < wordCount && w < (b + 1) * kWordsPerBlock; w++) {
+            for (int bit = 0; bit < 64; bit++) {
+                uint64_t position = uint64_t(w) * 64 + bit;
+                if (position >= bitCount_)
+                    break;
+                if ((words_[w] >> bit) & 1) {
+                    if (ones % kSelectSampleRate == 0)
+                        select1.push_back(b);
+                    ones++;
+                } else {
+                    uint64_t zeros = position - ones;
+                    if (zeros % kSelectSampleRate == 0)
+                        select0.push_back(b);
+                }
+            }
+        }
+    }
+    rank[blocks] = static_cast<uint32_t>(ones);
+
+    BitVectorHeader header = {};
+    header.bitCount = bitCount_;
+    header.oneCount = ones;
+    header.wordCount = wordCount;
+    header.rankCount = blocks + 1;
+    header.select1Count = static_cast<uint32_t>(select1.size());
+    header.select0Count = static_cast<uint32_t>(select0.size());
+
+    size_t wordsOffset = sizeof(BitVectorHeader);
+    size_t rankOffset = wordsOffset + words_.size() * 8;
+    size_t select1Offset = align8(rankOffset + rank.size() * 4);
+    size_t select0Offset = align8(select1Offset + select1.size() * 4);
+    std::vector<uint8_t> out(align8(select0Offset + select0.size() * 4), 0);
+
+    std::memcpy(out.data(), &header, sizeof(header));
+    if (!words_.empty())
+        std::memcpy(out.data() + wordsOffset, words_.data(), words_.size() * 8);
+    std::memcpy(out.data() + rankOffset, rank.data(), rank.size() * 4);
+    if (!select1.empty())
+        std::memcpy(out.data() + select1Offset, select1.data(), select1.size() * 4);
+    if (!select0.empty())
+        std::memcpy(out.data() + select0Offset, select0.data(), select0.size() * 4);
+    return out;
+}
+
+} // namespace predictor
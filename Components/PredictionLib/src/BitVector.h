@@ -0,0 +1,75 @@
+#ifndef PREDICTOR_BIT_VECTOR_H
+#define PREDICTOR_BIT_VECTOR_H
+
+// Rank/select bit vector in the layout described in DictionaryFormat.h.
+//
+// BitVector reads one in place from mapped memory; BitVectorBuilder collects
+// bits and serializes them with their directories. Rank costs one directory
+// lookup and at most eight popcounts; select starts from a sampled block and
+// walks the rank directory, which stays within a few cache lines for the
+// trees the dictionary builds.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "DictionaryFormat.h"
+
+namespace predictor {
+
+constexpr uint32_t kBitsPerBlock = 512;
+constexpr uint32_t kWordsPerBlock = kBitsPerBlock / 64;
+constexpr uint32_t kSelectSampleRate = 512;
+
+class BitVector {
+public:
+    BitVector() = default;
+
+    // Attach to a serialized vector of 'size' bytes. Returns false if it is
+    // truncated or inconsistent; only the sizes are checked, not the bits.
+    bool attach(const uint8_t* data, size_t size);
+
+    uint64_t size() const { return bitCount_; }
+    uint64_t ones() const { return oneCount_; }
+
+    bool get(uint64_t i) const { return (words_[i >> 6] >> (i & 63)) & 1; }
+
+    // Ones in positions [0, i)
+    uint64_t rank1(uint64_t i) const;
+    uint64_t rank0(uint64_t i) const { return i - rank1(i); }
+
+    // Position of the k-th one / zero, counting from 0. k must be in range.
+    uint64_t select1(uint64_t k) const;
+    uint64_t select0(uint64_t k) const;
+
+    // Position of the first zero at or after i; the vector must have one
+    uint64_t nextZero(uint64_t i) const;
+
+private:
+    const uint64_t* words_ = nullptr;
+    const uint32_t* rank_ = nullptr;
+    const uint32_t* select1_ = nullptr;
+    const uint32_t* select0_ = nullptr;
+    uint64_t bitCount_ = 0;
+    uint64_t oneCount_ = 0;
+    uint32_t wordCount_ = 0;
+    uint32_t blockCount_ = 0;
+};
+
+class BitVectorBuilder {
+public:
+    void push(bool bit);
+    void pushOnes(uint64_t count);
+    uint64_t size() const { return bitCount_; }
+
+    // Header, words and directories, ready to be written as a section
+    std::vector<uint8_t> serialize() const;
+
+private:
+    std::vector<uint64_t> words_;
+    uint64_t bitCount_ = 0;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_BIT_VECTOR_H
@@ -0,0 +1,79 @@
+#include "Blacklist.h"
+
+#include <algorithm>
+
+namespace predictor {
+
+// Set bits [first, end) of a vector sized on first use for 'count' bits
+void Blacklist::set(std::vector<uint64_t>& bits, uint32_t first, uint32_t end, uint32_t count)
+{
+    if (bits.empty())
+        bits.assign((size_t(count) + 63) / 64, 0);
+    for (uint32_t i = first; i < end;) {
+        uint32_t word = i >> 6, bit = i & 63;
+        uint32_t n = std::min<uint32_t>(64 - bit, end - i);
+        bits[word] |= (n == 64 ? ~uint64_t(0) : ((uint64_t(1) << n) - 1)) << bit;
+        i += n;
+    }
+}
+
+bool Blacklist::add(TextView word)
+{
+    if (word.empty() || !words_.insert(Text(word)).second)
+        return false;
+    index(word);
+    return true;
+}
+
+bool Blacklist::addStem(TextView stem)
+{
+    if (stem.empty() || !stems_.insert(Text(stem)).second)
+        return false;
+    indexStem(stem);
+    return true;
+}
+
+void Blacklist::reindex()
+{
+    wordBits_.clear();
+    nodeBits_.clear();
+    for (const Text& word : words_)
+        index(word);
+    for (const Text& stem : stems_)
+        indexStem(stem);
+}
+
+void Blacklist::index(TextView word)
+{
+    int32_t id = dictionary_.isOpen() ? dictionary_.lookup(word) : -1;
+    if (id >= 0)
+        set(wordBits_, static_cast<uint32_t>(id), static_cast<uint32_t>(id) + 1, dictionary_.wordCount());
+}
+
+// The stem's subtree is a range of nodes, and of word ids, on each level
+void Blacklist::indexStem(TextView stem)
+{
+    uint32_t node = dictionary_.isOpen() ? dictionary_.findNode(stem) : Dictionary::kNoNode;
+    if (node == Dictionary::kNoNode)
+        return;
+    for (uint32_t first = node, end = node + 1; first < end;
+         first = dictionary_.firstChild(first), end = dictionary_.firstChild(end)) {
+        set(nodeBits_, first, end, dictionary_.nodeCount());
+        uint32_t firstId = dictionary_.wordIdBefore(first), endId = dictionary_.wordIdBefore(end);
+        if (firstId < endId)
+            set(wordBits_, firstId, endId, dictionary_.wordCount());
+    }
+}
+
+bool Blacklist::contains(TextView word) const
+{
+    if (words_.find(word) != words_.end())
+        return true;
+    for (size_t length = 1; !stems_.empty() && length <= word.size(); length++) {
+        if (stems_.find(word.substr(0, length)) != stems_.end())
+            return true;
+    }
+    return false;
+}
+
+} // namespace predictor
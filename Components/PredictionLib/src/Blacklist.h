@@ -0,0 +1,72 @@
+#ifndef PREDICTOR_BLACKLIST_H
+#define PREDICTOR_BLACKLIST_H
+
+// Words kept out of predictions: those imported as the blacklist and, with
+// no user dictionary to remember them, those removed this session. A stem
+// may be listed too, keeping out every word that starts with it.
+//
+// The entries are kept as text and indexed against the dictionary as two
+// bit vectors, one by word id, set for each word listed or below a listed
+// stem, and one by trie node, set for each stem's node and those below it.
+// A search tests a word or node in O(1) as it goes (see CompletionSearch),
+// so it never expands a stem, nor spends a place on a listed word. Adding
+// an entry sets its bits, and reindex() after another dictionary is opened
+// sets those of every entry: the cost is the size of the blacklist and of
+// the stems' subtrees, never a pass over the dictionary.
+
+#include <cstddef>
+#include <cstdint>
+#include <set>
+#include <vector>
+
+#include "Dictionary.h"
+#include "Utf16.h"
+
+namespace predictor {
+
+class Blacklist {
+public:
+    explicit Blacklist(const Dictionary& dictionary) : dictionary_(dictionary) {}
+    Blacklist(const Blacklist&) = delete;
+    Blacklist& operator=(const Blacklist&) = delete;
+
+    // List 'word', or every word starting with 'stem'. Return false if it is
+    // empty or listed already.
+    bool add(TextView word);
+    bool addStem(TextView stem);
+
+    // Index the entries against the dictionary just opened
+    void reindex();
+
+    size_t size() const { return words_.size() + stems_.size(); }
+    bool hasStems() const { return !stems_.empty(); }
+
+    // Whether the dictionary word 'wordId' is listed or below a stem
+    bool contains(uint32_t wordId) const { return test(wordBits_, wordId); }
+
+    // Whether 'node' is a stem's or below one, so no word below it is wanted
+    bool prunes(uint32_t node) const { return test(nodeBits_, node); }
+
+    // Whether 'word', in the dictionary or not, is listed or starts with a stem
+    bool contains(TextView word) const;
+
+private:
+    static bool test(const std::vector<uint64_t>& bits, uint32_t index)
+    {
+        return (index >> 6) < bits.size() && (bits[index >> 6] >> (index & 63)) & 1;
+    }
+    static void set(std::vector<uint64_t>& bits, uint32_t first, uint32_t end, uint32_t count);
+
+    void index(TextView word);
+    void indexStem(TextView stem);
+
+    const Dictionary& dictionary_;
+    std::set<Text, std::less<>> words_;
+    std::set<Text, std::less<>> stems_;
+    std::vector<uint64_t> wordBits_;    // empty until a word of the dictionary is listed
+    std::vector<uint64_t> nodeBits_;    // empty until a stem of the dictionary is
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_BLACKLIST_H
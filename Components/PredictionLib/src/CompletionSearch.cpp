@@ -0,0 +1,167 @@
+#include "CompletionSearch.h"
+
+#include <algorithm>
+
+namespace predictor {
+
+void CompletionSearch::start(uint32_t node)
+{
+    heap_.clear();
+    returned_.clear();
+    sorted_.clear();
+    position_ = 0;
+    expanded_ = 0;
+    // Checked each time, as the dictionary may have been reloaded
+    bestFirst_ = dictionary_->hasSubtreeMaxima();
+    if (node == Dictionary::kNoNode || pruned(node))
+        return;
+    if (bestFirst_)
+        push({ dictionary_->subtreeMaximum(node), node, false });
+    else
+        scanAll(node);
+}
+
+void CompletionSearch::push(Entry entry)
+{
+    heap_.push_back(entry);
+    std::push_heap(heap_.begin(), heap_.end(), lowerPriority);
+}
+
+// Expand nodes until a word is on top of the heap
+bool CompletionSearch::settle()
+{
+    while (!heap_.empty() && !heap_.front().word) {
+        if (cancelled())
+            return false;
+        uint32_t node = heap_.front().node;
+        std::pop_heap(heap_.begin(), heap_.end(), lowerPriority);
+        heap_.pop_back();
+        if (pruned(node))
+            continue;       // under a stem listed since it was pushed
+        expanded_++;
+
+        if (dictionary_->isWord(node) && !blocked(dictionary_->wordId(node)))
+            push({ dictionary_->frequency(dictionary_->wordId(node)), node, true });
+        uint32_t first, end;
+        dictionary_->children(node, first, end);
+        for (uint32_t child = first; child < end; child++) {
+            if (!pruned(child))
+                push({ dictionary_->subtreeMaximum(child), child, false });
+        }
+    }
+    return !heap_.empty();
+}
+
+bool CompletionSearch::next(uint32_t& wordId)
+{
+    if (!bestFirst_) {
+        while (position_ < sorted_.size()) {
+            wordId = sorted_[position_++];
+            if (!blocked(wordId))
+                return true;
+        }
+        return false;
+    }
+
+    // Words found before they were listed are skipped, and not kept
+    while (position_ < returned_.size()) {
+        wordId = dictionary_->wordId(returned_[position_++]);
+        if (!blocked(wordId))
+            return true;
+    }
+    while (settle()) {
+        uint32_t node = heap_.front().node;
+        std::pop_heap(heap_.begin(), heap_.end(), lowerPriority);
+        heap_.pop_back();
+        wordId = dictionary_->wordId(node);
+        if (blocked(wordId))
+            continue;
+        returned_.push_back(node);
+        position_++;
+        return true;
+    }
+    return false;
+}
+
+void CompletionSearch::narrow(uint32_t node)
+{
+    position_ = 0;
+    if (node == Dictionary::kNoNode || !bestFirst_ || pruned(node)) {
+        start(node);
+        return;
+    }
+
+    // A node still unexpanded above 'node' stands for the whole subtree, so
+    // nothing below it was searched yet
+    ancestors_.clear();
+    for (uint32_t above = node; above != Dictionary::kRoot;) {
+        above = dictionary_->parent(above);
+        ancestors_.push_back(above);
+    }
+    std::sort(ancestors_.begin(), ancestors_.end());
+    uint32_t deepest = node;
+    for (const Entry& entry : heap_) {
+        if (!entry.word && std::binary_search(ancestors_.begin(), ancestors_.end(), entry.node)) {
+            start(node);
+            return;
+        }
+        deepest = std::max(deepest, entry.node);
+    }
+    for (uint32_t word : returned_)
+        deepest = std::max(deepest, word);
+
+    // The words returned so far come first in the order of any subtree they
+    // are in, and what is left of the subtree is in the frontier
+    describeSubtree(node, deepest);
+    returned_.erase(std::remove_if(returned_.begin(), returned_.end(),
+                                   [this](uint32_t word) { return !inSubtree(word); }),
+                    returned_.end());
+    heap_.erase(std::remove_if(heap_.begin(), heap_.end(),
+                               [this](const Entry& entry) { return !inSubtree(entry.node); }),
+                heap_.end());
+    std::make_heap(heap_.begin(), heap_.end(), lowerPriority);
+}
+
+// The subtree of 'node' as one node range per level, down to the level of
+// node number 'deepest'. Levels are numbered one after the other, so the
+// ranges come in increasing order.
+void CompletionSearch::describeSubtree(uint32_t node, uint32_t deepest)
+{
+    levels_.clear();
+    for (uint32_t first = node, end = node + 1; first < end && first <= deepest;
+         first = dictionary_->firstChild(first), end = dictionary_->firstChild(end))
+        levels_.emplace_back(first, end);
+}
+
+bool CompletionSearch::inSubtree(uint32_t node) const
+{
+    for (const auto& level : levels_) {
+        if (node < level.first)
+            return false;
+        if (node < level.second)
+            return true;
+    }
+    return false;
+}
+
+// The whole subtree level by level: each level is a contiguous node range
+// and its words a contiguous id range
+void CompletionSearch::scanAll(uint32_t node)
+{
+    for (uint32_t first = node, end = node + 1; first < end;
+         first = dictionary_->firstChild(first), end = dictionary_->firstChild(end)) {
+        if (cancelled())
+            return;
+        for (uint32_t id = dictionary_->wordIdBefore(first), last = dictionary_->wordIdBefore(end); id < last; id++) {
+            if (!blocked(id))
+                sorted_.push_back(id);
+        }
+        expanded_ += end - first;
+    }
+    std::sort(sorted_.begin(), sorted_.end(), [this](uint32_t a, uint32_t b) {
+        uint32_t fa = dictionary_->frequency(a), fb = dictionary_->frequency(b);
+        return fa != fb ? fa > fb : a < b;
+    });
+}
+
+} // namespace predictor
@@ -0,0 +1,109 @@
+#ifndef PREDICTOR_COMPLETION_SEARCH_H
+#define PREDICTOR_COMPLETION_SEARCH_H
+
+// The words below a trie node, most frequent first.
+//
+// With subtree maxima this is a best-first search: the frontier is a heap
+// of nodes keyed by their subtree maximum and of words keyed by their
+// frequency, and a word is only returned once nothing left in the frontier
+// can beat it. Taking k words expands O(k * depth) nodes, plus their
+// siblings, however many words the subtree holds. Without the maxima every
+// word in the subtree is read and sorted up front.
+//
+// Ties go to the lower word id, so both ways give the same order.
+//
+// A search is restarted rather than rebuilt for each query, so that the
+// frontier keeps its storage from one keystroke to the next. Words already
+// returned are kept, so a search can be replayed from the start, or narrowed
+// to a node below where it started and carried on from its frontier there.
+//
+// A search may be handed a cancellation flag, checked before each node is
+// expanded, for queries whose result is no longer wanted; once it is set the
+// search ends as if the subtree did.
+//
+// It may be handed a blacklist too: listed words are never returned, and a
+// node under a listed stem is never expanded, so the words below it cost
+// nothing. Words listed after they were found are dropped as they come up.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "Blacklist.h"
+#include "Dictionary.h"
+
+namespace predictor {
+
+class CompletionSearch {
+public:
+    explicit CompletionSearch(const Dictionary& dictionary) : dictionary_(&dictionary) {}
+
+    // Search below 'node', which may be Dictionary::kNoNode
+    void start(uint32_t node);
+
+    // Search below 'node', a descendant of the start node, in the same order
+    // as start(node) but reusing the work done so far: the words returned
+    // below 'node' are replayed first, then the frontier below it goes on.
+    void narrow(uint32_t node);
+
+    // Return the words from the first again
+    void rewind() { position_ = 0; }
+
+    // The next word id, or false when the subtree is exhausted
+    bool next(uint32_t& wordId);
+
+    // Stop searching once '*cancelled' turns true; nullptr to search on
+    void setCancellation(const std::atomic<bool>* cancelled) { cancelled_ = cancelled; }
+
+    // Leave out the words of '*blacklist'; nullptr for none
+    void setBlacklist(const Blacklist* blacklist) { blacklist_ = blacklist; }
+
+    // Nodes whose children were read since start(), for measuring
+    size_t expanded() const { return expanded_; }
+
+private:
+    struct Entry {
+        uint32_t key;       // subtree maximum, or the word's frequency
+        uint32_t node;
+        bool word;
+    };
+
+    // Heap order: higher key first; on equal keys nodes before words, so
+    // that every word of that frequency is in the heap before the first is
+    // taken, then words by id
+    static bool lowerPriority(const Entry& a, const Entry& b)
+    {
+        if (a.key != b.key)
+            return a.key < b.key;
+        if (a.word != b.word)
+            return a.word;
+        return a.node > b.node;
+    }
+
+    void push(Entry entry);
+    bool settle();
+    void scanAll(uint32_t node);
+    void describeSubtree(uint32_t node, uint32_t deepest);
+    bool inSubtree(uint32_t node) const;
+    bool cancelled() const { return cancelled_ && cancelled_->load(std::memory_order_relaxed); }
+    bool blocked(uint32_t wordId) const { return blacklist_ && blacklist_->contains(wordId); }
+    bool pruned(uint32_t node) const { return blacklist_ && blacklist_->prunes(node); }
+
+    const Dictionary* dictionary_;
+    std::vector<Entry> heap_;
+    std::vector<uint32_t> returned_;    // word nodes taken from the heap, in order
+    std::vector<uint32_t> sorted_;      // without maxima: every word id, in order
+    size_t position_ = 0;               // in returned_ or sorted_
+    std::vector<uint32_t> ancestors_;   // for narrow(): the path above the node
+    std::vector<std::pair<uint32_t, uint32_t>> levels_;    // and its subtree, level by level
+    size_t expanded_ = 0;
+    bool bestFirst_ = false;
+    const std::atomic<bool>* cancelled_ = nullptr;
+    const Blacklist* blacklist_ = nullptr;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_COMPLETION_SEARCH_H
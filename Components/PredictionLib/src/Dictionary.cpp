@@ -0,0 +1,168 @@
+#include "Dictionary.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace predictor {
+
+bool Dictionary::fail(const char* reason)
+{
+    close();
+    error_ = reason;
+    return false;
+}
+
+bool Dictionary::open(const char* path)
+{
+    close();
+    error_ = nullptr;
+    if (!file_.open(path))
+        return fail("cannot map file");
+
+    const uint8_t* data = file_.data();
+    size_t size = file_.size();
+
+    DictionaryHeader header;
+    if (size < sizeof(header))
+        return fail("truncated header");
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kDictionaryMagic, sizeof(header.magic)) != 0)
+        return fail("not a dictionary file");
+    if (header.byteOrder != kByteOrderMark)
+        return fail("wrong byte order");
+    if (header.version != kDictionaryVersion)
+        return fail("unsupported version");
+    if (header.headerSize < sizeof(header) || header.nodeCount == 0 || header.wordCount > header.nodeCount)
+        return fail("bad header");
+
+    uint64_t tableEnd = uint64_t(header.headerSize) + uint64_t(header.sectionCount) * sizeof(SectionEntry);
+    if (tableEnd > size)
+        return fail("truncated section table");
+
+    bool haveLouds = false, haveTerminal = false;
+    for (uint32_t i = 0; i < header.sectionCount; i++) {
+        SectionEntry entry;
+        std::memcpy(&entry, data + header.headerSize + i * sizeof(SectionEntry), sizeof(entry));
+        if (entry.offset % 8 != 0 || entry.offset > size || entry.size > size - entry.offset)
+            return fail("section out of range");
+
+        const uint8_t* section = data + entry.offset;
+        switch (entry.id) {
+        case kSectionLouds:
+            haveLouds = louds_.attach(section, entry.size);
+            if (!haveLouds)
+                return fail("bad tree section");
+            break;
+        case kSectionTerminal:
+            haveTerminal = terminal_.attach(section, entry.size);
+            if (!haveTerminal)
+                return fail("bad terminal section");
+            break;
+        case kSectionLabels:
+            if (entry.size < uint64_t(header.nodeCount) * sizeof(uint16_t))
+                return fail("bad label section");
+            labels_ = reinterpret_cast<const uint16_t*>(section);
+            break;
+        case kSectionFrequencies:
+            if (entry.size < uint64_t(header.wordCount) * sizeof(uint32_t))
+                return fail("bad frequency section");
+            frequencies_ = reinterpret_cast<const uint32_t*>(section);
+            break;
+        case kSectionSubtreeMaxima:
+            if (entry.size < uint64_t(header.nodeCount) * sizeof(uint32_t))
+                return fail("bad subtree maxima section");
+            subtreeMaxima_ = reinterpret_cast<const uint32_t*>(section);
+            break;
+        default:
+            break;      // a newer minor addition
+        }
+    }
+
+    if (!haveLouds || !haveTerminal || !labels_ || !frequencies_)
+        return fail("missing section");
+    if (louds_.size() != 2 * uint64_t(header.nodeCount) + 1 || louds_.ones() != header.nodeCount ||
+        terminal_.size() != header.nodeCount || terminal_.ones() != header.wordCount)
+        return fail("sections disagree with header");
+
+    nodeCount_ = header.nodeCount;
+    wordCount_ = header.wordCount;
+    return true;
+}
+
+void Dictionary::close()
+{
+    file_.close();
+    louds_ = BitVector();
+    terminal_ = BitVector();
+    labels_ = nullptr;
+    frequencies_ = nullptr;
+    subtreeMaxima_ = nullptr;
+    nodeCount_ = 0;
+    wordCount_ = 0;
+    generation_++;
+}
+
+void Dictionary::children(uint32_t node, uint32_t& first, uint32_t& end) const
+{
+    uint64_t start = louds_.select0(node) + 1;
+    first = static_cast<uint32_t>(start - node - 1);
+    end = first + static_cast<uint32_t>(louds_.nextZero(start) - start);
+}
+
+uint32_t Dictionary::child(uint32_t node, char16_t label) const
+{
+    uint32_t first, end;
+    children(node, first, end);
+    const uint16_t* found = std::lower_bound(labels_ + first, labels_ + end, uint16_t(label));
+    if (found == labels_ + end || *found != label)
+        return kNoNode;
+    return static_cast<uint32_t>(found - labels_);
+}
+
+uint32_t Dictionary::findNode(TextView prefix) const
+{
+    if (!isOpen())
+        return kNoNode;
+    uint32_t node = kRoot;
+    for (char16_t c : prefix) {
+        node = child(node, c);
+        if (node == kNoNode)
+            break;
+    }
+    return node;
+}
+
+int32_t Dictionary::lookup(TextView word) const
+{
+    uint32_t node = findNode(word);
+    if (node == kNoNode || !isWord(node))
+        return -1;
+    return static_cast<int32_t>(wordId(node));
+}
+
+void Dictionary::subtreeWordRanges(uint32_t node, std::vector<std::pair<uint32_t, uint32_t>>& ranges) const
+{
+    ranges.clear();
+    for (uint32_t first = node, end = node + 1; first < end; first = firstChild(first), end = firstChild(end)) {
+        uint32_t firstId = wordIdBefore(first), endId = wordIdBefore(end);
+        if (firstId < endId)
+            ranges.emplace_back(firstId, endId);
+    }
+}
+
+Text Dictionary::text(uint32_t node) const
+{
+    Text text;
+    appendText(node, text);
+    return text;
+}
+
+void Dictionary::appendText(uint32_t node, Text& out) const
+{
+    size_t start = out.size();
+    for (; node != kRoot; node = parent(node))
+        out.push_back(labels_[node]);
+    std::reverse(out.begin() + static_cast<std::ptrdiff_t>(start), out.end());
+}
+
+} // namespace predictor
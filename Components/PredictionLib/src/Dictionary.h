@@ -0,0 +1,105 @@
+#ifndef PREDICTOR_DICTIONARY_H
+#define PREDICTOR_DICTIONARY_H
+
+// The main dictionary: a LOUDS trie read in place from a mapped file in the
+// format of DictionaryFormat.h. open() checks the header and the section
+// table and attaches to the sections, nothing more, so it costs the same for
+// any dictionary size and the pages are only read as searches touch them.
+
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "BitVector.h"
+#include "MappedFile.h"
+#include "Utf16.h"
+
+namespace predictor {
+
+class Dictionary {
+public:
+    static constexpr uint32_t kNoNode = UINT32_MAX;
+    static constexpr uint32_t kRoot = 0;
+
+    Dictionary() = default;
+    Dictionary(const Dictionary&) = delete;
+    Dictionary& operator=(const Dictionary&) = delete;
+
+    // Map and validate 'path'. On failure the dictionary is left closed and
+    // error() says why.
+    bool open(const char* path);
+    void close();
+
+    bool isOpen() const { return file_.isOpen(); }
+    const char* error() const { return error_; }
+    size_t fileSize() const { return file_.size(); }
+
+    // Changes on every open() and close(), so that holders of node numbers
+    // can tell they are stale
+    uint32_t generation() const { return generation_; }
+
+    uint32_t nodeCount() const { return nodeCount_; }
+    uint32_t wordCount() const { return wordCount_; }
+
+    // Tree navigation. Children of a node are the consecutive node numbers
+    // [first, end), sorted by label.
+    void children(uint32_t node, uint32_t& first, uint32_t& end) const;
+    uint32_t child(uint32_t node, char16_t label) const;
+    uint32_t parent(uint32_t node) const { return static_cast<uint32_t>(louds_.select1(node) - node - 1); }
+    char16_t label(uint32_t node) const { return labels_[node]; }
+
+    // First child of 'node'; valid for node == nodeCount() too, which makes
+    // [firstChild(a), firstChild(b)) the next level of any node range [a, b).
+    uint32_t firstChild(uint32_t node) const { return static_cast<uint32_t>(louds_.select0(node) - node); }
+
+    // Node reached by 'prefix' from the root, or kNoNode
+    uint32_t findNode(TextView prefix) const;
+
+    bool isWord(uint32_t node) const { return terminal_.get(node); }
+
+    // Word ids are the ranks of word-ending nodes, so the words ending in a
+    // node range [a, b) have the ids [wordIdBefore(a), wordIdBefore(b)).
+    uint32_t wordIdBefore(uint32_t node) const { return static_cast<uint32_t>(terminal_.rank1(node)); }
+    uint32_t wordId(uint32_t node) const { return wordIdBefore(node); }
+    uint32_t nodeForWord(uint32_t wordId) const { return static_cast<uint32_t>(terminal_.select1(wordId)); }
+
+    // Ids of the words at or below 'node', as one range per level in
+    // increasing order
+    void subtreeWordRanges(uint32_t node, std::vector<std::pair<uint32_t, uint32_t>>& ranges) const;
+
+    // Id of 'word', or -1 if it is not in the dictionary
+    int32_t lookup(TextView word) const;
+
+    uint32_t frequency(uint32_t wordId) const { return frequencies_[wordId]; }
+
+    // Highest frequency of any word at or below 'node'; only when
+    // hasSubtreeMaxima()
+    bool hasSubtreeMaxima() const { return subtreeMaxima_ != nullptr; }
+    uint32_t subtreeMaximum(uint32_t node) const { return subtreeMaxima_[node]; }
+
+    // Spelling of the word or prefix ending at 'node'
+    Text text(uint32_t node) const;
+    Text word(uint32_t wordId) const { return text(nodeForWord(wordId)); }
+
+    // The same appended to 'out', for callers that keep a buffer
+    void appendText(uint32_t node, Text& out) const;
+    void appendWord(uint32_t wordId, Text& out) const { appendText(nodeForWord(wordId), out); }
+
+private:
+    bool fail(const char* reason);
+
+    MappedFile file_;
+    BitVector louds_;
+    BitVector terminal_;
+    const uint16_t* labels_ = nullptr;
+    const uint32_t* frequencies_ = nullptr;
+    const uint32_t* subtreeMaxima_ = nullptr;
+    uint32_t nodeCount_ = 0;
+    uint32_t wordCount_ = 0;
+    const char* error_ = nullptr;
+    uint32_t generation_ = 0;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_DICTIONARY_H
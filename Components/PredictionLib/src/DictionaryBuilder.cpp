@@ -0,0 +1,112 @@
+#include "DictionaryBuilder.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "BitVector.h"
+#include "DictionaryFormat.h"
+#include "FileImage.h"
+
+namespace predictor {
+
+namespace {
+
+struct Range {
+    uint32_t begin;
+    uint32_t end;
+};
+
+} // namespace
+
+void DictionaryBuilder::add(Text word, uint32_t frequency)
+{
+    if (!word.empty())
+        entries_.push_back({ std::move(word), frequency });
+}
+
+std::vector<uint8_t> DictionaryBuilder::build()
+{
+    std::sort(entries_.begin(), entries_.end(), [](const DictionaryEntry& a, const DictionaryEntry& b) {
+        return a.word < b.word || (a.word == b.word && a.frequency > b.frequency);
+    });
+    entries_.erase(std::unique(entries_.begin(), entries_.end(),
+                               [](const DictionaryEntry& a, const DictionaryEntry& b) { return a.word == b.word; }),
+                   entries_.end());
+
+    // Breadth-first over the sorted list: each node is the range of words
+    // sharing its prefix, at the depth of the queue level.
+    BitVectorBuilder louds, terminal;
+    std::vector<uint16_t> labels;
+    std::vector<uint32_t> frequencies;
+    std::vector<uint32_t> parents;
+    std::vector<uint32_t> maxima;
+
+    louds.push(true);
+    louds.push(false);
+    labels.push_back(0);
+    parents.push_back(0);
+
+    std::vector<Range> level = { { 0, static_cast<uint32_t>(entries_.size()) } };
+    std::vector<Range> next;
+    uint32_t nodeNumber = 0;
+    for (size_t depth = 0; !level.empty(); depth++) {
+        next.clear();
+        for (Range node : level) {
+            uint32_t i = node.begin;
+            bool isWord = i < node.end && entries_[i].word.size() == depth;
+            terminal.push(isWord);
+            maxima.push_back(isWord ? entries_[i].frequency : 0);
+            if (isWord)
+                frequencies.push_back(entries_[i++].frequency);
+
+            while (i < node.end) {
+                char16_t c = entries_[i].word[depth];
+                uint32_t j = i + 1;
+                while (j < node.end && entries_[j].word[depth] == c)
+                    j++;
+                louds.push(true);
+                labels.push_back(c);
+                parents.push_back(nodeNumber);
+                next.push_back({ i, j });
+                i = j;
+            }
+            louds.push(false);
+            nodeNumber++;
+        }
+        level.swap(next);
+    }
+
+    // Children are numbered after their parents, so one backward pass
+    // carries every maximum up to the root
+    for (size_t node = maxima.size() - 1; node > 0; node--)
+        maxima[parents[node]] = std::max(maxima[parents[node]], maxima[node]);
+
+    std::vector<uint8_t> loudsBytes = louds.serialize();
+    std::vector<uint8_t> terminalBytes = terminal.serialize();
+
+    std::vector<SectionData> sections = {
+        { kSectionLouds, loudsBytes.data(), loudsBytes.size() },
+        { kSectionTerminal, terminalBytes.data(), terminalBytes.size() },
+        { kSectionLabels, labels.data(), labels.size() * sizeof(uint16_t) },
+        { kSectionFrequencies, frequencies.data(), frequencies.size() * sizeof(uint32_t) },
+    };
+    if (subtreeMaxima_)
+        sections.push_back({ kSectionSubtreeMaxima, maxima.data(), maxima.size() * sizeof(uint32_t) });
+
+    DictionaryHeader header = {};
+    std::memcpy(header.magic, kDictionaryMagic, sizeof(header.magic));
+    header.version = kDictionaryVersion;
+    header.byteOrder = kByteOrderMark;
+    header.headerSize = sizeof(DictionaryHeader);
+    header.nodeCount = static_cast<uint32_t>(labels.size());
+    header.wordCount = static_cast<uint32_t>(frequencies.size());
+    header.sectionCount = static_cast<uint32_t>(sections.size());
+    return buildFileImage(&header, sizeof(header), sections);
+}
+
+bool DictionaryBuilder::write(const std::string& path)
+{
+    return writeFileImage(path, build());
+}
+
+} // namespace predictor
@@ -0,0 +1,45 @@
+#ifndef PREDICTOR_DICTIONARY_BUILDER_H
+#define PREDICTOR_DICTIONARY_BUILDER_H
+
+// Builds a main dictionary file from a word list. Used by
+// tools/build_dictionary and the benchmarks; the keyboard only reads.
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Utf16.h"
+
+namespace predictor {
+
+struct DictionaryEntry {
+    Text word;
+    uint32_t frequency;
+};
+
+class DictionaryBuilder {
+public:
+    // Duplicate words are merged, keeping the highest frequency; empty words
+    // are dropped.
+    void add(Text word, uint32_t frequency);
+    size_t size() const { return entries_.size(); }
+
+    // Whether to write the subtree maxima that make completion search best
+    // first (on by default; off gives the exhaustive search, for comparison)
+    void setSubtreeMaxima(bool enabled) { subtreeMaxima_ = enabled; }
+
+    // The complete file image
+    std::vector<uint8_t> build();
+
+    // build() and write it to 'path' through a temporary file, so a reader
+    // never maps a half written dictionary
+    bool write(const std::string& path);
+
+private:
+    std::vector<DictionaryEntry> entries_;
+    bool subtreeMaxima_ = true;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_DICTIONARY_BUILDER_H
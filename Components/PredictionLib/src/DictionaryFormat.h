@@ -0,0 +1,88 @@
+#ifndef PREDICTOR_DICTIONARY_FORMAT_H
+#define PREDICTOR_DICTIONARY_FORMAT_H
+
+// On-disk layout of the main dictionary (ta_main.data), written by
+// tools/build_dictionary and memory-mapped as is by Dictionary.
+//
+//   DictionaryHeader
+//   SectionEntry sections[sectionCount]
+//   section data, each section 8-byte aligned
+//
+// All integers are little endian. A reader accepts files with its own major
+// version and skips sections it does not know, so sections can be added
+// without breaking older readers; a change to an existing section bumps the
+// version.
+//
+// The word list is a LOUDS trie over UTF-16 code units: nodes are numbered
+// in breadth-first order and the tree shape is one bit vector holding, after
+// a leading "10" for a virtual super root, d ones and a zero for each node
+// with d children. A node's children are therefore consecutive node
+// numbers, and both navigations reduce to select on that vector:
+//
+//   children of node i:  node numbers select0(i) - i .. select0(i + 1) - i - 2
+//   parent of node j:    select1(j) - j - 1
+//
+// Every node stores the code unit on the edge into it. A second bit vector
+// marks the nodes that end a word; the rank of a word's node among those is
+// its word id, which indexes the per-word arrays.
+//
+// The subtree maxima let completion search go best first: a node's entry
+// bounds every word below it, so whole subtrees are skipped once k better
+// words are known. Files without them are searched exhaustively.
+
+#include <cstdint>
+
+namespace predictor {
+
+constexpr char     kDictionaryMagic[4] = { 'M', 'P', 'D', 'T' };
+constexpr uint32_t kDictionaryVersion = 1;
+constexpr uint32_t kByteOrderMark = 0x01020304;
+
+enum SectionId : uint32_t {
+    kSectionLouds       = 1,    // BitVectorHeader + data: the tree shape
+    kSectionTerminal    = 2,    // BitVectorHeader + data: nodes ending a word
+    kSectionLabels      = 3,    // uint16_t[nodeCount]: code unit into each node, 0 for the root
+    kSectionFrequencies = 4,    // uint32_t[wordCount]: corpus frequency by word id
+    kSectionSubtreeMaxima = 5,  // uint32_t[nodeCount]: highest frequency in each node's subtree (optional)
+};
+
+struct DictionaryHeader {
+    char     magic[4];
+    uint32_t version;
+    uint32_t byteOrder;         // kByteOrderMark as written
+    uint32_t headerSize;        // sizeof(DictionaryHeader)
+    uint32_t nodeCount;
+    uint32_t wordCount;
+    uint32_t sectionCount;
+    uint32_t flags;
+};
+
+struct SectionEntry {
+    uint32_t id;
+    uint32_t reserved;
+    uint64_t offset;            // from the start of the file
+    uint64_t size;
+};
+
+// A rank/select bit vector is stored as this header followed by
+//   uint64_t words[wordCount]
+//   uint32_t rank[rankCount]        ones before each 512-bit block, plus a final total
+//   uint32_t select1[select1Count]  block holding every 512th one
+//   uint32_t select0[select0Count]  block holding every 512th zero
+// each array starting 8-byte aligned.
+struct BitVectorHeader {
+    uint64_t bitCount;
+    uint64_t oneCount;
+    uint32_t wordCount;
+    uint32_t rankCount;
+    uint32_t select1Count;
+    uint32_t select0Count;
+};
+
+static_assert(sizeof(DictionaryHeader) == 32, "DictionaryHeader layout");
+static_assert(sizeof(SectionEntry) == 24, "SectionEntry layout");
+static_assert(sizeof(BitVectorHeader) == 32, "BitVectorHeader layout");
+
+} // namespace predictor
+
+#endif // PREDICTOR_DICTIONARY_FORMAT_H
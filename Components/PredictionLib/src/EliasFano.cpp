@@ -0,0 +1,78 @@
+#include "EliasFano.h"
+
+#include "BitOps.h"
+
+namespace predictor {
+
+unsigned EliasFanoReader::lowBits(uint32_t count, uint32_t universe)
+{
+    return count && universe > count ? floorLog2(universe / count) : 0;
+}
+
+uint64_t EliasFanoReader::bits(uint32_t count, uint32_t universe)
+{
+    unsigned low = lowBits(count, universe);
+    uint64_t highest = universe ? uint64_t(universe - 1) >> low : 0;
+    return uint64_t(count) * low + count + highest + 1;
+}
+
+uint64_t EliasFanoWriter::append(const uint32_t* values, size_t count, uint32_t universe)
+{
+    uint32_t n = static_cast<uint32_t>(count);
+    unsigned low = EliasFanoReader::lowBits(n, universe);
+    uint64_t start = bitCount_;
+    bitCount_ += EliasFanoReader::bits(n, universe);
+    words_.resize((bitCount_ + 63) / 64 + 1, 0);    // a spare word lets reads straddle the end
+
+    uint64_t highStart = start + uint64_t(n) * low;
+    for (uint32_t i = 0; i < n; i++) {
+        if (low)
+            write(start + uint64_t(i) * low, values[i] & ((uint32_t(1) << low) - 1), low);
+        uint64_t bit = highStart + (values[i] >> low) + i;
+        words_[bit >> 6] |= uint64_t(1) << (bit & 63);
+    }
+    return start;
+}
+
+void EliasFanoWriter::write(uint64_t position, uint64_t value, unsigned width)
+{
+    unsigned shift = position & 63;
+    words_[position >> 6] |= value << shift;
+    if (shift + width > 64)
+        words_[(position >> 6) + 1] |= value >> (64 - shift);
+}
+
+EliasFanoReader::EliasFanoReader(const uint64_t* words, uint64_t bitOffset, uint32_t count, uint32_t universe)
+    : words_(words), lowStart_(bitOffset), count_(count), low_(lowBits(count, universe))
+{
+    highStart_ = bitOffset + uint64_t(count) * low_;
+    word_ = highStart_ >> 6;
+    pending_ = count ? words_[word_] & (~uint64_t(0) << (highStart_ & 63)) : 0;
+}
+
+uint64_t EliasFanoReader::read(uint64_t position, unsigned width) const
+{
+    unsigned shift = position & 63;
+    uint64_t value = words_[position >> 6] >> shift;
+    if (shift + width > 64)
+        value |= words_[(position >> 6) + 1] << (64 - shift);
+    return value & ((uint64_t(1) << width) - 1);
+}
+
+bool EliasFanoReader::next(uint32_t& value)
+{
+    if (index_ == count_)
+        return false;
+    while (pending_ == 0)
+        pending_ = words_[++word_];
+    uint64_t bit = word_ * 64 + countTrailingZeros(pending_);
+    pending_ &= pending_ - 1;
+
+    uint64_t high = bit - highStart_ - index_;
+    uint64_t low = low_ ? read(lowStart_ + uint64_t(index_) * low_, low_) : 0;
+    value = static_cast<uint32_t>((high << low_) | low);
+    index_++;
+    return true;
+}
+
+} // namespace predictor
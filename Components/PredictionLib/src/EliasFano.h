@@ -0,0 +1,67 @@
+#ifndef PREDICTOR_ELIAS_FANO_H
+#define PREDICTOR_ELIAS_FANO_H
+
+// Elias-Fano coding of sorted lists of distinct integers below a bound,
+// such as the successor word ids of an n-gram context. A list of n values
+// below u takes n * l + n + (u >> l) + 1 bits with l = floor(log2(u / n)):
+// the low l bits of each value packed side by side, then the high bits as
+// a unary bit string, where value i sets bit (value >> l) + i.
+//
+// Lists are written one after the other into one stream of 64-bit words
+// and read back in order, which is all next-word prediction needs.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace predictor {
+
+class EliasFanoWriter {
+public:
+    // Append 'values', sorted and each below 'universe'; returns the bit
+    // offset to read them from
+    uint64_t append(const uint32_t* values, size_t count, uint32_t universe);
+
+    const std::vector<uint64_t>& words() const { return words_; }
+    uint64_t bitCount() const { return bitCount_; }
+
+private:
+    void write(uint64_t position, uint64_t value, unsigned width);
+
+    std::vector<uint64_t> words_{ 0 };     // always one spare word past the last bit
+    uint64_t bitCount_ = 0;
+};
+
+class EliasFanoReader {
+public:
+    EliasFanoReader() = default;
+
+    // The list of 'count' values below 'universe' written at 'bitOffset'
+    EliasFanoReader(const uint64_t* words, uint64_t bitOffset, uint32_t count, uint32_t universe);
+
+    uint32_t size() const { return count_; }
+
+    // The next value in order, or false after the last
+    bool next(uint32_t& value);
+
+    static unsigned lowBits(uint32_t count, uint32_t universe);
+
+    // Bits a list takes, for sizing streams
+    static uint64_t bits(uint32_t count, uint32_t universe);
+
+private:
+    uint64_t read(uint64_t position, unsigned width) const;
+
+    const uint64_t* words_ = nullptr;
+    uint64_t lowStart_ = 0;
+    uint64_t highStart_ = 0;
+    uint64_t word_ = 0;             // index of the high bits word being scanned
+    uint64_t pending_ = 0;          // its ones not yet read
+    uint32_t count_ = 0;
+    uint32_t index_ = 0;
+    unsigned low_ = 0;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_ELIAS_FANO_H
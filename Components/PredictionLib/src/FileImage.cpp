@@ -0,0 +1,58 @@
+#include "FileImage.h"
+
+#include <cstdio>
+#include <cstring>
+
+#include "DictionaryFormat.h"
+
+namespace predictor {
+
+namespace {
+
+uint64_t align8(uint64_t n) { return (n + 7) & ~uint64_t(7); }
+
+} // namespace
+
+std::vector<uint8_t> buildFileImage(const void* header, size_t headerSize, const std::vector<SectionData>& sections)
+{
+    // Offsets first, so that the image is allocated once
+    std::vector<SectionEntry> table(sections.size());
+    uint64_t offset = align8(headerSize + table.size() * sizeof(SectionEntry));
+    for (size_t i = 0; i < sections.size(); i++) {
+        table[i].id = sections[i].id;
+        table[i].offset = offset;
+        table[i].size = sections[i].size;
+        offset = align8(offset + sections[i].size);
+    }
+
+    std::vector<uint8_t> out(offset, 0);
+    std::memcpy(out.data(), header, headerSize);
+    std::memcpy(out.data() + headerSize, table.data(), table.size() * sizeof(SectionEntry));
+    for (size_t i = 0; i < sections.size(); i++) {
+        if (sections[i].size)
+            std::memcpy(out.data() + table[i].offset, sections[i].data, sections[i].size);
+    }
+    return out;
+}
+
+bool writeFileImage(const std::string& path, const std::vector<uint8_t>& image)
+{
+    std::string temporary = path + ".tmp";
+
+    FILE* file = std::fopen(temporary.c_str(), "wb");
+    if (!file)
+        return false;
+    bool ok = std::fwrite(image.data(), 1, image.size(), file) == image.size();
+    ok = std::fclose(file) == 0 && ok;
+#ifdef _WIN32
+    if (ok)
+        std::remove(path.c_str());
+#endif
+    if (ok)
+        ok = std::rename(temporary.c_str(), path.c_str()) == 0;
+    if (!ok)
+        std::remove(temporary.c_str());
+    return ok;
+}
+
+} // namespace predictor
@@ -0,0 +1,30 @@
+#ifndef PREDICTOR_FILE_IMAGE_H
+#define PREDICTOR_FILE_IMAGE_H
+
+// Writing the sectioned files the predictor maps (see DictionaryFormat.h):
+// a header, a table of SectionEntry and the sections, each 8-byte aligned.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace predictor {
+
+struct SectionData {
+    uint32_t id;
+    const void* data;
+    size_t size;
+};
+
+// The whole file: 'header' (headerSize bytes, its section count already
+// set), the table and the sections
+std::vector<uint8_t> buildFileImage(const void* header, size_t headerSize, const std::vector<SectionData>& sections);
+
+// Write 'image' to 'path' through a temporary file, so that a reader never
+// maps a half written file
+bool writeFileImage(const std::string& path, const std::vector<uint8_t>& image);
+
+} // namespace predictor
+
+#endif // PREDICTOR_FILE_IMAGE_H
@@ -0,0 +1,95 @@
+#include "FuzzySearch.h"
+
+#include <algorithm>
+#include <limits>
+
+namespace predictor {
+
+void FuzzySearch::start(TextView typed, float tolerance)
+{
+    merged_.clear();
+    walked_ = 0;
+    if (!dictionary_->isOpen())
+        return;
+    walk(typed, std::min(tolerance, kTolerancePerUnit * static_cast<float>(typed.size())));
+    merged_.start(kEditPenalty);
+}
+
+void FuzzySearch::walk(TextView typed, float tolerance)
+{
+    // Each letter of a node's text not typed costs a whole edit, which
+    // bounds how deep a branch can be within the tolerance
+    size_t width = typed.size() + 1;
+    size_t deepest = typed.size() + static_cast<size_t>(tolerance);
+    rows_.resize((deepest + 1) * width);
+    anchoredAbove_.resize(deepest + 1);
+    typedKeys_.clear();
+    for (char16_t unit : typed)
+        typedKeys_.push_back(layout_->keyOf(unit));
+
+    // The root: each typed letter one too many
+    for (size_t i = 0; i < width; i++)
+        rows_[i] = static_cast<float>(i);
+    anchoredAbove_[0] = std::numeric_limits<float>::infinity();
+    if (rows_[typed.size()] <= tolerance) {
+        merged_.add(Dictionary::kRoot, rows_[typed.size()]);
+        anchoredAbove_[0] = rows_[typed.size()];
+    }
+
+    // Depth first, so the rows of a node's ancestors are the rows above its
+    // own until its subtree is done
+    stack_.clear();
+    if (deepest > 0)
+        pushChildren(Dictionary::kRoot, 0, typed);
+    size_t allowance = kNodeBudget / 2;
+    while (!stack_.empty() && walked_ < allowance && !cancelled()) {
+        uint32_t node = stack_.back().first, level = stack_.back().second;
+        stack_.pop_back();
+        walked_++;
+
+        const float* above = &rows_[(level - 1) * width];
+        float* row = &rows_[level * width];
+        char16_t label = dictionary_->label(node);
+        uint16_t labelKey = layout_->keyOf(label);
+        row[0] = above[0] + 1;
+        float least = row[0];
+        for (size_t i = 1; i < width; i++) {
+            float substitution = typed[i - 1] == label ? 0.0f : layout_->substitutionCost(typedKeys_[i - 1], labelKey);
+            row[i] = std::min({ above[i - 1] + substitution, above[i] + 1, row[i - 1] + 1 });
+            least = std::min(least, row[i]);
+        }
+        if (least > tolerance)
+            continue;
+
+        float cost = row[typed.size()];
+        anchoredAbove_[level] = anchoredAbove_[level - 1];
+        if (cost <= tolerance && cost < anchoredAbove_[level]) {
+            merged_.add(node, cost);
+            anchoredAbove_[level] = cost;
+        }
+        if (level < deepest)
+            pushChildren(node, level, typed);
+    }
+}
+
+// Children go on the stack so that the one typed next is walked first, the
+// rest in label order
+void FuzzySearch::pushChildren(uint32_t node, uint32_t level, TextView typed)
+{
+    uint32_t first, end;
+    dictionary_->children(node, first, end);
+    for (uint32_t child = end; child > first; child--)
+        stack_.emplace_back(child - 1, level + 1);
+    if (level < typed.size()) {
+        uint32_t exact = dictionary_->child(node, typed[level]);
+        if (exact != Dictionary::kNoNode)
+            std::swap(stack_[stack_.size() - 1 - (exact - first)], stack_.back());
+    }
+}
+
+bool FuzzySearch::next(uint32_t& wordId, float& cost)
+{
+    return !cancelled() && merged_.next(wordId, cost, kNodeBudget - std::min(walked_, kNodeBudget));
+}
+
+} // namespace predictor
@@ -0,0 +1,86 @@
+#ifndef PREDICTOR_FUZZY_SEARCH_H
+#define PREDICTOR_FUZZY_SEARCH_H
+
+// Completions of a prefix typed with slips: the words below every trie node
+// whose text is within an edit cost of what was typed, best first.
+//
+// The trie is walked depth first carrying a row of edit costs per level,
+// as a Levenshtein automaton over the typed text would: entry i of a node's
+// row is the cheapest edit of the typed text's first i code units into the
+// node's text. A letter typed for another costs what the key layout says
+// (KeyLayout::substitutionCost), one typed too many or left out a whole
+// edit. A branch ends where every entry is over the tolerance, and a node
+// whose full-length entry is within it is an anchor, unless an anchor above
+// it costs no more. The walk goes down the exactly typed branch first.
+//
+// The anchors' completions are merged by a MergedSearch on log2(1 +
+// frequency) less kEditPenalty per unit of cost.
+//
+// Every trie node read, by the walk or the completion searches, counts
+// against kNodeBudget, of which the walk may take half, and the search ends
+// when it is spent, which bounds the time a query takes whatever the
+// dictionary and the typed text. The tolerance is also held to
+// kTolerancePerUnit per typed code unit, so a short prefix, which almost
+// anything is near, takes near slips only.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Dictionary.h"
+#include "KeyLayout.h"
+#include "MergedSearch.h"
+#include "Utf16.h"
+
+namespace predictor {
+
+class FuzzySearch {
+public:
+    static constexpr size_t kNodeBudget = 20000;
+    static constexpr float kEditPenalty = 6.0f;         // log2 of frequency a whole edit costs
+    static constexpr float kTolerancePerUnit = 0.4f;
+
+    FuzzySearch(const Dictionary& dictionary, const KeyLayout& layout)
+        : dictionary_(&dictionary), layout_(&layout), merged_(dictionary) {}
+
+    // Search for words starting within 'tolerance' of 'typed', a whole edit
+    // costing 1
+    void start(TextView typed, float tolerance);
+
+    // The next word id and the cost of its prefix, or false when there are
+    // no more or the budget is spent
+    bool next(uint32_t& wordId, float& cost);
+
+    void setCancellation(const std::atomic<bool>* cancelled)
+    {
+        cancelled_ = cancelled;
+        merged_.setCancellation(cancelled);
+    }
+    void setBlacklist(const Blacklist* blacklist) { merged_.setBlacklist(blacklist); }
+
+    // For measuring: trie nodes read since start(), how many anchors the
+    // walk found, and whether the budget ran out
+    size_t expanded() const { return walked_ + merged_.expanded(); }
+    size_t anchorCount() const { return merged_.anchorCount(); }
+    bool budgetSpent() const { return expanded() >= kNodeBudget; }
+
+private:
+    void walk(TextView typed, float tolerance);
+    void pushChildren(uint32_t node, uint32_t level, TextView typed);
+    bool cancelled() const { return cancelled_ && cancelled_->load(std::memory_order_relaxed); }
+
+    const Dictionary* dictionary_;
+    const KeyLayout* layout_;
+    std::vector<uint16_t> typedKeys_;
+    std::vector<float> rows_;                       // a row of edit costs per level of the walk
+    std::vector<float> anchoredAbove_;              // per level, the cheapest anchor on the path
+    std::vector<std::pair<uint32_t, uint32_t>> stack_;     // nodes to walk and their levels
+    MergedSearch merged_;
+    size_t walked_ = 0;
+    const std::atomic<bool>* cancelled_ = nullptr;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_FUZZY_SEARCH_H
@@ -0,0 +1,347 @@
+#include "KeyLayout.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+
+#include "Utf16.h"
+
+namespace predictor {
+
+namespace {
+
+// Enough JSON for layout files: values are read into a tree, numbers as
+// doubles and strings as UTF-8
+struct JsonValue {
+    enum Type { Null, Boolean, Number, String, Array, Object } type = Null;
+    double number = 0;
+    std::string string;
+    std::vector<JsonValue> items;
+    std::vector<std::pair<std::string, JsonValue>> members;
+
+    const JsonValue* member(const char* name) const
+    {
+        for (const auto& entry : members) {
+            if (entry.first == name)
+                return &entry.second;
+        }
+        return nullptr;
+    }
+};
+
+class JsonReader {
+public:
+    explicit JsonReader(const std::string& text) : text_(text) {}
+
+    // The whole text as one value
+    bool read(JsonValue& value)
+    {
+        if (!readValue(value, 0))
+            return false;
+        skipSpace();
+        return position_ == text_.size();
+    }
+
+private:
+    static constexpr int kMaxDepth = 32;
+
+    void skipSpace()
+    {
+        while (position_ < text_.size() && std::isspace(static_cast<unsigned char>(text_[position_])))
+            position_++;
+    }
+
+    bool consume(char c)
+    {
+        skipSpace();
+        if (position_ == text_.size() || text_[position_] != c)
+            return false;
+        position_++;
+        return true;
+    }
+
+    bool consumeWord(const char* word)
+    {
+        size_t length = std::char_traits<char>::length(word);
+        if (text_.compare(position_, length, word) != 0)
+            return false;
+        position_ += length;
+        return true;
+    }
+
+    bool readValue(JsonValue& value, int depth)
+    {
+        skipSpace();
+        if (position_ == text_.size() || depth > kMaxDepth)
+            return false;
+        char c = text_[position_];
+        if (c == '{')
+            return readObject(value, depth);
+        if (c == '[')
+            return readArray(value, depth);
+        if (c == '"') {
+            value.type = JsonValue::String;
+            return readString(value.string);
+        }
+        if (consumeWord("true") || consumeWord("false")) {
+            value.type = JsonValue::Boolean;
+            value.number = c == 't';
+            return true;
+        }
+        if (consumeWord("null")) {
+            value.type = JsonValue::Null;
+            return true;
+        }
+        const char* start = text_.c_str() + position_;
+        char* end;
+        value.number = std::strtod(start, &end);
+        if (end == start)
+            return false;
+        value.type = JsonValue::Number;
+        position_ += static_cast<size_t>(end - start);
+        return true;
+    }
+
+    bool readObject(JsonValue& value, int depth)
+    {
+        value.type = JsonValue::Object;
+        position_++;
+        if (consume('}'))
+            return true;
+        do {
+            std::string name;
+            skipSpace();
+            if (!readString(name) || !consume(':'))
+                return false;
+            value.members.emplace_back(std::move(name), JsonValue());
+            if (!readValue(value.members.back().second, depth + 1))
+                return false;
+        } while (consume(','));
+        return consume('}');
+    }
+
+    bool readArray(JsonValue& value, int depth)
+    {
+        value.type = JsonValue::Array;
+        position_++;
+        if (consume(']'))
+            return true;
+        do {
+            value.items.emplace_back();
+            if (!readValue(value.items.back(), depth + 1))
+                return false;
+        } while (consume(','));
+        return consume(']');
+    }
+
+    bool readString(std::string& out)
+    {
+        if (position_ == text_.size() || text_[position_] != '"')
+            return false;
+        position_++;
+        Text escaped;           // \u escapes, UTF-16 until the next plain character
+        auto flush = [&] {
+            out += toUtf8(escaped);
+            escaped.clear();
+        };
+        while (position_ < text_.size()) {
+            char c = text_[position_++];
+            if (c == '"') {
+                flush();
+                return true;
+            }
+            if (c != '\\') {
+                flush();
+                out += c;
+                continue;
+            }
+            if (position_ == text_.size())
+                return false;
+            c = text_[position_++];
+            if (c == 'u') {
+                if (position_ + 4 > text_.size())
+                    return false;
+                std::string hex = text_.substr(position_, 4);
+                char* end;
+                unsigned long unit = std::strtoul(hex.c_str(), &end, 16);
+                if (end != hex.c_str() + 4)
+                    return false;
+                escaped += static_cast<char16_t>(unit);
+                position_ += 4;
+                continue;
+            }
+            flush();
+            switch (c) {
+            case 'b': out += '\b'; break;
+            case 'f': out += '\f'; break;
+            case 'n': out += '\n'; break;
+            case 'r': out += '\r'; break;
+            case 't': out += '\t'; break;
+            default: out += c; break;
+            }
+        }
+        return false;
+    }
+
+    const std::string& text_;
+    size_t position_ = 0;
+};
+
+// A width, gap or height: "7.34375%" or a plain number, both percentages
+float dimension(const JsonValue* value, float fallback)
+{
+    if (!value)
+        return fallback;
+    if (value->type == JsonValue::Number)
+        return static_cast<float>(value->number);
+    if (value->type != JsonValue::String)
+        return fallback;
+    const char* start = value->string.c_str();
+    char* end;
+    double number = std::strtod(start, &end);
+    return end == start ? fallback : static_cast<float>(number);
+}
+
+// The first of a key's codes, "2950" or "2950,2951"; negative for keys that
+// type nothing (shift, delete, ...)
+long firstCode(const JsonValue* codes)
+{
+    if (!codes)
+        return -1;
+    if (codes->type == JsonValue::Number)
+        return static_cast<long>(codes->number);
+    if (codes->type != JsonValue::String)
+        return -1;
+    const char* start = codes->string.c_str();
+    char* end;
+    long code = std::strtol(start, &end, 10);
+    return end == start ? -1 : code;
+}
+
+// The vowel sign of an independent vowel in the Indic blocks from
+// Devanagari to Malayalam, which repeat one arrangement every 128 code
+// points: AA at +0x06 to AU at +0x14, their signs 0x38 further on, bar
+// vocalic L. 0 for other code points.
+char16_t vowelSign(char16_t unit)
+{
+    if (unit < 0x0900 || unit > 0x0D7F)
+        return 0;
+    unsigned offset = unit & 0x7F;
+    return offset >= 0x06 && offset <= 0x14 && offset != 0x0C ? static_cast<char16_t>(unit + 0x38) : 0;
+}
+
+} // namespace
+
+bool KeyLayout::fail(const char* reason)
+{
+    clear();
+    error_ = reason;
+    return false;
+}
+
+void KeyLayout::clear()
+{
+    keys_.clear();
+    units_.clear();
+    costs_.clear();
+    error_ = nullptr;
+}
+
+uint16_t KeyLayout::addKey(float x, float y)
+{
+    keys_.push_back({ x, y });
+    return static_cast<uint16_t>(keys_.size() - 1);
+}
+
+// The first key typing 'unit' keeps it
+void KeyLayout::mapUnit(char16_t unit, uint16_t key)
+{
+    if (std::none_of(units_.begin(), units_.end(), [&](const auto& entry) { return entry.first == unit; }))
+        units_.emplace_back(unit, key);
+}
+
+bool KeyLayout::load(const char* path, float aspectRatio)
+{
+    clear();
+    if (!path)
+        return fail("no path");
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        return fail("cannot read the file");
+    std::string text((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+
+    JsonValue layout;
+    if (!JsonReader(text).read(layout) || layout.type != JsonValue::Object)
+        return fail("not JSON");
+    const JsonValue* rows = layout.member("rows");
+    if (!rows || rows->type != JsonValue::Array)
+        return fail("no rows");
+    float keyWidth = dimension(layout.member("keyWidth"), 10.0f);
+    float gap = dimension(layout.member("horizontalGap"), 0.0f);
+    float pitch = keyWidth + gap;
+    if (!(pitch > 0) || !(aspectRatio > 0))
+        return fail("no key width");
+
+    // Heights in percent of the keyboard's height become percent of its
+    // width, then all of it key pitches
+    float top = 0;
+    bool alternativePlaced = false;
+    for (const JsonValue& row : rows->items) {
+        const JsonValue* rowId = row.member("rowId");
+        bool alternative = rowId && rowId->type == JsonValue::String;
+        if (alternative && alternativePlaced)
+            continue;
+        alternativePlaced |= alternative;
+
+        float keyHeight = dimension(row.member("keyHeight"), 25.0f);
+        top += dimension(row.member("verticalGap"), 0.0f);
+        float y = (top + keyHeight / 2) * aspectRatio / pitch;
+        top += keyHeight;
+
+        const JsonValue* keys = row.member("keys");
+        if (!keys || keys->type != JsonValue::Array)
+            continue;
+        float left = 0;
+        for (const JsonValue& key : keys->items) {
+            left += dimension(key.member("horizontalGap"), gap);
+            float width = dimension(key.member("keyWidth"), keyWidth);
+            float x = (left + width / 2) / pitch;
+            left += width;
+
+            long code = firstCode(key.member("codes"));
+            if (code <= 0 || code > 0xFFFF || keys_.size() == kNoKey)
+                continue;
+            uint16_t index = addKey(x, y);
+            mapUnit(static_cast<char16_t>(code), index);
+            if (char16_t sign = vowelSign(static_cast<char16_t>(code)))
+                mapUnit(sign, index);
+        }
+    }
+    if (keys_.empty())
+        return fail("no keys");
+    std::sort(units_.begin(), units_.end());
+
+    // Neighbours are a pitch or so apart, so the near cost covers them and
+    // keys further off cost in proportion
+    size_t count = keys_.size();
+    costs_.resize(count * count);
+    for (size_t a = 0; a < count; a++) {
+        for (size_t b = 0; b < count; b++) {
+            float distance = std::hypot(keys_[a].x - keys_[b].x, keys_[a].y - keys_[b].y);
+            costs_[a * count + b] = std::min(1.0f, kNearCost * std::max(distance, 1.0f));
+        }
+    }
+    return true;
+}
+
+uint16_t KeyLayout::keyOf(char16_t unit) const
+{
+    auto found = std::lower_bound(units_.begin(), units_.end(), std::make_pair(unit, uint16_t(0)));
+    return found != units_.end() && found->first == unit ? found->second : kNoKey;
+}
+
+} // namespace predictor
@@ -0,0 +1,78 @@
+#ifndef PREDICTOR_KEY_LAYOUT_H
+#define PREDICTOR_KEY_LAYOUT_H
+
+// Where the keys of a keyboard layout are, read from the keyboard's layout
+// JSON (mn_tamil99.json and the like), for pricing a typed letter that
+// should have been another by how far apart their keys are.
+//
+// The layout gives the default key width and gap between keys, then the
+// rows top to bottom, each with the gap above it and the key height, and
+// its keys left to right with their codes and their own width or gap where
+// these differ. Widths and gaps are percentages of the keyboard's width,
+// heights of its height, so placing the keys needs the keyboard's aspect
+// ratio. Rows with a rowId are alternatives for one kind of device or
+// another; the first of them is measured and the rest skipped.
+//
+// A key whose code is an independent vowel also types its vowel sign after
+// a consonant, so the sign is placed on the vowel's key.
+//
+// Distances are in key pitches, a default key width and gap. A letter
+// typed for one on the same or a neighbouring key costs kNearCost, and the
+// cost grows with the distance up to a whole edit, also the cost of any
+// letter off the layout.
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace predictor {
+
+class KeyLayout {
+public:
+    static constexpr uint16_t kNoKey = UINT16_MAX;
+    static constexpr float kNearCost = 0.35f;
+
+    // Height over width of a portrait phone keyboard
+    static constexpr float kDefaultAspectRatio = 0.58f;
+
+    // Read the layout at 'path', keyboard height over width 'aspectRatio'.
+    // On failure the layout is left empty.
+    bool load(const char* path, float aspectRatio = kDefaultAspectRatio);
+    void clear();
+
+    bool isLoaded() const { return !keys_.empty(); }
+    const char* error() const { return error_; }
+    size_t keyCount() const { return keys_.size(); }
+
+    // The key typing 'unit', or kNoKey
+    uint16_t keyOf(char16_t unit) const;
+
+    // What typing the letter of 'typed' for that of 'intended' costs, when
+    // they differ: kNearCost to 1
+    float substitutionCost(uint16_t typed, uint16_t intended) const
+    {
+        if (typed == kNoKey || intended == kNoKey)
+            return 1.0f;
+        return costs_[static_cast<size_t>(typed) * keys_.size() + intended];
+    }
+
+private:
+    struct Key {
+        float x;            // centre, in key pitches
+        float y;
+    };
+
+    bool fail(const char* reason);
+    uint16_t addKey(float x, float y);
+    void mapUnit(char16_t unit, uint16_t key);
+
+    std::vector<Key> keys_;
+    std::vector<std::pair<char16_t, uint16_t>> units_;     // sorted by unit
+    std::vector<float> costs_;                              // keys x keys
+    const char* error_ = nullptr;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_KEY_LAYOUT_H
@@ -0,0 +1,40 @@
+#ifndef PREDICTOR_MAPPED_FILE_H
+#define PREDICTOR_MAPPED_FILE_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace predictor {
+
+// Read-only memory mapping of a whole file (mmap on POSIX, a file mapping on
+// Windows). The pages belong to the OS page cache: they are read in on first
+// touch and shared by every process that maps the same file, so the keyboard
+// extension and the host app pay for a dictionary once.
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile() { close(); }
+
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    // Map 'path', replacing any current mapping. Returns false on failure,
+    // including an empty file.
+    bool open(const char* path);
+    void close();
+
+    const uint8_t* data() const { return data_; }
+    size_t size() const { return size_; }
+    bool isOpen() const { return data_ != nullptr; }
+
+private:
+    const uint8_t* data_ = nullptr;
+    size_t size_ = 0;
+    void* platform_ = nullptr;      // Windows mapping handle
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_MAPPED_FILE_H
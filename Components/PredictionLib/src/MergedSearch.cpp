@@ -0,0 +1,97 @@
+#include "MergedSearch.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace predictor {
+
+float MergedSearch::key(uint32_t frequency, float cost) const
+{
+    return std::log2(1.0f + static_cast<float>(frequency)) - penalty_ * cost;
+}
+
+void MergedSearch::clear()
+{
+    anchors_.clear();
+    heap_.clear();
+    returned_.clear();
+    expanded_ = 0;
+}
+
+void MergedSearch::start(float penalty)
+{
+    heap_.clear();
+    returned_.clear();
+    expanded_ = 0;
+    penalty_ = penalty;
+    // Checked each time, as the dictionary may have been reloaded
+    bestFirst_ = dictionary_->hasSubtreeMaxima();
+    keepBestAnchors();
+    for (uint32_t i = 0; i < anchors_.size(); i++) {
+        const Anchor& anchor = anchors_[i];
+        if (!bestFirst_) {
+            if (dictionary_->isWord(anchor.node)) {
+                uint32_t id = dictionary_->wordId(anchor.node);
+                if (!blacklist_ || !blacklist_->contains(id))
+                    push({ key(dictionary_->frequency(id), anchor.cost), id, i });
+            }
+            continue;
+        }
+        if (searches_.size() <= i)
+            searches_.emplace_back(*dictionary_);
+        searches_[i].setCancellation(cancelled_);
+        searches_[i].setBlacklist(blacklist_);
+        searches_[i].start(anchor.node);
+        pull(i);
+    }
+}
+
+void MergedSearch::keepBestAnchors()
+{
+    if (anchors_.size() <= kMaxAnchors)
+        return;
+    auto priority = [this](const Anchor& anchor) {
+        return bestFirst_ ? key(dictionary_->subtreeMaximum(anchor.node), anchor.cost) : -anchor.cost;
+    };
+    std::partial_sort(anchors_.begin(), anchors_.begin() + kMaxAnchors, anchors_.end(),
+                      [&](const Anchor& a, const Anchor& b) { return priority(a) > priority(b); });
+    anchors_.resize(kMaxAnchors);
+}
+
+void MergedSearch::push(Pending pending)
+{
+    heap_.push_back(pending);
+    std::push_heap(heap_.begin(), heap_.end(), lowerPriority);
+}
+
+// Put the next word of the anchor's search in the heap
+void MergedSearch::pull(uint32_t anchor)
+{
+    CompletionSearch& search = searches_[anchor];
+    size_t before = search.expanded();
+    uint32_t id;
+    if (search.next(id))
+        push({ key(dictionary_->frequency(id), anchors_[anchor].cost), id, anchor });
+    expanded_ += search.expanded() - before;
+}
+
+bool MergedSearch::next(uint32_t& wordId, float& cost, size_t limit)
+{
+    while (!heap_.empty() && expanded_ < limit && !cancelled()) {
+        Pending best = heap_.front();
+        std::pop_heap(heap_.begin(), heap_.end(), lowerPriority);
+        heap_.pop_back();
+        if (bestFirst_)
+            pull(best.anchor);
+
+        if (std::find(returned_.begin(), returned_.end(), best.wordId) != returned_.end())
+            continue;
+        returned_.push_back(best.wordId);
+        wordId = best.wordId;
+        cost = anchors_[best.anchor].cost;
+        return true;
+    }
+    return false;
+}
+
+} // namespace predictor
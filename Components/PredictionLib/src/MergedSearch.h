@@ -0,0 +1,93 @@
+#ifndef PREDICTOR_MERGED_SEARCH_H
+#define PREDICTOR_MERGED_SEARCH_H
+
+// The words below several trie nodes at once, each node reached at a cost,
+// best first on log2(1 + frequency) less a penalty per unit of cost. The
+// nodes, anchors, come from searches that read the typed text more than one
+// way (FuzzySearch, AnjalSearch).
+//
+// Each anchor has a CompletionSearch, and their next words are merged in a
+// heap. A word below two anchors, one above the other, comes up from both;
+// the first time is at its best, and the second is dropped. Of too many
+// anchors those whose best word could rank highest are kept. Without
+// subtree maxima only the anchors themselves are words on offer, as reading
+// their subtrees would cost too much.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "CompletionSearch.h"
+#include "Dictionary.h"
+
+namespace predictor {
+
+class MergedSearch {
+public:
+    static constexpr size_t kMaxAnchors = 32;
+
+    explicit MergedSearch(const Dictionary& dictionary) : dictionary_(&dictionary) {}
+
+    // Drop the anchors; the searches keep their storage
+    void clear();
+    void add(uint32_t node, float cost) { anchors_.push_back({ node, cost }); }
+    size_t anchorCount() const { return anchors_.size(); }
+
+    // Start the searches below the anchors, 'penalty' to a unit of cost
+    void start(float penalty);
+
+    // The next word id and the cost of its anchor, or false when there are
+    // no more or the searches have read 'limit' trie nodes
+    bool next(uint32_t& wordId, float& cost, size_t limit);
+
+    void setCancellation(const std::atomic<bool>* cancelled) { cancelled_ = cancelled; }
+    void setBlacklist(const Blacklist* blacklist) { blacklist_ = blacklist; }
+
+    // Trie nodes the searches read since start()
+    size_t expanded() const { return expanded_; }
+
+private:
+    struct Anchor {
+        uint32_t node;
+        float cost;
+    };
+
+    // The next word of an anchor, keyed for the merge
+    struct Pending {
+        float key;
+        uint32_t wordId;
+        uint32_t anchor;
+    };
+
+    // Heap order: higher key first, then lower word id, then earlier anchor
+    static bool lowerPriority(const Pending& a, const Pending& b)
+    {
+        if (a.key != b.key)
+            return a.key < b.key;
+        if (a.wordId != b.wordId)
+            return a.wordId > b.wordId;
+        return a.anchor > b.anchor;
+    }
+
+    float key(uint32_t frequency, float cost) const;
+    void keepBestAnchors();
+    void push(Pending pending);
+    void pull(uint32_t anchor);
+    bool cancelled() const { return cancelled_ && cancelled_->load(std::memory_order_relaxed); }
+
+    const Dictionary* dictionary_;
+    std::vector<Anchor> anchors_;
+    std::vector<CompletionSearch> searches_;        // one per anchor, kept for their storage
+    std::vector<Pending> heap_;
+    std::vector<uint32_t> returned_;
+    float penalty_ = 0;
+    size_t expanded_ = 0;
+    bool bestFirst_ = false;
+    const std::atomic<bool>* cancelled_ = nullptr;
+    const Blacklist* blacklist_ = nullptr;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_MERGED_SEARCH_H
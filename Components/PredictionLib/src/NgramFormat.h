@@ -0,0 +1,82 @@
+#ifndef PREDICTOR_NGRAM_FORMAT_H
+#define PREDICTOR_NGRAM_FORMAT_H
+
+// On-disk layout of the n-gram model (ta_ngram.data), written by
+// tools/build_ngram_model and memory-mapped as is by NgramModel. It uses
+// the header, section table and alignment rules of DictionaryFormat.h and
+// is keyed by the word ids of the dictionary it was built against.
+//
+// Each order (bigram, trigram) is stored as:
+//
+//   contexts    the context word ids, sorted: uint32_t for a bigram's one
+//               word, uint64_t (word1 << 32 | word2) for a trigram's two,
+//               so a context is found by binary search
+//   lists       one NgramList per context plus a final one: where its
+//               successors start
+//   successors  the successor word ids of each context, Elias-Fano coded
+//               (EliasFano.h) in one stream of uint64_t words
+//   weights     uint8_t per successor, in list order: its quantized log10
+//               probability given the context
+//   backoffs    uint8_t per context: its quantized log10 backoff weight
+//
+// Most contexts are seen with one or two successors, so the per-context
+// arrays are kept to 13 bytes a context.
+//
+// Probabilities are interpolated absolute discounting estimates, stored as
+// ARPA files store them: a listed successor has its own probability, any
+// other word w has backoff(context) + P(w | shorter context), in log10.
+// Both kinds of value are quantized to 8 bits against a table of 256
+// levels, each the median of an equal share of the values.
+
+#include <cstdint>
+
+#include "DictionaryFormat.h"
+
+namespace predictor {
+
+constexpr char     kNgramMagic[4] = { 'M', 'P', 'N', 'G' };
+constexpr uint32_t kNgramVersion = 1;
+
+enum NgramSectionId : uint32_t {
+    kNgramSectionLevels             = 1,    // float[256] probabilities, then float[256] backoffs
+    kNgramSectionBigramContexts     = 2,    // uint32_t[bigramContexts]
+    kNgramSectionBigramLists        = 3,    // NgramList[bigramContexts + 1]
+    kNgramSectionBigramSuccessors   = 4,    // uint64_t[]: Elias-Fano lists
+    kNgramSectionBigramWeights      = 5,    // uint8_t[bigrams]
+    kNgramSectionBigramBackoffs     = 6,    // uint8_t[bigramContexts]
+    kNgramSectionTrigramContexts    = 7,    // uint64_t[trigramContexts]
+    kNgramSectionTrigramLists       = 8,    // NgramList[trigramContexts + 1]
+    kNgramSectionTrigramSuccessors  = 9,    // uint64_t[]: Elias-Fano lists
+    kNgramSectionTrigramWeights     = 10,   // uint8_t[trigrams]
+    kNgramSectionTrigramBackoffs    = 11,   // uint8_t[trigramContexts]
+};
+
+// Sections per order, numbered from kNgramSectionBigramContexts and
+// kNgramSectionTrigramContexts in the order above
+constexpr uint32_t kNgramSectionsPerOrder = 5;
+
+struct NgramHeader {
+    char     magic[4];
+    uint32_t version;
+    uint32_t byteOrder;         // kByteOrderMark as written
+    uint32_t headerSize;        // sizeof(NgramHeader)
+    uint32_t wordCount;         // of the dictionary, the bound of every word id
+    uint32_t sectionCount;
+    uint64_t frequencyTotal;    // sum of the dictionary frequencies, for unigram probabilities
+    uint32_t bigramContexts;
+    uint32_t trigramContexts;
+    uint64_t bigrams;
+    uint64_t trigrams;
+};
+
+struct NgramList {
+    uint32_t bitOffset;         // of the successor list in the Elias-Fano stream
+    uint32_t first;             // index of its first successor; the next list's is one past its last
+};
+
+static_assert(sizeof(NgramHeader) == 56, "NgramHeader layout");
+static_assert(sizeof(NgramList) == 8, "NgramList layout");
+
+} // namespace predictor
+
+#endif // PREDICTOR_NGRAM_FORMAT_H
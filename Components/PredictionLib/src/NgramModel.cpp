@@ -0,0 +1,174 @@
+#include "NgramModel.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace predictor {
+
+bool NgramModel::Successors::next(uint32_t& wordId, float& logProbability)
+{
+    if (!ids_.next(wordId))
+        return false;
+    logProbability = levels_[weights_[index_++]];
+    return true;
+}
+
+bool NgramModel::open(const char* path, uint32_t wordCount)
+{
+    close();
+    error_ = nullptr;
+    if (!file_.open(path))
+        return fail("cannot map file");
+
+    const uint8_t* data = file_.data();
+    size_t size = file_.size();
+
+    NgramHeader header;
+    if (size < sizeof(header))
+        return fail("truncated header");
+    std::memcpy(&header, data, sizeof(header));
+    if (std::memcmp(header.magic, kNgramMagic, sizeof(header.magic)) != 0)
+        return fail("not an n-gram model");
+    if (header.byteOrder != kByteOrderMark)
+        return fail("wrong byte order");
+    if (header.version != kNgramVersion)
+        return fail("unsupported version");
+    if (header.headerSize < sizeof(header))
+        return fail("bad header");
+    if (header.wordCount != wordCount)
+        return fail("built for another dictionary");
+
+    uint64_t tableEnd = uint64_t(header.headerSize) + uint64_t(header.sectionCount) * sizeof(SectionEntry);
+    if (tableEnd > size)
+        return fail("truncated section table");
+
+    bigrams_.contextCount = header.bigramContexts;
+    bigrams_.count = header.bigrams;
+    trigrams_.contextCount = header.trigramContexts;
+    trigrams_.count = header.trigrams;
+    for (uint32_t i = 0; i < header.sectionCount; i++) {
+        SectionEntry entry;
+        std::memcpy(&entry, data + header.headerSize + i * sizeof(SectionEntry), sizeof(entry));
+        if (entry.offset % 8 != 0 || entry.offset > size || entry.size > size - entry.offset)
+            return fail("section out of range");
+
+        const uint8_t* section = data + entry.offset;
+        bool trigram = entry.id >= kNgramSectionTrigramContexts;
+        Order& order = trigram ? trigrams_ : bigrams_;
+        switch (entry.id) {
+        case kNgramSectionLevels:
+            if (entry.size < 2 * 256 * sizeof(float))
+                return fail("bad levels section");
+            probabilityLevels_ = reinterpret_cast<const float*>(section);
+            backoffLevels_ = probabilityLevels_ + 256;
+            break;
+        case kNgramSectionBigramContexts:
+        case kNgramSectionTrigramContexts:
+            if (entry.size < uint64_t(order.contextCount) * (trigram ? sizeof(uint64_t) : sizeof(uint32_t)))
+                return fail("bad context section");
+            order.contexts = section;
+            break;
+        case kNgramSectionBigramLists:
+        case kNgramSectionTrigramLists:
+            if (entry.size < (uint64_t(order.contextCount) + 1) * sizeof(NgramList))
+                return fail("bad list section");
+            order.lists = reinterpret_cast<const NgramList*>(section);
+            break;
+        case kNgramSectionBigramSuccessors:
+        case kNgramSectionTrigramSuccessors:
+            // The last word is a spare, so that reads may straddle the end
+            if (entry.size < sizeof(uint64_t))
+                return fail("bad successor section");
+            order.successors = reinterpret_cast<const uint64_t*>(section);
+            order.successorBits = (entry.size / sizeof(uint64_t) - 1) * 64;
+            break;
+        case kNgramSectionBigramWeights:
+        case kNgramSectionTrigramWeights:
+            if (entry.size < order.count)
+                return fail("bad weight section");
+            order.weights = section;
+            break;
+        case kNgramSectionBigramBackoffs:
+        case kNgramSectionTrigramBackoffs:
+            if (entry.size < order.contextCount)
+                return fail("bad backoff section");
+            order.backoffs = section;
+            break;
+        default:
+            break;      // a newer minor addition
+        }
+    }
+
+    for (const Order* order : { &bigrams_, &trigrams_ }) {
+        if (!order->contexts || !order->lists || !order->successors || !order->weights || !order->backoffs)
+            return fail("missing section");
+    }
+    if (!probabilityLevels_)
+        return fail("missing section");
+
+    wordCount_ = header.wordCount;
+    frequencyTotal_ = header.frequencyTotal;
+    return true;
+}
+
+void NgramModel::close()
+{
+    file_.close();
+    bigrams_ = Order();
+    trigrams_ = Order();
+    probabilityLevels_ = nullptr;
+    backoffLevels_ = nullptr;
+    wordCount_ = 0;
+    frequencyTotal_ = 0;
+}
+
+bool NgramModel::fail(const char* reason)
+{
+    close();
+    error_ = reason;
+    return false;
+}
+
+NgramModel::Successors NgramModel::bigram(uint32_t word) const
+{
+    if (!isOpen())
+        return Successors();
+    const uint32_t* contexts = static_cast<const uint32_t*>(bigrams_.contexts);
+    const uint32_t* end = contexts + bigrams_.contextCount;
+    const uint32_t* found = std::lower_bound(contexts, end, word);
+    if (found == end || *found != word)
+        return Successors();
+    return successors(bigrams_, static_cast<size_t>(found - contexts));
+}
+
+NgramModel::Successors NgramModel::trigram(uint32_t word1, uint32_t word2) const
+{
+    if (!isOpen())
+        return Successors();
+    uint64_t key = uint64_t(word1) << 32 | word2;
+    const uint64_t* contexts = static_cast<const uint64_t*>(trigrams_.contexts);
+    const uint64_t* end = contexts + trigrams_.contextCount;
+    const uint64_t* found = std::lower_bound(contexts, end, key);
+    if (found == end || *found != key)
+        return Successors();
+    return successors(trigrams_, static_cast<size_t>(found - contexts));
+}
+
+NgramModel::Successors NgramModel::successors(const Order& order, size_t context) const
+{
+    const NgramList& list = order.lists[context];
+    uint32_t first = list.first, end = order.lists[context + 1].first;
+    if (end < first || end > order.count ||
+        list.bitOffset + EliasFanoReader::bits(end - first, wordCount_) > order.successorBits)
+        return Successors();    // damaged; treated as unknown
+
+    Successors successors;
+    successors.ids_ = EliasFanoReader(order.successors, list.bitOffset, end - first, wordCount_);
+    successors.weights_ = order.weights + first;
+    successors.levels_ = probabilityLevels_;
+    successors.backoff_ = backoffLevels_[order.backoffs[context]];
+    successors.found_ = true;
+    return successors;
+}
+
+} // namespace predictor
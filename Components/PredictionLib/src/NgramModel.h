@@ -0,0 +1,95 @@
+#ifndef PREDICTOR_NGRAM_MODEL_H
+#define PREDICTOR_NGRAM_MODEL_H
+
+// The n-gram model: for a context of one or two dictionary word ids, the
+// words seen after it with their probabilities, read in place from a mapped
+// file in the format of NgramFormat.h. Like Dictionary, open() checks the
+// header and section table only; each list is bounds checked as it is read.
+//
+// Finding a context is a binary search over a sorted array of ids, and its
+// successors are one Elias-Fano list plus one byte each, read in order.
+
+#include <cstddef>
+#include <cstdint>
+
+#include "EliasFano.h"
+#include "MappedFile.h"
+#include "NgramFormat.h"
+
+namespace predictor {
+
+class NgramModel {
+public:
+    // The successors of one context, in word id order
+    class Successors {
+    public:
+        bool found() const { return found_; }
+        uint32_t size() const { return ids_.size(); }
+
+        // log10 weight of words not in the list, 0 if the context is unknown
+        float backoff() const { return backoff_; }
+
+        // The next successor and its log10 probability
+        bool next(uint32_t& wordId, float& logProbability);
+
+    private:
+        friend class NgramModel;
+
+        EliasFanoReader ids_;
+        const uint8_t* weights_ = nullptr;
+        const float* levels_ = nullptr;
+        uint32_t index_ = 0;
+        float backoff_ = 0;
+        bool found_ = false;
+    };
+
+    NgramModel() = default;
+    NgramModel(const NgramModel&) = delete;
+    NgramModel& operator=(const NgramModel&) = delete;
+
+    // Map and validate 'path', which must have been built against a
+    // dictionary of 'wordCount' words. On failure the model is left closed
+    // and error() says why.
+    bool open(const char* path, uint32_t wordCount);
+    void close();
+
+    bool isOpen() const { return file_.isOpen(); }
+    const char* error() const { return error_; }
+    size_t fileSize() const { return file_.size(); }
+
+    uint32_t wordCount() const { return wordCount_; }
+    uint64_t frequencyTotal() const { return frequencyTotal_; }
+    uint64_t bigramCount() const { return bigrams_.count; }
+    uint64_t trigramCount() const { return trigrams_.count; }
+
+    Successors bigram(uint32_t word) const;
+    Successors trigram(uint32_t word1, uint32_t word2) const;
+
+private:
+    struct Order {
+        const void* contexts = nullptr;
+        const NgramList* lists = nullptr;
+        const uint64_t* successors = nullptr;
+        const uint8_t* weights = nullptr;
+        const uint8_t* backoffs = nullptr;
+        uint32_t contextCount = 0;
+        uint64_t successorBits = 0;
+        uint64_t count = 0;
+    };
+
+    Successors successors(const Order& order, size_t context) const;
+    bool fail(const char* reason);
+
+    MappedFile file_;
+    Order bigrams_;
+    Order trigrams_;
+    const float* probabilityLevels_ = nullptr;
+    const float* backoffLevels_ = nullptr;
+    uint32_t wordCount_ = 0;
+    uint64_t frequencyTotal_ = 0;
+    const char* error_ = nullptr;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_NGRAM_MODEL_H
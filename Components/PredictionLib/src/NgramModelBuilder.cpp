@@ -0,0 +1,264 @@
+#include "NgramModelBuilder.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+#include "Dictionary.h"
+#include "EliasFano.h"
+#include "FileImage.h"
+#include "NgramFormat.h"
+
+namespace predictor {
+
+namespace {
+
+constexpr double kDiscount = 0.75;
+constexpr size_t kMergeThreshold = 1 << 16;
+
+bool sameWords(const uint32_t* a, const uint32_t* b)
+{
+    return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+}
+
+// 256 levels, each the median of an equal share of the sorted values
+std::vector<float> quantizationLevels(std::vector<float> values)
+{
+    std::vector<float> levels(256, 0.0f);
+    if (values.empty())
+        return levels;
+    std::sort(values.begin(), values.end());
+    for (size_t i = 0; i < levels.size(); i++) {
+        size_t begin = i * values.size() / levels.size();
+        size_t end = std::max(begin + 1, (i + 1) * values.size() / levels.size());
+        levels[i] = values[std::min(values.size() - 1, (begin + end - 1) / 2)];
+    }
+    return levels;
+}
+
+uint8_t quantize(const std::vector<float>& levels, float value)
+{
+    size_t above = static_cast<size_t>(std::lower_bound(levels.begin(), levels.end(), value) - levels.begin());
+    if (above == levels.size())
+        return static_cast<uint8_t>(above - 1);
+    if (above > 0 && value - levels[above - 1] < levels[above] - value)
+        above--;
+    return static_cast<uint8_t>(above);
+}
+
+// One order of the model before it is quantized and coded
+struct OrderData {
+    std::vector<uint64_t> contexts;     // word ids, two packed for trigrams
+    std::vector<uint32_t> listStarts;   // index of each context's first successor, then the end
+    std::vector<double> backoffs;       // per context
+    std::vector<uint32_t> successors;
+    std::vector<double> probabilities;  // per successor
+};
+
+} // namespace
+
+void NgramModelBuilder::addBigram(uint32_t word1, uint32_t word2, uint32_t count)
+{
+    uint32_t wordCount = dictionary_.wordCount();
+    if (word1 >= wordCount || word2 >= wordCount || count == 0)
+        return;
+    bigrams_.push_back({ { 0, word1, word2 }, count });
+    if (bigrams_.size() >= std::max(2 * mergedBigrams_, kMergeThreshold))
+        merge(bigrams_, mergedBigrams_);
+}
+
+void NgramModelBuilder::addTrigram(uint32_t word1, uint32_t word2, uint32_t word3, uint32_t count)
+{
+    uint32_t wordCount = dictionary_.wordCount();
+    if (word1 >= wordCount || word2 >= wordCount || word3 >= wordCount || count == 0)
+        return;
+    trigrams_.push_back({ { word1, word2, word3 }, count });
+    if (trigrams_.size() >= std::max(2 * mergedTrigrams_, kMergeThreshold))
+        merge(trigrams_, mergedTrigrams_);
+}
+
+void NgramModelBuilder::addSentence(const std::vector<int32_t>& wordIds)
+{
+    for (size_t i = 1; i < wordIds.size(); i++) {
+        if (wordIds[i] < 0 || wordIds[i - 1] < 0)
+            continue;
+        addBigram(static_cast<uint32_t>(wordIds[i - 1]), static_cast<uint32_t>(wordIds[i]));
+        if (i >= 2 && wordIds[i - 2] >= 0)
+            addTrigram(static_cast<uint32_t>(wordIds[i - 2]), static_cast<uint32_t>(wordIds[i - 1]),
+                       static_cast<uint32_t>(wordIds[i]));
+    }
+}
+
+// Sort and add up the counts of equal grams, keeping memory proportional to
+// the distinct ones
+void NgramModelBuilder::merge(std::vector<Gram>& grams, size_t& merged)
+{
+    std::sort(grams.begin(), grams.end(), [](const Gram& a, const Gram& b) {
+        return std::lexicographical_compare(a.words, a.words + 3, b.words, b.words + 3);
+    });
+    size_t out = 0;
+    for (size_t i = 0; i < grams.size(); i++) {
+        if (out > 0 && sameWords(grams[out - 1].words, grams[i].words))
+            grams[out - 1].count += grams[i].count;
+        else
+            grams[out++] = grams[i];
+    }
+    grams.resize(out);
+    merged = out;
+}
+
+std::vector<uint8_t> NgramModelBuilder::build()
+{
+    merge(bigrams_, mergedBigrams_);
+    merge(trigrams_, mergedTrigrams_);
+
+    uint32_t wordCount = dictionary_.wordCount();
+    uint64_t total = 0;
+    for (uint32_t id = 0; id < wordCount; id++)
+        total += std::max<uint32_t>(dictionary_.frequency(id), 1);
+    auto unigram = [&](uint32_t word) {
+        return static_cast<double>(std::max<uint32_t>(dictionary_.frequency(word), 1)) / static_cast<double>(total);
+    };
+
+    // Grams are sorted by context, then word. For each context c(a) counts
+    // every gram and N(a) every distinct successor, kept or not, and
+    //   P(w | a) = (c(a w) - D) / c(a) + D * N(a) / c(a) * P(w | shorter a)
+    // for the grams kept; words not kept back off to the shorter context
+    // with the weight that makes the distribution sum to one.
+    auto estimate = [&](const std::vector<Gram>& grams, bool trigram, auto lower, OrderData& out) {
+        for (size_t begin = 0, end; begin < grams.size(); begin = end) {
+            uint64_t context = trigram ? uint64_t(grams[begin].words[0]) << 32 | grams[begin].words[1]
+                                       : grams[begin].words[1];
+            uint64_t contextCount = 0;
+            for (end = begin; end < grams.size() && grams[end].words[0] == grams[begin].words[0] &&
+                              grams[end].words[1] == grams[begin].words[1]; end++)
+                contextCount += grams[end].count;
+
+            double count = static_cast<double>(contextCount);
+            double interpolation = kDiscount * static_cast<double>(end - begin) / count;
+            double keptProbability = 0, keptLower = 0;
+            size_t first = out.successors.size();
+            for (size_t i = begin; i < end; i++) {
+                if (grams[i].count < minimumCount_)
+                    continue;
+                double shorter = lower(grams[i].words[1], grams[i].words[2]);
+                double probability = (grams[i].count - kDiscount) / count + interpolation * shorter;
+                out.successors.push_back(grams[i].words[2]);
+                out.probabilities.push_back(probability);
+                keptProbability += probability;
+                keptLower += shorter;
+            }
+            if (out.successors.size() == first)
+                continue;
+            out.contexts.push_back(context);
+            out.listStarts.push_back(static_cast<uint32_t>(first));
+            out.backoffs.push_back(std::max(1 - keptProbability, 1e-12) / std::max(1 - keptLower, 1e-12));
+        }
+        out.listStarts.push_back(static_cast<uint32_t>(out.successors.size()));
+    };
+
+    OrderData bigrams, trigrams;
+    estimate(bigrams_, false, [&](uint32_t, uint32_t word) { return unigram(word); }, bigrams);
+
+    // P(w | b) as the model gives it: listed, backed off or unigram
+    auto bigramProbability = [&](uint32_t context, uint32_t word) {
+        auto found = std::lower_bound(bigrams.contexts.begin(), bigrams.contexts.end(), uint64_t(context));
+        if (found == bigrams.contexts.end() || *found != context)
+            return unigram(word);
+        size_t index = static_cast<size_t>(found - bigrams.contexts.begin());
+        auto begin = bigrams.successors.begin() + bigrams.listStarts[index];
+        auto end = bigrams.successors.begin() + bigrams.listStarts[index + 1];
+        auto successor = std::lower_bound(begin, end, word);
+        if (successor != end && *successor == word)
+            return bigrams.probabilities[static_cast<size_t>(successor - bigrams.successors.begin())];
+        return bigrams.backoffs[index] * unigram(word);
+    };
+    estimate(trigrams_, true, bigramProbability, trigrams);
+
+    // Quantize the log10 values, probabilities and backoffs separately
+    std::vector<float> logProbabilities, logBackoffs;
+    for (const OrderData* order : { &bigrams, &trigrams }) {
+        for (double probability : order->probabilities)
+            logProbabilities.push_back(static_cast<float>(std::log10(probability)));
+        for (double backoff : order->backoffs)
+            logBackoffs.push_back(static_cast<float>(std::log10(backoff)));
+    }
+    std::vector<float> probabilityLevels = quantizationLevels(logProbabilities);
+    std::vector<float> backoffLevels = quantizationLevels(logBackoffs);
+    std::vector<float> levels(probabilityLevels);
+    levels.insert(levels.end(), backoffLevels.begin(), backoffLevels.end());
+
+    // Code the successor lists
+    struct Coded {
+        std::vector<uint32_t> contexts32;
+        std::vector<NgramList> lists;
+        std::vector<uint8_t> weights;
+        std::vector<uint8_t> backoffs;
+        EliasFanoWriter successors;
+    } coded[2];
+    const OrderData* orders[2] = { &bigrams, &trigrams };
+    size_t probabilityIndex = 0, backoffIndex = 0;
+    for (int o = 0; o < 2; o++) {
+        const OrderData& order = *orders[o];
+        Coded& out = coded[o];
+        if (o == 0) {
+            for (uint64_t context : order.contexts)
+                out.contexts32.push_back(static_cast<uint32_t>(context));
+        }
+        for (size_t i = 0; i < order.contexts.size(); i++) {
+            NgramList list = {};
+            uint32_t first = order.listStarts[i], end = order.listStarts[i + 1];
+            list.bitOffset = static_cast<uint32_t>(
+                out.successors.append(order.successors.data() + first, end - first, wordCount));
+            list.first = first;
+            out.lists.push_back(list);
+            out.backoffs.push_back(quantize(backoffLevels, logBackoffs[backoffIndex++]));
+        }
+        if (out.successors.bitCount() > UINT32_MAX)
+            return std::vector<uint8_t>();     // beyond the 32-bit offsets of NgramList
+        NgramList last = {};
+        last.bitOffset = static_cast<uint32_t>(out.successors.bitCount());
+        last.first = static_cast<uint32_t>(order.successors.size());
+        out.lists.push_back(last);
+        for (size_t i = 0; i < order.successors.size(); i++)
+            out.weights.push_back(quantize(probabilityLevels, logProbabilities[probabilityIndex++]));
+    }
+
+    std::vector<SectionData> sections = {
+        { kNgramSectionLevels, levels.data(), levels.size() * sizeof(float) },
+        { kNgramSectionBigramContexts, coded[0].contexts32.data(), coded[0].contexts32.size() * sizeof(uint32_t) },
+        { kNgramSectionBigramLists, coded[0].lists.data(), coded[0].lists.size() * sizeof(NgramList) },
+        { kNgramSectionBigramSuccessors, coded[0].successors.words().data(),
+          coded[0].successors.words().size() * sizeof(uint64_t) },
+        { kNgramSectionBigramWeights, coded[0].weights.data(), coded[0].weights.size() },
+        { kNgramSectionBigramBackoffs, coded[0].backoffs.data(), coded[0].backoffs.size() },
+        { kNgramSectionTrigramContexts, trigrams.contexts.data(), trigrams.contexts.size() * sizeof(uint64_t) },
+        { kNgramSectionTrigramLists, coded[1].lists.data(), coded[1].lists.size() * sizeof(NgramList) },
+        { kNgramSectionTrigramSuccessors, coded[1].successors.words().data(),
+          coded[1].successors.words().size() * sizeof(uint64_t) },
+        { kNgramSectionTrigramWeights, coded[1].weights.data(), coded[1].weights.size() },
+        { kNgramSectionTrigramBackoffs, coded[1].backoffs.data(), coded[1].backoffs.size() },
+    };
+
+    NgramHeader header = {};
+    std::memcpy(header.magic, kNgramMagic, sizeof(header.magic));
+    header.version = kNgramVersion;
+    header.byteOrder = kByteOrderMark;
+    header.headerSize = sizeof(header);
+    header.wordCount = wordCount;
+    header.sectionCount = static_cast<uint32_t>(sections.size());
+    header.frequencyTotal = total;
+    header.bigramContexts = static_cast<uint32_t>(bigrams.contexts.size());
+    header.trigramContexts = static_cast<uint32_t>(trigrams.contexts.size());
+    header.bigrams = bigrams.successors.size();
+    header.trigrams = trigrams.successors.size();
+    return buildFileImage(&header, sizeof(header), sections);
+}
+
+bool NgramModelBuilder::write(const std::string& path)
+{
+    std::vector<uint8_t> image = build();
+    return !image.empty() && writeFileImage(path, image);
+}
+
+} // namespace predictor
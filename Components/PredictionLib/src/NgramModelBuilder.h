@@ -0,0 +1,61 @@
+#ifndef PREDICTOR_NGRAM_MODEL_BUILDER_H
+#define PREDICTOR_NGRAM_MODEL_BUILDER_H
+
+// Builds an n-gram model file (NgramFormat.h) from bigram and trigram
+// counts over the word ids of a dictionary. Used by tools/build_ngram_model
+// and the benchmarks; the keyboard only reads.
+//
+// Probabilities are interpolated absolute discounting with D = 0.75 over
+// unigram probabilities from the dictionary frequencies; the backoff weight
+// of a context is set so that its distribution sums to one.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace predictor {
+
+class Dictionary;
+
+class NgramModelBuilder {
+public:
+    explicit NgramModelBuilder(const Dictionary& dictionary) : dictionary_(dictionary) {}
+
+    void addBigram(uint32_t word1, uint32_t word2, uint32_t count = 1);
+    void addTrigram(uint32_t word1, uint32_t word2, uint32_t word3, uint32_t count = 1);
+
+    // Count the bigrams and trigrams of a sentence of word ids; -1, a word
+    // not in the dictionary, breaks the sequence
+    void addSentence(const std::vector<int32_t>& wordIds);
+
+    // N-grams seen fewer times are left out, their probability mass going to
+    // the backoff (default 1: all are kept)
+    void setMinimumCount(uint32_t count) { minimumCount_ = count; }
+
+    // The complete file image, or nothing if an order's successors take more
+    // than 2^32 bits
+    std::vector<uint8_t> build();
+
+    // build() and write it to 'path' through a temporary file
+    bool write(const std::string& path);
+
+private:
+    struct Gram {
+        uint32_t words[3];      // the context, then the word; words[0] unused for bigrams
+        uint32_t count;
+    };
+
+    static void merge(std::vector<Gram>& grams, size_t& merged);
+
+    const Dictionary& dictionary_;
+    std::vector<Gram> bigrams_;
+    std::vector<Gram> trigrams_;
+    size_t mergedBigrams_ = 0;      // size after the last merge, to merge again when it doubles
+    size_t mergedTrigrams_ = 0;
+    uint32_t minimumCount_ = 1;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_NGRAM_MODEL_BUILDER_H
@@ -0,0 +1,706 @@
+#include "Predictor.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdarg>
+#include <cstdio>
+#include <fstream>
+
+#include "ScriptConverter.h"
+
+namespace predictor {
+
+namespace {
+
+constexpr float kUserWordWeight = 4.0f;
+constexpr float kBigramWeight = 6.0f;
+constexpr float kTrigramWeight = 8.0f;
+
+float dictionaryScore(uint32_t frequency)
+{
+    return 1.0f + std::log2(1.0f + static_cast<float>(frequency));
+}
+
+// A probability from the n-gram model on the scale of dictionaryScore()
+float modelScore(float logProbability, uint64_t frequencyTotal)
+{
+    return 1.0f + static_cast<float>(std::log2(1.0 + std::pow(10.0, logProbability) * static_cast<double>(frequencyTotal)));
+}
+
+float countScore(uint32_t count, float weight)
+{
+    return count ? weight * std::log2(1.0f + static_cast<float>(count)) : 0.0f;
+}
+
+// Call 'entry' with the tab separated fields of each non-empty line of a
+// UTF-8 text file
+template <typename Entry>
+bool readTabSeparated(const char* path, Entry entry)
+{
+    if (!path)
+        return false;
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        return false;
+
+    std::string line;
+    Text text;
+    std::vector<TextView> fields;       // views into 'text'
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.size() >= 3 && line.compare(0, 3, "\xEF\xBB\xBF") == 0)
+            line.erase(0, 3);
+        if (line.empty())
+            continue;
+
+        text = fromUtf8(line);
+        fields.clear();
+        size_t start = 0;
+        for (;;) {
+            size_t tab = text.find(u'\t', start);
+            fields.push_back(TextView(text).substr(start, tab - start));
+            if (tab == Text::npos)
+                break;
+            start = tab + 1;
+        }
+        entry(fields);
+    }
+    return true;
+}
+
+} // namespace
+
+Predictor::Predictor(bool debug)
+    : debug_(debug), blacklist_(dictionary_), search_(dictionary_), fuzzy_(dictionary_, layout_), anjal_(dictionary_)
+{
+    search_.setBlacklist(&blacklist_);
+    fuzzy_.setBlacklist(&blacklist_);
+    anjal_.setBlacklist(&blacklist_);
+}
+
+bool Predictor::loadDictionary(const char* path)
+{
+    cache_.clear();
+    bool opened = dictionary_.open(path);
+    blacklist_.reindex();
+    if (!opened) {
+        log("cannot open dictionary %s: %s", path ? path : "(null)", dictionary_.error());
+        return false;
+    }
+    log("dictionary %s: %u words, %u nodes, %zu bytes", path, dictionary_.wordCount(),
+        dictionary_.nodeCount(), dictionary_.fileSize());
+    return true;
+}
+
+bool Predictor::setUserDictionary(const char* path)
+{
+    cache_.clear();
+    if (!path || !*path || !user_.open(path)) {
+        log("cannot open user dictionary %s", path ? path : "(null)");
+        return false;
+    }
+    log("user dictionary %s: %zu words", path, user_.wordCount());
+    return true;
+}
+
+bool Predictor::loadNgramModel(const char* path)
+{
+    if (!dictionary_.isOpen() || !model_.open(path, dictionary_.wordCount())) {
+        log("cannot open n-gram model %s: %s", path ? path : "(null)",
+            dictionary_.isOpen() ? model_.error() : "no dictionary");
+        return false;
+    }
+    log("n-gram model %s: %llu bigrams, %llu trigrams, %zu bytes", path,
+        static_cast<unsigned long long>(model_.bigramCount()), static_cast<unsigned long long>(model_.trigramCount()),
+        model_.fileSize());
+    return true;
+}
+
+bool Predictor::loadAnnotations(const char* path)
+{
+    cache_.invalidateAnnotated();
+    if (!dictionary_.isOpen() || !annotationStore_.open(path, dictionary_.wordCount())) {
+        log("cannot open annotations %s: %s", path ? path : "(null)",
+            dictionary_.isOpen() ? annotationStore_.error() : "no dictionary");
+        return false;
+    }
+    log("annotations %s: %u words, %zu bytes", path, annotationStore_.annotatedCount(), annotationStore_.fileSize());
+    return true;
+}
+
+bool Predictor::loadKeyLayout(const char* path, float aspectRatio)
+{
+    if (!layout_.load(path, aspectRatio)) {
+        log("cannot read key layout %s: %s", path ? path : "(null)", layout_.error());
+        return false;
+    }
+    log("key layout %s: %zu keys", path, layout_.keyCount());
+    return true;
+}
+
+// Dictionary words are blacklisted by id, other words by their spelling
+bool Predictor::isSuppressed(const Scored& entry) const
+{
+    TextView word = textOf(entry);
+    if (entry.wordId >= 0 ? blacklist_.contains(static_cast<uint32_t>(entry.wordId)) : blacklist_.contains(word))
+        return true;
+    return user_.isRemoved(word);
+}
+
+void Predictor::setCancellation(const std::atomic<bool>* cancelled)
+{
+    cancelled_ = cancelled;
+    search_.setCancellation(cancelled);
+    fuzzy_.setCancellation(cancelled);
+    anjal_.setCancellation(cancelled);
+}
+
+void Predictor::beginQuery()
+{
+    work_.text.clear();
+    work_.learned.clear();
+    work_.learnedIds.clear();
+    work_.modelled.clear();
+    work_.ranked.clear();
+    work_.results.clear();
+}
+
+TextView Predictor::textOf(const Scored& entry) const
+{
+    return TextView(work_.text).substr(entry.text, entry.length);
+}
+
+// A learned word scored with its dictionary frequency plus 'boost', spelled
+// in the workspace
+Predictor::Scored Predictor::learnedWord(TextView word, float boost)
+{
+    int32_t id = dictionary_.lookup(word);
+    uint32_t frequency = id >= 0 ? dictionary_.frequency(static_cast<uint32_t>(id)) : 0;
+    Scored entry = { static_cast<uint32_t>(work_.text.size()), static_cast<uint32_t>(word.size()), id, frequency,
+                     dictionaryScore(frequency) + boost, true };
+    work_.text.append(word);
+    return entry;
+}
+
+bool Predictor::ranksBefore(const Scored& a, const Scored& b) const
+{
+    if (a.score != b.score)
+        return a.score > b.score;
+    if (a.frequency != b.frequency)
+        return a.frequency > b.frequency;
+    if (a.wordId != b.wordId)
+        return static_cast<uint32_t>(a.wordId) < static_cast<uint32_t>(b.wordId);
+    if (a.text == kNoText || b.text == kNoText)
+        return false;
+    return textOf(a) < textOf(b);
+}
+
+bool Predictor::take(Scored& entry, bool unique)
+{
+    if (entry.text == kNoText) {
+        entry.text = static_cast<uint32_t>(work_.text.size());
+        dictionary_.appendWord(static_cast<uint32_t>(entry.wordId), work_.text);
+        entry.length = static_cast<uint32_t>(work_.text.size() - entry.text);
+    }
+    if (isSuppressed(entry))
+        return false;
+    TextView word = textOf(entry);
+    if (unique && std::any_of(work_.ranked.begin(), work_.ranked.end(),
+                              [&](const Scored& ranked) { return textOf(ranked) == word; }))
+        return false;
+    work_.ranked.push_back(entry);
+    return true;
+}
+
+void Predictor::rankCompletions(TextView prefix, CompletionSearch& search, size_t maxResults)
+{
+    // Learned words carry a boost on top of their frequency, so they are
+    // scored apart and merged into the dictionary's frequency order
+    std::vector<Scored>& learned = work_.learned;
+    std::vector<int32_t>& learnedIds = work_.learnedIds;
+    learned.clear();
+    learnedIds.clear();
+    if (userDictionaryEnabled()) {
+        user_.forEachCompletion(prefix, [this](TextView word, uint32_t count) {
+            work_.learned.push_back(learnedWord(word, countScore(count, kUserWordWeight)));
+            if (work_.learned.back().wordId >= 0)
+                work_.learnedIds.push_back(work_.learned.back().wordId);
+        });
+        std::sort(learned.begin(), learned.end(), [this](const Scored& a, const Scored& b) { return ranksBefore(a, b); });
+        std::sort(learnedIds.begin(), learnedIds.end());
+    }
+
+    bool unique = !work_.ranked.empty();
+    size_t before = work_.ranked.size();
+    size_t expanded = search.expanded();
+    size_t nextLearned = 0;
+    Scored pending;
+    bool havePending = false;
+    while (work_.ranked.size() < maxResults) {
+        uint32_t id;
+        while (!havePending && search.next(id)) {
+            if (std::binary_search(learnedIds.begin(), learnedIds.end(), static_cast<int32_t>(id)))
+                continue;
+            uint32_t frequency = dictionary_.frequency(id);
+            pending = { kNoText, 0, static_cast<int32_t>(id), frequency, dictionaryScore(frequency), false };
+            havePending = true;
+        }
+
+        Scored* best;
+        if (nextLearned < learned.size() && (!havePending || ranksBefore(learned[nextLearned], pending)))
+            best = &learned[nextLearned++];
+        else if (havePending)
+            best = &pending, havePending = false;
+        else
+            break;
+        if (best->score < config_.scoreThreshold)
+            break;
+        take(*best, unique);
+    }
+
+    if (debug_)
+        log("completions of %s: %zu, %zu trie nodes expanded", toUtf8(prefix).c_str(), work_.ranked.size() - before,
+            search.expanded() - expanded);
+}
+
+void Predictor::insertShortcut(TextView expansion, size_t position, size_t maxResults)
+{
+    if (expansion.empty())
+        return;
+    std::vector<Scored>& ranked = work_.ranked;
+    if (std::any_of(ranked.begin(), ranked.begin() + static_cast<std::ptrdiff_t>(position),
+                    [&](const Scored& entry) { return textOf(entry) == expansion; }))
+        return;
+
+    float score = (position < ranked.size() ? ranked[position].score : 1.0f) + 1.0f;
+    Scored entry = { static_cast<uint32_t>(work_.text.size()), static_cast<uint32_t>(expansion.size()),
+                     dictionary_.lookup(expansion), 0, score, true };
+    work_.text.append(expansion);
+    ranked.insert(ranked.begin() + static_cast<std::ptrdiff_t>(position), entry);
+    if (ranked.size() > maxResults)
+        ranked.pop_back();
+}
+
+const std::vector<Candidate>& Predictor::render(TargetScript script, AnnotationDataType annotation)
+{
+    // Converted words go after the spellings, all in one call. Room for them
+    // is reserved up front, so the workspace does not move and views into it
+    // stay valid.
+    Text& text = work_.text;
+    size_t converted = text.size();
+    if (script != Tamil) {
+        size_t needed = text.size();
+        for (const Scored& entry : work_.ranked)
+            needed += entry.length * 2;
+        text.reserve(needed);
+        work_.spellings.clear();
+        for (const Scored& entry : work_.ranked)
+            work_.spellings.push_back(textOf(entry));
+        work_.ends.resize(work_.ranked.size());
+        appendScripts(work_.spellings.data(), work_.spellings.size(), script, text, work_.ends.data());
+    }
+
+    for (size_t i = 0; i < work_.ranked.size(); i++) {
+        const Scored& entry = work_.ranked[i];
+        TextView tamil = textOf(entry);
+        Candidate candidate;
+        if (script == Tamil) {
+            candidate.word = tamil;
+        } else {
+            candidate.word = TextView(text).substr(converted, work_.ends[i] - converted);
+            converted = work_.ends[i];
+        }
+        candidate.frequency = entry.frequency;
+        candidate.wordId = entry.wordId;
+        candidate.score = entry.score;
+        candidate.userWord = entry.userWord;
+        candidate.isEmoji = isEmoji(tamil);
+        if (annotation != NotRequired)
+            candidate.annotation = findAnnotation(entry.wordId, tamil, annotation);
+        work_.results.push_back(candidate);
+    }
+    return work_.results;
+}
+
+TextView Predictor::findAnnotation(int32_t wordId, TextView word, AnnotationDataType type) const
+{
+    if (type != Meaning && type != Transliteration)
+        return TextView();
+    auto it = annotations_.find(word);
+    if (it != annotations_.end())
+        return type == Meaning ? it->second.meaning : it->second.transliteration;
+    if (wordId >= 0 && annotationsUsable())
+        return annotationStore_.lookup(static_cast<uint32_t>(wordId), type);
+    return TextView();
+}
+
+TextView Predictor::annotation(int32_t wordId, AnnotationDataType type) const
+{
+    if (wordId < 0 || !dictionary_.isOpen() || static_cast<uint32_t>(wordId) >= dictionary_.wordCount())
+        return TextView();
+    // Spelt only when there are imports to search by spelling
+    if (annotations_.empty())
+        return findAnnotation(wordId, TextView(), type);
+    return findAnnotation(wordId, dictionary_.word(static_cast<uint32_t>(wordId)), type);
+}
+
+bool Predictor::findCached(TextView prefix, TargetScript script, AnnotationDataType annotation, size_t maxResults)
+{
+    if (!cache_.find({ prefix, script, annotation, maxResults }, work_.text, work_.results))
+        return false;
+    if (debug_)
+        log("completions of %s: %zu, cached", toUtf8(prefix).c_str(), work_.results.size());
+    return true;
+}
+
+// Keep the rendered results, unless the query was cut short
+const std::vector<Candidate>& Predictor::cache(TextView prefix, TargetScript script, AnnotationDataType annotation,
+                                               size_t maxResults)
+{
+    if (cancelled())
+        return work_.results;
+    work_.spellings.clear();
+    for (const Scored& entry : work_.ranked)
+        work_.spellings.push_back(textOf(entry));
+    cache_.insert({ prefix, script, annotation, maxResults }, work_.results, work_.spellings);
+    return work_.results;
+}
+
+const std::vector<Candidate>& Predictor::wordPredictions(TextView prefix, TargetScript script,
+                                                         AnnotationDataType annotation, size_t maxResults)
+{
+    beginQuery();
+    if (maxResults == 0)
+        return work_.results;
+
+    if (findCached(prefix, script, annotation, maxResults))
+        return work_.results;
+
+    search_.start(dictionary_.findNode(prefix));
+    rankCompletions(prefix, search_, maxResults);
+    insertShortcut(shortcutOf(prefix), 0, maxResults);
+    render(script, annotation);
+    return cache(prefix, script, annotation, maxResults);
+}
+
+const std::vector<Candidate>& Predictor::cursorPredictions(PrefixCursor& cursor, TargetScript script,
+                                                           AnnotationDataType annotation, size_t maxResults)
+{
+    beginQuery();
+    if (maxResults == 0)
+        return work_.results;
+
+    if (findCached(cursor.text(), script, annotation, maxResults))
+        return work_.results;
+
+    rankCompletions(cursor.text(), cursor.search(&blacklist_), maxResults);
+    insertShortcut(shortcuts_.expansion(cursor.shortcut(shortcuts_)), 0, maxResults);
+    render(script, annotation);
+    return cache(cursor.text(), script, annotation, maxResults);
+}
+
+const std::vector<Candidate>& Predictor::fuzzyPredictions(TextView prefix, float tolerance, TargetScript script,
+                                                          AnnotationDataType annotation, size_t maxResults)
+{
+    beginQuery();
+    if (maxResults == 0)
+        return work_.results;
+
+    fuzzy_.start(prefix, tolerance);
+    uint32_t id;
+    float cost;
+    while (work_.ranked.size() < maxResults && fuzzy_.next(id, cost)) {
+        uint32_t frequency = dictionary_.frequency(id);
+        Scored entry = { kNoText, 0, static_cast<int32_t>(id), frequency,
+                         dictionaryScore(frequency) - FuzzySearch::kEditPenalty * cost, false };
+        if (entry.score < config_.scoreThreshold)
+            break;
+        take(entry, false);
+    }
+    insertShortcut(shortcutOf(prefix), 0, maxResults);
+
+    if (debug_)
+        log("fuzzy completions of %s: %zu, %zu anchors, %zu trie nodes read%s", toUtf8(prefix).c_str(),
+            work_.ranked.size(), fuzzy_.anchorCount(), fuzzy_.expanded(),
+            fuzzy_.budgetSpent() ? ", budget spent" : "");
+    return render(script, annotation);
+}
+
+const std::vector<Candidate>& Predictor::anjalPredictions(std::string_view keys, TargetScript script,
+                                                          AnnotationDataType annotation, size_t maxResults)
+{
+    beginQuery();
+    if (maxResults == 0)
+        return work_.results;
+
+    anjal_.start(keys);
+    uint32_t id;
+    float cost;
+    while (work_.ranked.size() < maxResults && anjal_.next(id, cost)) {
+        uint32_t frequency = dictionary_.frequency(id);
+        Scored entry = { kNoText, 0, static_cast<int32_t>(id), frequency,
+                         dictionaryScore(frequency) - AnjalSearch::kOtherPenalty * cost, false };
+        if (entry.score < config_.scoreThreshold)
+            break;
+        take(entry, false);
+    }
+
+    if (debug_)
+        log("Anjal completions of %.*s: %zu, %zu anchors, %zu trie nodes read%s", static_cast<int>(keys.size()),
+            keys.data(), work_.ranked.size(), anjal_.anchorCount(), anjal_.expanded(),
+            anjal_.budgetSpent() ? ", budget spent" : "");
+    return render(script, annotation);
+}
+
+const std::vector<Candidate>& Predictor::ngramPredictions(TextView word1, TextView word2, TextView prefix,
+                                                          TargetScript script, AnnotationDataType annotation,
+                                                          size_t maxResults)
+{
+    beginQuery();
+    if (maxResults == 0)
+        return work_.results;
+
+    // Words seen after the context, each scored once with both boosts
+    std::vector<Scored>& following = work_.learned;
+    if (userDictionaryEnabled()) {
+        if (!word1.empty() && !word2.empty()) {
+            user_.forEachTrigram(word1, word2, prefix, [this](TextView word, uint32_t count) {
+                work_.learned.push_back(learnedWord(word, countScore(count, kTrigramWeight)));
+            });
+        }
+        TextView previous = word2.empty() ? word1 : word2;
+        if (!previous.empty()) {
+            user_.forEachBigram(previous, prefix, [this](TextView word, uint32_t count) {
+                float boost = countScore(count, kBigramWeight);
+                for (Scored& entry : work_.learned) {
+                    if (textOf(entry) == word) {
+                        entry.score += boost;
+                        return;
+                    }
+                }
+                work_.learned.push_back(learnedWord(word, boost));
+            });
+        }
+    }
+    if (modelUsable())
+        addModelPredictions(word1, word2, prefix, maxResults);
+    std::sort(following.begin(), following.end(), [this](const Scored& a, const Scored& b) { return ranksBefore(a, b); });
+
+    size_t fromContext = following.size();
+    for (Scored& entry : following) {
+        if (work_.ranked.size() == maxResults || entry.score < config_.scoreThreshold)
+            break;
+        take(entry, false);
+    }
+
+    // Top up with plain completions, which rank below anything the context
+    // predicted
+    size_t contextRanked = work_.ranked.size();
+    if (contextRanked < maxResults) {
+        search_.start(dictionary_.findNode(prefix));
+        rankCompletions(prefix, search_, maxResults);
+        insertShortcut(shortcutOf(prefix), contextRanked, maxResults);
+    }
+
+    if (debug_)
+        log("ngram predictions after %s %s for %s: %zu from context, %zu in all", toUtf8(word1).c_str(),
+            toUtf8(word2).c_str(), toUtf8(prefix).c_str(), fromContext, work_.ranked.size());
+    return render(script, annotation);
+}
+
+void Predictor::addModelPredictions(TextView word1, TextView word2, TextView prefix, size_t maxResults)
+{
+    TextView previous = word2.empty() ? word1 : word2;
+    int32_t id2 = previous.empty() ? -1 : dictionary_.lookup(previous);
+    int32_t id1 = word2.empty() || word1.empty() ? -1 : dictionary_.lookup(word1);
+    if (id2 < 0)
+        return;
+    NgramModel::Successors bigram = model_.bigram(static_cast<uint32_t>(id2));
+    NgramModel::Successors trigram =
+        id1 >= 0 ? model_.trigram(static_cast<uint32_t>(id1), static_cast<uint32_t>(id2)) : NgramModel::Successors();
+    if (!bigram.found() && !trigram.found())
+        return;
+
+    // Words starting with the prefix are a few id ranges, walked alongside
+    // the successors, which come in id order
+    std::vector<std::pair<uint32_t, uint32_t>>& ranges = work_.prefixIds;
+    uint32_t node = dictionary_.findNode(prefix);
+    if (node == Dictionary::kNoNode)
+        return;
+    dictionary_.subtreeWordRanges(node, ranges);
+
+    std::vector<Scored>& learned = work_.learned;
+    std::vector<int32_t>& learnedIds = work_.learnedIds;
+    learnedIds.clear();
+    for (const Scored& entry : learned) {
+        if (entry.wordId >= 0)
+            learnedIds.push_back(entry.wordId);
+    }
+    std::sort(learnedIds.begin(), learnedIds.end());
+
+    std::vector<Modelled>& modelled = work_.modelled;
+    size_t range = 0, fromModel = 0;
+    uint32_t triId = 0, biId = 0;
+    float triLog = 0, biLog = 0;
+    bool haveTri = trigram.next(triId, triLog), haveBi = bigram.next(biId, biLog);
+    while ((haveTri || haveBi) && !cancelled()) {
+        // Merge the two lists; a word only the bigram lists backs off from
+        // the trigram context
+        uint32_t id;
+        float logProbability;
+        if (haveTri && (!haveBi || triId <= biId)) {
+            id = triId, logProbability = triLog;
+            if (haveBi && biId == triId)
+                haveBi = bigram.next(biId, biLog);
+            haveTri = trigram.next(triId, triLog);
+        } else {
+            id = biId, logProbability = trigram.backoff() + biLog;
+            haveBi = bigram.next(biId, biLog);
+        }
+
+        while (range < ranges.size() && ranges[range].second <= id)
+            range++;
+        if (range == ranges.size())
+            break;
+        if (id < ranges[range].first)
+            continue;
+        fromModel++;
+
+        if (std::binary_search(learnedIds.begin(), learnedIds.end(), static_cast<int32_t>(id))) {
+            float score = modelScore(logProbability, model_.frequencyTotal());
+            for (Scored& entry : learned) {
+                if (entry.wordId == static_cast<int32_t>(id))
+                    entry.score += score - dictionaryScore(entry.frequency);
+            }
+            continue;
+        }
+
+        // Keep the best maxResults, scored once chosen: the heap's top is
+        // the worst of them
+        if (modelled.size() == maxResults && logProbability < modelled.front().logProbability)
+            continue;
+        Modelled entry = { logProbability, dictionary_.frequency(id), id };
+        if (modelled.size() < maxResults) {
+            modelled.push_back(entry);
+            std::push_heap(modelled.begin(), modelled.end());
+        } else if (entry < modelled.front()) {
+            std::pop_heap(modelled.begin(), modelled.end());
+            modelled.back() = entry;
+            std::push_heap(modelled.begin(), modelled.end());
+        }
+    }
+    for (const Modelled& entry : modelled) {
+        learned.push_back({ kNoText, 0, static_cast<int32_t>(entry.wordId), entry.frequency,
+                            modelScore(entry.logProbability, model_.frequencyTotal()), false });
+    }
+
+    if (debug_)
+        log("n-gram model after %s %s for %s: %zu successors, %zu kept", toUtf8(word1).c_str(),
+            toUtf8(word2).c_str(), toUtf8(prefix).c_str(), fromModel, modelled.size());
+}
+
+void Predictor::addWord(TextView word)
+{
+    if (!userDictionaryEnabled())
+        return;
+    user_.addWord(word);
+    int32_t id = dictionary_.lookup(word);
+    uint32_t frequency = id >= 0 ? dictionary_.frequency(static_cast<uint32_t>(id)) : 0;
+    cache_.invalidate({ word, dictionaryScore(frequency) + countScore(user_.count(word), kUserWordWeight), false });
+}
+
+void Predictor::addBigram(TextView word1, TextView word2)
+{
+    if (userDictionaryEnabled())
+        user_.addBigram(word1, word2);
+}
+
+void Predictor::addTrigram(TextView word1, TextView word2, TextView word3)
+{
+    if (userDictionaryEnabled())
+        user_.addTrigram(word1, word2, word3);
+}
+
+bool Predictor::removeWord(TextView word)
+{
+    bool removed = user_.isOpen() && user_.removeWord(word);
+    if (dictionary_.lookup(word) >= 0) {
+        // Remembered in the user dictionary so that it stays removed;
+        // without one it lasts for this session
+        if (user_.isOpen())
+            user_.setRemoved(word, true);
+        else
+            blacklist_.add(word);
+        removed = true;
+    }
+    if (removed)
+        cache_.invalidate({ word, 0, true });
+    log("remove %s: %s", toUtf8(word).c_str(), removed ? "removed" : "not found");
+    return removed;
+}
+
+bool Predictor::importAnnotations(const char* path, size_t& count)
+{
+    count = 0;
+    bool read = readTabSeparated(path, [&](const std::vector<TextView>& fields) {
+        if (fields.size() < 2 || fields[0].empty())
+            return;
+        auto found = annotations_.find(fields[0]);
+        Annotation& entry = found != annotations_.end() ? found->second : annotations_[Text(fields[0])];
+        entry.meaning = fields[1];
+        entry.transliteration = fields.size() > 2 ? fields[2] : TextView();
+        count++;
+    });
+    if (count > 0)
+        cache_.invalidateAnnotated();
+    return read;
+}
+
+bool Predictor::importShortcuts(const char* path, size_t& count)
+{
+    count = 0;
+    return readTabSeparated(path, [&](const std::vector<TextView>& fields) {
+        if (fields.size() < 2 || fields[0].empty() || fields[1].empty())
+            return;
+        shortcuts_.insert(fields[0], fields[1]);
+        cache_.invalidate(fields[0]);
+        count++;
+    });
+}
+
+bool Predictor::importBlacklist(const char* path, size_t& count)
+{
+    count = 0;
+    bool stems = false;
+    bool read = readTabSeparated(path, [&](const std::vector<TextView>& fields) {
+        TextView word = fields[0];
+        if (word.size() > 1 && word.back() == u'*') {
+            if (blacklist_.addStem(word.substr(0, word.size() - 1))) {
+                stems = true;
+                count++;
+            }
+        } else if (blacklist_.add(word)) {
+            cache_.invalidate({ word, 0, true });
+            count++;
+        }
+    });
+    // A stem may take out words cached under any prefix
+    if (stems)
+        cache_.clear();
+    return read;
+}
+
+void Predictor::log(const char* format, ...) const
+{
+    if (!debug_)
+        return;
+    va_list args;
+    va_start(args, format);
+    std::fputs("[Predictor] ", stderr);
+    std::vfprintf(stderr, format, args);
+    std::fputc('\n', stderr);
+    va_end(args);
+}
+
+} // namespace predictor
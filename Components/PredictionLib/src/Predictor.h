@@ -0,0 +1,292 @@
+#ifndef PREDICTOR_PREDICTOR_H
+#define PREDICTOR_PREDICTOR_H
+
+// The predictor behind predictor_c_api.h: completions from the main
+// dictionary and the user dictionary, next-word predictions from learned
+// word sequences and the n-gram model, the annotations of a mapped file and
+// of text imports, and the imported shortcuts and blacklist.
+//
+// All text is UTF-16 (see Utf16.h). Scores are 1 + log2(1 + frequency) for
+// dictionary words, so every word scores at least 1, plus a weighted
+// log2(1 + count) for each time the user typed it or typed it after the
+// same context. With an n-gram model, a word predicted from the context
+// takes 1 + log2(1 + P(word | context) * total frequency) in place of its
+// dictionary score, so both are on the scale of frequencies.
+//
+// Queries allocate nothing once warmed up: candidates are built in a
+// workspace owned by the predictor, whose buffers keep their capacity from
+// one query to the next, and are returned as views into it. A predictor
+// therefore serves one thread at a time. A query running for a result no
+// longer wanted can be stopped early from another thread through the flag
+// given to setCancellation().
+//
+// Completions of recent prefixes are kept in a ResultCache, and the changes
+// that can reorder them drop the entries they affect.
+//
+// Blacklisted words are left out by the searches themselves (see Blacklist),
+// which skip a listed word by its id and never expand a listed stem.
+//
+// Fuzzy completions take the prefix as typed with slips (see FuzzySearch):
+// a word scores its dictionary score less FuzzySearch::kEditPenalty per unit
+// of edit cost, letters typed for their neighbours on the loaded key layout
+// costing less than others. They rank dictionary words alone, uncached.
+//
+// Anjal completions take the Latin keys typed on the Anjal keyboard and
+// search every Tamil reading of them (see AnjalSearch): a word scores its
+// dictionary score less AnjalSearch::kOtherPenalty for each letter read as
+// another typed alike. They rank dictionary words alone, uncached.
+//
+// Annotations are looked up for the candidates returned and only when asked
+// for, or one word at a time through annotation(), so that a keyboard shows
+// them for the words on screen. Text imports take precedence over the
+// mapped file (see AnnotationStore), which costs nothing until read.
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "AnjalSearch.h"
+#include "AnnotationStore.h"
+#include "Blacklist.h"
+#include "CompletionSearch.h"
+#include "Dictionary.h"
+#include "FuzzySearch.h"
+#include "KeyLayout.h"
+#include "NgramModel.h"
+#include "PrefixCursor.h"
+#include "ResultCache.h"
+#include "ScriptConverterStructs.h"
+#include "ShortcutTrie.h"
+#include "UserDictionary.h"
+#include "Utf16.h"
+
+namespace predictor {
+
+struct PredictorConfig {
+    bool allowVariations = false;
+    bool enableUserDictionary = true;
+    float scoreThreshold = 1.0f;    // candidates scoring lower are dropped
+};
+
+// Views into the predictor, valid until its next query or change
+struct Candidate {
+    TextView word;                  // in the requested script
+    TextView annotation;            // empty if none or not requested
+    double frequency = 0;           // main dictionary frequency
+    int32_t wordId = -1;            // main dictionary id, -1 if not in it
+    float score = 0;
+    bool userWord = false;
+    bool isEmoji = false;
+};
+
+class Predictor {
+public:
+    explicit Predictor(bool debug);
+    Predictor(const Predictor&) = delete;
+    Predictor& operator=(const Predictor&) = delete;
+
+    bool loadDictionary(const char* path);
+    bool setUserDictionary(const char* path);
+
+    // Learned words reach the disk in batches; this writes and syncs what is
+    // pending. Returns false if that failed or there is no user dictionary.
+    bool flushUserDictionary() { return user_.isOpen() && user_.flush(); }
+
+    // The n-gram model built against the loaded dictionary (see
+    // NgramModelBuilder.h); ignored once another dictionary is loaded
+    bool loadNgramModel(const char* path);
+    // The annotations built against the loaded dictionary (see
+    // AnnotationStoreBuilder.h); ignored once another dictionary is loaded
+    bool loadAnnotations(const char* path);
+    // The keyboard layout JSON whose key positions price slips in fuzzy
+    // completions (see KeyLayout.h); without one every slip is a whole edit
+    bool loadKeyLayout(const char* path, float aspectRatio);
+
+    void configure(const PredictorConfig& config)
+    {
+        config_ = config;
+        cache_.clear();
+    }
+    void setDebug(bool debug) { debug_ = debug; }
+
+    // Cut queries short once '*cancelled' turns true, nullptr for never. A
+    // query cut short returns what it ranked so far, which the caller
+    // should drop.
+    void setCancellation(const std::atomic<bool>* cancelled);
+
+    const std::vector<Candidate>& wordPredictions(TextView prefix, TargetScript script,
+                                                  AnnotationDataType annotation, size_t maxResults);
+
+    // Words likely to follow 'word1' 'word2' and start with 'prefix'. Either
+    // context word may be empty; the list is topped up with completions of
+    // 'prefix' when the context has too few.
+    const std::vector<Candidate>& ngramPredictions(TextView word1, TextView word2, TextView prefix,
+                                                   TargetScript script, AnnotationDataType annotation,
+                                                   size_t maxResults);
+
+    // Completions of the cursor's text, ranked as wordPredictions() ranks
+    // them, carrying on the trie search the cursor kept from earlier
+    // keystrokes. The cursor must be over this predictor's dictionary().
+    const std::vector<Candidate>& cursorPredictions(PrefixCursor& cursor, TargetScript script,
+                                                    AnnotationDataType annotation, size_t maxResults);
+
+    // Completions of words starting within 'tolerance' of 'prefix', a whole
+    // edit costing 1 and a slip to a neighbouring key KeyLayout::kNearCost
+    const std::vector<Candidate>& fuzzyPredictions(TextView prefix, float tolerance, TargetScript script,
+                                                   AnnotationDataType annotation, size_t maxResults);
+
+    // Completions of the Tamil words the Anjal 'keys' may have been typed for
+    const std::vector<Candidate>& anjalPredictions(std::string_view keys, TargetScript script,
+                                                   AnnotationDataType annotation, size_t maxResults);
+
+    const Dictionary& dictionary() const { return dictionary_; }
+
+    // Bytes the result cache may hold, 0 to turn it off
+    void setCacheBudget(size_t bytes) { cache_.setBudget(bytes); }
+    ResultCache::Stats cacheStats() const { return cache_.stats(); }
+
+    void addWord(TextView word);
+    void addBigram(TextView word1, TextView word2);
+    void addTrigram(TextView word1, TextView word2, TextView word3);
+
+    // Stop suggesting 'word'. Returns false if it is neither learned nor in
+    // the main dictionary.
+    bool removeWord(TextView word);
+
+    // Text file imports, one entry per line, fields separated by tabs:
+    //   annotations  word, meaning[, transliteration]
+    //   shortcuts    shortcut, expansion
+    //   blacklist    word, or stem* for every word starting with stem
+    // Each returns false if the file cannot be read and counts the entries
+    // taken from it.
+    bool importAnnotations(const char* path, size_t& count);
+    bool importShortcuts(const char* path, size_t& count);
+    bool importBlacklist(const char* path, size_t& count);
+
+    // Annotations imported and in the mapped file; a word in both counts twice
+    size_t annotationCount() const
+    {
+        return annotations_.size() + (annotationsUsable() ? annotationStore_.annotatedCount() : 0);
+    }
+
+    // The meaning or transliteration of the word with dictionary id
+    // 'wordId', empty if it has none. The view is NUL terminated and valid
+    // until annotations are next loaded or imported.
+    TextView annotation(int32_t wordId, AnnotationDataType type) const;
+
+private:
+    // A candidate before it is rendered: word ids and scores only, so the
+    // text of words that do not make the list is never built
+    struct Scored {
+        uint32_t text;              // Tamil spelling in the workspace, once needed
+        uint32_t length;
+        int32_t wordId;
+        uint32_t frequency;
+        float score;
+        bool userWord;
+    };
+    static constexpr uint32_t kNoText = UINT32_MAX;
+
+    // A word the n-gram model predicts, before it is scored
+    struct Modelled {
+        float logProbability;
+        uint32_t frequency;
+        uint32_t wordId;
+
+        // Better first: more probable, then more frequent, then lower id
+        bool operator<(const Modelled& other) const
+        {
+            if (logProbability != other.logProbability)
+                return logProbability > other.logProbability;
+            if (frequency != other.frequency)
+                return frequency > other.frequency;
+            return wordId < other.wordId;
+        }
+    };
+
+    struct Annotation {
+        Text meaning;
+        Text transliteration;
+    };
+
+    // Storage reused by every query
+    struct Workspace {
+        Text text;                          // spellings and rendered words
+        std::vector<Scored> learned;        // learned completions or context words
+        std::vector<int32_t> learnedIds;    // their dictionary ids, sorted
+        std::vector<Modelled> modelled;     // best words the model alone predicts, a heap
+        std::vector<std::pair<uint32_t, uint32_t>> prefixIds;   // word id ranges under the prefix
+        std::vector<Scored> ranked;
+        std::vector<Candidate> results;
+        std::vector<TextView> spellings;    // of the results, for the cache
+        std::vector<size_t> ends;           // of the converted words in text
+    };
+
+    void beginQuery();
+    TextView textOf(const Scored& entry) const;
+    Scored learnedWord(TextView word, float boost);
+    bool ranksBefore(const Scored& a, const Scored& b) const;
+
+    // Append completions of 'prefix' to the ranked list in rank order until
+    // it holds 'maxResults', leaving out suppressed words, those under the
+    // score threshold and those already in the list. 'search' is at the
+    // first word below the node of 'prefix'.
+    void rankCompletions(TextView prefix, CompletionSearch& search, size_t maxResults);
+
+    // Put the expansion of the shortcut typed, if any, at 'position' of the
+    // ranked list, scored above the entry it displaces
+    void insertShortcut(TextView expansion, size_t position, size_t maxResults);
+    TextView shortcutOf(TextView prefix) const { return shortcuts_.expansion(shortcuts_.find(prefix)); }
+
+    // Append 'entry' to the ranked list unless it is suppressed or, when
+    // 'unique', already there
+    bool take(Scored& entry, bool unique);
+    bool isSuppressed(const Scored& entry) const;
+    const std::vector<Candidate>& render(TargetScript script, AnnotationDataType annotation);
+    bool findCached(TextView prefix, TargetScript script, AnnotationDataType annotation, size_t maxResults);
+    const std::vector<Candidate>& cache(TextView prefix, TargetScript script, AnnotationDataType annotation,
+                                        size_t maxResults);
+    bool cancelled() const { return cancelled_ && cancelled_->load(std::memory_order_relaxed); }
+    bool userDictionaryEnabled() const { return config_.enableUserDictionary && user_.isOpen(); }
+    bool modelUsable() const { return model_.isOpen() && model_.wordCount() == dictionary_.wordCount(); }
+    bool annotationsUsable() const
+    {
+        return annotationStore_.isOpen() && annotationStore_.wordCount() == dictionary_.wordCount();
+    }
+    TextView findAnnotation(int32_t wordId, TextView word, AnnotationDataType type) const;
+
+    // Score the model's successors of the context that start with 'prefix':
+    // learned words in the workspace are rescored, and the best of the rest
+    // added to it
+    void addModelPredictions(TextView word1, TextView word2, TextView prefix, size_t maxResults);
+    void log(const char* format, ...) const;
+
+    Dictionary dictionary_;
+    UserDictionary user_;
+    NgramModel model_;
+    AnnotationStore annotationStore_;
+    PredictorConfig config_;
+    bool debug_;
+
+    // An ordered map, which is searched by view without building a key
+    std::map<Text, Annotation, std::less<>> annotations_;
+    Blacklist blacklist_;
+
+    ShortcutTrie shortcuts_;
+
+    CompletionSearch search_;
+    KeyLayout layout_;
+    FuzzySearch fuzzy_;
+    AnjalSearch anjal_;
+    Workspace work_;
+    ResultCache cache_;
+    const std::atomic<bool>* cancelled_ = nullptr;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_PREDICTOR_H
@@ -0,0 +1,110 @@
+#include "PrefixCursor.h"
+
+#include <algorithm>
+
+namespace predictor {
+
+PrefixCursor::PrefixCursor(const Dictionary& dictionary)
+    : dictionary_(dictionary), generation_(dictionary.generation())
+{
+    levels_.emplace_back(dictionary);
+    levels_[0].node = dictionary.isOpen() ? Dictionary::kRoot : Dictionary::kNoNode;
+}
+
+void PrefixCursor::push(size_t length, uint32_t node)
+{
+    if (depth_ == levels_.size())
+        levels_.emplace_back(dictionary_);
+    Level& level = levels_[depth_++];
+    level.length = length;
+    level.node = node;
+    level.searched = false;
+    level.shortcutGeneration = 0;
+}
+
+void PrefixCursor::extend(TextView text)
+{
+    revalidate();
+    for (size_t i = 0; i < text.size();) {
+        size_t start = i;
+        nextCodePoint(text, i);
+        uint32_t node = levels_[depth_ - 1].node;
+        for (size_t j = start; j < i && node != Dictionary::kNoNode; j++)
+            node = dictionary_.child(node, text[j]);
+        text_.append(text.substr(start, i - start));
+        push(text_.size(), node);
+    }
+}
+
+size_t PrefixCursor::retract(size_t codePoints)
+{
+    size_t removed = std::min(codePoints, depth_ - 1);
+    depth_ -= removed;
+    text_.resize(levels_[depth_ - 1].length);
+    return removed;
+}
+
+void PrefixCursor::reset()
+{
+    retract(depth_ - 1);
+}
+
+CompletionSearch& PrefixCursor::search(const Blacklist* blacklist)
+{
+    revalidate();
+    Level& top = levels_[depth_ - 1];
+    top.search.setBlacklist(blacklist);
+    if (!top.searched) {
+        // Carry on from the longest shorter prefix that was searched
+        size_t searched = depth_ - 1;
+        while (searched > 0 && !levels_[searched - 1].searched)
+            searched--;
+        if (searched > 0) {
+            top.search = levels_[searched - 1].search;
+            top.search.setBlacklist(blacklist);
+            top.search.narrow(top.node);
+        } else {
+            top.search.start(top.node);
+        }
+        top.searched = true;
+    }
+    top.search.rewind();
+    return top.search;
+}
+
+uint32_t PrefixCursor::shortcut(const ShortcutTrie& shortcuts)
+{
+    // The empty text is always at the root
+    size_t known = depth_ - 1;
+    while (known > 0 && levels_[known].shortcutGeneration != shortcuts.generation())
+        known--;
+    for (size_t d = known + 1; d < depth_; d++) {
+        uint32_t node = levels_[d - 1].shortcut;
+        for (size_t j = levels_[d - 1].length; j < levels_[d].length; j++)
+            node = shortcuts.child(node, text_[j]);
+        levels_[d].shortcut = node;
+        levels_[d].shortcutGeneration = shortcuts.generation();
+    }
+    return levels_[depth_ - 1].shortcut;
+}
+
+// Walk the text again and drop every search once the dictionary was
+// reopened, as their node numbers are of the old file
+void PrefixCursor::revalidate()
+{
+    if (generation_ == dictionary_.generation())
+        return;
+    generation_ = dictionary_.generation();
+
+    levels_[0].node = dictionary_.isOpen() ? Dictionary::kRoot : Dictionary::kNoNode;
+    levels_[0].searched = false;
+    for (size_t d = 1; d < depth_; d++) {
+        uint32_t node = levels_[d - 1].node;
+        for (size_t j = levels_[d - 1].length; j < levels_[d].length && node != Dictionary::kNoNode; j++)
+            node = dictionary_.child(node, text_[j]);
+        levels_[d].node = node;
+        levels_[d].searched = false;
+    }
+}
+
+} // namespace predictor
@@ -0,0 +1,73 @@
+#ifndef PREDICTOR_PREFIX_CURSOR_H
+#define PREDICTOR_PREFIX_CURSOR_H
+
+// The word being typed, kept across keystrokes: its trie node after every
+// code point, and the completion search of each prefix that was queried.
+//
+// Typing walks on from the last node and backspace steps back to an earlier
+// one, so neither re-walks the trie from the root. The first query after
+// typing narrows the search of the longest queried prefix to the new node
+// (see CompletionSearch::narrow) instead of starting afresh, and a query
+// after backspace finds the search of that prefix where it was left.
+//
+// The node the text reaches in the shortcut trie is kept the same way,
+// found when first asked for by following the units typed since the last
+// level that knows it.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "CompletionSearch.h"
+#include "Dictionary.h"
+#include "ShortcutTrie.h"
+#include "Utf16.h"
+
+namespace predictor {
+
+class PrefixCursor {
+public:
+    explicit PrefixCursor(const Dictionary& dictionary);
+
+    void extend(TextView text);
+
+    // Remove the last 'codePoints' code points, or all there are; returns how
+    // many were removed
+    size_t retract(size_t codePoints);
+    void reset();
+
+    TextView text() const { return text_; }
+
+    // The search below the text's node, rewound to its first word, leaving
+    // out the words of 'blacklist' if not nullptr
+    CompletionSearch& search(const Blacklist* blacklist = nullptr);
+
+    // The text's node in 'shortcuts', ShortcutTrie::kNoNode if no shortcut
+    // starts with it. A cursor is used with one trie.
+    uint32_t shortcut(const ShortcutTrie& shortcuts);
+
+private:
+    struct Level {
+        explicit Level(const Dictionary& dictionary) : search(dictionary) {}
+
+        size_t length = 0;          // of the text up to here
+        uint32_t node = Dictionary::kRoot;
+        bool searched = false;      // whether 'search' is this prefix's
+        uint32_t shortcut = ShortcutTrie::kRoot;
+        uint32_t shortcutGeneration = 0;    // of the trie when 'shortcut' was found, 0 if not yet
+        CompletionSearch search;
+    };
+
+    void push(size_t length, uint32_t node);
+    void revalidate();
+
+    const Dictionary& dictionary_;
+    uint32_t generation_;
+    Text text_;
+    std::vector<Level> levels_;     // the empty prefix first, then one per code point
+    size_t depth_ = 1;              // levels in use; the others keep their storage
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_PREFIX_CURSOR_H
@@ -0,0 +1,291 @@
+#include "ResultCache.h"
+
+#include "Predictor.h"
+
+namespace predictor {
+
+uint32_t ResultCache::hashOf(TextView text)
+{
+    uint32_t hash = hashStart();
+    for (char16_t unit : text)
+        hash = hashNext(hash, unit);
+    return hash;
+}
+
+// Storage a string holds outside itself; short ones hold none
+size_t ResultCache::heapBytes(const Text& text)
+{
+    static const size_t inPlace = Text().capacity();
+    return text.capacity() > inPlace ? (text.capacity() + 1) * sizeof(char16_t) : 0;
+}
+
+void ResultCache::setUp()
+{
+    if (!entries_.empty())
+        return;
+    entries_.resize(kMaxEntries);
+    index_.assign(kIndexSize, kEmpty);
+    free_.reserve(kMaxEntries);
+    for (size_t slot = kMaxEntries; slot > 0; slot--)
+        free_.push_back(static_cast<uint32_t>(slot - 1));
+    hand_ = 0;
+}
+
+void ResultCache::setBudget(size_t bytes)
+{
+    budget_ = bytes;
+    if (budget_ == 0) {
+        std::vector<Entry>().swap(entries_);
+        std::vector<uint32_t>().swap(index_);
+        std::vector<uint32_t>().swap(free_);
+        bytes_ = 0;
+        return;
+    }
+    trim();
+}
+
+bool ResultCache::find(const Key& key, Text& text, std::vector<Candidate>& results)
+{
+    if (budget_ == 0)
+        return false;
+    uint32_t hash = hashOf(key.prefix);
+    for (size_t i = hash & (kIndexSize - 1); !index_.empty() && index_[i] != kEmpty; i = (i + 1) & (kIndexSize - 1)) {
+        Entry& entry = entries_[index_[i]];
+        if (entry.hash != hash || entry.script != key.script || entry.annotation != key.annotation ||
+            entry.maxResults != key.maxResults || entry.prefix != key.prefix)
+            continue;
+
+        entry.referenced = true;
+        stats_.hits++;
+        text.assign(entry.text);
+        results.clear();
+        TextView stored(text);
+        for (const Stored& candidate : entry.candidates) {
+            Candidate result;
+            result.word = stored.substr(candidate.word, candidate.wordLength);
+            if (candidate.annotationLength > 0)
+                result.annotation = stored.substr(candidate.annotation, candidate.annotationLength);
+            result.frequency = candidate.frequency;
+            result.wordId = candidate.wordId;
+            result.score = candidate.score;
+            result.userWord = candidate.userWord;
+            result.isEmoji = candidate.isEmoji;
+            results.push_back(result);
+        }
+        return true;
+    }
+    stats_.misses++;
+    return false;
+}
+
+void ResultCache::insert(const Key& key, const std::vector<Candidate>& results, const std::vector<TextView>& spellings)
+{
+    if (budget_ == 0)
+        return;
+    setUp();
+    uint32_t slot;
+    if (!free_.empty()) {
+        slot = free_.back();
+        free_.pop_back();
+    } else {
+        slot = victim();
+        erase(slot);
+        free_.pop_back();
+        stats_.evicted++;
+    }
+
+    Entry& entry = entries_[slot];
+    entry.prefix.assign(key.prefix);
+    entry.script = key.script;
+    entry.annotation = key.annotation;
+    entry.maxResults = key.maxResults;
+    entry.text.clear();
+    entry.candidates.clear();
+    for (size_t i = 0; i < results.size(); i++) {
+        const Candidate& result = results[i];
+        Stored candidate;
+        candidate.word = static_cast<uint32_t>(entry.text.size());
+        candidate.wordLength = static_cast<uint32_t>(result.word.size());
+        entry.text.append(result.word);
+        candidate.spelling = candidate.word;
+        candidate.spellingLength = static_cast<uint32_t>(spellings[i].size());
+        if (key.script != Tamil) {
+            candidate.spelling = static_cast<uint32_t>(entry.text.size());
+            entry.text.append(spellings[i]);
+        }
+        candidate.annotation = static_cast<uint32_t>(entry.text.size());
+        candidate.annotationLength = static_cast<uint32_t>(result.annotation.size());
+        entry.text.append(result.annotation);
+        candidate.frequency = result.frequency;
+        candidate.wordId = result.wordId;
+        candidate.score = result.score;
+        candidate.userWord = result.userWord;
+        candidate.isEmoji = result.isEmoji;
+        entry.candidates.push_back(candidate);
+    }
+    entry.hash = hashOf(key.prefix);
+    entry.used = true;
+    entry.referenced = true;
+    place(slot);
+    account(slot);
+    trim();
+}
+
+void ResultCache::invalidate(TextView prefix)
+{
+    if (!index_.empty())
+        invalidate(prefix, hashOf(prefix), nullptr);
+}
+
+void ResultCache::invalidate(const Change& change)
+{
+    if (index_.empty())
+        return;
+    uint32_t hash = hashStart();
+    for (size_t length = 0;; length++) {
+        invalidate(change.word.substr(0, length), hash, &change);
+        if (length == change.word.size())
+            break;
+        hash = hashNext(hash, change.word[length]);
+    }
+}
+
+// Drop the entries of 'prefix', all of them or those 'change' reorders
+void ResultCache::invalidate(TextView prefix, uint32_t hash, const Change* change)
+{
+    // Erasing shifts the rest of the run back, so look again from its start
+    for (bool erased = true; erased;) {
+        erased = false;
+        for (size_t i = hash & (kIndexSize - 1); index_[i] != kEmpty; i = (i + 1) & (kIndexSize - 1)) {
+            const Entry& entry = entries_[index_[i]];
+            if (entry.hash == hash && entry.prefix == prefix && (!change || reorders(entry, *change))) {
+                erase(index_[i]);
+                stats_.invalidated++;
+                erased = true;
+                break;
+            }
+        }
+    }
+}
+
+// The results are in rank order, bar a shortcut's expansion put first, and
+// the other results keep their scores, so a word not listed only gets in by
+// reaching the last one. Ties are taken as getting in.
+bool ResultCache::reorders(const Entry& entry, const Change& change)
+{
+    TextView text(entry.text);
+    for (const Stored& candidate : entry.candidates) {
+        if (text.substr(candidate.spelling, candidate.spellingLength) == change.word)
+            return true;
+    }
+    if (change.removed)
+        return false;
+    return entry.candidates.size() < entry.maxResults || change.score >= entry.candidates.back().score;
+}
+
+void ResultCache::invalidateAnnotated()
+{
+    for (size_t slot = 0; slot < entries_.size(); slot++) {
+        if (entries_[slot].used && entries_[slot].annotation != NotRequired) {
+            erase(static_cast<uint32_t>(slot));
+            stats_.invalidated++;
+        }
+    }
+}
+
+void ResultCache::clear()
+{
+    for (size_t slot = 0; slot < entries_.size(); slot++) {
+        if (entries_[slot].used) {
+            erase(static_cast<uint32_t>(slot));
+            stats_.invalidated++;
+        }
+    }
+}
+
+ResultCache::Stats ResultCache::stats() const
+{
+    Stats stats = stats_;
+    stats.entries = entries_.size() - free_.size();
+    stats.bytes = bytes_;
+    return stats;
+}
+
+void ResultCache::place(uint32_t slot)
+{
+    size_t i = entries_[slot].hash & (kIndexSize - 1);
+    while (index_[i] != kEmpty)
+        i = (i + 1) & (kIndexSize - 1);
+    index_[i] = slot;
+}
+
+// Take the entry out of the index, moving back each later entry of the run
+// that may sit where it was, so that no probe run has a gap
+void ResultCache::erase(uint32_t slot)
+{
+    constexpr size_t mask = kIndexSize - 1;
+    Entry& entry = entries_[slot];
+    size_t i = entry.hash & mask;
+    while (index_[i] != slot)
+        i = (i + 1) & mask;
+    for (size_t j = (i + 1) & mask; index_[j] != kEmpty; j = (j + 1) & mask) {
+        size_t home = entries_[index_[j]].hash & mask;
+        if (((j - home) & mask) >= ((j - i) & mask)) {
+            index_[i] = index_[j];
+            i = j;
+        }
+    }
+    index_[i] = kEmpty;
+    entry.used = false;
+    free_.push_back(slot);
+}
+
+void ResultCache::release(uint32_t slot)
+{
+    Entry& entry = entries_[slot];
+    Text().swap(entry.prefix);
+    Text().swap(entry.text);
+    std::vector<Stored>().swap(entry.candidates);
+    account(slot);
+}
+
+void ResultCache::account(uint32_t slot)
+{
+    Entry& entry = entries_[slot];
+    size_t bytes = heapBytes(entry.prefix) + heapBytes(entry.text) + entry.candidates.capacity() * sizeof(Stored);
+    bytes_ = bytes_ - entry.bytes + bytes;
+    entry.bytes = bytes;
+}
+
+// Within the budget again: the storage kept by free slots goes first, then
+// entries in CLOCK order
+void ResultCache::trim()
+{
+    for (size_t i = 0; i < free_.size() && bytes_ > budget_; i++)
+        release(free_[i]);
+    while (bytes_ > budget_ && free_.size() < entries_.size()) {
+        uint32_t slot = victim();
+        erase(slot);
+        release(slot);
+        stats_.evicted++;
+    }
+}
+
+// The next entry in use the hand finds unmarked, unmarking those it passes
+uint32_t ResultCache::victim()
+{
+    for (;;) {
+        Entry& entry = entries_[hand_];
+        uint32_t slot = static_cast<uint32_t>(hand_);
+        hand_ = (hand_ + 1) % entries_.size();
+        if (!entry.used)
+            continue;
+        if (entry.referenced) {
+            entry.referenced = false;
+            continue;
+        }
+        return slot;
+    }
+}
+
+} // namespace predictor
@@ -0,0 +1,146 @@
+#ifndef PREDICTOR_RESULT_CACHE_H
+#define PREDICTOR_RESULT_CACHE_H
+
+// Rendered completions of recent prefixes, so that a prefix typed again
+// after backspace, or queried again after a word is committed, costs a
+// lookup instead of a search.
+//
+// Entries are keyed by prefix, script, annotation type and result count,
+// and hold copies of the candidates and their text. At most kMaxEntries
+// are kept, their text and candidates in at most the byte budget, which
+// also counts the storage dropped entries leave for the next. CLOCK picks
+// which to drop: an entry is marked when added and on each hit, and the
+// hand goes round unmarking entries until it finds one unmarked.
+//
+// The index is an open-addressing table hashed on the prefix alone, so all
+// entries of one prefix are in one probe run. A word can only appear in
+// the completions of its own prefixes, so a change to one word looks at
+// those entries alone, and drops those whose results it enters, leaves or
+// moves in: the ones listing it, and when it gains score the ones not full
+// or whose last result it now reaches.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ScriptConverterStructs.h"
+#include "Utf16.h"
+
+namespace predictor {
+
+struct Candidate;
+
+class ResultCache {
+public:
+    static constexpr size_t kMaxEntries = 1024;
+    static constexpr size_t kDefaultBudget = 512 * 1024;
+
+    struct Key {
+        TextView prefix;
+        TargetScript script;
+        AnnotationDataType annotation;
+        size_t maxResults;
+    };
+
+    struct Stats {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t invalidated = 0;       // entries dropped as the ranking changed
+        uint64_t evicted = 0;           // entries dropped for room
+        size_t entries = 0;
+        size_t bytes = 0;
+    };
+
+    ResultCache() = default;
+    ResultCache(const ResultCache&) = delete;
+    ResultCache& operator=(const ResultCache&) = delete;
+
+    // Bytes the cache may hold; 0 turns it off and frees what it holds
+    void setBudget(size_t bytes);
+
+    // On a hit, the candidates go to 'results' as views into 'text', both
+    // cleared first
+    bool find(const Key& key, Text& text, std::vector<Candidate>& results);
+
+    // Add the results of a key find() missed, with the Tamil spelling of
+    // each result
+    void insert(const Key& key, const std::vector<Candidate>& results, const std::vector<TextView>& spellings);
+
+    // A word learned, with the score it now has, or no longer suggested
+    struct Change {
+        TextView word;              // Tamil spelling
+        float score;
+        bool removed;
+    };
+
+    // Drop the entries of 'prefix'
+    void invalidate(TextView prefix);
+
+    // Drop the entries the change reorders
+    void invalidate(const Change& change);
+
+    // Drop the entries with annotations
+    void invalidateAnnotated();
+
+    void clear();
+
+    Stats stats() const;
+
+private:
+    struct Stored {
+        uint32_t word;              // offsets and lengths in the entry's text
+        uint32_t wordLength;
+        uint32_t spelling;          // Tamil, the same as the word in Tamil entries
+        uint32_t spellingLength;
+        uint32_t annotation;
+        uint32_t annotationLength;
+        double frequency;
+        int32_t wordId;
+        float score;
+        bool userWord;
+        bool isEmoji;
+    };
+
+    struct Entry {
+        Text prefix;
+        TargetScript script = Tamil;
+        AnnotationDataType annotation = NotRequired;
+        size_t maxResults = 0;
+        Text text;
+        std::vector<Stored> candidates;
+        uint32_t hash = 0;
+        size_t bytes = 0;           // of storage held
+        bool used = false;
+        bool referenced = false;
+    };
+
+    static constexpr uint32_t kEmpty = UINT32_MAX;
+    static constexpr size_t kIndexSize = kMaxEntries * 2;      // a power of two, at most half full
+
+    static uint32_t hashStart() { return 2166136261u; }
+    static uint32_t hashNext(uint32_t hash, char16_t unit) { return (hash ^ unit) * 16777619u; }
+    static uint32_t hashOf(TextView text);
+    static size_t heapBytes(const Text& text);
+
+    void setUp();
+    void place(uint32_t slot);
+    void erase(uint32_t slot);
+    void release(uint32_t slot);
+    void account(uint32_t slot);
+    void trim();
+    void invalidate(TextView prefix, uint32_t hash, const Change* change);
+    static bool reorders(const Entry& entry, const Change& change);
+    uint32_t victim();
+
+    std::vector<Entry> entries_;
+    std::vector<uint32_t> index_;       // entry numbers, kEmpty where free
+    std::vector<uint32_t> free_;        // entry numbers not in use
+    size_t hand_ = 0;
+    size_t budget_ = kDefaultBudget;
+    size_t bytes_ = 0;
+    Stats stats_;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_RESULT_CACHE_H
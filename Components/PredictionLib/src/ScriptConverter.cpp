@@ -0,0 +1,429 @@
+#include "ScriptConverter.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <map>
+#include <vector>
+
+namespace predictor {
+
+namespace {
+
+// Brahmi code point for each character of the Tamil block (U+0B80-U+0BFF),
+// 0 where Tamil has nothing to map
+const char32_t kTamilToBrahmi[128] = {
+    // 0B80
+    0, 0, 0x11001, 0x11002, 0, 0x11005, 0x11006, 0x11007,
+    0x11008, 0x11009, 0x1100A, 0, 0, 0, 0x11071, 0x1100F,
+    // 0B90
+    0x11010, 0, 0x11072, 0x11011, 0x11012, 0x11013, 0, 0,
+    0, 0x11017, 0x11018, 0, 0x1101A, 0, 0x1101C, 0x1101D,
+    // 0BA0
+    0, 0, 0, 0x11021, 0x11022, 0, 0, 0,
+    0x11026, 0x11037, 0x11027, 0, 0, 0, 0x1102B, 0x1102C,
+    // 0BB0
+    0x1102D, 0x11036, 0x1102E, 0x11034, 0x11035, 0x1102F, 0x11030, 0x11031,
+    0x11032, 0x11033, 0, 0, 0, 0, 0x11038, 0x1103A,
+    // 0BC0
+    0x1103B, 0x1103C, 0x1103D, 0, 0, 0, 0x11073, 0x11042,
+    0x11043, 0, 0x11074, 0x11044, 0x11045, 0x11046, 0, 0,
+    // 0BD0
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    // 0BE0
+    0, 0, 0, 0, 0, 0, 0x11066, 0x11067,
+    0x11068, 0x11069, 0x1106A, 0x1106B, 0x1106C, 0x1106D, 0x1106E, 0x1106F,
+    // 0BF0
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+constexpr char16_t kTamilFirst = 0x0B80;
+constexpr size_t kTamilSize = 128;
+
+bool isTamil(char16_t unit)
+{
+    return unit >= kTamilFirst && unit < kTamilFirst + kTamilSize;
+}
+
+// Where a rule holds
+enum Context : uint8_t {
+    kAnywhere = 0,
+    kWordStart = 1,
+    kWordEnd = 2,
+};
+
+struct Rule {
+    Text from;
+    Text to;
+    uint8_t context;
+};
+
+// Tamil letters and their readings in a script, for the generated rules
+struct Letter {
+    char16_t tamil;
+    const char16_t* text;
+};
+
+const char16_t kPulli = 0x0BCD;
+
+// Consonants with no sign carry the inherent a; in ISO 15919
+const Letter kLatinConsonants[] = {
+    { u'க', u"k" }, { u'ங', u"ṅ" }, { u'ச', u"c" }, { u'ஜ', u"j" }, { u'ஞ', u"ñ" }, { u'ட', u"ṭ" },
+    { u'ண', u"ṇ" }, { u'த', u"t" }, { u'ந', u"n" }, { u'ன', u"ṉ" }, { u'ப', u"p" }, { u'ம', u"m" },
+    { u'ய', u"y" }, { u'ர', u"r" }, { u'ற', u"ṟ" }, { u'ல', u"l" }, { u'ள', u"ḷ" }, { u'ழ', u"ḻ" },
+    { u'வ', u"v" }, { u'ஶ', u"ś" }, { u'ஷ', u"ṣ" }, { u'ஸ', u"s" }, { u'ஹ', u"h" },
+};
+const Letter kLatinVowels[] = {
+    { u'அ', u"a" }, { u'ஆ', u"ā" }, { u'இ', u"i" }, { u'ஈ', u"ī" }, { u'உ', u"u" }, { u'ஊ', u"ū" },
+    { u'எ', u"e" }, { u'ஏ', u"ē" }, { u'ஐ', u"ai" }, { u'ஒ', u"o" }, { u'ஓ', u"ō" }, { u'ஔ', u"au" },
+    { u'ஃ', u"ḵ" },
+};
+const Letter kLatinSigns[] = {
+    { u'ா', u"ā" }, { u'ி', u"i" }, { u'ீ', u"ī" }, { u'ு', u"u" }, { u'ூ', u"ū" }, { u'ெ', u"e" },
+    { u'ே', u"ē" }, { u'ை', u"ai" }, { u'ொ', u"o" }, { u'ோ', u"ō" }, { u'ௌ', u"au" }, { u'ௗ', u"au" },
+};
+
+// Arwi letters for the consonants
+const Letter kJawiConsonants[] = {
+    { u'க', u"ك" }, { u'ங', u"ڠ" }, { u'ச', u"چ" }, { u'ஜ', u"ج" }, { u'ஞ', u"ڽ" }, { u'ட', u"ڊ" },
+    { u'ண', u"ڼ" }, { u'த', u"ت" }, { u'ந', u"ن" }, { u'ன', u"ن" }, { u'ப', u"ڤ" }, { u'ம', u"م" },
+    { u'ய', u"ي" }, { u'ர', u"ر" }, { u'ற', u"ڔ" }, { u'ல', u"ل" }, { u'ள', u"ڸ" }, { u'ழ', u"ژ" },
+    { u'வ', u"و" }, { u'ஶ', u"ش" }, { u'ஷ', u"ش" }, { u'ஸ', u"س" }, { u'ஹ', u"ه" },
+};
+const Letter kJawiSigns[] = {
+    { u'ா', u"ا" }, { u'ி', u"ي" }, { u'ீ', u"ي" }, { u'ு', u"و" }, { u'ூ', u"و" }, { u'ெ', u"ي" },
+    { u'ே', u"ي" }, { u'ை', u"اي" }, { u'ொ', u"و" }, { u'ோ', u"و" }, { u'ௌ', u"او" }, { u'ௗ', u"و" },
+    { kPulli, u"" },
+};
+// Independent vowels: on an alif to start a word, on a hamza seat within one
+const Letter kJawiInitialVowels[] = {
+    { u'அ', u"ا" }, { u'ஆ', u"ا" }, { u'இ', u"اي" }, { u'ஈ', u"اي" }, { u'உ', u"او" }, { u'ஊ', u"او" },
+    { u'எ', u"اي" }, { u'ஏ', u"اي" }, { u'ஐ', u"اي" }, { u'ஒ', u"او" }, { u'ஓ', u"او" }, { u'ஔ', u"او" },
+};
+const Letter kJawiMedialVowels[] = {
+    { u'அ', u"ا" }, { u'ஆ', u"ا" }, { u'இ', u"ئ" }, { u'ஈ', u"ئ" }, { u'உ', u"ؤ" }, { u'ஊ', u"ؤ" },
+    { u'எ', u"ئ" }, { u'ஏ', u"ئ" }, { u'ஐ', u"ئ" }, { u'ஒ', u"ؤ" }, { u'ஓ', u"ؤ" }, { u'ஔ', u"ؤ" },
+};
+
+// Grantha letters as the native ones Vatteluttu writes for them, and the
+// two part signs as their parts
+const Letter kVatteluttuReplacements[] = {
+    { u'ஜ', u"ச" }, { u'ஶ', u"ச" }, { u'ஷ', u"ட" }, { u'ஸ', u"ச" }, { u'ஹ', u"க" },
+    { u'ொ', u"\u0BC6\u0BBE" }, { u'ோ', u"\u0BC7\u0BBE" }, { u'ௌ', u"\u0BC6\u0BD7" },
+};
+
+Text textOf(char16_t unit)
+{
+    return Text(1, unit);
+}
+
+std::vector<Rule> brahmiRules()
+{
+    std::vector<Rule> rules;
+    for (size_t i = 0; i < kTamilSize; i++) {
+        if (!kTamilToBrahmi[i])
+            continue;
+        Text to;
+        appendCodePoint(to, kTamilToBrahmi[i]);
+        rules.push_back({ textOf(static_cast<char16_t>(kTamilFirst + i)), to, kAnywhere });
+    }
+    return rules;
+}
+
+std::vector<Rule> vatteluttuRules()
+{
+    auto shifted = [](const char16_t* tamil) {
+        Text text;
+        for (const char16_t* unit = tamil; *unit; unit++)
+            text += static_cast<char16_t>(kVatteluttuBase + (*unit - kTamilFirst));
+        return text;
+    };
+    std::vector<Rule> rules;
+    for (const Letter& letter : kVatteluttuReplacements)
+        rules.push_back({ textOf(letter.tamil), shifted(letter.text), kAnywhere });
+    for (size_t i = 0; i < kTamilSize; i++) {
+        char16_t unit = static_cast<char16_t>(kTamilFirst + i);
+        bool replaced = std::any_of(std::begin(kVatteluttuReplacements), std::end(kVatteluttuReplacements),
+                                    [&](const Letter& letter) { return letter.tamil == unit; });
+        if (!replaced)
+            rules.push_back({ textOf(unit), textOf(static_cast<char16_t>(kVatteluttuBase + i)), kAnywhere });
+    }
+    return rules;
+}
+
+std::vector<Rule> latinRules()
+{
+    std::vector<Rule> rules;
+    for (const Letter& consonant : kLatinConsonants) {
+        for (const Letter& sign : kLatinSigns)
+            rules.push_back({ Text{ consonant.tamil, sign.tamil }, Text(consonant.text) + sign.text, kAnywhere });
+        rules.push_back({ Text{ consonant.tamil, kPulli }, consonant.text, kAnywhere });
+        rules.push_back({ textOf(consonant.tamil), Text(consonant.text) + u"a", kAnywhere });
+    }
+    for (const Letter& vowel : kLatinVowels)
+        rules.push_back({ textOf(vowel.tamil), vowel.text, kAnywhere });
+    for (char16_t digit = 0x0BE6; digit <= 0x0BEF; digit++)
+        rules.push_back({ textOf(digit), textOf(static_cast<char16_t>(u'0' + (digit - 0x0BE6))), kAnywhere });
+    return rules;
+}
+
+std::vector<Rule> jawiRules()
+{
+    std::vector<Rule> rules;
+    for (const Letter& consonant : kJawiConsonants) {
+        rules.push_back({ textOf(consonant.tamil), Text(consonant.text) + u"ا", kWordEnd });
+        rules.push_back({ textOf(consonant.tamil), consonant.text, kAnywhere });
+    }
+    for (const Letter& sign : kJawiSigns)
+        rules.push_back({ textOf(sign.tamil), sign.text, kAnywhere });
+    for (const Letter& vowel : kJawiInitialVowels)
+        rules.push_back({ textOf(vowel.tamil), vowel.text, kWordStart });
+    for (const Letter& vowel : kJawiMedialVowels)
+        rules.push_back({ textOf(vowel.tamil), vowel.text, kAnywhere });
+    for (char16_t digit = 0x0BE6; digit <= 0x0BEF; digit++)
+        rules.push_back({ textOf(digit), textOf(static_cast<char16_t>(0x0660 + (digit - 0x0BE6))), kAnywhere });
+    return rules;
+}
+
+class CompiledScript {
+public:
+    explicit CompiledScript(const std::vector<Rule>& rules);
+
+    void append(TextView tamil, Text& out) const;
+
+private:
+    struct Node {
+        uint32_t row;           // of transitions in rows_, or kNoRow for a leaf
+        uint32_t firstOutput;
+        uint32_t outputCount;
+    };
+
+    static constexpr uint32_t kNoRow = UINT32_MAX;
+
+    struct Output {
+        uint8_t context;
+        uint32_t text;          // into text_
+        uint32_t length;
+    };
+
+    // How a Tamil block unit is read: through the flat table, or the trie
+    enum Way : uint8_t { kFlat, kWalk };
+
+    uint32_t child(uint32_t node, char16_t unit) const;
+    static bool holds(uint8_t context, TextView tamil, size_t start, size_t end);
+
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> rows_;                // kTamilSize transitions a row, 0 for none
+    std::vector<Output> outputs_;
+    Text text_;
+    Way ways_[kTamilSize];
+    uint32_t roots_[kTamilSize];                // the node of each unit
+    char16_t flat_[kTamilSize][2];              // what kFlat units map to
+    uint8_t flatLength_[kTamilSize];
+};
+
+CompiledScript::CompiledScript(const std::vector<Rule>& rules)
+{
+    // A trie with maps for children first, then laid out as a table of
+    // transitions on the Tamil block, which is all the rules read
+    std::vector<std::map<char16_t, uint32_t>> children(1);
+    std::vector<std::vector<Output>> outputs(1);
+    for (const Rule& rule : rules) {
+        uint32_t node = 0;
+        for (char16_t unit : rule.from) {
+            auto found = children[node].find(unit);
+            if (found != children[node].end()) {
+                node = found->second;
+                continue;
+            }
+            uint32_t added = static_cast<uint32_t>(children.size());
+            children[node].emplace(unit, added);
+            children.emplace_back();
+            outputs.emplace_back();
+            node = added;
+        }
+        outputs[node].push_back({ rule.context, static_cast<uint32_t>(text_.size()),
+                                  static_cast<uint32_t>(rule.to.size()) });
+        text_ += rule.to;
+    }
+
+    for (size_t node = 0; node < children.size(); node++) {
+        uint32_t row = kNoRow;
+        if (!children[node].empty()) {
+            row = static_cast<uint32_t>(rows_.size() / kTamilSize);
+            rows_.resize(rows_.size() + kTamilSize);
+            for (const auto& [unit, next] : children[node]) {
+                if (isTamil(unit))
+                    rows_[row * kTamilSize + (unit - kTamilFirst)] = next;
+            }
+        }
+        nodes_.push_back({ row, static_cast<uint32_t>(outputs_.size()), static_cast<uint32_t>(outputs[node].size()) });
+        outputs_.insert(outputs_.end(), outputs[node].begin(), outputs[node].end());
+    }
+
+    for (size_t i = 0; i < kTamilSize; i++) {
+        uint32_t node = child(0, static_cast<char16_t>(kTamilFirst + i));
+        roots_[i] = node;
+        // Units no rule reads map to themselves
+        ways_[i] = kFlat;
+        flat_[i][0] = static_cast<char16_t>(kTamilFirst + i);
+        flat_[i][1] = 0;
+        flatLength_[i] = 1;
+        if (node == 0)
+            continue;
+        ways_[i] = kWalk;
+        if (nodes_[node].row != kNoRow || nodes_[node].outputCount != 1)
+            continue;
+        const Output& output = outputs_[nodes_[node].firstOutput];
+        if (output.context == kAnywhere && output.length <= 2) {
+            ways_[i] = kFlat;
+            std::copy_n(text_.data() + output.text, output.length, flat_[i]);
+            flatLength_[i] = static_cast<uint8_t>(output.length);
+        }
+    }
+}
+
+// The child of 'node' on 'unit', or 0, the root, for none
+uint32_t CompiledScript::child(uint32_t node, char16_t unit) const
+{
+    uint32_t row = nodes_[node].row;
+    return row != kNoRow && isTamil(unit) ? rows_[row * kTamilSize + (unit - kTamilFirst)] : 0;
+}
+
+bool CompiledScript::holds(uint8_t context, TextView tamil, size_t start, size_t end)
+{
+    if ((context & kWordStart) && start > 0 && isTamil(tamil[start - 1]))
+        return false;
+    if ((context & kWordEnd) && end < tamil.size() && isTamil(tamil[end]))
+        return false;
+    return true;
+}
+
+void CompiledScript::append(TextView tamil, Text& out) const
+{
+    // Written in place into room for the most a rule makes, cut to size
+    // after; the room is there already when 'tamil' is part of 'out'
+    size_t base = out.size();
+    out.resize(base + tamil.size() * 2);
+    char16_t* write = &out[base];
+    const char16_t* read = tamil.data();
+    size_t i = 0;
+    while (i < tamil.size()) {
+        char16_t unit = read[i];
+        if (!isTamil(unit)) {
+            size_t end = i + 1;
+            while (end < tamil.size() && !isTamil(read[end]))
+                end++;
+            write = std::copy(read + i, read + end, write);
+            i = end;
+            continue;
+        }
+        size_t index = unit - kTamilFirst;
+        if (ways_[index] == kFlat) {
+            // Most of a word goes this way, with no branch per unit on
+            // what it maps to
+            do {
+                write[0] = flat_[index][0];
+                write[1] = flat_[index][1];
+                write += flatLength_[index];
+                if (++i == tamil.size())
+                    break;
+                index = static_cast<char16_t>(read[i] - kTamilFirst);
+            } while (index < kTamilSize && ways_[index] == kFlat);
+            continue;
+        }
+
+        // The longest match whose context holds
+        const Output* taken = nullptr;
+        size_t takenEnd = i + 1;
+        uint32_t node = roots_[index];
+        for (size_t end = i + 1;; end++) {
+            const Output* first = outputs_.data() + nodes_[node].firstOutput;
+            for (const Output* output = first; output != first + nodes_[node].outputCount; output++) {
+                if (holds(output->context, tamil, i, end)) {
+                    taken = output;
+                    takenEnd = end;
+                    break;
+                }
+            }
+            if (end == tamil.size() || (node = child(node, read[end])) == 0)
+                break;
+        }
+        if (taken)
+            write = std::copy_n(text_.data() + taken->text, taken->length, write);
+        else
+            *write++ = unit;
+        i = takenEnd;
+    }
+    out.resize(static_cast<size_t>(write - out.data()));
+}
+
+const CompiledScript* compiledScript(TargetScript script)
+{
+    switch (script) {
+    case Brahmi: {
+        static const CompiledScript brahmi(brahmiRules());
+        return &brahmi;
+    }
+    case Vatteluttu: {
+        static const CompiledScript vatteluttu(vatteluttuRules());
+        return &vatteluttu;
+    }
+    case Transliterated: {
+        static const CompiledScript latin(latinRules());
+        return &latin;
+    }
+    case Jawi: {
+        static const CompiledScript jawi(jawiRules());
+        return &jawi;
+    }
+    case Tamil:
+    default:
+        return nullptr;
+    }
+}
+
+} // namespace
+
+Text convertToBrahmi(TextView tamil)
+{
+    Text brahmi;
+    appendScript(tamil, Brahmi, brahmi);
+    return brahmi;
+}
+
+Text convertScript(TextView tamil, TargetScript script)
+{
+    Text converted;
+    appendScript(tamil, script, converted);
+    return converted;
+}
+
+void appendScript(TextView tamil, TargetScript script, Text& out)
+{
+    const CompiledScript* compiled = compiledScript(script);
+    if (!compiled) {
+        out.append(tamil);
+        return;
+    }
+    compiled->append(tamil, out);
+}
+
+void appendScripts(const TextView* words, size_t count, TargetScript script, Text& out, size_t* ends)
+{
+    const CompiledScript* compiled = compiledScript(script);
+    size_t needed = out.size();
+    for (size_t i = 0; i < count; i++)
+        needed += words[i].size() * (compiled ? 2 : 1);
+    out.reserve(needed);
+    for (size_t i = 0; i < count; i++) {
+        if (compiled)
+            compiled->append(words[i], out);
+        else
+            out.append(words[i]);
+        ends[i] = out.size();
+    }
+}
+
+} // namespace predictor
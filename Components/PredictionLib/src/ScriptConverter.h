@@ -0,0 +1,58 @@
+#ifndef PREDICTOR_SCRIPT_CONVERTER_H
+#define PREDICTOR_SCRIPT_CONVERTER_H
+
+// Rendering of Tamil text in the other TargetScripts.
+//
+// Each script is a list of rules, Tamil text to its rendering, compiled on
+// first use into an automaton over the Tamil text, a trie with a row of
+// transitions on the Tamil block for each node, matched longest first.
+// A rule may hold only at the start or the end of a word, a word being a
+// run of Tamil block code units; of rules for the same text the first
+// that holds is taken. Text no rule reads is copied as it is.
+//
+//   Brahmi          letter for letter into the Brahmi block
+//   Vatteluttu      the Tamil block's layout moved to the Private Use Area
+//                   at kVatteluttuBase, where Vatteluttu fonts put their
+//                   glyphs; the Grantha letters, which Vatteluttu lacks,
+//                   as the native letters that replace them, and the two
+//                   part vowel signs as their parts
+//   Transliterated  ISO 15919 Latin, a consonant with no sign after it
+//                   carrying its inherent a
+//   Jawi            Arabic letters as Arwi spells Tamil, with the vowels
+//                   as Jawi writes them: long vowel letters for the signs,
+//                   nothing for the inherent a but an alif at the end of a
+//                   word, and a vowel letter on an alif at the start of a
+//                   word or a hamza seat within one. Joining the letters
+//                   into their forms is left to the text renderer.
+//
+// Code units no longer rule starts with, and only one context-free rule of
+// one unit reads, map through a flat table in a tight loop, and runs of
+// text outside the Tamil block are copied whole, so common text takes few
+// automaton steps. Output is written in place into room for the most the
+// rules make, two code units for each one read.
+
+#include <cstddef>
+
+#include "ScriptConverterStructs.h"
+#include "Utf16.h"
+
+namespace predictor {
+
+constexpr char16_t kVatteluttuBase = 0xE000;
+
+Text convertToBrahmi(TextView tamil);
+
+// 'tamil' in 'script'; Tamil itself is returned unchanged
+Text convertScript(TextView tamil, TargetScript script);
+
+// The same appended to 'out'. At most two code units are appended per code
+// unit of 'tamil', which may point into 'out' if that much room is reserved.
+void appendScript(TextView tamil, TargetScript script, Text& out);
+
+// Each of 'count' words appended to 'out' in turn, where each ends going
+// to 'ends'; the words are converted as separate words
+void appendScripts(const TextView* words, size_t count, TargetScript script, Text& out, size_t* ends);
+
+} // namespace predictor
+
+#endif // PREDICTOR_SCRIPT_CONVERTER_H
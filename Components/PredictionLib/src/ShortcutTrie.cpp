@@ -0,0 +1,105 @@
+#include "ShortcutTrie.h"
+
+namespace predictor {
+
+namespace {
+
+constexpr size_t kInitialEdges = 64;
+
+} // namespace
+
+ShortcutTrie::ShortcutTrie()
+{
+    clear();
+}
+
+void ShortcutTrie::clear()
+{
+    edges_.assign(kInitialEdges, Edge{ 0, 0, 0 });
+    expansionOf_.assign(1, kNoExpansion);
+    expansions_.clear();
+    text_.clear();
+    edgeCount_ = 0;
+    shortcutCount_ = 0;
+    generation_++;
+}
+
+// The slot holding the edge, or the empty slot where it would go
+size_t ShortcutTrie::slotOf(uint32_t node, char16_t unit) const
+{
+    uint64_t key = (uint64_t(node) << 16) | unit;
+    size_t mask = edges_.size() - 1;
+    size_t slot = static_cast<size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & mask;
+    while (edges_[slot].child != 0 && (edges_[slot].node != node || edges_[slot].unit != unit))
+        slot = (slot + 1) & mask;
+    return slot;
+}
+
+void ShortcutTrie::grow()
+{
+    std::vector<Edge> old(edges_.size() * 2, Edge{ 0, 0, 0 });
+    old.swap(edges_);
+    for (const Edge& edge : old) {
+        if (edge.child != 0)
+            edges_[slotOf(edge.node, edge.unit)] = edge;
+    }
+}
+
+void ShortcutTrie::insert(TextView shortcut, TextView expansion)
+{
+    if (shortcut.empty())
+        return;
+    uint32_t node = kRoot;
+    for (char16_t unit : shortcut) {
+        size_t slot = slotOf(node, unit);
+        if (edges_[slot].child == 0) {
+            if (4 * (edgeCount_ + 1) > 3 * edges_.size()) {
+                grow();
+                slot = slotOf(node, unit);
+            }
+            uint32_t child = static_cast<uint32_t>(expansionOf_.size());
+            expansionOf_.push_back(kNoExpansion);
+            edges_[slot] = { node, child, unit };
+            edgeCount_++;
+        }
+        node = edges_[slot].child;
+    }
+    // A new expansion goes after the others; the text of one it replaces is
+    // left unused
+    Expansion entry = { static_cast<uint32_t>(text_.size()), static_cast<uint32_t>(expansion.size()) };
+    text_.append(expansion);
+    if (expansionOf_[node] == kNoExpansion) {
+        expansionOf_[node] = static_cast<uint32_t>(expansions_.size());
+        expansions_.push_back(entry);
+        shortcutCount_++;
+    } else {
+        expansions_[expansionOf_[node]] = entry;
+    }
+    generation_++;
+}
+
+uint32_t ShortcutTrie::child(uint32_t node, char16_t unit) const
+{
+    if (node == kNoNode)
+        return kNoNode;
+    const Edge& edge = edges_[slotOf(node, unit)];
+    return edge.child != 0 ? edge.child : kNoNode;
+}
+
+uint32_t ShortcutTrie::find(TextView text) const
+{
+    uint32_t node = kRoot;
+    for (size_t i = 0; i < text.size() && node != kNoNode; i++)
+        node = child(node, text[i]);
+    return node;
+}
+
+TextView ShortcutTrie::expansion(uint32_t node) const
+{
+    if (node == kNoNode || expansionOf_[node] == kNoExpansion)
+        return TextView();
+    const Expansion& entry = expansions_[expansionOf_[node]];
+    return TextView(text_).substr(entry.start, entry.length);
+}
+
+} // namespace predictor
@@ -0,0 +1,79 @@
+#ifndef PREDICTOR_SHORTCUT_TRIE_H
+#define PREDICTOR_SHORTCUT_TRIE_H
+
+// The imported shortcuts: a trie over UTF-16 code units whose edges all
+// live in one open-addressing table keyed by node and code unit, so a
+// typed code unit is followed in one probe or so whatever the number of
+// shortcuts, and a PrefixCursor follows the word being typed one unit per
+// keystroke (see PrefixCursor::shortcut).
+//
+// Shortcuts are inserted in place, an import costing the length of what it
+// adds and never a rebuild. Nodes are only ever added, so a node number
+// stays valid; generation() changes with every insert, for holders of the
+// node a text reached to tell that it may now reach further.
+//
+// A shortcut matches the whole word typed, as Predictor has always matched
+// them. Matching shortcuts that end inside a word, the failure links of
+// Aho-Corasick, would offer an expansion for words that merely end in a
+// shortcut, and is left out.
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "Utf16.h"
+
+namespace predictor {
+
+class ShortcutTrie {
+public:
+    static constexpr uint32_t kRoot = 0;
+    static constexpr uint32_t kNoNode = UINT32_MAX;
+
+    ShortcutTrie();
+
+    // Add 'shortcut', or give it a new expansion; an empty shortcut is
+    // ignored
+    void insert(TextView shortcut, TextView expansion);
+    void clear();
+
+    size_t size() const { return shortcutCount_; }
+    uint32_t generation() const { return generation_; }
+
+    // The node below 'node' on 'unit', kNoNode if none or 'node' is kNoNode
+    uint32_t child(uint32_t node, char16_t unit) const;
+
+    // The node of 'text', kNoNode if no shortcut starts with it
+    uint32_t find(TextView text) const;
+
+    // The expansion of the shortcut ending at 'node', empty if none; valid
+    // until the next insert
+    TextView expansion(uint32_t node) const;
+
+private:
+    struct Edge {
+        uint32_t node;
+        uint32_t child;             // 0, the root, for an empty slot
+        char16_t unit;
+    };
+    struct Expansion {
+        uint32_t start;             // in text_
+        uint32_t length;
+    };
+    static constexpr uint32_t kNoExpansion = UINT32_MAX;
+
+    size_t slotOf(uint32_t node, char16_t unit) const;
+    void grow();
+
+    std::vector<Edge> edges_;                   // a power of two, at most 3/4 full
+    std::vector<uint32_t> expansionOf_;         // per node, an index into expansions_
+    std::vector<Expansion> expansions_;
+    Text text_;                                 // the expansions, one after another
+    size_t edgeCount_ = 0;
+    size_t shortcutCount_ = 0;
+    uint32_t generation_ = 0;
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_SHORTCUT_TRIE_H
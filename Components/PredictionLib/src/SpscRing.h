@@ -0,0 +1,50 @@
+#ifndef PREDICTOR_SPSC_RING_H
+#define PREDICTOR_SPSC_RING_H
+
+// A fixed-size queue from one producing thread to one consuming thread,
+// without locks: each side advances an index of its own and publishes it
+// with a release store, so neither ever waits for the other. push() fails
+// when the ring is full and pop() when it is empty.
+
+#include <atomic>
+#include <cstddef>
+
+namespace predictor {
+
+template <typename T, size_t Capacity>
+class SpscRing {
+    static_assert(Capacity > 0 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+
+public:
+    // Producer side
+    bool push(const T& value)
+    {
+        size_t tail = tail_.load(std::memory_order_relaxed);
+        if (tail - head_.load(std::memory_order_acquire) == Capacity)
+            return false;
+        slots_[tail % Capacity] = value;
+        tail_.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    // Consumer side
+    bool pop(T& value)
+    {
+        size_t head = head_.load(std::memory_order_relaxed);
+        if (head == tail_.load(std::memory_order_acquire))
+            return false;
+        value = slots_[head % Capacity];
+        head_.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+private:
+    // On cache lines of their own, so that the two sides do not contend
+    alignas(64) std::atomic<size_t> head_{ 0 };
+    alignas(64) std::atomic<size_t> tail_{ 0 };
+    T slots_[Capacity];
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_SPSC_RING_H
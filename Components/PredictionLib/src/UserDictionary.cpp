@@ -0,0 +1,469 @@
+#include "UserDictionary.h"
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#ifdef _WIN32
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace predictor {
+
+namespace {
+
+constexpr char16_t kSeparator = u'\t';
+constexpr char16_t kSequenceTag[] = u"#sequence";
+
+// A batch is written once this many changes are queued or the first of
+// them has waited this long
+constexpr size_t kBatchRecords = 64;
+constexpr std::chrono::milliseconds kBatchDelay(1000);
+
+// The log is folded into a new snapshot once it is larger than the
+// snapshot and this
+constexpr uint64_t kMinimumLogBytes = 64 * 1024;
+
+// A record is its payload size and the CRC-32 of the payload, then the
+// payload: the change's sequence number, its Operation and its words in
+// UTF-8, separated by tabs
+constexpr size_t kRecordHeader = 2 * sizeof(uint32_t);
+constexpr size_t kPayloadHeader = sizeof(uint64_t) + 1;
+
+Text join(TextView a, TextView b)
+{
+    Text key(a);
+    key.push_back(kSeparator);
+    key.append(b);
+    return key;
+}
+
+std::vector<Text> split(TextView line)
+{
+    std::vector<Text> fields;
+    size_t start = 0;
+    for (;;) {
+        size_t tab = line.find(kSeparator, start);
+        fields.emplace_back(line.substr(start, tab - start));
+        if (tab == TextView::npos)
+            break;
+        start = tab + 1;
+    }
+    return fields;
+}
+
+uint32_t crc32(const char* data, size_t size)
+{
+    static const std::array<uint32_t, 256> table = [] {
+        std::array<uint32_t, 256> entries{};
+        for (uint32_t i = 0; i < entries.size(); i++) {
+            uint32_t c = i;
+            for (int bit = 0; bit < 8; bit++)
+                c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            entries[i] = c;
+        }
+        return entries;
+    }();
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; i++)
+        crc = table[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+    return crc ^ 0xFFFFFFFFu;
+}
+
+bool syncFile(std::FILE* file)
+{
+    if (std::fflush(file) != 0)
+        return false;
+#ifdef _WIN32
+    return _commit(_fileno(file)) == 0;
+#else
+    return fsync(fileno(file)) == 0;
+#endif
+}
+
+// A rename only lasts once the directory holding it is synced
+void syncDirectory(const std::string& path)
+{
+#ifndef _WIN32
+    size_t slash = path.rfind('/');
+    std::string directory = slash == std::string::npos ? "." : slash == 0 ? "/" : path.substr(0, slash);
+    int descriptor = ::open(directory.c_str(), O_RDONLY);
+    if (descriptor >= 0) {
+        fsync(descriptor);
+        ::close(descriptor);
+    }
+#else
+    (void)path;
+#endif
+}
+
+} // namespace
+
+bool UserDictionary::open(const std::string& path)
+{
+    close();
+    bool damaged;
+    if (!load(path, entries_, snapshotBytes_, logBytes_, damaged)) {
+        close();
+        return false;
+    }
+    path_ = path;
+
+    // New records must not follow a damaged one, so the log is replaced
+    // before anything is written to it
+    if (damaged && !writeSnapshot(snapshotText(entries_)))
+        snapshotNeeded_ = true;
+    startWriter();
+    return true;
+}
+
+void UserDictionary::close()
+{
+    if (writer_.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(mutex_);
+            stopping_ = true;
+        }
+        wake_.notify_one();
+        writer_.join();
+    }
+    if (log_) {
+        std::fclose(log_);
+        log_ = nullptr;
+    }
+
+    path_.clear();
+    entries_ = Entries();
+    queued_.clear();
+    queuedCount_ = 0;
+    attempted_ = durable_ = 0;
+    flushRequested_ = stopping_ = snapshotNeeded_ = false;
+    logBytes_ = snapshotBytes_ = 0;
+}
+
+bool UserDictionary::load(const std::string& path, Entries& entries, uint64_t& snapshotBytes, uint64_t& logBytes,
+                          bool& damaged)
+{
+    entries = Entries();
+    snapshotBytes = logBytes = 0;
+    damaged = false;
+
+    errno = 0;
+    std::ifstream in(path, std::ios::binary);
+    if (!in && errno != ENOENT)
+        return false;
+
+    std::string line;
+    while (in && std::getline(in, line)) {
+        snapshotBytes += line.size() + 1;
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        std::vector<Text> fields = split(fromUtf8(line));
+        if (fields.size() < 2 || fields[1].empty())
+            continue;
+
+        if (fields[0] == kSequenceTag) {
+            entries.sequence = std::strtoull(toUtf8(fields[1]).c_str(), nullptr, 10);
+            continue;
+        }
+        if (fields[0] == u"-") {
+            entries.removed.insert(fields[1]);
+            continue;
+        }
+        uint32_t count = static_cast<uint32_t>(std::strtoul(toUtf8(fields[0]).c_str(), nullptr, 10));
+        if (count == 0)
+            continue;
+        if (fields.size() == 2)
+            entries.words[fields[1]] = count;
+        else if (fields.size() == 3)
+            entries.bigrams[join(fields[1], fields[2])] = count;
+        else if (fields.size() == 4)
+            entries.trigrams[join(join(fields[1], fields[2]), fields[3])] = count;
+    }
+
+    // The log's changes that came after the snapshot, up to the first
+    // damaged record
+    errno = 0;
+    std::ifstream logIn(path + ".log", std::ios::binary);
+    if (!logIn)
+        return errno == ENOENT;
+    std::string data((std::istreambuf_iterator<char>(logIn)), std::istreambuf_iterator<char>());
+
+    uint64_t snapshotSequence = entries.sequence;
+    size_t offset = 0;
+    while (data.size() - offset >= kRecordHeader) {
+        uint32_t size, crc;
+        std::memcpy(&size, data.data() + offset, sizeof(size));
+        std::memcpy(&crc, data.data() + offset + sizeof(size), sizeof(crc));
+        const char* payload = data.data() + offset + kRecordHeader;
+        if (size < kPayloadHeader || size > data.size() - offset - kRecordHeader || crc32(payload, size) != crc)
+            break;
+        offset += kRecordHeader + size;
+
+        uint64_t sequence;
+        std::memcpy(&sequence, payload, sizeof(sequence));
+        if (sequence <= snapshotSequence)
+            continue;       // a crash came between writing a snapshot and emptying the log
+        entries.sequence = std::max(entries.sequence, sequence);
+        std::vector<Text> fields =
+            split(fromUtf8(std::string_view(payload + kPayloadHeader, size - kPayloadHeader)));
+        fields.resize(3);
+        apply(entries, static_cast<Operation>(payload[sizeof(sequence)]), fields[0], fields[1], fields[2]);
+    }
+    logBytes = offset;
+    damaged = offset < data.size();
+    return true;
+}
+
+std::string UserDictionary::snapshotText(const Entries& entries)
+{
+    std::string text = toUtf8(kSequenceTag) + '\t' + std::to_string(entries.sequence) + '\n';
+    for (const Counts* counts : { &entries.words, &entries.bigrams, &entries.trigrams }) {
+        for (const auto& entry : *counts)
+            text += std::to_string(entry.second) + '\t' + toUtf8(entry.first) + '\n';
+    }
+    for (const Text& word : entries.removed)
+        text += "-\t" + toUtf8(word) + '\n';
+    return text;
+}
+
+bool UserDictionary::apply(Entries& entries, Operation operation, TextView word1, TextView word2, TextView word3)
+{
+    if (word1.empty())
+        return false;
+    switch (operation) {
+    case kAddWord: {
+        entries.words[Text(word1)]++;
+        auto removed = entries.removed.find(word1);
+        if (removed != entries.removed.end())
+            entries.removed.erase(removed);
+        return true;
+    }
+    case kAddBigram:
+        entries.bigrams[join(word1, word2)]++;
+        return true;
+    case kAddTrigram:
+        entries.trigrams[join(join(word1, word2), word3)]++;
+        return true;
+    case kRemoveWord: {
+        auto it = entries.words.find(word1);
+        if (it == entries.words.end())
+            return false;
+        entries.words.erase(it);
+        return true;
+    }
+    case kSetRemoved:
+        return entries.removed.insert(Text(word1)).second;
+    case kClearRemoved: {
+        auto removed = entries.removed.find(word1);
+        if (removed == entries.removed.end())
+            return false;
+        entries.removed.erase(removed);
+        return true;
+    }
+    }
+    return false;
+}
+
+bool UserDictionary::change(Operation operation, TextView word1, TextView word2, TextView word3)
+{
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (!apply(entries_, operation, word1, word2, word3))
+        return false;
+    if (!writer_.joinable())
+        return true;
+
+    size_t start = queued_.size();
+    uint64_t sequence = ++entries_.sequence;
+    queued_.append(kRecordHeader, '\0');
+    queued_.append(reinterpret_cast<const char*>(&sequence), sizeof(sequence));
+    queued_.push_back(static_cast<char>(operation));
+    for (TextView word : { word1, word2, word3 }) {
+        if (word.empty())
+            break;
+        if (queued_.size() > start + kRecordHeader + kPayloadHeader)
+            queued_.push_back('\t');
+        queued_.append(toUtf8(word));
+    }
+    uint32_t size = static_cast<uint32_t>(queued_.size() - start - kRecordHeader);
+    uint32_t crc = crc32(queued_.data() + start + kRecordHeader, size);
+    std::memcpy(&queued_[start], &size, sizeof(size));
+    std::memcpy(&queued_[start + sizeof(size)], &crc, sizeof(crc));
+
+    // Wake the writer to time the batch, and again when it is full
+    if (queuedCount_++ == 0) {
+        firstQueued_ = std::chrono::steady_clock::now();
+        wake_.notify_one();
+    } else if (queuedCount_ == kBatchRecords) {
+        wake_.notify_one();
+    }
+    return true;
+}
+
+void UserDictionary::addWord(TextView word)
+{
+    if (!word.empty())
+        change(kAddWord, word);
+}
+
+void UserDictionary::addBigram(TextView word1, TextView word2)
+{
+    if (!word1.empty() && !word2.empty())
+        change(kAddBigram, word1, word2);
+}
+
+void UserDictionary::addTrigram(TextView word1, TextView word2, TextView word3)
+{
+    if (!word1.empty() && !word2.empty() && !word3.empty())
+        change(kAddTrigram, word1, word2, word3);
+}
+
+bool UserDictionary::removeWord(TextView word)
+{
+    return change(kRemoveWord, word);
+}
+
+void UserDictionary::setRemoved(TextView word, bool removed)
+{
+    change(removed ? kSetRemoved : kClearRemoved, word);
+}
+
+bool UserDictionary::isRemoved(TextView word) const
+{
+    return entries_.removed.find(word) != entries_.removed.end();
+}
+
+uint32_t UserDictionary::count(TextView word) const
+{
+    auto it = entries_.words.find(word);
+    return it == entries_.words.end() ? 0 : it->second;
+}
+
+bool UserDictionary::flush()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    if (!writer_.joinable())
+        return false;
+    uint64_t target = entries_.sequence;
+    if (durable_ >= target)
+        return true;
+    flushRequested_ = true;
+    wake_.notify_one();
+    written_.wait(lock, [&] { return attempted_ >= target; });
+    return durable_ >= target;
+}
+
+void UserDictionary::startWriter()
+{
+    if (!log_)
+        log_ = std::fopen((path_ + ".log").c_str(), "ab");
+    snapshotNeeded_ = snapshotNeeded_ || !log_;
+    durable_ = attempted_ = entries_.sequence;
+    stopping_ = false;
+    writer_ = std::thread(&UserDictionary::writerLoop, this);
+}
+
+void UserDictionary::writerLoop()
+{
+    std::unique_lock<std::mutex> lock(mutex_);
+    for (;;) {
+        while (!stopping_ && !flushRequested_ && queuedCount_ < kBatchRecords) {
+            if (queuedCount_ == 0)
+                wake_.wait(lock);
+            else if (wake_.wait_until(lock, firstQueued_ + kBatchDelay) == std::cv_status::timeout)
+                break;
+        }
+        flushRequested_ = false;
+
+        std::string batch;
+        batch.swap(queued_);
+        queuedCount_ = 0;
+        uint64_t last = entries_.sequence;
+        if (snapshotNeeded_) {
+            // The log lacks changes that are in the maps: write the maps,
+            // which hold the queued changes too
+            std::string text = snapshotText(entries_);
+            lock.unlock();
+            bool written = writeSnapshot(text);
+            lock.lock();
+            if (written) {
+                durable_ = last;
+                snapshotNeeded_ = !log_;
+            }
+        } else if (!batch.empty()) {
+            lock.unlock();
+            bool written = appendToLog(batch);
+            if (written && logBytes_ > std::max(kMinimumLogBytes, snapshotBytes_))
+                compact();
+            lock.lock();
+            if (written)
+                durable_ = last;
+            else
+                snapshotNeeded_ = true;
+        }
+        attempted_ = last;
+        written_.notify_all();
+
+        if (stopping_ && queuedCount_ == 0)
+            return;
+    }
+}
+
+bool UserDictionary::appendToLog(const std::string& records)
+{
+    if (!log_)
+        return false;
+    bool written = std::fwrite(records.data(), 1, records.size(), log_) == records.size() && syncFile(log_);
+    logBytes_ += records.size();
+    return written;
+}
+
+// Fold the log into a new snapshot, from the files rather than the maps so
+// that changes go on meanwhile. Only the writer appends to the log, and it
+// is here, so the files hold every change written so far and nothing else.
+void UserDictionary::compact()
+{
+    Entries entries;
+    uint64_t snapshotBytes, logBytes;
+    bool damaged;
+    if (!load(path_, entries, snapshotBytes, logBytes, damaged) || damaged)
+        return;
+    writeSnapshot(snapshotText(entries));
+}
+
+// Replace the snapshot with 'text', then empty the log
+bool UserDictionary::writeSnapshot(const std::string& text)
+{
+    std::string temporary = path_ + ".tmp";
+    std::FILE* file = std::fopen(temporary.c_str(), "wb");
+    bool written = file && std::fwrite(text.data(), 1, text.size(), file) == text.size() && syncFile(file);
+    if (file)
+        written = std::fclose(file) == 0 && written;
+#ifdef _WIN32
+    if (written)
+        std::remove(path_.c_str());
+#endif
+    written = written && std::rename(temporary.c_str(), path_.c_str()) == 0;
+    if (!written) {
+        std::remove(temporary.c_str());
+        return false;
+    }
+
+    syncDirectory(path_);
+    if (log_)
+        std::fclose(log_);
+    log_ = std::fopen((path_ + ".log").c_str(), "wb");
+    logBytes_ = 0;
+    snapshotBytes_ = text.size();
+    return true;
+}
+
+} // namespace predictor
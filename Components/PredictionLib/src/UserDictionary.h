@@ -0,0 +1,181 @@
+#ifndef PREDICTOR_USER_DICTIONARY_H
+#define PREDICTOR_USER_DICTIONARY_H
+
+// Words and word sequences the user has typed, with use counts, and the
+// main dictionary words the user removed.
+//
+// Held in sorted maps so that completions of a prefix are one range. On
+// disk, for a path of anjaluser.data:
+//
+//   anjaluser.data      a snapshot, UTF-8 text with one entry per line
+//                         #sequence<TAB>n                        the last change it holds
+//                         count<TAB>word[<TAB>word[<TAB>word]]   a word, bigram or trigram
+//                         -<TAB>word                             a removed word
+//   anjaluser.data.log  the changes since, as checksummed records
+//
+// A change updates the maps and queues its record, which is all the
+// keystroke path pays. A writer thread appends queued records to the log
+// and syncs them in batches. Once the log outgrows the snapshot, the writer
+// reads both back into maps of its own, writes them as the new snapshot
+// through a temporary and a rename, and empties the log, so compaction
+// never holds up a change. Opening replays the log over the snapshot,
+// stopping at the first damaged record: only the tail a crash cut short is
+// lost.
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+
+#include "Utf16.h"
+
+namespace predictor {
+
+class UserDictionary {
+public:
+    UserDictionary() = default;
+    UserDictionary(const UserDictionary&) = delete;
+    UserDictionary& operator=(const UserDictionary&) = delete;
+    ~UserDictionary() { close(); }
+
+    // Load 'path', which need not exist yet, and save changes to it from now
+    // on. Returns false if the file exists but cannot be read.
+    bool open(const std::string& path);
+
+    // Write what is queued and stop saving
+    void close();
+    bool isOpen() const { return !path_.empty(); }
+
+    // Write and sync every change made so far; returns false if that failed
+    bool flush();
+
+    void addWord(TextView word);
+    void addBigram(TextView word1, TextView word2);
+    void addTrigram(TextView word1, TextView word2, TextView word3);
+
+    // Forget a learned word; returns false if there was none
+    bool removeWord(TextView word);
+
+    // Record that a main dictionary word was removed, or undo that
+    void setRemoved(TextView word, bool removed);
+    bool isRemoved(TextView word) const;
+
+    uint32_t count(TextView word) const;
+
+    // Call visit(TextView word, uint32_t count) for the learned words
+    // starting with 'prefix'. The views are only valid during the call.
+    template <typename Visit>
+    void forEachCompletion(TextView prefix, Visit visit) const
+    {
+        forEachWithPrefix(entries_.words, TextView(), TextView(), prefix, visit);
+    }
+
+    // The same for words learned after 'word1' (and 'word2')
+    template <typename Visit>
+    void forEachBigram(TextView word1, TextView prefix, Visit visit) const
+    {
+        forEachWithPrefix(entries_.bigrams, word1, TextView(), prefix, visit);
+    }
+
+    template <typename Visit>
+    void forEachTrigram(TextView word1, TextView word2, TextView prefix, Visit visit) const
+    {
+        forEachWithPrefix(entries_.trigrams, word1, word2, prefix, visit);
+    }
+
+    size_t wordCount() const { return entries_.words.size(); }
+
+private:
+    using Counts = std::map<Text, uint32_t, std::less<>>;
+
+    struct Entries {
+        Counts words;
+        Counts bigrams;         // "word1\tword2"
+        Counts trigrams;        // "word1\tword2\tword3"
+        std::set<Text, std::less<>> removed;
+        uint64_t sequence = 0;  // of the last change they hold
+    };
+
+    enum Operation : uint8_t {
+        kAddWord = 1,
+        kAddBigram = 2,
+        kAddTrigram = 3,
+        kRemoveWord = 4,
+        kSetRemoved = 5,
+        kClearRemoved = 6,
+    };
+
+    // Entries keyed "context1\tcontext2\tword" whose word starts with
+    // 'prefix'; empty context words are left out of the key
+    template <typename Visit>
+    void forEachWithPrefix(const Counts& counts, TextView context1, TextView context2, TextView prefix,
+                           Visit visit) const
+    {
+        // Built in a kept buffer, so that lookups do not allocate
+        key_.clear();
+        for (TextView context : { context1, context2 }) {
+            if (!context.empty()) {
+                key_.append(context);
+                key_.push_back(u'\t');
+            }
+        }
+        size_t skip = key_.size();
+        key_.append(prefix);
+        for (auto it = counts.lower_bound(key_); it != counts.end() && hasPrefix(it->first, key_); ++it)
+            visit(TextView(it->first).substr(skip), it->second);
+    }
+
+    // Change 'entries'; returns whether anything changed
+    static bool apply(Entries& entries, Operation operation, TextView word1, TextView word2, TextView word3);
+
+    // apply() and queue the record of the change for the log
+    bool change(Operation operation, TextView word1, TextView word2 = TextView(), TextView word3 = TextView());
+
+    // Read the snapshot and the log over it into 'entries'. 'logBytes' is
+    // set to the length of the log up to any damaged record.
+    static bool load(const std::string& path, Entries& entries, uint64_t& snapshotBytes, uint64_t& logBytes,
+                     bool& damaged);
+    static std::string snapshotText(const Entries& entries);
+
+    void startWriter();
+    void writerLoop();
+    bool appendToLog(const std::string& records);
+    void compact();
+    bool writeSnapshot(const std::string& text);
+
+    std::string path_;
+    Entries entries_;
+    mutable Text key_;
+
+    // Changes are numbered (entries_.sequence is the last), so that replay
+    // skips those a snapshot holds.
+    // The maps are changed on the caller's thread and read by the writer
+    // while it writes a snapshot, so both hold the mutex; reads on the
+    // caller's thread need not.
+    std::mutex mutex_;
+    std::condition_variable wake_;          // the writer: records queued, flush or close
+    std::condition_variable written_;       // flush(): a batch was written
+    std::thread writer_;
+    std::string queued_;                    // records not yet written
+    size_t queuedCount_ = 0;
+    std::chrono::steady_clock::time_point firstQueued_;
+    uint64_t attempted_ = 0;                // last change the writer tried to write
+    uint64_t durable_ = 0;                  // last change written and synced
+    bool flushRequested_ = false;
+    bool stopping_ = false;
+
+    // Owned by the writer thread while it runs
+    std::FILE* log_ = nullptr;
+    uint64_t logBytes_ = 0;
+    uint64_t snapshotBytes_ = 0;
+    bool snapshotNeeded_ = false;           // the log lacks changes, so write the maps
+};
+
+} // namespace predictor
+
+#endif // PREDICTOR_USER_DICTIONARY_H
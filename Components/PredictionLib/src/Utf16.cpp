@@ -0,0 +1,91 @@
+#include "Utf16.h"
+
+namespace predictor {
+
+Text fromUtf8(std::string_view utf8)
+{
+    Text text;
+    text.reserve(utf8.size());
+
+    size_t i = 0;
+    while (i < utf8.size()) {
+        unsigned char lead = static_cast<unsigned char>(utf8[i++]);
+        char32_t codePoint;
+        int extra;
+        if (lead < 0x80) {
+            text.push_back(lead);
+            continue;
+        } else if ((lead & 0xE0) == 0xC0) {
+            codePoint = lead & 0x1F;
+            extra = 1;
+        } else if ((lead & 0xF0) == 0xE0) {
+            codePoint = lead & 0x0F;
+            extra = 2;
+        } else if ((lead & 0xF8) == 0xF0) {
+            codePoint = lead & 0x07;
+            extra = 3;
+        } else {
+            text.push_back(0xFFFD);
+            continue;
+        }
+
+        bool valid = i + extra <= utf8.size();
+        for (int k = 0; valid && k < extra; k++) {
+            unsigned char c = static_cast<unsigned char>(utf8[i + k]);
+            valid = (c & 0xC0) == 0x80;
+            codePoint = (codePoint << 6) | (c & 0x3F);
+        }
+        if (!valid || codePoint > 0x10FFFF || (codePoint >= 0xD800 && codePoint <= 0xDFFF)) {
+            text.push_back(0xFFFD);
+            continue;
+        }
+        i += extra;
+        appendCodePoint(text, codePoint);
+    }
+    return text;
+}
+
+std::string toUtf8(TextView text)
+{
+    std::string utf8;
+    utf8.reserve(text.size() * 3);
+
+    size_t i = 0;
+    while (i < text.size()) {
+        char32_t c = nextCodePoint(text, i);
+        if (c < 0x80) {
+            utf8.push_back(static_cast<char>(c));
+        } else if (c < 0x800) {
+            utf8.push_back(static_cast<char>(0xC0 | (c >> 6)));
+            utf8.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        } else if (c < 0x10000) {
+            utf8.push_back(static_cast<char>(0xE0 | (c >> 12)));
+            utf8.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+            utf8.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        } else {
+            utf8.push_back(static_cast<char>(0xF0 | (c >> 18)));
+            utf8.push_back(static_cast<char>(0x80 | ((c >> 12) & 0x3F)));
+            utf8.push_back(static_cast<char>(0x80 | ((c >> 6) & 0x3F)));
+            utf8.push_back(static_cast<char>(0x80 | (c & 0x3F)));
+        }
+    }
+    return utf8;
+}
+
+bool hasPrefix(TextView text, TextView prefix)
+{
+    return text.size() >= prefix.size() && text.compare(0, prefix.size(), prefix) == 0;
+}
+
+bool isEmoji(TextView word)
+{
+    if (word.empty())
+        return false;
+    size_t i = 0;
+    char32_t c = nextCodePoint(word, i);
+    return (c >= 0x1F000 && c <= 0x1FAFF) ||    // pictographs, emoticons, transport, symbols
+           (c >= 0x2600 && c <= 0x27BF) ||      // miscellaneous symbols, dingbats
+           (c >= 0x2B00 && c <= 0x2BFF);        // arrows and stars
+}
+
+} // namespace predictor
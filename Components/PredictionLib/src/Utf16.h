@@ -0,0 +1,70 @@
+#ifndef PREDICTOR_UTF16_H
+#define PREDICTOR_UTF16_H
+
+// Strings inside the predictor are UTF-16, as the hosts use them.
+//
+// The C API declares its strings as wchar_t, but the Swift and Objective-C
+// hosts pass NUL terminated UTF-16 code unit arrays through those pointers
+// and read results back as UTF-16 (see PredictorWrapper.swift), whatever the
+// width of wchar_t. fromApi()/toApi() do that reinterpretation in one place.
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+namespace predictor {
+
+using Text = std::u16string;
+using TextView = std::u16string_view;
+
+inline TextView fromApi(const wchar_t* text)
+{
+    if (!text)
+        return TextView();
+    return TextView(reinterpret_cast<const char16_t*>(text));
+}
+
+inline const wchar_t* toApi(const char16_t* text)
+{
+    return reinterpret_cast<const wchar_t*>(text);
+}
+
+inline bool isHighSurrogate(char16_t c) { return c >= 0xD800 && c <= 0xDBFF; }
+inline bool isLowSurrogate(char16_t c) { return c >= 0xDC00 && c <= 0xDFFF; }
+
+// Append 'codePoint' as one or two code units
+inline void appendCodePoint(Text& text, char32_t codePoint)
+{
+    if (codePoint < 0x10000) {
+        text.push_back(static_cast<char16_t>(codePoint));
+    } else {
+        codePoint -= 0x10000;
+        text.push_back(static_cast<char16_t>(0xD800 + (codePoint >> 10)));
+        text.push_back(static_cast<char16_t>(0xDC00 + (codePoint & 0x3FF)));
+    }
+}
+
+// Decode the code point at text[i] and advance i past it. Unpaired
+// surrogates come back as themselves.
+inline char32_t nextCodePoint(TextView text, size_t& i)
+{
+    char16_t c = text[i++];
+    if (isHighSurrogate(c) && i < text.size() && isLowSurrogate(text[i]))
+        return 0x10000 + ((char32_t(c) - 0xD800) << 10) + (text[i++] - 0xDC00);
+    return c;
+}
+
+// UTF-8 for the text files the predictor imports and writes. Malformed
+// sequences become U+FFFD.
+Text fromUtf8(std::string_view utf8);
+std::string toUtf8(TextView text);
+
+bool hasPrefix(TextView text, TextView prefix);
+
+// Emoji and pictographs, judged by the first code point
+bool isEmoji(TextView word);
+
+} // namespace predictor
+
+#endif // PREDICTOR_UTF16_H
@@ -0,0 +1,742 @@
+// C entry points of predictor_c_api.h over predictor::Predictor.
+//
+// Strings cross the API as NUL terminated UTF-16 behind the declared
+// wchar_t pointers (see Utf16.h). No exception leaves this file: allocation
+// failures become PREDICTOR_ERROR_OUT_OF_MEMORY and anything else
+// PREDICTOR_ERROR_INTERNAL.
+//
+// Results are packed into one block, the PredictorResult array first and
+// the strings after it: a malloc'd block for Predictor_GetWordPredictions,
+// and the caller's buffer or the handle's arena for the ..._Into calls.
+//
+// Asynchronous requests run on the handle's AsyncRunner. The predictor is
+// used by that thread and the callers' alike, so every call that uses it
+// holds the handle's mutex while it does.
+
+#include "predictor_c_api.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <new>
+#include <thread>
+#include <vector>
+
+#include "AsyncRunner.h"
+#include "Predictor.h"
+#include "ScriptConverter.h"
+#include "SpscRing.h"
+
+using predictor::Candidate;
+using predictor::Text;
+using predictor::TextView;
+using predictor::fromApi;
+using predictor::toApi;
+
+struct PredictorHandle {
+    explicit PredictorHandle(bool debug) : predictor(debug) {}
+    ~PredictorHandle()
+    {
+        // Complete the requests left while the predictor is still there
+        runner.stop();
+        PredictorCompletion completion;
+        while (completions.pop(completion))
+            std::free(completion.results);
+    }
+
+    predictor::Predictor predictor;
+    std::vector<std::max_align_t> arena;    // results of the ..._Into calls without a buffer
+    std::mutex mutex;                       // held while the predictor is used
+    predictor::SpscRing<PredictorCompletion, PREDICTOR_COMPLETION_QUEUE_SIZE> completions;
+    predictor::AsyncRunner runner;
+};
+
+struct PredictorCursorHandle {
+    explicit PredictorCursorHandle(PredictorHandle& owner) : owner(owner), cursor(owner.predictor.dictionary()) {}
+    PredictorHandle& owner;
+    predictor::PrefixCursor cursor;
+};
+
+namespace {
+
+template <typename Body>
+PredictorStatus guarded(Body body)
+{
+    try {
+        return body();
+    } catch (const std::bad_alloc&) {
+        return PREDICTOR_ERROR_OUT_OF_MEMORY;
+    } catch (...) {
+        return PREDICTOR_ERROR_INTERNAL;
+    }
+}
+
+// The same with the handle's mutex held
+template <typename Body>
+PredictorStatus guarded(PredictorHandle& handle, Body body)
+{
+    return guarded([&] {
+        std::lock_guard<std::mutex> lock(handle.mutex);
+        return body();
+    });
+}
+
+size_t textBytes(TextView text)
+{
+    // NUL terminated and padded so that the next string stays wchar_t aligned
+    size_t bytes = (text.size() + 1) * sizeof(char16_t);
+    return (bytes + alignof(wchar_t) - 1) & ~(alignof(wchar_t) - 1);
+}
+
+const wchar_t* copyText(TextView text, char*& cursor)
+{
+    const wchar_t* start = reinterpret_cast<const wchar_t*>(cursor);
+    std::memcpy(cursor, text.data(), text.size() * sizeof(char16_t));
+    std::memset(cursor + text.size() * sizeof(char16_t), 0, sizeof(char16_t));
+    cursor += textBytes(text);
+    return start;
+}
+
+size_t packedSize(const Candidate& candidate)
+{
+    return sizeof(PredictorResult) + textBytes(candidate.word) +
+           (candidate.annotation.empty() ? 0 : textBytes(candidate.annotation));
+}
+
+// Write the first 'count' candidates to 'memory'
+PredictorResult* pack(const std::vector<Candidate>& candidates, size_t count, void* memory)
+{
+    PredictorResult* results = static_cast<PredictorResult*>(memory);
+    char* cursor = reinterpret_cast<char*>(results + count);
+    for (size_t i = 0; i < count; i++) {
+        const Candidate& candidate = candidates[i];
+        PredictorResult& result = results[i];
+        result.word = copyText(candidate.word, cursor);
+        result.annotation = candidate.annotation.empty() ? nullptr : copyText(candidate.annotation, cursor);
+        result.frequency = candidate.frequency;
+        result.word_id = candidate.wordId;
+        result.final_score = candidate.score;
+        result.user_word = candidate.userWord;
+        result.is_emoji = candidate.isEmoji;
+    }
+    return results;
+}
+
+// The results in one malloc'd block, released by Predictor_FreeResults
+PredictorStatus packResults(const std::vector<Candidate>& candidates, PredictorResult** out_results, size_t* out_count)
+{
+    if (candidates.empty())
+        return PREDICTOR_SUCCESS;
+
+    size_t size = 0;
+    for (const Candidate& candidate : candidates)
+        size += packedSize(candidate);
+    void* memory = std::malloc(size);
+    if (!memory)
+        return PREDICTOR_ERROR_OUT_OF_MEMORY;
+
+    *out_results = pack(candidates, candidates.size(), memory);
+    *out_count = candidates.size();
+    return PREDICTOR_SUCCESS;
+}
+
+// The results in 'buffer' as far as they fit, or all of them in the handle's
+// arena, which only allocates when it has to grow
+PredictorStatus packInto(PredictorHandle& handle, const std::vector<Candidate>& candidates, void* buffer,
+                         size_t buffer_size, PredictorResult** out_results, size_t* out_count)
+{
+    if (!buffer) {
+        size_t size = 0;
+        for (const Candidate& candidate : candidates)
+            size += packedSize(candidate);
+        size_t blocks = (size + sizeof(std::max_align_t) - 1) / sizeof(std::max_align_t);
+        if (handle.arena.size() < blocks)
+            handle.arena.resize(blocks);
+        buffer = handle.arena.data();
+        buffer_size = handle.arena.size() * sizeof(std::max_align_t);
+    }
+
+    size_t count = 0;
+    for (size_t used = 0; count < candidates.size() && used + packedSize(candidates[count]) <= buffer_size; count++)
+        used += packedSize(candidates[count]);
+    if (count > 0)
+        *out_results = pack(candidates, count, buffer);
+    *out_count = count;
+    return PREDICTOR_SUCCESS;
+}
+
+bool isResultAligned(const void* buffer)
+{
+    return reinterpret_cast<uintptr_t>(buffer) % alignof(PredictorResult) == 0;
+}
+
+// An asynchronous request, with its strings copied
+class PredictionJob : public predictor::AsyncJob {
+public:
+    PredictionJob(PredictorHandle& handle, const PredictorRequest& request, PredictorCompletionCallback callback,
+                  void* context)
+        : handle_(handle), kind_(request.kind), session_(request.session), prefix_(fromApi(request.prefix)),
+          baseWord_(fromApi(request.base_word)), secondWord_(fromApi(request.second_word)),
+          script_(request.target_script), annotation_(request.annotation_type), maxResults_(request.max_results),
+          callback_(callback), context_(context)
+    {
+    }
+
+    void run(uint64_t ticket, const std::atomic<bool>& cancelled) override
+    {
+        PredictorCompletion completion = { ticket, session_, PREDICTOR_SUCCESS, nullptr, 0 };
+        completion.status = guarded(handle_, [&] {
+            predictor::Predictor& predictor = handle_.predictor;
+            predictor.setCancellation(&cancelled);
+            PredictorStatus status = guarded([&] {
+                const std::vector<Candidate>& candidates =
+                    kind_ == PREDICTOR_REQUEST_NGRAMS
+                        ? predictor.ngramPredictions(baseWord_, secondWord_, prefix_, script_, annotation_, maxResults_)
+                        : predictor.wordPredictions(prefix_, script_, annotation_, maxResults_);
+                if (cancelled.load(std::memory_order_relaxed))
+                    return PREDICTOR_ERROR_CANCELLED;
+                return packResults(candidates, &completion.results, &completion.count);
+            });
+            predictor.setCancellation(nullptr);
+            return status;
+        });
+        complete(completion);
+    }
+
+    void cancel(uint64_t ticket) override
+    {
+        PredictorCompletion completion = { ticket, session_, PREDICTOR_ERROR_CANCELLED, nullptr, 0 };
+        complete(completion);
+    }
+
+private:
+    void complete(PredictorCompletion& completion)
+    {
+        if (callback_) {
+            callback_(context_, &completion);
+            std::free(completion.results);
+            return;
+        }
+        // Wait for the poller to make room, unless the handle is going away
+        while (!handle_.completions.push(completion)) {
+            if (handle_.runner.stopping()) {
+                std::free(completion.results);
+                return;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+    }
+
+    PredictorHandle& handle_;
+    PredictorRequestKind kind_;
+    uint32_t session_;
+    Text prefix_;
+    Text baseWord_;
+    Text secondWord_;
+    TargetScript script_;
+    AnnotationDataType annotation_;
+    size_t maxResults_;
+    PredictorCompletionCallback callback_;
+    void* context_;
+};
+
+} // namespace
+
+extern "C" {
+
+PredictorRef Predictor_Create(int debug_mode, PredictorStatus* status)
+{
+    PredictorRef predictor = new (std::nothrow) PredictorHandle(debug_mode != 0);
+    if (status)
+        *status = predictor ? PREDICTOR_SUCCESS : PREDICTOR_ERROR_OUT_OF_MEMORY;
+    return predictor;
+}
+
+void Predictor_Destroy(PredictorRef predictor)
+{
+    delete predictor;
+}
+
+PredictorStatus Predictor_Initialize(PredictorRef predictor, const char* trie_path)
+{
+    if (!predictor || !trie_path)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        return predictor->predictor.loadDictionary(trie_path) ? PREDICTOR_SUCCESS : PREDICTOR_ERROR_INITIALIZATION;
+    });
+}
+
+PredictorStatus Predictor_SetUserDictionary(PredictorRef predictor, const char* db_path)
+{
+    if (!predictor || !db_path)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        return predictor->predictor.setUserDictionary(db_path) ? PREDICTOR_SUCCESS : PREDICTOR_ERROR_INITIALIZATION;
+    });
+}
+
+PredictorStatus Predictor_FlushUserDictionary(PredictorRef predictor)
+{
+    if (!predictor)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        return predictor->predictor.flushUserDictionary() ? PREDICTOR_SUCCESS : PREDICTOR_ERROR_INTERNAL;
+    });
+}
+
+PredictorStatus Predictor_LoadNgramModel(PredictorRef predictor, const char* model_path)
+{
+    if (!predictor || !model_path)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        return predictor->predictor.loadNgramModel(model_path) ? PREDICTOR_SUCCESS : PREDICTOR_ERROR_INITIALIZATION;
+    });
+}
+
+PredictorStatus Predictor_LoadAnnotations(PredictorRef predictor, const char* annotations_path)
+{
+    if (!predictor || !annotations_path)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        return predictor->predictor.loadAnnotations(annotations_path) ? PREDICTOR_SUCCESS
+                                                                      : PREDICTOR_ERROR_INITIALIZATION;
+    });
+}
+
+PredictorStatus Predictor_LoadKeyLayout(PredictorRef predictor, const char* layout_path, float aspect_ratio)
+{
+    if (!predictor || !layout_path || aspect_ratio < 0)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    float ratio = aspect_ratio > 0 ? aspect_ratio : predictor::KeyLayout::kDefaultAspectRatio;
+    return guarded(*predictor, [&] {
+        return predictor->predictor.loadKeyLayout(layout_path, ratio) ? PREDICTOR_SUCCESS
+                                                                       : PREDICTOR_ERROR_INITIALIZATION;
+    });
+}
+
+PredictorStatus Predictor_Configure(PredictorRef predictor, const PredictorOptions* options)
+{
+    if (!predictor || !options)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    predictor::PredictorConfig config;
+    config.allowVariations = options->allow_variations != 0;
+    config.enableUserDictionary = options->enable_user_dictionary != 0;
+    config.scoreThreshold = options->score_threshold;
+    std::lock_guard<std::mutex> lock(predictor->mutex);
+    predictor->predictor.configure(config);
+    return PREDICTOR_SUCCESS;
+}
+
+PredictorStatus Predictor_SetCacheBudget(PredictorRef predictor, size_t bytes)
+{
+    if (!predictor)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        predictor->predictor.setCacheBudget(bytes);
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_GetCacheStats(PredictorRef predictor, PredictorCacheStats* out_stats)
+{
+    if (!predictor || !out_stats)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    std::lock_guard<std::mutex> lock(predictor->mutex);
+    predictor::ResultCache::Stats stats = predictor->predictor.cacheStats();
+    out_stats->hits = stats.hits;
+    out_stats->misses = stats.misses;
+    out_stats->invalidated = stats.invalidated;
+    out_stats->evicted = stats.evicted;
+    out_stats->entries = stats.entries;
+    out_stats->bytes = stats.bytes;
+    return PREDICTOR_SUCCESS;
+}
+
+PredictorStatus Predictor_GetWordPredictions(PredictorRef predictor, const wchar_t* prefix,
+                                             enum TargetScript target_script,
+                                             enum AnnotationDataType annotation_type, size_t max_results,
+                                             PredictorResult** out_results, size_t* out_count)
+{
+    if (!predictor || !prefix || !out_results || !out_count)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    *out_results = nullptr;
+    *out_count = 0;
+    return guarded(*predictor, [&] {
+        return packResults(predictor->predictor.wordPredictions(fromApi(prefix), target_script, annotation_type,
+                                                                max_results),
+                           out_results, out_count);
+    });
+}
+
+PredictorStatus Predictor_GetNgramPredictions(PredictorRef predictor, const wchar_t* base_word,
+                                              const wchar_t* second_word, const wchar_t* next_word_prefix,
+                                              enum TargetScript target_script,
+                                              enum AnnotationDataType annotation_type, size_t max_results,
+                                              PredictorResult** out_results, size_t* out_count)
+{
+    if (!predictor || !base_word || !out_results || !out_count)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    *out_results = nullptr;
+    *out_count = 0;
+    return guarded(*predictor, [&] {
+        return packResults(predictor->predictor.ngramPredictions(fromApi(base_word), fromApi(second_word),
+                                                                 fromApi(next_word_prefix), target_script,
+                                                                 annotation_type, max_results),
+                           out_results, out_count);
+    });
+}
+
+PredictorStatus Predictor_GetWordPredictionsInto(PredictorRef predictor, const wchar_t* prefix,
+                                                 enum TargetScript target_script,
+                                                 enum AnnotationDataType annotation_type, size_t max_results,
+                                                 void* buffer, size_t buffer_size, PredictorResult** out_results,
+                                                 size_t* out_count)
+{
+    if (!predictor || !prefix || !out_results || !out_count || !isResultAligned(buffer))
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    *out_results = nullptr;
+    *out_count = 0;
+    return guarded(*predictor, [&] {
+        return packInto(*predictor,
+                        predictor->predictor.wordPredictions(fromApi(prefix), target_script, annotation_type,
+                                                             max_results),
+                        buffer, buffer_size, out_results, out_count);
+    });
+}
+
+PredictorStatus Predictor_GetNgramPredictionsInto(PredictorRef predictor, const wchar_t* base_word,
+                                                  const wchar_t* second_word, const wchar_t* next_word_prefix,
+                                                  enum TargetScript target_script,
+                                                  enum AnnotationDataType annotation_type, size_t max_results,
+                                                  void* buffer, size_t buffer_size, PredictorResult** out_results,
+                                                  size_t* out_count)
+{
+    if (!predictor || !base_word || !out_results || !out_count || !isResultAligned(buffer))
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    *out_results = nullptr;
+    *out_count = 0;
+    return guarded(*predictor, [&] {
+        return packInto(*predictor,
+                        predictor->predictor.ngramPredictions(fromApi(base_word), fromApi(second_word),
+                                                              fromApi(next_word_prefix), target_script,
+                                                              annotation_type, max_results),
+                        buffer, buffer_size, out_results, out_count);
+    });
+}
+
+PredictorStatus Predictor_GetFuzzyPredictionsInto(PredictorRef predictor, const wchar_t* prefix, float tolerance,
+                                                  enum TargetScript target_script,
+                                                  enum AnnotationDataType annotation_type, size_t max_results,
+                                                  void* buffer, size_t buffer_size, PredictorResult** out_results,
+                                                  size_t* out_count)
+{
+    if (!predictor || !prefix || !(tolerance >= 0) || !out_results || !out_count || !isResultAligned(buffer))
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    *out_results = nullptr;
+    *out_count = 0;
+    return guarded(*predictor, [&] {
+        return packInto(*predictor,
+                        predictor->predictor.fuzzyPredictions(fromApi(prefix), tolerance, target_script,
+                                                              annotation_type, max_results),
+                        buffer, buffer_size, out_results, out_count);
+    });
+}
+
+PredictorStatus Predictor_GetAnjalPredictionsInto(PredictorRef predictor, const char* keystrokes,
+                                                  enum TargetScript target_script,
+                                                  enum AnnotationDataType annotation_type, size_t max_results,
+                                                  void* buffer, size_t buffer_size, PredictorResult** out_results,
+                                                  size_t* out_count)
+{
+    if (!predictor || !keystrokes || !out_results || !out_count || !isResultAligned(buffer))
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    *out_results = nullptr;
+    *out_count = 0;
+    return guarded(*predictor, [&] {
+        return packInto(*predictor,
+                        predictor->predictor.anjalPredictions(keystrokes, target_script, annotation_type,
+                                                              max_results),
+                        buffer, buffer_size, out_results, out_count);
+    });
+}
+
+PredictorCursorRef Predictor_CreateCursor(PredictorRef predictor, PredictorStatus* status)
+{
+    PredictorCursorRef cursor = predictor ? new (std::nothrow) PredictorCursorHandle(*predictor) : nullptr;
+    if (status)
+        *status = cursor ? PREDICTOR_SUCCESS : predictor ? PREDICTOR_ERROR_OUT_OF_MEMORY : PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return cursor;
+}
+
+void Predictor_DestroyCursor(PredictorCursorRef cursor)
+{
+    delete cursor;
+}
+
+PredictorStatus Predictor_CursorExtend(PredictorCursorRef cursor, const wchar_t* text)
+{
+    if (!cursor || !text)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    // the cursor walks the owner's dictionary, which Predictor_Initialize may replace
+    return guarded(cursor->owner, [&] {
+        cursor->cursor.extend(fromApi(text));
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_CursorRetract(PredictorCursorRef cursor, size_t count, size_t* out_removed)
+{
+    if (!cursor)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(cursor->owner, [&] {
+        size_t removed = cursor->cursor.retract(count);
+        if (out_removed)
+            *out_removed = removed;
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_CursorReset(PredictorCursorRef cursor)
+{
+    if (!cursor)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(cursor->owner, [&] {
+        cursor->cursor.reset();
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_GetCursorPredictions(PredictorCursorRef cursor, enum TargetScript target_script,
+                                               enum AnnotationDataType annotation_type, size_t max_results,
+                                               void* buffer, size_t buffer_size, PredictorResult** out_results,
+                                               size_t* out_count)
+{
+    if (!cursor || !out_results || !out_count || !isResultAligned(buffer))
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    *out_results = nullptr;
+    *out_count = 0;
+    return guarded(cursor->owner, [&] {
+        PredictorHandle& owner = cursor->owner;
+        return packInto(owner,
+                        owner.predictor.cursorPredictions(cursor->cursor, target_script, annotation_type, max_results),
+                        buffer, buffer_size, out_results, out_count);
+    });
+}
+
+PredictorStatus Predictor_SubmitAsync(PredictorRef predictor, const PredictorRequest* request,
+                                     PredictorCompletionCallback callback, void* context, uint64_t* out_ticket)
+{
+    bool valid = request && (request->kind == PREDICTOR_REQUEST_WORDS ? request->prefix != nullptr
+                             : request->kind == PREDICTOR_REQUEST_NGRAMS && request->base_word != nullptr);
+    if (!predictor || !valid)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded([&] {
+        uint64_t ticket = predictor->runner.submit(
+            request->session, std::make_unique<PredictionJob>(*predictor, *request, callback, context));
+        if (out_ticket)
+            *out_ticket = ticket;
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_CancelAsync(PredictorRef predictor, uint64_t ticket)
+{
+    if (!predictor)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return predictor->runner.cancel(ticket) ? PREDICTOR_SUCCESS : PREDICTOR_ERROR_INVALID_ARGUMENT;
+}
+
+int Predictor_PollCompletion(PredictorRef predictor, PredictorCompletion* out_completion)
+{
+    if (!predictor || !out_completion)
+        return 0;
+    return predictor->completions.pop(*out_completion) ? 1 : 0;
+}
+
+PredictorStatus Predictor_AddWord(PredictorRef predictor, const wchar_t* word)
+{
+    if (!predictor || !word)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        predictor->predictor.addWord(fromApi(word));
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_AddBigram(PredictorRef predictor, const wchar_t* word1, const wchar_t* word2)
+{
+    if (!predictor || !word1 || !word2)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        predictor->predictor.addBigram(fromApi(word1), fromApi(word2));
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_AddTrigram(PredictorRef predictor, const wchar_t* word1, const wchar_t* word2,
+                                     const wchar_t* word3)
+{
+    if (!predictor || !word1 || !word2 || !word3)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        predictor->predictor.addTrigram(fromApi(word1), fromApi(word2), fromApi(word3));
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_GetAnnotationsCount(PredictorRef predictor, size_t* out_count)
+{
+    if (!predictor || !out_count)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    std::lock_guard<std::mutex> lock(predictor->mutex);
+    *out_count = predictor->predictor.annotationCount();
+    return PREDICTOR_SUCCESS;
+}
+
+PredictorStatus Predictor_GetAnnotation(PredictorRef predictor, int32_t word_id,
+                                        enum AnnotationDataType annotation_type, const wchar_t** out_annotation)
+{
+    if (!predictor || !out_annotation)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    *out_annotation = nullptr;
+    return guarded(*predictor, [&] {
+        TextView annotation = predictor->predictor.annotation(word_id, annotation_type);
+        if (!annotation.empty())
+            *out_annotation = toApi(annotation.data());
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_ImportAnnotationsFromTextFile(PredictorRef predictor, const char* fileName,
+                                                        size_t* out_count)
+{
+    if (!predictor || !fileName || !out_count)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        return predictor->predictor.importAnnotations(fileName, *out_count) ? PREDICTOR_SUCCESS
+                                                                           : PREDICTOR_ERROR_INVALID_ARGUMENT;
+    });
+}
+
+PredictorStatus Predictor_ImportShortcutsFromTextFile(PredictorRef predictor, const char* fileName,
+                                                      size_t* out_count)
+{
+    if (!predictor || !fileName || !out_count)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        return predictor->predictor.importShortcuts(fileName, *out_count) ? PREDICTOR_SUCCESS
+                                                                         : PREDICTOR_ERROR_INVALID_ARGUMENT;
+    });
+}
+
+PredictorStatus Predictor_ImportBlacklistFromTextFile(PredictorRef predictor, const char* fileName,
+                                                      size_t* out_count)
+{
+    if (!predictor || !fileName || !out_count)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        return predictor->predictor.importBlacklist(fileName, *out_count) ? PREDICTOR_SUCCESS
+                                                                         : PREDICTOR_ERROR_INVALID_ARGUMENT;
+    });
+}
+
+PredictorStatus Predictor_RemoveWord(PredictorRef predictor, const wchar_t* word, size_t* out_result)
+{
+    if (!predictor || !word || !out_result)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    return guarded(*predictor, [&] {
+        *out_result = predictor->predictor.removeWord(fromApi(word)) ? 1 : 0;
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_ConvertToBrahmi(const wchar_t* word, wchar_t** out_result)
+{
+    if (!word || !out_result)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    *out_result = nullptr;
+    return guarded([&] {
+        Text brahmi = predictor::convertToBrahmi(fromApi(word));
+
+        // The hosts read the result as UTF-16 packed into wchar_t: with a 32
+        // bit wchar_t each element carries two code units, the first in the
+        // low half, so a Brahmi surrogate pair fills exactly one element.
+        constexpr size_t unitsPerChar = sizeof(wchar_t) / sizeof(char16_t);
+        size_t chars = (brahmi.size() + unitsPerChar - 1) / unitsPerChar;
+        wchar_t* result = static_cast<wchar_t*>(std::calloc(chars + 1, sizeof(wchar_t)));
+        if (!result)
+            return PREDICTOR_ERROR_OUT_OF_MEMORY;
+        std::memcpy(result, brahmi.data(), brahmi.size() * sizeof(char16_t));
+        *out_result = result;
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_ConvertTextInto(const wchar_t* text, enum TargetScript target_script, void* buffer,
+                                          size_t buffer_size, const wchar_t** out_text, size_t* out_length)
+{
+    if (!text || !out_text || !out_length || reinterpret_cast<uintptr_t>(buffer) % alignof(wchar_t) != 0)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    *out_text = nullptr;
+    return guarded([&] {
+        Text converted = predictor::convertScript(fromApi(text), target_script);
+        *out_length = converted.size();
+        if (!buffer)
+            return PREDICTOR_SUCCESS;
+        if ((converted.size() + 1) * sizeof(char16_t) > buffer_size)
+            return PREDICTOR_ERROR_INVALID_ARGUMENT;
+        char* cursor = static_cast<char*>(buffer);
+        *out_text = copyText(converted, cursor);
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+PredictorStatus Predictor_ConvertResults(PredictorResult* results, size_t count, enum TargetScript target_script,
+                                         void* buffer, size_t buffer_size, size_t* out_count)
+{
+    if ((!results && count > 0) || !out_count || (!buffer && buffer_size > 0) ||
+        reinterpret_cast<uintptr_t>(buffer) % alignof(wchar_t) != 0)
+        return PREDICTOR_ERROR_INVALID_ARGUMENT;
+    *out_count = 0;
+    return guarded([&] {
+        std::vector<TextView> words(count);
+        for (size_t i = 0; i < count; i++)
+            words[i] = fromApi(results[i].word);
+        Text converted;
+        std::vector<size_t> ends(count);
+        predictor::appendScripts(words.data(), words.size(), target_script, converted, ends.data());
+
+        char* cursor = static_cast<char*>(buffer);
+        size_t used = 0, start = 0;
+        for (size_t i = 0; i < count; i++) {
+            TextView word = TextView(converted).substr(start, ends[i] - start);
+            start = ends[i];
+            if (used + textBytes(word) > buffer_size)
+                break;
+            used += textBytes(word);
+            results[i].word = copyText(word, cursor);
+            *out_count = i + 1;
+        }
+        return PREDICTOR_SUCCESS;
+    });
+}
+
+void Predictor_FreeResults(PredictorResult* results)
+{
+    std::free(results);
+}
+
+void Predictor_SetDebugMode(PredictorRef predictor, int enable)
+{
+    if (!predictor)
+        return;
+    std::lock_guard<std::mutex> lock(predictor->mutex);
+    predictor->predictor.setDebug(enable != 0);
+}
+
+} // extern "C"
@@ -0,0 +1,140 @@
+#ifndef PREDICTOR_SYNTHETIC_CORPUS_H
+#define PREDICTOR_SYNTHETIC_CORPUS_H
+
+// Deterministic Tamil-like word lists for the benchmarks, so they run
+// without the licensed ta_main word list. Words are one to six syllables of
+// consonant plus vowel sign (or pulli), with Zipf distributed frequencies in
+// a random rank order, which gives a trie of about the shape and fan-out of
+// the real one.
+//
+// sentences() strings such words into text with word-to-word structure for
+// the n-gram benchmarks: each word has a few favoured followers, which come
+// next most of the time.
+
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+#include "DictionaryBuilder.h"
+#include "Utf16.h"
+
+namespace predictor {
+namespace synthetic {
+
+inline const std::vector<char16_t>& consonants()
+{
+    static const std::vector<char16_t> list = {
+        0x0B95, 0x0B99, 0x0B9A, 0x0B9E, 0x0B9F, 0x0BA3, 0x0BA4, 0x0BA8, 0x0BAA,
+        0x0BAE, 0x0BAF, 0x0BB0, 0x0BB2, 0x0BB5, 0x0BB4, 0x0BB3, 0x0BB1, 0x0BA9,
+        0x0B9C, 0x0BB7, 0x0BB8, 0x0BB9,
+    };
+    return list;
+}
+
+inline const std::vector<char16_t>& vowels()
+{
+    static const std::vector<char16_t> list = {
+        0x0B85, 0x0B86, 0x0B87, 0x0B88, 0x0B89, 0x0B8A, 0x0B8E, 0x0B8F, 0x0B90, 0x0B92, 0x0B93,
+    };
+    return list;
+}
+
+// Vowel signs, with 0 for the inherent a
+inline const std::vector<char16_t>& vowelSigns()
+{
+    static const std::vector<char16_t> list = {
+        0, 0, 0, 0x0BBE, 0x0BBF, 0x0BC0, 0x0BC1, 0x0BC2, 0x0BC6, 0x0BC7, 0x0BC8, 0x0BCA, 0x0BCB, 0x0BCD, 0x0BCD,
+    };
+    return list;
+}
+
+// Syllables are drawn with a skew so that common ones dominate, as in text
+template <typename Random>
+size_t skewedIndex(Random& random, size_t size)
+{
+    std::uniform_real_distribution<double> unit(0.0, 1.0);
+    double u = unit(random);
+    return static_cast<size_t>(u * u * static_cast<double>(size)) % size;
+}
+
+template <typename Random>
+void appendSyllable(Text& word, Random& random, bool first)
+{
+    if (first && skewedIndex(random, 6) == 0) {
+        word.push_back(vowels()[skewedIndex(random, vowels().size())]);
+        return;
+    }
+    word.push_back(consonants()[skewedIndex(random, consonants().size())]);
+    char16_t sign = vowelSigns()[skewedIndex(random, vowelSigns().size())];
+    if (sign)
+        word.push_back(sign);
+}
+
+template <typename Random>
+Text randomWord(Random& random, int minSyllables, int maxSyllables)
+{
+    std::uniform_int_distribution<int> length(minSyllables, maxSyllables);
+    Text word;
+    int syllables = length(random);
+    for (int i = 0; i < syllables; i++)
+        appendSyllable(word, random, i == 0);
+    return word;
+}
+
+// 'count' distinct words; the word at rank r has frequency about 10^8 / r
+inline std::vector<DictionaryEntry> words(size_t count, uint32_t seed = 1)
+{
+    std::mt19937 random(seed);
+    std::unordered_set<Text> seen;
+    std::vector<DictionaryEntry> entries;
+    entries.reserve(count);
+    while (entries.size() < count) {
+        Text word = randomWord(random, 1, 6);
+        if (!seen.insert(word).second)
+            continue;
+        double rank = static_cast<double>(entries.size() + 1);
+        entries.push_back({ std::move(word), static_cast<uint32_t>(1e8 / rank) });
+    }
+    return entries;
+}
+
+// 'count' sentences of 4 to 20 words, as indices into 'entries'. After a
+// word comes one of its eight followers 70% of the time, the first more
+// often than the last, and otherwise any word by frequency.
+inline std::vector<std::vector<uint32_t>> sentences(const std::vector<DictionaryEntry>& entries, size_t count,
+                                                    uint32_t seed = 1)
+{
+    constexpr size_t kFollowers = 8;
+    std::mt19937 random(seed);
+    std::vector<double> weights;
+    weights.reserve(entries.size());
+    for (const DictionaryEntry& entry : entries)
+        weights.push_back(entry.frequency);
+    std::discrete_distribution<uint32_t> byFrequency(weights.begin(), weights.end());
+
+    std::vector<uint32_t> followers(entries.size() * kFollowers);
+    for (uint32_t& follower : followers)
+        follower = byFrequency(random);
+
+    std::uniform_int_distribution<int> length(4, 20), percent(0, 99);
+    std::vector<std::vector<uint32_t>> out(count);
+    for (std::vector<uint32_t>& sentence : out) {
+        int words = length(random);
+        sentence.push_back(byFrequency(random));
+        for (int i = 1; i < words; i++) {
+            uint32_t previous = sentence.back();
+            if (percent(random) < 70)
+                sentence.push_back(followers[previous * kFollowers + skewedIndex(random, kFollowers)]);
+            else
+                sentence.push_back(byFrequency(random));
+        }
+    }
+    return out;
+}
+
+} // namespace synthetic
+} // namespace predictor
+
+#endif // PREDICTOR_SYNTHETIC_CORPUS_H
@@ -0,0 +1,243 @@
+// Heap allocations per keystroke through the C API, with malloc'd results
+// (Predictor_GetWordPredictions) and with the ..._Into calls writing to a
+// caller buffer or to the handle's arena.
+//
+//   allocation_benchmark [words] [typed words]
+//
+// Simulated typing over a synthetic dictionary (default 500000 words): each
+// typed word, drawn by frequency, is queried after every key, then learned
+// with its bigram and followed by a next-word query. Global operator new is
+// counted around the queries only, on the querying thread; learning and the
+// user dictionary's writer thread are allowed to allocate.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "DictionaryBuilder.h"
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+std::atomic<size_t> allocations{ 0 };
+thread_local bool counting = false;     // set around the measured calls
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    if (counting)
+        allocations.fetch_add(1, std::memory_order_relaxed);
+    if (void* memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace {
+
+constexpr size_t kMaxResults = 10;
+constexpr size_t kWarmUpWords = 50;
+
+enum class Mode { Malloc, Buffer, Arena };
+
+struct Tally {
+    size_t keystrokes = 0;
+    size_t allocations = 0;
+    size_t warmAllocations = 0;     // after the first kWarmUpWords words
+    size_t worst = 0;               // most in one warm keystroke
+    size_t resultBlocks = 0;        // malloc'd result blocks, Mode::Malloc only
+    std::vector<double> micros;
+
+    void add(size_t count, bool warm, double micro)
+    {
+        keystrokes++;
+        allocations += count;
+        if (warm) {
+            warmAllocations += count;
+            worst = std::max(worst, count);
+        }
+        micros.push_back(micro);
+    }
+
+    double percentile(double p)
+    {
+        std::sort(micros.begin(), micros.end());
+        return micros[static_cast<size_t>(p * static_cast<double>(micros.size() - 1))];
+    }
+};
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+// One query in 'mode'; returns the number of results
+size_t query(PredictorRef predictor, Mode mode, const Text& previous, const Text& prefix, bool ngram, Tally& tally)
+{
+    alignas(PredictorResult) static char buffer[PREDICTOR_RESULT_BUFFER_SIZE(kMaxResults)];
+    PredictorResult* results = nullptr;
+    size_t count = 0;
+    const wchar_t* base = toApi(previous.c_str());
+    const wchar_t* typed = toApi(prefix.c_str());
+
+    if (mode == Mode::Malloc) {
+        if (ngram)
+            Predictor_GetNgramPredictions(predictor, base, nullptr, typed, Tamil, Meaning, kMaxResults, &results, &count);
+        else
+            Predictor_GetWordPredictions(predictor, typed, Tamil, Meaning, kMaxResults, &results, &count);
+        if (results)
+            tally.resultBlocks++;
+        Predictor_FreeResults(results);
+        return count;
+    }
+
+    void* memory = mode == Mode::Buffer ? buffer : nullptr;
+    if (ngram)
+        Predictor_GetNgramPredictionsInto(predictor, base, nullptr, typed, Tamil, Meaning, kMaxResults, memory,
+                                          sizeof(buffer), &results, &count);
+    else
+        Predictor_GetWordPredictionsInto(predictor, typed, Tamil, Meaning, kMaxResults, memory, sizeof(buffer),
+                                         &results, &count);
+    return count;
+}
+
+Tally type(Mode mode, const std::string& dictionaryPath, const std::string& annotationsPath,
+           const std::vector<Text>& typed)
+{
+    std::string userPath = temporaryPath("allocation_benchmark_user.data");
+    std::remove(userPath.c_str());
+
+    PredictorStatus status;
+    PredictorRef predictor = Predictor_Create(0, &status);
+    size_t annotations = 0;
+    if (!predictor || Predictor_Initialize(predictor, dictionaryPath.c_str()) != PREDICTOR_SUCCESS ||
+        Predictor_SetUserDictionary(predictor, userPath.c_str()) != PREDICTOR_SUCCESS ||
+        Predictor_ImportAnnotationsFromTextFile(predictor, annotationsPath.c_str(), &annotations) != PREDICTOR_SUCCESS) {
+        std::fprintf(stderr, "cannot set up the predictor\n");
+        std::exit(1);
+    }
+    // count what a query allocates, not what the result cache keeps
+    Predictor_SetCacheBudget(predictor, 0);
+
+    Tally tally;
+    Text previous;
+    for (size_t w = 0; w < typed.size(); w++) {
+        const Text& word = typed[w];
+        bool warm = w >= kWarmUpWords;
+        for (size_t length = 1; length <= word.size(); length++) {
+            Text prefix = word.substr(0, length);
+            size_t before = allocations.load(std::memory_order_relaxed);
+            Clock::time_point start = Clock::now();
+            counting = true;
+            query(predictor, mode, previous, prefix, !previous.empty() && length == 1, tally);
+            counting = false;
+            double micro = std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+            tally.add(allocations.load(std::memory_order_relaxed) - before, warm, micro);
+        }
+
+        Predictor_AddWord(predictor, toApi(word.c_str()));
+        if (!previous.empty())
+            Predictor_AddBigram(predictor, toApi(previous.c_str()), toApi(word.c_str()));
+        previous = word;
+    }
+
+    Predictor_Destroy(predictor);
+    std::remove(userPath.c_str());
+    return tally;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t wordCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500000;
+    size_t typedCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+    if (wordCount == 0 || typedCount <= kWarmUpWords) {
+        std::fprintf(stderr, "usage: %s [words] [typed words, more than %zu]\n", argv[0], kWarmUpWords);
+        return 2;
+    }
+
+    std::string dictionaryPath = temporaryPath("allocation_benchmark.data");
+    std::string annotationsPath = temporaryPath("allocation_benchmark_annotations.txt");
+    std::vector<Text> typed;
+    {
+        std::vector<DictionaryEntry> words = synthetic::words(wordCount);
+        DictionaryBuilder builder;
+        std::vector<double> weights;
+        std::ofstream annotations(annotationsPath, std::ios::binary);
+        for (size_t i = 0; i < words.size(); i++) {
+            weights.push_back(words[i].frequency);
+            if (i % 10 == 0)
+                annotations << toUtf8(words[i].word) << "\tmeaning " << i << "\ttranslit " << i << '\n';
+            builder.add(words[i].word, words[i].frequency);
+        }
+        if (!builder.write(dictionaryPath) || !annotations) {
+            std::fprintf(stderr, "cannot write to %s\n", dictionaryPath.c_str());
+            return 1;
+        }
+
+        std::mt19937 random(5);
+        std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+        for (size_t i = 0; i < typedCount; i++)
+            typed.push_back(words[pick(random)].word);
+    }
+
+    std::printf("%zu words, %zu typed, top %zu with meanings\n\n", wordCount, typedCount, kMaxResults);
+    std::printf("results        keystrokes  operator new  per key  after warm-up  worst warm  "
+                "malloc'd  p50 us  p99 us\n");
+    const struct {
+        Mode mode;
+        const char* name;
+    } modes[] = { { Mode::Malloc, "malloc'd" }, { Mode::Buffer, "caller buffer" }, { Mode::Arena, "handle arena" } };
+    for (const auto& mode : modes) {
+        Tally tally = type(mode.mode, dictionaryPath, annotationsPath, typed);
+        std::printf("%-13s  %10zu  %12zu  %7.2f  %13zu  %10zu  %8zu  %6.1f  %6.1f\n", mode.name, tally.keystrokes,
+                    tally.allocations, static_cast<double>(tally.allocations) / static_cast<double>(tally.keystrokes),
+                    tally.warmAllocations,
+                    tally.worst, tally.resultBlocks, tally.percentile(0.5), tally.percentile(0.99));
+    }
+
+    std::remove(dictionaryPath.c_str());
+    std::remove(annotationsPath.c_str());
+    return 0;
+}
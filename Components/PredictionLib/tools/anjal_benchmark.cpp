@@ -0,0 +1,231 @@
+// Recall and per-keystroke latency of Predictor_GetAnjalPredictionsInto.
+//
+//   anjal_benchmark [words] [typed words]
+//
+// Words are drawn by frequency from a synthetic dictionary (default 500000
+// words) and typed in Anjal keys (default 5000 typed words), some of their
+// syllables, or all of them, up to 20 keys. Half are typed sloppily, as
+// people do: n for ந, ண and ன, l for ல, ள and ழ, r for ர and ற. A word is
+// recalled when it is among the top results. The lattice of readings is set
+// against plain completions of the one reading the keyboard would type.
+// Latency is of every keystroke of the words. Then, for the worst case,
+// keys drawn from the ambiguous ones alone, up to 20 long, are searched.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "DictionaryBuilder.h"
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kMaxResults = 10;
+constexpr size_t kMaxKeys = 20;
+
+struct Timing {
+    std::vector<double> micros;
+
+    double percentile(double p)
+    {
+        std::sort(micros.begin(), micros.end());
+        return micros[static_cast<size_t>(p * static_cast<double>(micros.size() - 1))];
+    }
+};
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+double since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// A letter as the Anjal keyboard types it, and as typed sloppily with the
+// letter the keyboard then gives
+struct Typing {
+    char16_t letter;
+    const char* keys;
+    const char* sloppyKeys;
+    char16_t sloppyLetter;
+};
+
+const Typing kTypings[] = {
+    { u'க', "k", "k", u'க' },   { u'ங', "ng", "ng", u'ங' }, { u'ச', "c", "c", u'ச' },   { u'ஞ', "nj", "nj", u'ஞ' },
+    { u'ட', "d", "d", u'ட' },   { u'ண', "N", "n", u'ன' },   { u'த', "th", "th", u'த' }, { u'ந', "w", "n", u'ன' },
+    { u'ப', "p", "p", u'ப' },   { u'ம', "m", "m", u'ம' },   { u'ய', "y", "y", u'ய' },   { u'ர', "r", "r", u'ர' },
+    { u'ல', "l", "l", u'ல' },   { u'வ', "v", "v", u'வ' },   { u'ழ', "z", "l", u'ல' },   { u'ள', "L", "l", u'ல' },
+    { u'ற', "R", "r", u'ர' },   { u'ன', "n", "n", u'ன' },   { u'ஜ', "j", "j", u'ஜ' },   { u'ஷ', "sh", "sh", u'ஷ' },
+    { u'ஸ', "S", "S", u'ஸ' },   { u'ஹ', "h", "h", u'ஹ' },   { u'அ', "a", "a", u'அ' },   { u'ஆ', "aa", "aa", u'ஆ' },
+    { u'இ', "i", "i", u'இ' },   { u'ஈ', "ii", "ii", u'ஈ' }, { u'உ', "u", "u", u'உ' },   { u'ஊ', "uu", "uu", u'ஊ' },
+    { u'எ', "e", "e", u'எ' },   { u'ஏ', "ee", "ee", u'ஏ' }, { u'ஐ', "ai", "ai", u'ஐ' }, { u'ஒ', "o", "o", u'ஒ' },
+    { u'ஓ', "oo", "oo", u'ஓ' }, { u'ா', "aa", "aa", u'ா' }, { u'ி', "i", "i", u'ி' },   { u'ீ', "ii", "ii", u'ீ' },
+    { u'ு', "u", "u", u'ு' },   { u'ூ', "uu", "uu", u'ூ' }, { u'ெ', "e", "e", u'ெ' },   { u'ே', "ee", "ee", u'ே' },
+    { u'ை', "ai", "ai", u'ை' }, { u'ொ', "o", "o", u'ொ' },   { u'ோ', "oo", "oo", u'ோ' }, { u'்', "", "", u'்' },
+};
+
+const Typing* typingOf(char16_t letter)
+{
+    for (const Typing& typing : kTypings) {
+        if (typing.letter == letter)
+            return &typing;
+    }
+    return nullptr;
+}
+
+bool isConsonant(char16_t unit) { return unit >= 0x0B95 && unit <= 0x0BB9; }
+bool isSign(char16_t unit) { return unit >= 0x0BBE && unit <= 0x0BCD; }
+
+// The keys for the first 'letters' code units of 'word', whole syllables,
+// and the text the keyboard types for them; false if it has no such keys
+bool type(const Text& word, size_t letters, bool sloppy, std::string& keys, Text& typed)
+{
+    keys.clear();
+    typed.clear();
+    for (size_t i = 0; i < letters; i++) {
+        const Typing* typing = typingOf(word[i]);
+        if (!typing)
+            return false;
+        keys += sloppy ? typing->sloppyKeys : typing->keys;
+        typed += sloppy ? typing->sloppyLetter : typing->letter;
+        // The inherent a is typed too
+        if (isConsonant(word[i]) && (i + 1 == word.size() || !isSign(word[i + 1])))
+            keys += 'a';
+    }
+    return !keys.empty() && keys.size() <= kMaxKeys;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t wordCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500000;
+    size_t typedCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 5000;
+    if (wordCount == 0 || typedCount == 0) {
+        std::fprintf(stderr, "usage: %s [words] [typed words]\n", argv[0]);
+        return 2;
+    }
+
+    std::string dictionaryPath = temporaryPath("anjal_benchmark.data");
+    std::vector<DictionaryEntry> words = synthetic::words(wordCount);
+    {
+        DictionaryBuilder builder;
+        for (const DictionaryEntry& entry : words)
+            builder.add(entry.word, entry.frequency);
+        if (!builder.write(dictionaryPath)) {
+            std::fprintf(stderr, "cannot write to %s\n", dictionaryPath.c_str());
+            return 1;
+        }
+    }
+
+    PredictorStatus status;
+    PredictorRef predictor = Predictor_Create(0, &status);
+    if (!predictor || Predictor_Initialize(predictor, dictionaryPath.c_str()) != PREDICTOR_SUCCESS) {
+        std::fprintf(stderr, "cannot set up the predictor\n");
+        return 1;
+    }
+
+    // Keys typed for a word, as far as a syllable boundary, and the text
+    // the keyboard gives for them
+    struct Typed {
+        std::string keys;
+        Text text;
+        const Text* word;
+        bool sloppy;
+    };
+    std::mt19937 random(7);
+    std::vector<double> weights;
+    for (const DictionaryEntry& entry : words)
+        weights.push_back(entry.frequency);
+    std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+    std::vector<Typed> typedWords;
+    while (typedWords.size() < typedCount) {
+        const Text& word = words[pick(random)].word;
+        std::vector<size_t> boundaries;
+        for (size_t i = 1; i <= word.size(); i++) {
+            if (i == word.size() || !isSign(word[i]))
+                boundaries.push_back(i);
+        }
+        size_t letters = boundaries[random() % boundaries.size()];
+        Typed entry{ {}, {}, &word, typedWords.size() % 2 == 1 };
+        if (type(word, letters, entry.sloppy, entry.keys, entry.text))
+            typedWords.push_back(std::move(entry));
+    }
+
+    alignas(PredictorResult) static char buffer[PREDICTOR_RESULT_BUFFER_SIZE(kMaxResults)];
+    auto recalled = [&](const Text& word, PredictorResult* results, size_t count) {
+        for (size_t i = 0; i < count; i++) {
+            if (fromApi(results[i].word) == TextView(word))
+                return true;
+        }
+        return false;
+    };
+
+    // [0] exact, [1] sloppy; one reading, then the lattice
+    size_t hits[2][2] = {}, counts[2] = {};
+    Timing perKey;
+    for (const Typed& entry : typedWords) {
+        PredictorResult* results;
+        size_t count;
+        counts[entry.sloppy]++;
+        Predictor_GetWordPredictionsInto(predictor, toApi(entry.text.c_str()), Tamil, NotRequired, kMaxResults,
+                                         buffer, sizeof(buffer), &results, &count);
+        hits[entry.sloppy][0] += recalled(*entry.word, results, count);
+        for (size_t length = 1; length <= entry.keys.size(); length++) {
+            std::string keys = entry.keys.substr(0, length);
+            Clock::time_point start = Clock::now();
+            Predictor_GetAnjalPredictionsInto(predictor, keys.c_str(), Tamil, NotRequired, kMaxResults, buffer,
+                                              sizeof(buffer), &results, &count);
+            perKey.micros.push_back(since(start));
+        }
+        hits[entry.sloppy][1] += recalled(*entry.word, results, count);
+    }
+
+    std::printf("%zu words, %zu typed words, top %zu\n\n", wordCount, typedWords.size(), kMaxResults);
+    std::printf("                 one reading   lattice\n");
+    for (int sloppy = 0; sloppy < 2; sloppy++) {
+        double total = static_cast<double>(std::max<size_t>(counts[sloppy], 1));
+        std::printf("%-16s %10.1f%% %8.1f%%\n", sloppy ? "sloppy" : "exact", 100.0 * hits[sloppy][0] / total,
+                    100.0 * hits[sloppy][1] / total);
+    }
+    std::printf("\nper keystroke, microseconds: p50 %.1f, p99 %.1f, max %.1f\n", perKey.percentile(0.5),
+                perKey.percentile(0.99), perKey.percentile(1.0));
+
+    // Worst case: the keys with the most readings, every prefix up to 20
+    Timing worst;
+    const char ambiguous[] = "nlrRNLzaiu";
+    for (size_t i = 0; i < 200; i++) {
+        std::string keys;
+        for (size_t k = 0; k < kMaxKeys; k++)
+            keys += ambiguous[random() % (sizeof(ambiguous) - 1)];
+        for (size_t length = 1; length <= keys.size(); length++) {
+            PredictorResult* results;
+            size_t count;
+            std::string prefix = keys.substr(0, length);
+            Clock::time_point start = Clock::now();
+            Predictor_GetAnjalPredictionsInto(predictor, prefix.c_str(), Tamil, NotRequired, kMaxResults, buffer,
+                                              sizeof(buffer), &results, &count);
+            worst.micros.push_back(since(start));
+        }
+    }
+    std::printf("ambiguous keys: p50 %.1f, p99 %.1f, max %.1f\n", worst.percentile(0.5), worst.percentile(0.99),
+                worst.percentile(1.0));
+
+    Predictor_Destroy(predictor);
+    std::remove(dictionaryPath.c_str());
+    return 0;
+}
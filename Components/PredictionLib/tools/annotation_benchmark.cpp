@@ -0,0 +1,234 @@
+// Startup cost and resident memory of annotations imported from text
+// against the same annotations mapped from a built file.
+//
+//   annotation_benchmark [words] [annotated words]
+//
+// A synthetic dictionary (default 500000 words) is written with meanings
+// and transliterations for its most frequent words (default 200000), once
+// as the text file Predictor_ImportAnnotationsFromTextFile reads and once
+// built with AnnotationStoreBuilder. Each way of loading them runs in a
+// fresh process (the benchmark re-executing itself with --text or
+// --mapped), so the memory it reports is its own: after loading, and after
+// queries that look up the annotations of the five candidates a keyboard
+// shows, as Predictor_GetAnnotation does.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <mach/mach.h>
+#endif
+
+#include "AnnotationStoreBuilder.h"
+#include "Dictionary.h"
+#include "DictionaryBuilder.h"
+#include "ScriptConverter.h"
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kMaxResults = 10;
+constexpr size_t kShown = 5;
+constexpr size_t kQueries = 5000;
+
+double millisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+struct Memory {
+    size_t resident = 0;    // all resident pages, including clean file pages
+    size_t footprint = 0;   // private memory: what the OS charges the process for
+};
+
+// Zero where it cannot be read. Footprint is phys_footprint on Apple
+// platforms and resident minus file-backed pages on Linux.
+Memory memoryUse()
+{
+    Memory memory;
+#if defined(__APPLE__)
+    task_vm_info_data_t info;
+    mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+    if (task_info(mach_task_self(), TASK_VM_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        memory.resident = info.resident_size;
+        memory.footprint = info.phys_footprint;
+    }
+#elif defined(__linux__)
+    FILE* statm = std::fopen("/proc/self/statm", "r");
+    if (!statm)
+        return memory;
+    unsigned long size = 0, resident = 0, shared = 0;
+    if (std::fscanf(statm, "%lu %lu %lu", &size, &resident, &shared) == 3) {
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        memory.resident = resident * page;
+        memory.footprint = (resident - shared) * page;
+    }
+    std::fclose(statm);
+#endif
+    return memory;
+}
+
+// Run this program again with 'mode', the dictionary and the annotations,
+// and wait for it
+bool runMeasurement(const char* self, const char* mode, const std::string& dictionary, const std::string& annotations)
+{
+    std::fflush(stdout);
+    pid_t child = fork();
+    if (child == 0) {
+        execl(self, self, mode, dictionary.c_str(), annotations.c_str(), static_cast<char*>(nullptr));
+        _exit(127);
+    }
+    int status = 0;
+    return child > 0 && waitpid(child, &status, 0) == child && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+double megabytes(size_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); }
+
+void printMemory(const char* label, const Memory& before, const Memory& after)
+{
+    std::printf("  %-16s %10.2f MB resident, %.2f MB footprint\n", label,
+                megabytes(after.resident - before.resident), megabytes(after.footprint - before.footprint));
+}
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+// Load the annotations one way, then query as a keyboard does
+int measure(const char* mode, const char* dictionaryPath, const char* annotationsPath)
+{
+    bool mapped = std::strcmp(mode, "--mapped") == 0;
+    PredictorStatus status;
+    PredictorRef predictor = Predictor_Create(0, &status);
+    if (!predictor || Predictor_Initialize(predictor, dictionaryPath) != PREDICTOR_SUCCESS)
+        return 1;
+
+    Memory before = memoryUse();
+    Clock::time_point start = Clock::now();
+    size_t imported = 0;
+    status = mapped ? Predictor_LoadAnnotations(predictor, annotationsPath)
+                    : Predictor_ImportAnnotationsFromTextFile(predictor, annotationsPath, &imported);
+    double loadMs = millisecondsSince(start);
+    Memory afterLoad = memoryUse();
+    if (status != PREDICTOR_SUCCESS)
+        return 1;
+
+    // Results without annotations, then those of the candidates shown
+    std::mt19937 random(7);
+    alignas(PredictorResult) static char buffer[PREDICTOR_RESULT_BUFFER_SIZE(kMaxResults)];
+    size_t shown = 0, annotated = 0;
+    start = Clock::now();
+    for (size_t i = 0; i < kQueries; i++) {
+        Text prefix = synthetic::randomWord(random, 1, 2);
+        PredictorResult* results;
+        size_t count;
+        Predictor_GetWordPredictionsInto(predictor, toApi(prefix.c_str()), Tamil, NotRequired, kMaxResults, buffer,
+                                         sizeof(buffer), &results, &count);
+        for (size_t r = 0; r < count && r < kShown; r++) {
+            const wchar_t* meaning;
+            Predictor_GetAnnotation(predictor, results[r].word_id, Meaning, &meaning);
+            shown++;
+            annotated += meaning != nullptr;
+        }
+    }
+    double queryUs = millisecondsSince(start) * 1000.0 / kQueries;
+    Memory afterQueries = memoryUse();
+
+    size_t count = 0;
+    Predictor_GetAnnotationsCount(predictor, &count);
+    std::printf("\n%s\n", mapped ? "mapped file" : "text import");
+    std::printf("  startup          %10.3f ms (%zu annotations)\n", loadMs, count);
+    std::printf("  queries          %10.2f us each (%zu of %zu shown candidates annotated)\n", queryUs, annotated,
+                shown);
+    printMemory("after load", before, afterLoad);
+    printMemory("after queries", before, afterQueries);
+    Predictor_Destroy(predictor);
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc == 4 && (std::strcmp(argv[1], "--text") == 0 || std::strcmp(argv[1], "--mapped") == 0))
+        return measure(argv[1], argv[2], argv[3]);
+
+    size_t wordCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500000;
+    size_t annotatedCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 200000;
+    if (wordCount == 0 || annotatedCount == 0) {
+        std::fprintf(stderr, "usage: %s [words] [annotated words]\n", argv[0]);
+        return 2;
+    }
+
+    std::string dictionaryPath = temporaryPath("annotation_benchmark.data");
+    std::string textPath = temporaryPath("annotation_benchmark.txt");
+    std::string mappedPath = temporaryPath("annotation_benchmark_annotations.data");
+    std::vector<DictionaryEntry> words = synthetic::words(wordCount);
+    {
+        DictionaryBuilder builder;
+        for (const DictionaryEntry& entry : words)
+            builder.add(entry.word, entry.frequency);
+        if (!builder.write(dictionaryPath)) {
+            std::fprintf(stderr, "cannot write to %s\n", dictionaryPath.c_str());
+            return 1;
+        }
+    }
+
+    // A meaning of two to five words and the transliteration of each word
+    Dictionary dictionary;
+    if (!dictionary.open(dictionaryPath.c_str())) {
+        std::fprintf(stderr, "cannot open %s: %s\n", dictionaryPath.c_str(), dictionary.error());
+        return 1;
+    }
+    AnnotationStoreBuilder builder(dictionary);
+    std::ofstream text(textPath, std::ios::binary | std::ios::trunc);
+    std::mt19937 random(3);
+    std::uniform_int_distribution<int> glossWords(2, 5);
+    for (size_t i = 0; i < annotatedCount && i < words.size(); i++) {
+        Text meaning;
+        for (int w = glossWords(random); w > 0; w--) {
+            if (!meaning.empty())
+                meaning += u' ';
+            meaning += synthetic::randomWord(random, 2, 4);
+        }
+        Text transliteration = convertScript(words[i].word, Transliterated);
+        builder.add(words[i].word, meaning, transliteration);
+        text << toUtf8(words[i].word) << '\t' << toUtf8(meaning) << '\t' << toUtf8(transliteration) << '\n';
+    }
+    text.close();
+    Clock::time_point start = Clock::now();
+    if (!text || !builder.write(mappedPath)) {
+        std::fprintf(stderr, "cannot write to %s\n", mappedPath.c_str());
+        return 1;
+    }
+    double buildMs = millisecondsSince(start);
+    std::ifstream sizes[2] = { std::ifstream(textPath, std::ios::binary | std::ios::ate),
+                               std::ifstream(mappedPath, std::ios::binary | std::ios::ate) };
+    std::printf("%zu words, %zu annotated: text %.1f MB, built %.1f MB in %.0f ms\n", words.size(), builder.size(),
+                megabytes(static_cast<size_t>(sizes[0].tellg())), megabytes(static_cast<size_t>(sizes[1].tellg())),
+                buildMs);
+
+    bool ok = runMeasurement(argv[0], "--text", dictionaryPath, textPath) &&
+              runMeasurement(argv[0], "--mapped", dictionaryPath, mappedPath);
+    std::remove(dictionaryPath.c_str());
+    std::remove(textPath.c_str());
+    std::remove(mappedPath.c_str());
+    return ok ? 0 : 1;
+}
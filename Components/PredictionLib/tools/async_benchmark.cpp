@@ -0,0 +1,202 @@
+// What the input thread pays for Predictor_SubmitAsync against a blocking
+// Predictor_GetWordPredictionsInto, over simulated fast typing.
+//
+//   async_benchmark [words] [typed words] [microseconds between keys]
+//
+// Words are drawn by frequency from a synthetic dictionary (default 500000
+// words) and typed a code point at a time (default 2000 words, a key every
+// 50 microseconds), each key submitted in one session so that it
+// supersedes the last. Completions are polled between keys. After a word's
+// last key the benchmark waits for its result, which must match the
+// blocking call's for the whole word, then times the blocking call for
+// each of the word's prefixes, as the input thread would have waited.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "DictionaryBuilder.h"
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kMaxResults = 10;
+constexpr uint32_t kSession = 1;
+
+struct Timing {
+    std::vector<double> micros;
+
+    double percentile(double p)
+    {
+        std::sort(micros.begin(), micros.end());
+        return micros[static_cast<size_t>(p * static_cast<double>(micros.size() - 1))];
+    }
+};
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+using Ranking = std::vector<std::pair<Text, float>>;
+
+Ranking ranking(const PredictorResult* results, size_t count)
+{
+    Ranking ranked;
+    for (size_t i = 0; i < count; i++)
+        ranked.emplace_back(Text(fromApi(results[i].word)), results[i].final_score);
+    return ranked;
+}
+
+double since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t wordCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500000;
+    size_t typedCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+    long interval = argc > 3 ? std::strtol(argv[3], nullptr, 10) : 50;
+    if (wordCount == 0 || typedCount == 0 || interval < 0) {
+        std::fprintf(stderr, "usage: %s [words] [typed words] [microseconds between keys]\n", argv[0]);
+        return 2;
+    }
+
+    std::string dictionaryPath = temporaryPath("async_benchmark.data");
+    std::vector<Text> typed;
+    {
+        std::vector<DictionaryEntry> words = synthetic::words(wordCount);
+        DictionaryBuilder builder;
+        std::vector<double> weights;
+        for (const DictionaryEntry& entry : words) {
+            weights.push_back(entry.frequency);
+            builder.add(entry.word, entry.frequency);
+        }
+        if (!builder.write(dictionaryPath)) {
+            std::fprintf(stderr, "cannot write to %s\n", dictionaryPath.c_str());
+            return 1;
+        }
+
+        std::mt19937 random(3);
+        std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+        for (size_t i = 0; i < typedCount; i++)
+            typed.push_back(words[pick(random)].word);
+    }
+
+    PredictorStatus status;
+    PredictorRef predictor = Predictor_Create(0, &status);
+    if (!predictor || Predictor_Initialize(predictor, dictionaryPath.c_str()) != PREDICTOR_SUCCESS) {
+        std::fprintf(stderr, "cannot set up the predictor\n");
+        return 1;
+    }
+
+    alignas(PredictorResult) static char buffer[PREDICTOR_RESULT_BUFFER_SIZE(kMaxResults)];
+    Timing blocking, submit, result;
+    size_t keystrokes = 0, completed = 0, cancelled = 0, failed = 0, mismatches = 0;
+
+    // Take what has completed, keeping the ranking of 'ticket'; true if
+    // that came
+    auto poll = [&](uint64_t ticket, Ranking& ranked) {
+        bool found = false;
+        PredictorCompletion completion;
+        while (Predictor_PollCompletion(predictor, &completion)) {
+            if (completion.status == PREDICTOR_SUCCESS)
+                completed++;
+            else if (completion.status == PREDICTOR_ERROR_CANCELLED)
+                cancelled++;
+            else
+                failed++;
+            if (completion.ticket == ticket) {
+                ranked = ranking(completion.results, completion.count);
+                found = true;
+            }
+            Predictor_FreeResults(completion.results);
+        }
+        return found;
+    };
+
+    PredictorRequest request = {};
+    request.kind = PREDICTOR_REQUEST_WORDS;
+    request.session = kSession;
+    request.target_script = Tamil;
+    request.annotation_type = NotRequired;
+    request.max_results = kMaxResults;
+
+    for (const Text& word : typed) {
+        uint64_t ticket = 0;
+        bool done = false;
+        Ranking actual;
+        Clock::time_point lastKey;
+        for (size_t i = 0; i < word.size();) {
+            nextCodePoint(word, i);
+            Text text = word.substr(0, i);
+            request.prefix = toApi(text.c_str());
+            lastKey = Clock::now();
+            Predictor_SubmitAsync(predictor, &request, nullptr, nullptr, &ticket);
+            submit.micros.push_back(since(lastKey));
+            keystrokes++;
+
+            Clock::time_point next = lastKey + std::chrono::microseconds(interval);
+            done = false;
+            while (Clock::now() < next)
+                done |= poll(ticket, actual);
+        }
+
+        while (!done) {
+            std::this_thread::yield();
+            done = poll(ticket, actual);
+        }
+        result.micros.push_back(since(lastKey));
+
+        PredictorResult* results;
+        size_t count;
+        Predictor_GetWordPredictionsInto(predictor, toApi(word.c_str()), Tamil, NotRequired, kMaxResults, buffer,
+                                         sizeof(buffer), &results, &count);
+        if (ranking(results, count) != actual)
+            mismatches++;
+        for (size_t i = 0; i < word.size();) {
+            nextCodePoint(word, i);
+            Text text = word.substr(0, i);
+            Clock::time_point start = Clock::now();
+            Predictor_GetWordPredictionsInto(predictor, toApi(text.c_str()), Tamil, NotRequired, kMaxResults, buffer,
+                                             sizeof(buffer), &results, &count);
+            blocking.micros.push_back(since(start));
+        }
+    }
+
+    std::printf("%zu words, %zu typed, %zu keystrokes %ld microseconds apart, top %zu\n\n", wordCount, typedCount,
+                keystrokes, interval, kMaxResults);
+    std::printf("latency in microseconds               p50     p99     max\n");
+    std::printf("blocking query                    %7.1f %7.1f %7.1f\n", blocking.percentile(0.5),
+                blocking.percentile(0.99), blocking.percentile(1.0));
+    std::printf("submit, on the input thread       %7.1f %7.1f %7.1f\n", submit.percentile(0.5),
+                submit.percentile(0.99), submit.percentile(1.0));
+    std::printf("last key to its result            %7.1f %7.1f %7.1f\n\n", result.percentile(0.5),
+                result.percentile(0.99), result.percentile(1.0));
+    std::printf("requests completed %zu, superseded %zu, failed %zu\n", completed, cancelled, failed);
+
+    Predictor_Destroy(predictor);
+    std::remove(dictionaryPath.c_str());
+
+    if (mismatches || failed || completed + cancelled != keystrokes) {
+        std::printf("\n%zu words ranked differently\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
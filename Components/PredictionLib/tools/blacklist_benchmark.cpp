@@ -0,0 +1,229 @@
+// Cost of leaving blacklisted words out of completions by filtering what the
+// search returns against marking them for the search to skip, and of
+// importing the blacklist.
+//
+//   blacklist_benchmark [words] [listed words] [stems]
+//
+// A synthetic dictionary (default 500000 words) is blacklisted some of its
+// most frequent words (default 5000 of the top 50000) and every word below a
+// number of three and four unit stems (default 200) taken from them. The top
+// ten completions of prefixes, a third of them starting a listed word and a
+// third a stem, are then found by a CompletionSearch that spells every word
+// it returns and looks it up in ordered sets, as ranking did before, and by
+// one given the Blacklist, which never returns a listed word nor expands a
+// stem. Both must agree.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "Blacklist.h"
+#include "CompletionSearch.h"
+#include "Dictionary.h"
+#include "DictionaryBuilder.h"
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kMaxResults = 10;
+constexpr size_t kQueries = 20000;
+
+double millisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+// The words and stems as an ordered set each, looked up by spelling
+struct TextBlacklist {
+    std::set<Text, std::less<>> words;
+    std::set<Text, std::less<>> stems;
+
+    bool contains(TextView word) const
+    {
+        if (words.find(word) != words.end())
+            return true;
+        for (size_t length = 1; length <= word.size(); length++) {
+            if (stems.find(word.substr(0, length)) != stems.end())
+                return true;
+        }
+        return false;
+    }
+};
+
+struct Totals {
+    double ms = 0;
+    size_t expanded = 0;
+    size_t spelled = 0;
+};
+
+void printTotals(const char* label, const Totals& totals)
+{
+    std::printf("  %-12s %8.2f us per query, %8.1f nodes expanded, %8.1f words spelled\n", label,
+                totals.ms * 1000.0 / kQueries, static_cast<double>(totals.expanded) / kQueries,
+                static_cast<double>(totals.spelled) / kQueries);
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t wordCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500000;
+    size_t listedCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 5000;
+    size_t stemCount = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 200;
+    if (wordCount == 0) {
+        std::fprintf(stderr, "usage: %s [words] [listed words] [stems]\n", argv[0]);
+        return 2;
+    }
+
+    std::string dictionaryPath = temporaryPath("blacklist_benchmark.data");
+    std::string blacklistPath = temporaryPath("blacklist_benchmark.txt");
+    std::vector<DictionaryEntry> words = synthetic::words(wordCount);
+    {
+        DictionaryBuilder builder;
+        for (const DictionaryEntry& entry : words)
+            builder.add(entry.word, entry.frequency);
+        if (!builder.write(dictionaryPath)) {
+            std::fprintf(stderr, "cannot write to %s\n", dictionaryPath.c_str());
+            return 1;
+        }
+    }
+    Dictionary dictionary;
+    if (!dictionary.open(dictionaryPath.c_str())) {
+        std::fprintf(stderr, "cannot open %s: %s\n", dictionaryPath.c_str(), dictionary.error());
+        return 1;
+    }
+
+    // The most frequent words, and stems of three or four units from them
+    std::sort(words.begin(), words.end(),
+              [](const DictionaryEntry& a, const DictionaryEntry& b) { return a.frequency > b.frequency; });
+    std::mt19937 random(11);
+    size_t pool = std::min(words.size(), std::max<size_t>(listedCount * 10, 1));
+    TextBlacklist text;
+    for (size_t i = 0; i < 20 * (listedCount + stemCount) && text.words.size() < listedCount; i++)
+        text.words.insert(words[random() % pool].word);
+    for (size_t i = 0; i < 20 * (listedCount + stemCount) && text.stems.size() < stemCount; i++) {
+        const Text& word = words[random() % pool].word;
+        size_t length = 3 + random() % 2;
+        if (word.size() > length)
+            text.stems.insert(word.substr(0, length));
+    }
+    {
+        std::ofstream out(blacklistPath, std::ios::binary | std::ios::trunc);
+        for (const Text& word : text.words)
+            out << toUtf8(word) << '\n';
+        for (const Text& stem : text.stems)
+            out << toUtf8(stem) << "*\n";
+        if (!out) {
+            std::fprintf(stderr, "cannot write to %s\n", blacklistPath.c_str());
+            return 1;
+        }
+    }
+
+    Clock::time_point start = Clock::now();
+    Blacklist blacklist(dictionary);
+    for (const Text& word : text.words)
+        blacklist.add(word);
+    for (const Text& stem : text.stems)
+        blacklist.addStem(stem);
+    double indexMs = millisecondsSince(start);
+    start = Clock::now();
+    blacklist.reindex();
+    double reindexMs = millisecondsSince(start);
+
+    PredictorStatus status;
+    PredictorRef predictor = Predictor_Create(0, &status);
+    size_t imported = 0;
+    start = Clock::now();
+    if (!predictor || Predictor_Initialize(predictor, dictionaryPath.c_str()) != PREDICTOR_SUCCESS ||
+        Predictor_ImportBlacklistFromTextFile(predictor, blacklistPath.c_str(), &imported) != PREDICTOR_SUCCESS) {
+        std::fprintf(stderr, "cannot import %s\n", blacklistPath.c_str());
+        return 1;
+    }
+    double importMs = millisecondsSince(start);
+    Predictor_Destroy(predictor);
+
+    size_t blocked = 0;
+    for (uint32_t id = 0; id < dictionary.wordCount(); id++)
+        blocked += blacklist.contains(id);
+    std::printf("%u words, %zu listed and %zu stems covering %zu words\n", dictionary.wordCount(), text.words.size(),
+                text.stems.size(), blocked);
+    std::printf("  index %.2f ms, reindex %.2f ms, load and import %.2f ms\n\n", indexMs, reindexMs, importMs);
+
+    // A third of the prefixes start a listed word and a third a stem
+    std::vector<Text> prefixes;
+    std::vector<Text> listed(text.words.begin(), text.words.end());
+    std::vector<Text> stems(text.stems.begin(), text.stems.end());
+    for (size_t i = 0; i < kQueries; i++) {
+        if (i % 3 == 1 && !listed.empty())
+            prefixes.push_back(listed[random() % listed.size()].substr(0, 2 + random() % 2));
+        else if (i % 3 == 2 && !stems.empty())
+            prefixes.push_back(stems[random() % stems.size()].substr(0, 1 + random() % 2));
+        else
+            prefixes.push_back(synthetic::randomWord(random, 1, 2));
+    }
+
+    CompletionSearch filtered(dictionary), pruned(dictionary);
+    pruned.setBlacklist(&blacklist);
+    Totals filterTotals, pruneTotals;
+    std::vector<uint32_t> filterIds, pruneIds;
+    Text spelling;
+    bool same = true;
+    for (const Text& prefix : prefixes) {
+        uint32_t node = dictionary.findNode(prefix);
+        uint32_t id;
+
+        filterIds.clear();
+        start = Clock::now();
+        filtered.start(node);
+        while (filterIds.size() < kMaxResults && filtered.next(id)) {
+            spelling.clear();
+            dictionary.appendWord(id, spelling);
+            filterTotals.spelled++;
+            if (!text.contains(spelling))
+                filterIds.push_back(id);
+        }
+        filterTotals.ms += millisecondsSince(start);
+        filterTotals.expanded += filtered.expanded();
+
+        pruneIds.clear();
+        start = Clock::now();
+        pruned.start(node);
+        while (pruneIds.size() < kMaxResults && pruned.next(id)) {
+            spelling.clear();
+            dictionary.appendWord(id, spelling);
+            pruneTotals.spelled++;
+            pruneIds.push_back(id);
+        }
+        pruneTotals.ms += millisecondsSince(start);
+        pruneTotals.expanded += pruned.expanded();
+        same = same && filterIds == pruneIds;
+    }
+    std::printf("top %zu of %zu prefixes\n", kMaxResults, kQueries);
+    printTotals("post-filter", filterTotals);
+    printTotals("pruned", pruneTotals);
+
+    std::remove(dictionaryPath.c_str());
+    std::remove(blacklistPath.c_str());
+    if (!same)
+        std::fprintf(stderr, "completions differ\n");
+    return same ? 0 : 1;
+}
@@ -0,0 +1,84 @@
+// Builds an annotation file (ta_annotations.data) for the predictor from the
+// text file Predictor_ImportAnnotationsFromTextFile reads, against the
+// dictionary the keyboard ships with it.
+//
+//   build_annotations ta_main.data annotations.txt ta_annotations.data
+//
+// annotations.txt is UTF-8, a line per word: word, meaning and optionally
+// transliteration, separated by tabs. Words not in the dictionary are
+// counted and left out; of lines for the same word the last is kept.
+
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "AnnotationStore.h"
+#include "AnnotationStoreBuilder.h"
+#include "Dictionary.h"
+
+using namespace predictor;
+
+static bool readAnnotations(const char* path, AnnotationStoreBuilder& builder, size_t& lines, size_t& known)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        return false;
+
+    std::string line;
+    std::vector<Text> fields;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.size() >= 3 && line.compare(0, 3, "\xEF\xBB\xBF") == 0)
+            line.erase(0, 3);
+        Text text = fromUtf8(line);
+        fields.clear();
+        for (size_t start = 0;;) {
+            size_t tab = text.find(u'\t', start);
+            fields.push_back(text.substr(start, tab - start));
+            if (tab == Text::npos)
+                break;
+            start = tab + 1;
+        }
+        if (fields.size() < 2 || fields[0].empty())
+            continue;
+        lines++;
+        known += builder.add(fields[0], fields[1], fields.size() > 2 ? TextView(fields[2]) : TextView());
+    }
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    if (argc != 4) {
+        std::fprintf(stderr, "usage: %s dictionary.data annotations.txt output.data\n", argv[0]);
+        return 2;
+    }
+
+    Dictionary dictionary;
+    if (!dictionary.open(argv[1])) {
+        std::fprintf(stderr, "cannot open %s: %s\n", argv[1], dictionary.error());
+        return 1;
+    }
+
+    AnnotationStoreBuilder builder(dictionary);
+    size_t lines = 0, known = 0;
+    if (!readAnnotations(argv[2], builder, lines, known)) {
+        std::fprintf(stderr, "cannot read %s\n", argv[2]);
+        return 1;
+    }
+    if (!builder.write(argv[3])) {
+        std::fprintf(stderr, "cannot write %s\n", argv[3]);
+        return 1;
+    }
+
+    AnnotationStore store;
+    if (!store.open(argv[3], dictionary.wordCount())) {
+        std::fprintf(stderr, "%s does not read back: %s\n", argv[3], store.error());
+        return 1;
+    }
+    std::printf("%s: %zu annotations read, %zu in the dictionary, %u words annotated, %zu bytes\n", argv[3], lines,
+                known, store.annotatedCount(), store.fileSize());
+    return 0;
+}
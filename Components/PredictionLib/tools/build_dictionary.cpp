@@ -0,0 +1,74 @@
+// Builds a main dictionary file (ta_main.data) for the predictor.
+//
+//   build_dictionary words.tsv ta_main.data
+//   build_dictionary --synthetic count ta_main.data
+//
+// words.tsv is UTF-8 with one "word<TAB>frequency" per line; a word without
+// a frequency gets 1. --synthetic writes a generated Tamil-like list
+// instead, for benchmarks and testing.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+
+#include "Dictionary.h"
+#include "DictionaryBuilder.h"
+#include "SyntheticCorpus.h"
+
+using namespace predictor;
+
+static bool readWordList(const char* path, DictionaryBuilder& builder)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        return false;
+
+    std::string line;
+    while (std::getline(in, line)) {
+        if (!line.empty() && line.back() == '\r')
+            line.pop_back();
+        if (line.size() >= 3 && line.compare(0, 3, "\xEF\xBB\xBF") == 0)
+            line.erase(0, 3);
+        size_t tab = line.find('\t');
+        uint32_t frequency = tab == std::string::npos ? 1 : static_cast<uint32_t>(std::strtoul(line.c_str() + tab + 1, nullptr, 10));
+        builder.add(fromUtf8(line.substr(0, tab)), frequency);
+    }
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    DictionaryBuilder builder;
+    const char* output;
+    if (argc == 4 && std::strcmp(argv[1], "--synthetic") == 0) {
+        for (DictionaryEntry& entry : synthetic::words(std::strtoul(argv[2], nullptr, 10)))
+            builder.add(std::move(entry.word), entry.frequency);
+        output = argv[3];
+    } else if (argc == 3) {
+        if (!readWordList(argv[1], builder)) {
+            std::fprintf(stderr, "cannot read %s\n", argv[1]);
+            return 1;
+        }
+        output = argv[2];
+    } else {
+        std::fprintf(stderr, "usage: %s words.tsv output.data\n       %s --synthetic count output.data\n",
+                     argv[0], argv[0]);
+        return 2;
+    }
+
+    if (!builder.write(output)) {
+        std::fprintf(stderr, "cannot write %s\n", output);
+        return 1;
+    }
+
+    Dictionary dictionary;
+    if (!dictionary.open(output)) {
+        std::fprintf(stderr, "%s does not read back: %s\n", output, dictionary.error());
+        return 1;
+    }
+    std::printf("%s: %u words, %u nodes, %zu bytes\n", output, dictionary.wordCount(), dictionary.nodeCount(),
+                dictionary.fileSize());
+    return 0;
+}
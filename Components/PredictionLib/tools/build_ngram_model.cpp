@@ -0,0 +1,107 @@
+// Builds an n-gram model file (ta_ngram.data) for the predictor from a text
+// corpus, against the dictionary the keyboard ships with it.
+//
+//   build_ngram_model ta_main.data corpus.txt ta_ngram.data [--min-count N]
+//
+// corpus.txt is UTF-8 running text. Words are split at spaces and
+// punctuation, sentences at line ends and . ? ! and the danda; words not in
+// the dictionary break the word sequence. N-grams seen fewer than N times
+// (default 1) are left out.
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "Dictionary.h"
+#include "NgramModel.h"
+#include "NgramModelBuilder.h"
+
+using namespace predictor;
+
+static bool endsSentence(char16_t c)
+{
+    return c == u'.' || c == u'?' || c == u'!' || c == 0x0964 || c == 0x0965;
+}
+
+// ASCII other than letters and digits, and Unicode spaces and punctuation
+// short of the joiners that occur inside Tamil words
+static bool separatesWords(char16_t c)
+{
+    if (c < 0x80)
+        return !(c >= u'0' && c <= u'9') && !(c >= u'A' && c <= u'Z') && !(c >= u'a' && c <= u'z');
+    return c == 0x00A0 || (c >= 0x2000 && c <= 0x206F && c != 0x200C && c != 0x200D) || c == 0x3000;
+}
+
+static bool readCorpus(const char* path, const Dictionary& dictionary, NgramModelBuilder& builder,
+                       size_t& words, size_t& known)
+{
+    std::ifstream in(path, std::ios::binary);
+    if (!in)
+        return false;
+
+    std::string line;
+    std::vector<int32_t> sentence;
+    while (std::getline(in, line)) {
+        Text text = fromUtf8(line);
+        size_t start = 0;
+        for (size_t i = 0; i <= text.size(); i++) {
+            bool end = i == text.size();
+            if (!end && !separatesWords(text[i]))
+                continue;
+            if (i > start) {
+                int32_t id = dictionary.lookup(TextView(text).substr(start, i - start));
+                sentence.push_back(id);
+                words++;
+                known += id >= 0;
+            }
+            start = i + 1;
+            if (end || endsSentence(text[i])) {
+                builder.addSentence(sentence);
+                sentence.clear();
+            }
+        }
+    }
+    return true;
+}
+
+int main(int argc, char* argv[])
+{
+    uint32_t minimumCount = 1;
+    if (argc == 6 && std::strcmp(argv[4], "--min-count") == 0) {
+        minimumCount = static_cast<uint32_t>(std::strtoul(argv[5], nullptr, 10));
+    } else if (argc != 4) {
+        std::fprintf(stderr, "usage: %s dictionary.data corpus.txt output.data [--min-count N]\n", argv[0]);
+        return 2;
+    }
+
+    Dictionary dictionary;
+    if (!dictionary.open(argv[1])) {
+        std::fprintf(stderr, "cannot open %s: %s\n", argv[1], dictionary.error());
+        return 1;
+    }
+
+    NgramModelBuilder builder(dictionary);
+    builder.setMinimumCount(minimumCount);
+    size_t words = 0, known = 0;
+    if (!readCorpus(argv[2], dictionary, builder, words, known)) {
+        std::fprintf(stderr, "cannot read %s\n", argv[2]);
+        return 1;
+    }
+    if (!builder.write(argv[3])) {
+        std::fprintf(stderr, "cannot write %s\n", argv[3]);
+        return 1;
+    }
+
+    NgramModel model;
+    if (!model.open(argv[3], dictionary.wordCount())) {
+        std::fprintf(stderr, "%s does not read back: %s\n", argv[3], model.error());
+        return 1;
+    }
+    std::printf("%s: %zu words read, %zu in the dictionary, %llu bigrams, %llu trigrams, %zu bytes\n", argv[3],
+                words, known, static_cast<unsigned long long>(model.bigramCount()),
+                static_cast<unsigned long long>(model.trigramCount()), model.fileSize());
+    return 0;
+}
@@ -0,0 +1,209 @@
+// Latency of Predictor_GetWordPredictionsInto with and without the result
+// cache, over replayed typing sessions.
+//
+//   cache_benchmark [words] [typed words]
+//
+// Words are drawn by frequency from a synthetic dictionary (default 500000
+// words) and typed a code point at a time (default 5000 words). Typos are
+// backspaced and typed again, now and then the prefixes of the word before
+// are queried again, as when switching between fields, and every word is
+// committed and learned. Every 50 words one of them is removed. Two
+// predictors replay the same session, one with the cache and one without,
+// and must rank every keystroke identically.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "DictionaryBuilder.h"
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kMaxResults = 10;
+
+struct Timing {
+    std::vector<double> micros;
+
+    double percentile(double p)
+    {
+        std::sort(micros.begin(), micros.end());
+        return micros[static_cast<size_t>(p * static_cast<double>(micros.size() - 1))];
+    }
+};
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+using Ranking = std::vector<std::pair<Text, float>>;
+
+Ranking ranking(const PredictorResult* results, size_t count)
+{
+    Ranking ranked;
+    for (size_t i = 0; i < count; i++)
+        ranked.emplace_back(Text(fromApi(results[i].word)), results[i].final_score);
+    return ranked;
+}
+
+double since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// The code point boundaries of 'word' after the first, one per prefix
+std::vector<size_t> prefixEnds(const Text& word)
+{
+    std::vector<size_t> ends;
+    for (size_t i = 0; i < word.size();) {
+        nextCodePoint(word, i);
+        ends.push_back(i);
+    }
+    return ends;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t wordCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500000;
+    size_t typedCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 5000;
+    if (wordCount == 0 || typedCount == 0) {
+        std::fprintf(stderr, "usage: %s [words] [typed words]\n", argv[0]);
+        return 2;
+    }
+
+    std::string dictionaryPath = temporaryPath("cache_benchmark.data");
+    std::string userPaths[2] = { temporaryPath("cache_benchmark_user0.data"),
+                                 temporaryPath("cache_benchmark_user1.data") };
+    std::vector<Text> typed;
+    {
+        std::vector<DictionaryEntry> words = synthetic::words(wordCount);
+        DictionaryBuilder builder;
+        std::vector<double> weights;
+        for (const DictionaryEntry& entry : words) {
+            weights.push_back(entry.frequency);
+            builder.add(entry.word, entry.frequency);
+        }
+        if (!builder.write(dictionaryPath)) {
+            std::fprintf(stderr, "cannot write to %s\n", dictionaryPath.c_str());
+            return 1;
+        }
+
+        std::mt19937 random(3);
+        std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+        for (size_t i = 0; i < typedCount; i++)
+            typed.push_back(words[pick(random)].word);
+    }
+
+    // [0] caches, [1] does not
+    PredictorRef predictors[2];
+    for (int i = 0; i < 2; i++) {
+        std::remove(userPaths[i].c_str());
+        std::remove((userPaths[i] + ".log").c_str());
+        PredictorStatus status;
+        predictors[i] = Predictor_Create(0, &status);
+        if (!predictors[i] || Predictor_Initialize(predictors[i], dictionaryPath.c_str()) != PREDICTOR_SUCCESS ||
+            Predictor_SetUserDictionary(predictors[i], userPaths[i].c_str()) != PREDICTOR_SUCCESS) {
+            std::fprintf(stderr, "cannot set up the predictor\n");
+            return 1;
+        }
+    }
+    Predictor_SetCacheBudget(predictors[1], 0);
+
+    alignas(PredictorResult) static char buffer[PREDICTOR_RESULT_BUFFER_SIZE(kMaxResults)];
+    Timing timings[2];
+    size_t keystrokes = 0, mismatches = 0;
+
+    // Query 'text' both ways, taking turns at going first
+    auto query = [&](const Text& text) {
+        Ranking rankings[2];
+        for (int turn = 0; turn < 2; turn++) {
+            int which = static_cast<int>((turn + keystrokes) % 2);
+            PredictorResult* results;
+            size_t count;
+            Clock::time_point start = Clock::now();
+            Predictor_GetWordPredictionsInto(predictors[which], toApi(text.c_str()), Tamil, NotRequired, kMaxResults,
+                                             buffer, sizeof(buffer), &results, &count);
+            timings[which].micros.push_back(since(start));
+            rankings[which] = ranking(results, count);
+        }
+        if (rankings[0] != rankings[1])
+            mismatches++;
+        keystrokes++;
+    };
+
+    std::mt19937 random(17);
+    std::uniform_int_distribution<int> percent(0, 99);
+    Text previous;
+    for (size_t w = 0; w < typed.size(); w++) {
+        const Text& word = typed[w];
+        std::vector<size_t> ends = prefixEnds(word);
+        for (size_t k = 0; k < ends.size(); k++) {
+            query(word.substr(0, ends[k]));
+            if (percent(random) < 15 && k + 1 < ends.size()) {
+                // A typo backspaced: one or two code points back, the
+                // prefixes shown again, then the right key
+                size_t back = std::min<size_t>(k, 1 + static_cast<size_t>(percent(random) % 2));
+                for (size_t b = 1; b <= back; b++)
+                    query(word.substr(0, ends[k - b]));
+                k -= back;
+            }
+        }
+
+        if (!previous.empty() && percent(random) < 10) {
+            for (size_t end : prefixEnds(previous))
+                query(previous.substr(0, end));
+        }
+
+        for (PredictorRef predictor : predictors)
+            Predictor_AddWord(predictor, toApi(word.c_str()));
+        if (w % 50 == 49) {
+            size_t removed;
+            for (PredictorRef predictor : predictors)
+                Predictor_RemoveWord(predictor, toApi(typed[w / 2].c_str()), &removed);
+        }
+        previous = word;
+    }
+
+    PredictorCacheStats stats;
+    Predictor_GetCacheStats(predictors[0], &stats);
+    std::printf("%zu words, %zu typed, %zu queries, top %zu, latency in microseconds\n\n", wordCount, typedCount,
+                keystrokes, kMaxResults);
+    std::printf("                 p50     p90     p99\n");
+    std::printf("uncached     %7.1f %7.1f %7.1f\n", timings[1].percentile(0.5), timings[1].percentile(0.9),
+                timings[1].percentile(0.99));
+    std::printf("cached       %7.1f %7.1f %7.1f\n\n", timings[0].percentile(0.5), timings[0].percentile(0.9),
+                timings[0].percentile(0.99));
+    std::printf("hits %llu, misses %llu (%.1f%% hit), invalidated %llu, evicted %llu, %zu entries in %zu bytes\n",
+                static_cast<unsigned long long>(stats.hits), static_cast<unsigned long long>(stats.misses),
+                100.0 * static_cast<double>(stats.hits) / static_cast<double>(stats.hits + stats.misses),
+                static_cast<unsigned long long>(stats.invalidated), static_cast<unsigned long long>(stats.evicted),
+                stats.entries, stats.bytes);
+
+    for (int i = 0; i < 2; i++) {
+        Predictor_Destroy(predictors[i]);
+        std::remove(userPaths[i].c_str());
+        std::remove((userPaths[i] + ".log").c_str());
+    }
+    std::remove(dictionaryPath.c_str());
+
+    if (mismatches) {
+        std::printf("\n%zu queries ranked differently\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,144 @@
+// Latency of Predictor_GetWordPredictions for 1, 2 and 3 syllable prefixes,
+// with the best-first search over subtree maxima and with the exhaustive
+// scan of files built without them.
+//
+//   completion_benchmark [words] [prefixes per length]
+//
+// Both dictionaries hold the same synthetic words (default 500000); every
+// query is checked to rank identically on both.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "Dictionary.h"
+#include "DictionaryBuilder.h"
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kMaxResults = 10;
+
+struct Timing {
+    std::vector<double> micros;
+
+    double percentile(double p)
+    {
+        std::sort(micros.begin(), micros.end());
+        return micros[static_cast<size_t>(p * static_cast<double>(micros.size() - 1))];
+    }
+};
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+PredictorRef openPredictor(const std::string& path)
+{
+    PredictorStatus status;
+    PredictorRef predictor = Predictor_Create(0, &status);
+    if (predictor && Predictor_Initialize(predictor, path.c_str()) != PREDICTOR_SUCCESS) {
+        Predictor_Destroy(predictor);
+        return nullptr;
+    }
+    // time the search, not the result cache
+    if (predictor)
+        Predictor_SetCacheBudget(predictor, 0);
+    return predictor;
+}
+
+// Time one query and return its words and scores for comparison
+std::vector<std::pair<Text, float>> query(PredictorRef predictor, const Text& prefix, Timing& timing)
+{
+    PredictorResult* results = nullptr;
+    size_t count = 0;
+    Clock::time_point start = Clock::now();
+    Predictor_GetWordPredictions(predictor, toApi(prefix.c_str()), Tamil, NotRequired, kMaxResults, &results, &count);
+    timing.micros.push_back(std::chrono::duration<double, std::micro>(Clock::now() - start).count());
+
+    std::vector<std::pair<Text, float>> ranked;
+    for (size_t i = 0; i < count; i++)
+        ranked.emplace_back(Text(fromApi(results[i].word)), results[i].final_score);
+    Predictor_FreeResults(results);
+    return ranked;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t wordCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500000;
+    size_t perLength = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+    if (wordCount == 0 || perLength == 0) {
+        std::fprintf(stderr, "usage: %s [words] [prefixes per length]\n", argv[0]);
+        return 2;
+    }
+
+    std::string bestFirstPath = temporaryPath("completion_benchmark.data");
+    std::string exhaustivePath = temporaryPath("completion_benchmark_scan.data");
+    {
+        DictionaryBuilder builder;
+        for (DictionaryEntry& entry : synthetic::words(wordCount))
+            builder.add(std::move(entry.word), entry.frequency);
+        bool written = builder.write(bestFirstPath);
+        builder.setSubtreeMaxima(false);
+        if (!written || !builder.write(exhaustivePath)) {
+            std::fprintf(stderr, "cannot write to %s\n", bestFirstPath.c_str());
+            return 1;
+        }
+    }
+
+    Dictionary dictionary;
+    PredictorRef bestFirst = openPredictor(bestFirstPath);
+    PredictorRef exhaustive = openPredictor(exhaustivePath);
+    if (!dictionary.open(bestFirstPath.c_str()) || !bestFirst || !exhaustive) {
+        std::fprintf(stderr, "cannot open the dictionaries\n");
+        return 1;
+    }
+
+    std::printf("%zu words, top %zu, latency in microseconds\n\n", wordCount, kMaxResults);
+    std::printf("syllables  prefixes   exhaustive p50     p99   best-first p50     p99\n");
+
+    std::mt19937 random(11);
+    int mismatches = 0;
+    for (int syllables = 1; syllables <= 3; syllables++) {
+        std::vector<Text> prefixes;
+        while (prefixes.size() < perLength) {
+            Text prefix = synthetic::randomWord(random, syllables, syllables);
+            if (dictionary.findNode(prefix) != Dictionary::kNoNode)
+                prefixes.push_back(prefix);
+        }
+
+        Timing before, after;
+        for (const Text& prefix : prefixes) {
+            if (query(exhaustive, prefix, before) != query(bestFirst, prefix, after))
+                mismatches++;
+        }
+        std::printf("%9d  %8zu   %14.1f %7.1f   %14.1f %7.1f\n", syllables, prefixes.size(), before.percentile(0.5),
+                    before.percentile(0.99), after.percentile(0.5), after.percentile(0.99));
+    }
+
+    Predictor_Destroy(bestFirst);
+    Predictor_Destroy(exhaustive);
+    std::remove(bestFirstPath.c_str());
+    std::remove(exhaustivePath.c_str());
+
+    if (mismatches) {
+        std::printf("\n%d queries ranked differently\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,193 @@
+// Latency per keystroke of Predictor_GetCursorPredictions against the
+// stateless Predictor_GetWordPredictionsInto, over simulated typing with
+// backspaces.
+//
+//   cursor_benchmark [words] [typed words]
+//
+// Words are drawn by frequency from a synthetic dictionary (default 500000
+// words). After some keys one or two code points are deleted and typed
+// again, and every typed word is learned, so that learned words, the
+// blacklist and backspace are all exercised. Each keystroke is queried both
+// ways and must rank identically.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "DictionaryBuilder.h"
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kMaxResults = 10;
+
+struct Timing {
+    std::vector<double> micros;
+
+    double percentile(double p)
+    {
+        std::sort(micros.begin(), micros.end());
+        return micros[static_cast<size_t>(p * static_cast<double>(micros.size() - 1))];
+    }
+};
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+using Ranking = std::vector<std::pair<Text, float>>;
+
+Ranking ranking(const PredictorResult* results, size_t count)
+{
+    Ranking ranked;
+    for (size_t i = 0; i < count; i++)
+        ranked.emplace_back(Text(fromApi(results[i].word)), results[i].final_score);
+    return ranked;
+}
+
+double since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t wordCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500000;
+    size_t typedCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 2000;
+    if (wordCount == 0 || typedCount == 0) {
+        std::fprintf(stderr, "usage: %s [words] [typed words]\n", argv[0]);
+        return 2;
+    }
+
+    std::string dictionaryPath = temporaryPath("cursor_benchmark.data");
+    std::string userPath = temporaryPath("cursor_benchmark_user.data");
+    std::string blacklistPath = temporaryPath("cursor_benchmark_blacklist.txt");
+    std::remove(userPath.c_str());
+    std::vector<Text> typed;
+    {
+        std::vector<DictionaryEntry> words = synthetic::words(wordCount);
+        DictionaryBuilder builder;
+        std::vector<double> weights;
+        std::ofstream blacklist(blacklistPath, std::ios::binary);
+        for (size_t i = 0; i < words.size(); i++) {
+            weights.push_back(words[i].frequency);
+            if (i % 97 == 0)
+                blacklist << toUtf8(words[i].word) << '\n';
+            builder.add(words[i].word, words[i].frequency);
+        }
+        if (!builder.write(dictionaryPath) || !blacklist) {
+            std::fprintf(stderr, "cannot write to %s\n", dictionaryPath.c_str());
+            return 1;
+        }
+
+        std::mt19937 random(3);
+        std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+        for (size_t i = 0; i < typedCount; i++)
+            typed.push_back(words[pick(random)].word);
+    }
+
+    PredictorStatus status;
+    PredictorRef predictor = Predictor_Create(0, &status);
+    size_t blacklisted = 0;
+    if (!predictor || Predictor_Initialize(predictor, dictionaryPath.c_str()) != PREDICTOR_SUCCESS ||
+        Predictor_SetUserDictionary(predictor, userPath.c_str()) != PREDICTOR_SUCCESS ||
+        Predictor_ImportBlacklistFromTextFile(predictor, blacklistPath.c_str(), &blacklisted) != PREDICTOR_SUCCESS) {
+        std::fprintf(stderr, "cannot set up the predictor\n");
+        return 1;
+    }
+    // time the searches, not the result cache
+    Predictor_SetCacheBudget(predictor, 0);
+    PredictorCursorRef cursor = Predictor_CreateCursor(predictor, &status);
+
+    alignas(PredictorResult) static char statelessBuffer[PREDICTOR_RESULT_BUFFER_SIZE(kMaxResults)];
+    alignas(PredictorResult) static char cursorBuffer[PREDICTOR_RESULT_BUFFER_SIZE(kMaxResults)];
+    Timing stateless, incremental, backspace;
+    size_t keystrokes = 0, mismatches = 0;
+
+    // Query the cursor's text both ways, taking turns at going first so that
+    // neither gains from the other warming the caches
+    auto check = [&](const Text& text, Timing& timing) {
+        PredictorResult* results;
+        size_t count;
+        Ranking expected, actual;
+        for (int turn = 0; turn < 2; turn++) {
+            Clock::time_point start = Clock::now();
+            if ((turn + keystrokes) % 2 == 0) {
+                Predictor_GetWordPredictionsInto(predictor, toApi(text.c_str()), Tamil, NotRequired, kMaxResults,
+                                                 statelessBuffer, sizeof(statelessBuffer), &results, &count);
+                stateless.micros.push_back(since(start));
+                expected = ranking(results, count);
+            } else {
+                Predictor_GetCursorPredictions(cursor, Tamil, NotRequired, kMaxResults, cursorBuffer,
+                                               sizeof(cursorBuffer), &results, &count);
+                timing.micros.push_back(since(start));
+                actual = ranking(results, count);
+            }
+        }
+        if (actual != expected)
+            mismatches++;
+        keystrokes++;
+    };
+
+    std::mt19937 random(17);
+    std::uniform_int_distribution<int> percent(0, 99);
+    for (const Text& word : typed) {
+        Predictor_CursorReset(cursor);
+        Text text;
+        std::vector<size_t> starts;     // of each code point typed
+        for (size_t i = 0; i < word.size();) {
+            starts.push_back(i);
+            nextCodePoint(word, i);
+            Text key = word.substr(starts.back(), i - starts.back());
+            text += key;
+            Predictor_CursorExtend(cursor, toApi(key.c_str()));
+            check(text, incremental);
+
+            if (percent(random) < 10 && i < word.size()) {
+                // A typo corrected: one or two code points back, then typed again
+                size_t back = 1 + static_cast<size_t>(percent(random) % 2), removed;
+                Predictor_CursorRetract(cursor, back, &removed);
+                i = starts[starts.size() - removed];
+                starts.resize(starts.size() - removed);
+                text.resize(i);
+                check(text, backspace);
+            }
+        }
+        Predictor_AddWord(predictor, toApi(word.c_str()));
+    }
+
+    std::printf("%zu words, %zu typed, %zu blacklisted, %zu keystrokes, top %zu, latency in microseconds\n\n",
+                wordCount, typedCount, blacklisted, keystrokes, kMaxResults);
+    std::printf("                      p50     p99\n");
+    std::printf("stateless         %7.1f %7.1f\n", stateless.percentile(0.5), stateless.percentile(0.99));
+    std::printf("cursor, typing    %7.1f %7.1f\n", incremental.percentile(0.5), incremental.percentile(0.99));
+    std::printf("cursor, backspace %7.1f %7.1f\n", backspace.percentile(0.5), backspace.percentile(0.99));
+
+    Predictor_DestroyCursor(cursor);
+    Predictor_Destroy(predictor);
+    std::remove(dictionaryPath.c_str());
+    std::remove(userPath.c_str());
+    std::remove(blacklistPath.c_str());
+
+    if (mismatches) {
+        std::printf("\n%zu keystrokes ranked differently\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
@@ -0,0 +1,207 @@
+// Recall and latency of Predictor_GetFuzzyPredictionsInto on prefixes typed
+// with a slip to a neighbouring key.
+//
+//   fuzzy_benchmark layout.json [words] [typed words]
+//
+// Words are drawn by frequency from a synthetic dictionary (default 500000
+// words); of each typed word (default 5000) a prefix of three to six code
+// units has one letter swapped for one on a neighbouring key of the layout,
+// a consonant for a consonant, a vowel sign for a sign. A prefix is
+// recalled when its word is among the top results. Fuzzy completions with
+// the layout are set against plain completions of the slipped prefix and
+// against fuzzy completions pricing every slip as a whole edit. Then, for
+// the worst case, prefixes of random letters up to 24 long are searched
+// with a tolerance of 2.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "DictionaryBuilder.h"
+#include "KeyLayout.h"
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kMaxResults = 10;
+
+struct Timing {
+    std::vector<double> micros;
+
+    double percentile(double p)
+    {
+        std::sort(micros.begin(), micros.end());
+        return micros[static_cast<size_t>(p * static_cast<double>(micros.size() - 1))];
+    }
+};
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+double since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// Consonants, independent vowels and vowel signs slip into their own kind
+int letterKind(char16_t unit)
+{
+    if (unit >= 0x0B95 && unit <= 0x0BB9)
+        return 0;
+    if (unit >= 0x0B85 && unit <= 0x0B94)
+        return 1;
+    if (unit >= 0x0BBE && unit <= 0x0BCD)
+        return 2;
+    return 3;
+}
+
+// The Tamil letters on keys next to that of 'unit'
+std::vector<char16_t> neighbours(const KeyLayout& layout, char16_t unit)
+{
+    std::vector<char16_t> near;
+    uint16_t key = layout.keyOf(unit);
+    if (key == KeyLayout::kNoKey)
+        return near;
+    for (char16_t other = 0x0B80; other < 0x0C00; other++) {
+        uint16_t otherKey = layout.keyOf(other);
+        if (other != unit && otherKey != KeyLayout::kNoKey && otherKey != key &&
+            letterKind(other) == letterKind(unit) && layout.substitutionCost(key, otherKey) <= 1.6f * KeyLayout::kNearCost)
+            near.push_back(other);
+    }
+    return near;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    const char* layoutPath = argc > 1 ? argv[1] : nullptr;
+    size_t wordCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 500000;
+    size_t typedCount = argc > 3 ? std::strtoul(argv[3], nullptr, 10) : 5000;
+    KeyLayout layout;
+    if (!layoutPath || wordCount == 0 || typedCount == 0 || !layout.load(layoutPath)) {
+        std::fprintf(stderr, "usage: %s layout.json [words] [typed words]\n", argv[0]);
+        return 2;
+    }
+
+    std::string dictionaryPath = temporaryPath("fuzzy_benchmark.data");
+    std::vector<DictionaryEntry> words = synthetic::words(wordCount);
+    {
+        DictionaryBuilder builder;
+        for (const DictionaryEntry& entry : words)
+            builder.add(entry.word, entry.frequency);
+        if (!builder.write(dictionaryPath)) {
+            std::fprintf(stderr, "cannot write to %s\n", dictionaryPath.c_str());
+            return 1;
+        }
+    }
+
+    // [0] prices slips by the layout, [1] as whole edits
+    PredictorRef predictors[2];
+    for (int i = 0; i < 2; i++) {
+        PredictorStatus status;
+        predictors[i] = Predictor_Create(0, &status);
+        if (!predictors[i] || Predictor_Initialize(predictors[i], dictionaryPath.c_str()) != PREDICTOR_SUCCESS) {
+            std::fprintf(stderr, "cannot set up the predictor\n");
+            return 1;
+        }
+    }
+    if (Predictor_LoadKeyLayout(predictors[0], layoutPath, 0) != PREDICTOR_SUCCESS) {
+        std::fprintf(stderr, "cannot load %s\n", layoutPath);
+        return 1;
+    }
+
+    // Slipped prefixes and the words they were meant for
+    std::mt19937 random(5);
+    std::vector<double> weights;
+    for (const DictionaryEntry& entry : words)
+        weights.push_back(entry.frequency);
+    std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+    std::vector<std::pair<Text, const Text*>> slipped;
+    while (slipped.size() < typedCount) {
+        const Text& word = words[pick(random)].word;
+        if (word.size() < 3)
+            continue;
+        size_t length = std::min<size_t>(word.size(), 3 + random() % 4);
+        Text prefix = word.substr(0, length);
+        size_t at = random() % length;
+        std::vector<char16_t> near = neighbours(layout, prefix[at]);
+        if (near.empty())
+            continue;
+        prefix[at] = near[random() % near.size()];
+        slipped.emplace_back(prefix, &word);
+    }
+
+    alignas(PredictorResult) static char buffer[PREDICTOR_RESULT_BUFFER_SIZE(kMaxResults)];
+    const char* names[3] = { "exact", "fuzzy, whole edits", "fuzzy, key layout" };
+    Timing timings[3];
+    size_t recalled[3] = {};
+    for (const auto& entry : slipped) {
+        for (int way = 0; way < 3; way++) {
+            PredictorResult* results;
+            size_t count;
+            Clock::time_point start = Clock::now();
+            if (way == 0)
+                Predictor_GetWordPredictionsInto(predictors[1], toApi(entry.first.c_str()), Tamil, NotRequired,
+                                                 kMaxResults, buffer, sizeof(buffer), &results, &count);
+            else
+                Predictor_GetFuzzyPredictionsInto(predictors[way == 1 ? 1 : 0], toApi(entry.first.c_str()), 1.0f,
+                                                  Tamil, NotRequired, kMaxResults, buffer, sizeof(buffer), &results,
+                                                  &count);
+            timings[way].micros.push_back(since(start));
+            for (size_t i = 0; i < count; i++) {
+                if (fromApi(results[i].word) == TextView(*entry.second)) {
+                    recalled[way]++;
+                    break;
+                }
+            }
+        }
+    }
+
+    std::printf("%zu words, %zu slipped prefixes, top %zu, latency in microseconds\n\n", wordCount, slipped.size(),
+                kMaxResults);
+    std::printf("                       recall     p50     p99     max\n");
+    for (int way = 0; way < 3; way++) {
+        double recall = 100.0 * static_cast<double>(recalled[way]) / static_cast<double>(slipped.size());
+        std::printf("%-20s %7.1f%% %7.1f %7.1f %7.1f\n", names[way], recall, timings[way].percentile(0.5),
+                    timings[way].percentile(0.99), timings[way].percentile(1.0));
+    }
+
+    // Worst case: long prefixes of random letters, which keep many branches
+    // within the tolerance and leave the budget to stop the search
+    Timing worst;
+    const std::vector<char16_t>& consonants = synthetic::consonants();
+    for (size_t i = 0; i < 2000; i++) {
+        Text prefix;
+        size_t length = 1 + random() % 24;
+        for (size_t k = 0; k < length; k++)
+            prefix.push_back(consonants[random() % consonants.size()]);
+        PredictorResult* results;
+        size_t count;
+        Clock::time_point start = Clock::now();
+        Predictor_GetFuzzyPredictionsInto(predictors[0], toApi(prefix.c_str()), 2.0f, Tamil, NotRequired,
+                                          kMaxResults, buffer, sizeof(buffer), &results, &count);
+        worst.micros.push_back(since(start));
+    }
+    std::printf("\nrandom prefixes, tolerance 2: p50 %.1f, p99 %.1f, max %.1f\n", worst.percentile(0.5),
+                worst.percentile(0.99), worst.percentile(1.0));
+
+    for (PredictorRef predictor : predictors)
+        Predictor_Destroy(predictor);
+    std::remove(dictionaryPath.c_str());
+    return 0;
+}
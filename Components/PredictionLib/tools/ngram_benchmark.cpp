@@ -0,0 +1,315 @@
+// Memory and latency of the n-gram model against a naive in-memory one.
+//
+//   ngram_benchmark [words] [sentences]
+//
+// A synthetic dictionary (default 500000 words) and a corpus of synthetic
+// sentences over it (default 300000; see SyntheticCorpus.h) stand in for
+// the licensed word list and a Tamil corpus. The model is built from 90% of
+// the sentences; the held-out 10% are typed through
+// Predictor_GetNgramPredictionsInto, with and without the first code point
+// of the next word, and scored by how often the word typed next is in the
+// top 10. The naive model is the usual nested hash map of the same n-grams
+// with float probabilities; its heap use is counted through operator new.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <random>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "Dictionary.h"
+#include "DictionaryBuilder.h"
+#include "MappedFile.h"
+#include "NgramFormat.h"
+#include "NgramModel.h"
+#include "NgramModelBuilder.h"
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+size_t allocatedBytes = 0;
+
+} // namespace
+
+void* operator new(std::size_t size)
+{
+    allocatedBytes += size;
+    if (void* memory = std::malloc(size ? size : 1))
+        return memory;
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t size)
+{
+    return operator new(size);
+}
+
+void operator delete(void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete(void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+void operator delete[](void* memory, std::size_t) noexcept
+{
+    std::free(memory);
+}
+
+namespace {
+
+constexpr size_t kMaxResults = 10;
+constexpr size_t kQueries = 20000;
+
+struct Timing {
+    std::vector<double> micros;
+
+    double percentile(double p)
+    {
+        std::sort(micros.begin(), micros.end());
+        return micros[static_cast<size_t>(p * static_cast<double>(micros.size() - 1))];
+    }
+};
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+double since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+// The usual first implementation: one hash map per context
+struct NaiveModel {
+    std::unordered_map<uint32_t, std::unordered_map<uint32_t, float>> bigrams;
+    std::unordered_map<uint64_t, std::unordered_map<uint32_t, float>> trigrams;
+
+    // Top successors of the context, trigram ones first
+    void predict(uint32_t word1, uint32_t word2, std::vector<std::pair<float, uint32_t>>& out) const
+    {
+        out.clear();
+        auto collect = [&](const std::unordered_map<uint32_t, float>& successors, float offset) {
+            for (const auto& successor : successors)
+                out.emplace_back(successor.second + offset, successor.first);
+        };
+        auto trigram = trigrams.find(uint64_t(word1) << 32 | word2);
+        if (trigram != trigrams.end())
+            collect(trigram->second, 1e6f);
+        auto bigram = bigrams.find(word2);
+        if (bigram != bigrams.end())
+            collect(bigram->second, 0);
+        size_t top = std::min(out.size(), kMaxResults);
+        std::partial_sort(out.begin(), out.begin() + static_cast<std::ptrdiff_t>(top), out.end(),
+                          [](const auto& a, const auto& b) { return a > b; });
+        out.resize(top);
+    }
+};
+
+// Bytes of each kind of section in the model file
+void printSections(const char* path, uint64_t ngrams)
+{
+    MappedFile file;
+    if (!file.open(path))
+        return;
+    NgramHeader header;
+    std::memcpy(&header, file.data(), sizeof(header));
+    const char* names[] = { "levels", "contexts", "lists", "successors", "weights", "backoffs" };
+    size_t bytes[6] = {};
+    for (uint32_t i = 0; i < header.sectionCount; i++) {
+        SectionEntry entry;
+        std::memcpy(&entry, file.data() + header.headerSize + i * sizeof(SectionEntry), sizeof(entry));
+        size_t kind = entry.id == kNgramSectionLevels ? 0 : 1 + (entry.id - 2) % kNgramSectionsPerOrder;
+        bytes[kind] += entry.size;
+    }
+    for (size_t kind = 0; kind < 6; kind++)
+        std::printf("  %-11s %12zu bytes  %6.2f bytes per n-gram\n", names[kind], bytes[kind],
+                    static_cast<double>(bytes[kind]) / static_cast<double>(ngrams));
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t wordCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500000;
+    size_t sentenceCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 300000;
+    if (wordCount == 0 || sentenceCount < 10) {
+        std::fprintf(stderr, "usage: %s [words] [sentences, at least 10]\n", argv[0]);
+        return 2;
+    }
+
+    std::string dictionaryPath = temporaryPath("ngram_benchmark.data");
+    std::string modelPath = temporaryPath("ngram_benchmark_ngram.data");
+    std::vector<DictionaryEntry> words = synthetic::words(wordCount);
+    std::vector<std::vector<uint32_t>> sentences = synthetic::sentences(words, sentenceCount);
+    {
+        DictionaryBuilder builder;
+        for (const DictionaryEntry& entry : words)
+            builder.add(entry.word, entry.frequency);
+        if (!builder.write(dictionaryPath)) {
+            std::fprintf(stderr, "cannot write to %s\n", dictionaryPath.c_str());
+            return 1;
+        }
+    }
+    Dictionary dictionary;
+    if (!dictionary.open(dictionaryPath.c_str())) {
+        std::fprintf(stderr, "cannot open %s\n", dictionaryPath.c_str());
+        return 1;
+    }
+
+    // Sentences as dictionary ids, split into training and held-out text
+    std::vector<uint32_t> ids(words.size());
+    for (size_t i = 0; i < words.size(); i++)
+        ids[i] = static_cast<uint32_t>(dictionary.lookup(words[i].word));
+    for (std::vector<uint32_t>& sentence : sentences) {
+        for (uint32_t& word : sentence)
+            word = ids[word];
+    }
+    size_t training = sentences.size() - sentences.size() / 10;
+    size_t tokens = 0;
+
+    Clock::time_point start = Clock::now();
+    NgramModelBuilder builder(dictionary);
+    std::vector<int32_t> sentenceIds;
+    for (size_t s = 0; s < training; s++) {
+        sentenceIds.assign(sentences[s].begin(), sentences[s].end());
+        builder.addSentence(sentenceIds);
+        tokens += sentences[s].size();
+    }
+    if (!builder.write(modelPath)) {
+        std::fprintf(stderr, "cannot write to %s\n", modelPath.c_str());
+        return 1;
+    }
+    double buildSeconds = since(start) / 1e6;
+
+    NgramModel model;
+    if (!model.open(modelPath.c_str(), dictionary.wordCount())) {
+        std::fprintf(stderr, "cannot open %s: %s\n", modelPath.c_str(), model.error());
+        return 1;
+    }
+    uint64_t ngrams = model.bigramCount() + model.trigramCount();
+
+    size_t before = allocatedBytes;
+    NaiveModel naive;
+    for (size_t s = 0; s < training; s++) {
+        const std::vector<uint32_t>& sentence = sentences[s];
+        for (size_t i = 1; i < sentence.size(); i++) {
+            naive.bigrams[sentence[i - 1]][sentence[i]] += 1;
+            if (i >= 2)
+                naive.trigrams[uint64_t(sentence[i - 2]) << 32 | sentence[i - 1]][sentence[i]] += 1;
+        }
+    }
+    size_t naiveBytes = allocatedBytes - before;
+
+    std::printf("%zu words, %zu training sentences (%zu words), %llu bigrams, %llu trigrams, built in %.1f s\n\n",
+                wordCount, training, tokens, static_cast<unsigned long long>(model.bigramCount()),
+                static_cast<unsigned long long>(model.trigramCount()), buildSeconds);
+    std::printf("memory\n");
+    std::printf("  model file  %12zu bytes  %6.2f bytes per n-gram, mapped\n", model.fileSize(),
+                static_cast<double>(model.fileSize()) / static_cast<double>(ngrams));
+    printSections(modelPath.c_str(), ngrams);
+    std::printf("  hash maps   %12zu bytes  %6.2f bytes per n-gram, heap\n\n", naiveBytes,
+                static_cast<double>(naiveBytes) / static_cast<double>(ngrams));
+
+    // Held-out positions with two words of context
+    struct Query {
+        Text word1, word2, next, firstLetter;
+        uint32_t id1, id2;
+    };
+    std::vector<Query> queries;
+    std::mt19937 random(11);
+    while (queries.size() < kQueries) {
+        const std::vector<uint32_t>& sentence =
+            sentences[training + std::uniform_int_distribution<size_t>(0, sentences.size() - training - 1)(random)];
+        size_t i = std::uniform_int_distribution<size_t>(2, sentence.size() - 1)(random);
+        Query query{ dictionary.word(sentence[i - 2]), dictionary.word(sentence[i - 1]), dictionary.word(sentence[i]),
+                     Text(), sentence[i - 2], sentence[i - 1] };
+        size_t length = 0;
+        nextCodePoint(query.next, length);
+        query.firstLetter = query.next.substr(0, length);
+        queries.push_back(std::move(query));
+    }
+
+    PredictorStatus status;
+    PredictorRef withModel = Predictor_Create(0, &status);
+    PredictorRef withoutModel = Predictor_Create(0, &status);
+    if (!withModel || !withoutModel || Predictor_Initialize(withModel, dictionaryPath.c_str()) != PREDICTOR_SUCCESS ||
+        Predictor_Initialize(withoutModel, dictionaryPath.c_str()) != PREDICTOR_SUCCESS ||
+        Predictor_LoadNgramModel(withModel, modelPath.c_str()) != PREDICTOR_SUCCESS) {
+        std::fprintf(stderr, "cannot set up the predictor\n");
+        return 1;
+    }
+
+    alignas(PredictorResult) static char buffer[PREDICTOR_RESULT_BUFFER_SIZE(kMaxResults)];
+    Timing naiveTiming, nextWord, firstLetter, dictionaryOnly;
+    size_t naiveHits = 0, nextWordHits = 0, firstLetterHits = 0, dictionaryHits = 0;
+    std::vector<std::pair<float, uint32_t>> naiveResults;
+    auto predict = [&](PredictorRef predictor, const Query& query, const Text& prefix, Timing& timing) {
+        PredictorResult* results;
+        size_t count;
+        Clock::time_point begin = Clock::now();
+        Predictor_GetNgramPredictionsInto(predictor, toApi(query.word1.c_str()), toApi(query.word2.c_str()),
+                                          toApi(prefix.c_str()), Tamil, NotRequired, kMaxResults, buffer,
+                                          sizeof(buffer), &results, &count);
+        timing.micros.push_back(since(begin));
+        for (size_t i = 0; i < count; i++) {
+            if (fromApi(results[i].word) == query.next)
+                return size_t(1);
+        }
+        return size_t(0);
+    };
+    for (const Query& query : queries) {
+        Clock::time_point begin = Clock::now();
+        naive.predict(query.id1, query.id2, naiveResults);
+        naiveTiming.micros.push_back(since(begin));
+        uint32_t next = static_cast<uint32_t>(dictionary.lookup(query.next));
+        naiveHits += std::any_of(naiveResults.begin(), naiveResults.end(),
+                                 [&](const std::pair<float, uint32_t>& result) { return result.second == next; });
+
+        nextWordHits += predict(withModel, query, Text(), nextWord);
+        firstLetterHits += predict(withModel, query, query.firstLetter, firstLetter);
+        dictionaryHits += predict(withoutModel, query, query.firstLetter, dictionaryOnly);
+    }
+
+    auto rate = [&](size_t hits) { return 100.0 * static_cast<double>(hits) / static_cast<double>(queries.size()); };
+    std::printf("%zu held-out next words, top %zu, latency in microseconds\n\n", queries.size(), kMaxResults);
+    std::printf("                                      p50     p99  next word in top %zu\n", kMaxResults);
+    std::printf("hash maps, lookup only            %7.1f %7.1f  %5.1f%%\n", naiveTiming.percentile(0.5),
+                naiveTiming.percentile(0.99), rate(naiveHits));
+    std::printf("predictor, model, next word       %7.1f %7.1f  %5.1f%%\n", nextWord.percentile(0.5),
+                nextWord.percentile(0.99), rate(nextWordHits));
+    std::printf("predictor, model, first letter    %7.1f %7.1f  %5.1f%%\n", firstLetter.percentile(0.5),
+                firstLetter.percentile(0.99), rate(firstLetterHits));
+    std::printf("predictor, no model, first letter %7.1f %7.1f  %5.1f%%\n", dictionaryOnly.percentile(0.5),
+                dictionaryOnly.percentile(0.99), rate(dictionaryHits));
+
+    Predictor_Destroy(withModel);
+    Predictor_Destroy(withoutModel);
+    model.close();
+    dictionary.close();
+    std::remove(dictionaryPath.c_str());
+    std::remove(modelPath.c_str());
+    return 0;
+}
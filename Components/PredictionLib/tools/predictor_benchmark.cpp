@@ -0,0 +1,252 @@
+// Startup time and memory use of the mapped dictionary, against
+// loading the same word list into a std::map the way a deserializing
+// loader does.
+//
+//   predictor_benchmark [words]
+//
+// Builds a synthetic dictionary of 'words' entries (default 500000) in the
+// temporary directory, checks that every word reads back with its id and
+// frequency, then measures each loader and a batch of 2-syllable prefix
+// lookups with both. Each loader runs in a fresh process (the benchmark
+// re-executing itself with --mapped or --baseline), so the resident memory
+// it reports is its own.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef __APPLE__
+#include <mach/mach.h>
+#endif
+
+#include "Dictionary.h"
+#include "DictionaryBuilder.h"
+#include "SyntheticCorpus.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+double millisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+struct Memory {
+    size_t resident = 0;    // all resident pages, including clean file pages
+    size_t footprint = 0;   // private memory: what the OS charges the process for
+};
+
+// Zero where it cannot be read. Footprint is phys_footprint on Apple
+// platforms, which is what the keyboard extension memory limit applies to,
+// and resident minus file-backed pages on Linux.
+Memory memoryUse()
+{
+    Memory memory;
+#if defined(__APPLE__)
+    task_vm_info_data_t info;
+    mach_msg_type_number_t count = TASK_VM_INFO_COUNT;
+    if (task_info(mach_task_self(), TASK_VM_INFO, reinterpret_cast<task_info_t>(&info), &count) == KERN_SUCCESS) {
+        memory.resident = info.resident_size;
+        memory.footprint = info.phys_footprint;
+    }
+#elif defined(__linux__)
+    FILE* statm = std::fopen("/proc/self/statm", "r");
+    if (!statm)
+        return memory;
+    unsigned long size = 0, resident = 0, shared = 0;
+    if (std::fscanf(statm, "%lu %lu %lu", &size, &resident, &shared) == 3) {
+        size_t page = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        memory.resident = resident * page;
+        memory.footprint = (resident - shared) * page;
+    }
+    std::fclose(statm);
+#endif
+    return memory;
+}
+
+// Run this program again with 'mode' and 'path' and wait for it
+bool runMeasurement(const char* self, const char* mode, const std::string& path)
+{
+    std::fflush(stdout);
+    pid_t child = fork();
+    if (child == 0) {
+        execl(self, self, mode, path.c_str(), static_cast<char*>(nullptr));
+        _exit(127);
+    }
+    int status = 0;
+    return child > 0 && waitpid(child, &status, 0) == child && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+double megabytes(size_t bytes) { return static_cast<double>(bytes) / (1024.0 * 1024.0); }
+
+void printMemory(const char* label, const Memory& before, const Memory& after)
+{
+    std::printf("  %-16s %10.2f MB resident, %.2f MB footprint\n", label,
+                megabytes(after.resident - before.resident), megabytes(after.footprint - before.footprint));
+}
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+// The baseline file: per word a uint16_t length, its code units and a
+// uint32_t frequency
+bool writeBaseline(const std::string& path, const std::vector<DictionaryEntry>& entries)
+{
+    std::ofstream out(path, std::ios::binary | std::ios::trunc);
+    for (const DictionaryEntry& entry : entries) {
+        uint16_t length = static_cast<uint16_t>(entry.word.size());
+        out.write(reinterpret_cast<const char*>(&length), sizeof(length));
+        out.write(reinterpret_cast<const char*>(entry.word.data()), length * sizeof(char16_t));
+        out.write(reinterpret_cast<const char*>(&entry.frequency), sizeof(entry.frequency));
+    }
+    return static_cast<bool>(out);
+}
+
+std::map<Text, uint32_t> loadBaseline(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    std::map<Text, uint32_t> words;
+    uint16_t length;
+    while (in.read(reinterpret_cast<char*>(&length), sizeof(length))) {
+        Text word(length, u'\0');
+        uint32_t frequency;
+        in.read(reinterpret_cast<char*>(&word[0]), length * sizeof(char16_t));
+        in.read(reinterpret_cast<char*>(&frequency), sizeof(frequency));
+        words.emplace(std::move(word), frequency);
+    }
+    return words;
+}
+
+std::vector<Text> benchmarkPrefixes()
+{
+    std::mt19937 random(7);
+    std::vector<Text> prefixes;
+    for (int i = 0; i < 10000; i++)
+        prefixes.push_back(synthetic::randomWord(random, 2, 2));
+    return prefixes;
+}
+
+int measureMapped(const char* path)
+{
+    std::vector<Text> prefixes = benchmarkPrefixes();
+    Memory before = memoryUse();
+    Clock::time_point start = Clock::now();
+    const int opens = 100;
+    Dictionary dictionary;
+    for (int i = 0; i < opens; i++) {
+        if (!dictionary.open(path))
+            return 1;
+    }
+    double openMs = millisecondsSince(start) / opens;
+    Memory afterOpen = memoryUse();
+
+    start = Clock::now();
+    size_t found = 0;
+    for (const Text& prefix : prefixes)
+        found += dictionary.findNode(prefix) != Dictionary::kNoNode;
+    double lookupUs = millisecondsSince(start) * 1000.0 / prefixes.size();
+    Memory afterLookups = memoryUse();
+
+    std::printf("\nmapped trie\n");
+    std::printf("  startup          %10.3f ms\n", openMs);
+    std::printf("  lookups          %10.2f us each (%zu of %zu prefixes found)\n", lookupUs, found, prefixes.size());
+    printMemory("after open", before, afterOpen);
+    printMemory("after lookups", before, afterLookups);
+    return 0;
+}
+
+int measureBaseline(const char* path)
+{
+    std::vector<Text> prefixes = benchmarkPrefixes();
+    Memory before = memoryUse();
+    Clock::time_point start = Clock::now();
+    std::map<Text, uint32_t> words = loadBaseline(path);
+    double loadMs = millisecondsSince(start);
+    Memory afterLoad = memoryUse();
+
+    start = Clock::now();
+    size_t found = 0;
+    for (const Text& prefix : prefixes) {
+        auto it = words.lower_bound(prefix);
+        found += it != words.end() && hasPrefix(it->first, prefix);
+    }
+    double lookupUs = millisecondsSince(start) * 1000.0 / prefixes.size();
+
+    std::printf("\ndeserialized std::map\n");
+    std::printf("  startup          %10.3f ms\n", loadMs);
+    std::printf("  lookups          %10.2f us each (%zu of %zu prefixes found)\n", lookupUs, found, prefixes.size());
+    printMemory("after load", before, afterLoad);
+    return words.empty();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    if (argc == 3 && std::strcmp(argv[1], "--mapped") == 0)
+        return measureMapped(argv[2]);
+    if (argc == 3 && std::strcmp(argv[1], "--baseline") == 0)
+        return measureBaseline(argv[2]);
+
+    size_t wordCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 500000;
+    if (wordCount == 0) {
+        std::fprintf(stderr, "usage: %s [words]\n", argv[0]);
+        return 2;
+    }
+
+    std::string dictionaryPath = temporaryPath("predictor_benchmark.data");
+    std::string baselinePath = temporaryPath("predictor_benchmark.baseline");
+    std::vector<DictionaryEntry> entries = synthetic::words(wordCount);
+    {
+        DictionaryBuilder builder;
+        for (const DictionaryEntry& entry : entries)
+            builder.add(entry.word, entry.frequency);
+        Clock::time_point start = Clock::now();
+        if (!builder.write(dictionaryPath) || !writeBaseline(baselinePath, entries)) {
+            std::fprintf(stderr, "cannot write to %s\n", dictionaryPath.c_str());
+            return 1;
+        }
+        std::printf("built %zu words in %.0f ms\n", entries.size(), millisecondsSince(start));
+    }
+
+    {
+        Dictionary dictionary;
+        if (!dictionary.open(dictionaryPath.c_str())) {
+            std::fprintf(stderr, "cannot open %s: %s\n", dictionaryPath.c_str(), dictionary.error());
+            return 1;
+        }
+        for (const DictionaryEntry& entry : entries) {
+            int32_t id = dictionary.lookup(entry.word);
+            if (id < 0 || dictionary.frequency(static_cast<uint32_t>(id)) != entry.frequency ||
+                dictionary.word(static_cast<uint32_t>(id)) != entry.word) {
+                std::fprintf(stderr, "dictionary does not read back %s\n", toUtf8(entry.word).c_str());
+                return 1;
+            }
+        }
+        std::printf("verified %u words, %u nodes, %.1f MB file\n", dictionary.wordCount(), dictionary.nodeCount(),
+                    megabytes(dictionary.fileSize()));
+    }
+
+    bool ok = runMeasurement(argv[0], "--mapped", dictionaryPath) &&
+              runMeasurement(argv[0], "--baseline", baselinePath);
+    std::remove(dictionaryPath.c_str());
+    std::remove(baselinePath.c_str());
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,108 @@
+// Cost of converting Tamil to the other TargetScripts, a word per call
+// against the batch entry points.
+//
+//   script_benchmark [words]
+//
+// A document of synthetic words (default 200000) is converted to each
+// script word by word with Predictor_ConvertToBrahmi, which allocates each
+// result, and whole with Predictor_ConvertTextInto. Then ten results, as a
+// prediction returns them, are converted one Predictor_ConvertToBrahmi call
+// each against one Predictor_ConvertResults call for all of them.
+
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+double since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::nano>(Clock::now() - start).count();
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t wordCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 200000;
+    if (wordCount == 0) {
+        std::fprintf(stderr, "usage: %s [words]\n", argv[0]);
+        return 2;
+    }
+
+    std::vector<DictionaryEntry> words = synthetic::words(wordCount);
+    Text document;
+    for (const DictionaryEntry& entry : words) {
+        document += entry.word;
+        document += u' ';
+    }
+    // Room for twice the units, wchar_t aligned
+    std::vector<uint32_t> output(document.size() + 1);
+
+    std::printf("%zu words, %zu code units, nanoseconds per word\n\n", words.size(), document.size());
+    std::printf("                   word per call   whole text\n");
+    const char* names[] = { "Tamil", "Brahmi", "Vatteluttu", "Transliterated", "Jawi" };
+    for (int script = Tamil; script <= Jawi; script++) {
+        double perWord = 0;
+        if (script == Brahmi) {
+            Clock::time_point start = Clock::now();
+            for (const DictionaryEntry& entry : words) {
+                wchar_t* result;
+                Predictor_ConvertToBrahmi(toApi(entry.word.c_str()), &result);
+                std::free(result);
+            }
+            perWord = since(start) / static_cast<double>(words.size());
+        }
+        const wchar_t* converted;
+        size_t length;
+        Clock::time_point start = Clock::now();
+        PredictorStatus status =
+            Predictor_ConvertTextInto(toApi(document.c_str()), static_cast<TargetScript>(script), output.data(),
+                                      output.size() * sizeof(uint32_t), &converted, &length);
+        double whole = since(start) / static_cast<double>(words.size());
+        if (status != PREDICTOR_SUCCESS) {
+            std::fprintf(stderr, "cannot convert to %s\n", names[script]);
+            return 1;
+        }
+        if (perWord > 0)
+            std::printf("%-16s %15.1f %12.1f\n", names[script], perWord, whole);
+        else
+            std::printf("%-16s %15s %12.1f\n", names[script], "-", whole);
+    }
+
+    // Ten results at a time
+    constexpr size_t kResults = 10;
+    constexpr size_t kRounds = 20000;
+    {
+        alignas(PredictorResult) static char buffer[PREDICTOR_RESULT_BUFFER_SIZE(kResults)];
+        PredictorResult results[kResults] = {};
+        double single = 0, batch = 0;
+        for (size_t round = 0; round < kRounds; round++) {
+            for (size_t i = 0; i < kResults; i++)
+                results[i].word = toApi(words[(round * kResults + i) % words.size()].word.c_str());
+            Clock::time_point start = Clock::now();
+            for (size_t i = 0; i < kResults; i++) {
+                wchar_t* result;
+                Predictor_ConvertToBrahmi(results[i].word, &result);
+                std::free(result);
+            }
+            single += since(start);
+            size_t count;
+            start = Clock::now();
+            Predictor_ConvertResults(results, kResults, Brahmi, buffer, sizeof(buffer), &count);
+            batch += since(start);
+        }
+        std::printf("\n%zu results to Brahmi, nanoseconds: a call each %.1f, one batch %.1f\n", kResults,
+                    single / kRounds, batch / kRounds);
+    }
+    return 0;
+}
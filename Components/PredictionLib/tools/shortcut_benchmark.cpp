@@ -0,0 +1,152 @@
+// Cost of importing shortcuts and of matching them per keystroke, against
+// an ordered map of shortcut to expansion.
+//
+//   shortcut_benchmark [shortcuts]
+//
+// Sets of 1000, 10000 and 100000 (or the given number of) Latin shortcuts
+// for Tamil expansions are inserted into a ShortcutTrie and imported whole
+// with Predictor_ImportShortcutsFromTextFile. Then every prefix of words
+// typed, half of them shortcuts, is matched: in the map by looking the
+// prefix up, as each keystroke did before, and in the trie by following
+// the typed unit from the node of the prefix before, as a cursor does.
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <random>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include "ShortcutTrie.h"
+#include "SyntheticCorpus.h"
+#include "predictor_c_api.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+constexpr size_t kTypedWords = 20000;
+
+double millisecondsSince(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+Text randomLatin(std::mt19937& random, size_t minLength, size_t maxLength)
+{
+    std::uniform_int_distribution<size_t> length(minLength, maxLength);
+    std::uniform_int_distribution<int> letter('a', 'z');
+    Text text;
+    for (size_t i = length(random); i > 0; i--)
+        text += static_cast<char16_t>(letter(random));
+    return text;
+}
+
+bool measure(size_t count, const std::string& path)
+{
+    std::mt19937 random(static_cast<uint32_t>(count));
+    std::unordered_set<Text> seen;
+    std::vector<std::pair<Text, Text>> shortcuts;
+    while (shortcuts.size() < count) {
+        Text shortcut = randomLatin(random, 2, 8);
+        if (seen.insert(shortcut).second)
+            shortcuts.emplace_back(std::move(shortcut), synthetic::randomWord(random, 2, 6));
+    }
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        for (const auto& [shortcut, expansion] : shortcuts)
+            out << toUtf8(shortcut) << '\t' << toUtf8(expansion) << '\n';
+        if (!out)
+            return false;
+    }
+
+    Clock::time_point start = Clock::now();
+    ShortcutTrie trie;
+    for (const auto& [shortcut, expansion] : shortcuts)
+        trie.insert(shortcut, expansion);
+    double insertMs = millisecondsSince(start);
+
+    start = Clock::now();
+    std::map<Text, Text, std::less<>> map(shortcuts.begin(), shortcuts.end());
+    double mapMs = millisecondsSince(start);
+
+    PredictorStatus status;
+    PredictorRef predictor = Predictor_Create(0, &status);
+    size_t imported = 0;
+    start = Clock::now();
+    status = Predictor_ImportShortcutsFromTextFile(predictor, path.c_str(), &imported);
+    double importMs = millisecondsSince(start);
+    Predictor_Destroy(predictor);
+    if (status != PREDICTOR_SUCCESS || imported != count)
+        return false;
+
+    std::vector<Text> typed;
+    for (size_t i = 0; i < kTypedWords; i++)
+        typed.push_back(i % 2 ? shortcuts[random() % shortcuts.size()].first : randomLatin(random, 2, 10));
+    size_t keys = 0;
+    for (const Text& word : typed)
+        keys += word.size();
+
+    size_t mapMatches = 0, trieMatches = 0;
+    start = Clock::now();
+    for (const Text& word : typed) {
+        for (size_t length = 1; length <= word.size(); length++) {
+            auto found = map.find(TextView(word).substr(0, length));
+            mapMatches += found != map.end();
+        }
+    }
+    double mapNs = millisecondsSince(start) * 1e6 / static_cast<double>(keys);
+
+    start = Clock::now();
+    for (const Text& word : typed) {
+        uint32_t node = ShortcutTrie::kRoot;
+        for (char16_t unit : word) {
+            node = trie.child(node, unit);
+            trieMatches += !trie.expansion(node).empty();
+        }
+    }
+    double trieNs = millisecondsSince(start) * 1e6 / static_cast<double>(keys);
+    if (mapMatches != trieMatches)
+        return false;
+
+    std::printf("%9zu %10.1f %10.1f %10.1f %12.1f %10.1f\n", count, insertMs, importMs, mapMs, mapNs, trieNs);
+    return true;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t largest = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    if (largest == 0) {
+        std::fprintf(stderr, "usage: %s [shortcuts]\n", argv[0]);
+        return 2;
+    }
+
+    std::string path = temporaryPath("shortcut_benchmark.txt");
+    std::printf("                  milliseconds to load            ns per keystroke\n");
+    std::printf("shortcuts     insert     import  map build   map lookup  trie step\n");
+    bool ok = true;
+    for (size_t count : { size_t(1000), size_t(10000) }) {
+        if (ok && count < largest)
+            ok = measure(count, path);
+    }
+    ok = ok && measure(largest, path);
+    std::remove(path.c_str());
+    if (!ok)
+        std::fprintf(stderr, "shortcuts do not match alike\n");
+    return ok ? 0 : 1;
+}
@@ -0,0 +1,213 @@
+// Cost of learning on the keystroke path, and what survives a crash.
+//
+//   user_dictionary_benchmark [changes] [crashes]
+//
+// Typing is simulated as words drawn by frequency from a synthetic list,
+// each learned with its bigram and now and then a removal (default 20000
+// changes), timing every call. The files are then reopened and compared
+// with the changes made.
+//
+// Crashes are simulated on a fresh dictionary of 1000 changes, all still in
+// the log, by cutting the log short or flipping a byte in it (default 200
+// times): each must open to the state after some prefix of the changes,
+// and keep what is learned after.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "SyntheticCorpus.h"
+#include "UserDictionary.h"
+
+using namespace predictor;
+using Clock = std::chrono::steady_clock;
+
+namespace {
+
+struct Timing {
+    std::vector<double> micros;
+
+    double percentile(double p)
+    {
+        std::sort(micros.begin(), micros.end());
+        return micros[static_cast<size_t>(p * static_cast<double>(micros.size() - 1))];
+    }
+};
+
+std::string temporaryPath(const char* name)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = directory && *directory ? directory : "/tmp";
+    if (path.back() != '/')
+        path += '/';
+    return path + name;
+}
+
+double since(Clock::time_point start)
+{
+    return std::chrono::duration<double, std::micro>(Clock::now() - start).count();
+}
+
+std::string readFile(const std::string& path)
+{
+    std::ifstream in(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+}
+
+void writeFile(const std::string& path, const std::string& data)
+{
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << data;
+}
+
+} // namespace
+
+int main(int argc, char* argv[])
+{
+    size_t changeCount = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 20000;
+    size_t crashCount = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 200;
+    if (changeCount == 0) {
+        std::fprintf(stderr, "usage: %s [changes] [crashes]\n", argv[0]);
+        return 2;
+    }
+
+    std::string path = temporaryPath("user_dictionary_benchmark.data");
+    std::string logPath = path + ".log";
+    std::remove(path.c_str());
+    std::remove(logPath.c_str());
+
+    std::vector<DictionaryEntry> words = synthetic::words(50000);
+    std::vector<double> weights;
+    for (const DictionaryEntry& entry : words)
+        weights.push_back(entry.frequency);
+    std::mt19937 random(7);
+    std::discrete_distribution<size_t> pick(weights.begin(), weights.end());
+    std::uniform_int_distribution<int> percent(0, 99);
+
+    // A change of the simulated typing; returns the word whose count it changed
+    Text previous;
+    auto type = [&](UserDictionary& dictionary, std::map<Text, uint32_t>& counts) {
+        const Text& word = words[pick(random)].word;
+        if (percent(random) < 2 && counts.count(word)) {
+            dictionary.removeWord(word);
+            counts.erase(word);
+        } else if (percent(random) < 50 || previous.empty()) {
+            dictionary.addWord(word);
+            counts[word]++;
+        } else {
+            dictionary.addBigram(previous, word);
+        }
+        previous = word;
+        return word;
+    };
+
+    std::map<Text, uint32_t> expected;
+    Timing learning;
+    double slowest = 0;
+    {
+        UserDictionary dictionary;
+        if (!dictionary.open(path)) {
+            std::fprintf(stderr, "cannot open %s\n", path.c_str());
+            return 1;
+        }
+        Clock::time_point start = Clock::now();
+        for (size_t i = 0; i < changeCount; i++) {
+            Clock::time_point call = Clock::now();
+            type(dictionary, expected);
+            learning.micros.push_back(since(call));
+            slowest = std::max(slowest, learning.micros.back());
+        }
+        double total = since(start);
+        Clock::time_point flushStart = Clock::now();
+        dictionary.flush();
+        std::printf("%zu changes in %.1f ms, then flush %.1f ms\n", changeCount, total / 1000,
+                    since(flushStart) / 1000);
+    }
+    std::printf("per change: p50 %.2f us, p99 %.2f us, max %.0f us\n", learning.percentile(0.5),
+                learning.percentile(0.99), slowest);
+    std::printf("files: snapshot %zu bytes, log %zu bytes\n", readFile(path).size(), readFile(logPath).size());
+
+    size_t mismatches = 0;
+    {
+        UserDictionary dictionary;
+        bool same = dictionary.open(path) && dictionary.wordCount() == expected.size() &&
+                    std::all_of(expected.begin(), expected.end(), [&](const std::pair<const Text, uint32_t>& entry) {
+                        return dictionary.count(entry.first) == entry.second;
+                    });
+        if (!same) {
+            std::printf("reopened dictionary differs\n");
+            mismatches++;
+        }
+    }
+
+    // The crash runs: the counts of every word touched, after each change
+    constexpr size_t kCrashChanges = 1000;
+    std::remove(path.c_str());
+    std::remove(logPath.c_str());
+    std::map<Text, size_t> touched;
+    std::vector<std::pair<Text, uint32_t>> history;    // word and its count after each change
+    {
+        UserDictionary dictionary;
+        dictionary.open(path);
+        std::map<Text, uint32_t> counts;
+        previous.clear();
+        for (size_t i = 0; i < kCrashChanges; i++) {
+            Text word = type(dictionary, counts);
+            touched.emplace(word, touched.size());
+            history.emplace_back(word, counts.count(word) ? counts[word] : 0);
+        }
+    }
+    std::vector<std::vector<uint32_t>> states(1, std::vector<uint32_t>(touched.size(), 0));
+    for (const auto& change : history) {
+        states.push_back(states.back());
+        states.back()[touched[change.first]] = change.second;
+    }
+    std::string snapshot = readFile(path), log = readFile(logPath);
+
+    std::uniform_int_distribution<size_t> offset(0, log.size());
+    size_t replayed = 0;
+    for (size_t crash = 0; crash < crashCount; crash++) {
+        std::string damaged = log.substr(0, offset(random));
+        if (crash % 2 && !damaged.empty())
+            damaged[offset(random) % damaged.size()] ^= 0x5A;
+        writeFile(path, snapshot);
+        writeFile(logPath, damaged);
+
+        UserDictionary dictionary;
+        if (!dictionary.open(path)) {
+            mismatches++;
+            continue;
+        }
+        std::vector<uint32_t> state(touched.size());
+        for (const auto& word : touched)
+            state[word.second] = dictionary.count(word.first);
+        auto match = std::find(states.begin(), states.end(), state);
+        replayed += static_cast<size_t>(match - states.begin());
+
+        // What is learned after recovery must survive the next open
+        Text marker = u"மீட்பு";
+        dictionary.addWord(marker);
+        dictionary.close();
+        dictionary.open(path);
+        if (match == states.end() || dictionary.count(marker) == 0)
+            mismatches++;
+    }
+    if (crashCount)
+        std::printf("%zu simulated crashes over a %zu byte log of %zu changes: %.0f changes recovered on average\n",
+                    crashCount, log.size(), kCrashChanges,
+                    static_cast<double>(replayed) / static_cast<double>(crashCount));
+
+    std::remove(path.c_str());
+    std::remove(logPath.c_str());
+    if (mismatches) {
+        std::printf("%zu mismatches\n", mismatches);
+        return 1;
+    }
+    return 0;
+}
@@ -22,13 +22,27 @@ let package = Package(
             sources: [
                 "src/tamil/AnjalKeyMap.c",
                 "src/tamil/KeyTranslatorTamil.c",
+                "src/tamil/TextOriginDetector.c",
+                "src/tamil/EnglishLexicon.c",
+                "src/KeyTranslatorMultilingual.c",
+                "src/MappedFile.c",
                 "src/indic/IndicNotesIMEngine.c",
+                "src/indic/IndicPhoneticEngine.c",
                 "src/indic/IndicDevanagariKeymap.c",
                 "src/indic/IndicMalayalamKeymap.c",
                 "src/indic/IndicKannadaKeymap.c",
                 "src/indic/IndicTamilAnjalKeymap.c",
                 "src/indic/IndicTeluguKeymap.c",
-                "src/indic/IndicGurmukhiKeymap.c"
+                "src/indic/IndicGurmukhiKeymap.c",
+                "src/indic/IndicBengaliKeymap.c",
+                "src/indic/IndicGujaratiKeymap.c",
+                "src/indic/IndicOriyaKeymap.c",
+                "src/indic/IndicSinhalaKeymap.c",
+                "src/indic/IndicDiacriticKeymap.c",
+                "src/indic/IndicKeyPosHash.c",
+                "src/indic/IndicTransliterator.c",
+                "src/indic/AksharaSegmenter.c",
+                "src/indic/IndicSessionPool.c"
             ],
             publicHeadersPath: "include",
             cSettings: [
@@ -0,0 +1,50 @@
+#ifndef AKSHARA_SEGMENTER_H
+#define AKSHARA_SEGMENTER_H
+
+#include <stddef.h>
+#include <wchar.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Akshara (orthographic syllable) segmentation for Tamil and the other Indic
+// scripts from Devanagari to Sinhala.
+//
+// An akshara is what the user sees as one letter and expects a single
+// backspace or cursor step to cross: a consonant with its nukta, vowel sign
+// and anusvara/visarga, a conjunct joined by virama (क्षत्रि), or an
+// independent vowel with its marks. Script rules:
+//
+//   - the Tamil pulli and the Malayalam visible viramas end the akshara
+//     (க் ட ம்), except for the conjunct க்ஷ
+//   - Sinhala al-lakuna only joins through ZWJ (ශ්‍රී, ක්‍ය)
+//   - ZWJ after a virama asks for a half form and keeps the next consonant
+//     in the akshara; ZWNJ ends it
+//   - CR LF is one unit; combining marks attach to whatever precedes them
+//
+// Everything outside the Indic blocks (Latin, digits, punctuation) is one
+// character per akshara. None of the functions allocate; they can be called
+// on any thread.
+
+// Length of the akshara that starts text[0]; 0 only if 'length' is 0
+size_t akshara_next_length(const wchar_t* text, size_t length);
+
+// Length of the akshara that ends just before text[length], i.e. how many
+// characters a backspace at that cursor position should delete. Only looks
+// back a bounded distance, so the cost does not depend on 'length'.
+size_t akshara_previous_length(const wchar_t* text, size_t length);
+
+// Store the start offset of every akshara in 'starts', at most 'capacity' of
+// them. Returns the total number of aksharas, which can be larger than
+// 'capacity'; 'starts' may be NULL when 'capacity' is 0.
+size_t akshara_boundaries(const wchar_t* text, size_t length, size_t* starts, size_t capacity);
+
+// Number of aksharas in the text
+size_t akshara_count(const wchar_t* text, size_t length);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // AKSHARA_SEGMENTER_H
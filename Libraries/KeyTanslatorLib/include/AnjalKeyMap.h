@@ -48,6 +48,8 @@
 
 #endif // !WIN32
 
+#include "KeyMask128.h"
+
 // character sets
 #define MAX_ROWS           37  //35  //}  Applied to Tamil only
 #define MAX_COLS           13  //}
@@ -66,6 +68,24 @@
 #define kbdBamini           8
 #define kbdTNTWriter        9
 
+// keyboard matrix tables. Each layout has MAX_TABLES tables, see AnjalKeyMapLookup.h
+#define Conso1stKeys     0
+#define Conso2ndKeys     1
+#define Conso3rdKeys     2
+#define Conso1stChar     3
+#define Conso2ndChar     4
+#define Conso3rdChar     5
+#define ConsoRsltant     6
+#define Vowel1stKeys     7
+#define Vowel2ndKeys     8
+#define Vowel1stChar     9
+#define Vowel2ndChar    10
+#define OutOfMatrixKeys 11
+#define outOfMatrixChar 12
+
+#define MAX_TABLES      13
+#define MAX_TABLESIZE   50
+
 // getKeyString results
 #define KSR_DELETE_PREV_KS_LENGTH -1
 #define KSR_DELETE_NONE            0
@@ -107,6 +127,8 @@ WCHAR    LeftVowelSignFor(WCHAR twoPartVS);
 void     SetWytiwygVowelLeftHalf(WCHAR lh);
 void     SetWytiwygDeleteInReverseTypingOrder(BOOL reverseOrder);
 int      GetUnmappedCharStringForKey(WCHAR key, WCHAR* s, WCHAR prevChar, bool isShifted);
+const char* GetLayoutTable(int layout, int tableId);
+KeyMask128  GetContinuationKeys(WCHAR prevKey);  // keys that continue the current composition
 
 
 // To be migrates
@@ -77,22 +77,8 @@ const WCHAR* encTable[MAX_ROWS][MAX_COLS] = {
 //
 //  escape character = '^'
 
-#define Conso1stKeys     0
-#define Conso2ndKeys     1
-#define Conso3rdKeys     2
-#define Conso1stChar     3
-#define Conso2ndChar     4
-#define Conso3rdChar     5
-#define ConsoRsltant     6
-#define Vowel1stKeys     7
-#define Vowel2ndKeys     8
-#define Vowel1stChar     9
-#define Vowel2ndChar    10
-#define OutOfMatrixKeys 11
-#define outOfMatrixChar 12
-
-#define MAX_TABLES      13
-#define MAX_TABLESIZE   50
+// Table indexes (Conso1stKeys ... outOfMatrixChar) and MAX_TABLES are
+// defined in AnjalKeyMap.h so the tables can be read through GetLayoutTable()
 
 #define C1Keys  kbdTable[kbdType][Conso1stKeys]
 #define C2Keys  kbdTable[kbdType][Conso2ndKeys]
@@ -0,0 +1,114 @@
+#ifndef ENGLISH_LEXICON_H
+#define ENGLISH_LEXICON_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Compact English word list used to let code-mixed English words typed on
+// the Anjal phonetic layout pass through untransliterated.
+//
+// The lexicon file (built by tools/build_english_lexicon) is memory-mapped
+// and holds two structures:
+//  - a blocked Bloom filter (one 64-bit word per key) that rejects almost
+//    every non-English word with a single memory access, and
+//  - a minimal acyclic automaton (a trie with shared suffixes) that confirms
+//    Bloom hits and carries a per-word confidence byte.
+//
+// File layout, all integers little endian, sections 8-byte aligned:
+//   EnglishLexiconHeader
+//   uint64_t bloom[bloomWords]
+//   EnglishLexiconNode nodes[nodeCount]     (BFS order, node 0 is the root)
+//   uint32_t edges[edgeCount]               ((child << 8) | letter)
+
+#define ENGLISH_LEXICON_MAGIC       "ENLX"
+#define ENGLISH_LEXICON_VERSION     1
+#define ENGLISH_LEXICON_MAX_WORD    24      // longer words are never matched
+#define ENGLISH_LEXICON_MIN_WORD    2
+
+typedef struct {
+    char     magic[4];
+    uint16_t version;
+    uint8_t  bloomHashes;       // bits set per key, all within one word
+    uint8_t  maxWordLength;
+    uint32_t bloomWords;        // power of two
+    uint32_t nodeCount;
+    uint32_t edgeCount;
+    uint32_t bloomOffset;
+    uint32_t nodesOffset;
+    uint32_t edgesOffset;
+} EnglishLexiconHeader;
+
+typedef struct {
+    uint32_t firstEdge;
+    uint8_t  edgeCount;
+    uint8_t  confidence;        // 0 = not a word, 1..255 = word
+    uint16_t reserved;
+} EnglishLexiconNode;
+
+typedef struct EnglishLexicon EnglishLexicon;
+
+// Per-composition word tracker. Fed one keystroke at a time; the hash is
+// rolled forward so the word-boundary check needs no rescan.
+typedef struct {
+    uint32_t hash;
+    uint8_t  length;
+    bool     rejected;          // something in the word can't be English
+    char     typed[ENGLISH_LEXICON_MAX_WORD + 1];  // as typed, NUL terminated
+    char     folded[ENGLISH_LEXICON_MAX_WORD + 1]; // lower case
+} EnglishLexiconState;
+
+// Map a lexicon file. Returns NULL if the file is missing or malformed.
+EnglishLexicon* english_lexicon_open(const char* path);
+
+// Use a lexicon already in memory (e.g. a bundled resource). The buffer must
+// be 8-byte aligned and outlive the returned lexicon.
+EnglishLexicon* english_lexicon_open_memory(const void* data, size_t size);
+
+void english_lexicon_close(EnglishLexicon* lexicon);
+
+// Bytes of lexicon data (mapped, not necessarily resident)
+size_t english_lexicon_size(const EnglishLexicon* lexicon);
+
+// Confidence (1..255) for a lower-case ASCII word, 0 if it isn't listed.
+int english_lexicon_lookup(const EnglishLexicon* lexicon, const char* word, int length);
+
+void english_lexicon_state_reset(EnglishLexiconState* state);
+
+// Add a typed key to the current word. Letters are accepted; a capital is
+// only accepted as the first letter since Anjal uses capitals mid-word for
+// retroflex and long sounds. Returns false once the word can no longer be
+// passed through.
+bool english_lexicon_state_push(EnglishLexiconState* state, int key);
+
+// Confidence that the word typed so far is English, 0 if not.
+int english_lexicon_state_match(const EnglishLexicon* lexicon, const EnglishLexiconState* state);
+
+// Hash helpers shared with the builder so both sides agree on the filter.
+static inline uint32_t english_lexicon_hash_step(uint32_t hash, char c)
+{
+    return (hash ^ (uint8_t)c) * 16777619u;
+}
+
+static inline uint64_t english_lexicon_bloom_key(uint32_t hash, int length)
+{
+    uint64_t x = ((uint64_t)hash << 8) ^ (uint64_t)length;
+    x ^= x >> 33;
+    x *= 0xff51afd7ed558ccdULL;
+    x ^= x >> 33;
+    x *= 0xc4ceb9fe1a85ec53ULL;
+    x ^= x >> 33;
+    return x;
+}
+
+#define ENGLISH_LEXICON_HASH_SEED   2166136261u
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // ENGLISH_LEXICON_H
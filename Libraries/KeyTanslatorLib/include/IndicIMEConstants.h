@@ -9,5 +9,9 @@
 #define kImeTypeTelugu        104
 #define kImeTypeKannada       105
 #define kImeTypeDiacritic     106
+#define kImeTypeBengali       107
+#define kImeTypeGujarati      108
+#define kImeTypeOriya         109
+#define kImeTypeSinhala       110
 
 #endif // INDIC_IME_CONSTANTS_H
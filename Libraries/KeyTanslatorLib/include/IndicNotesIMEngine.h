@@ -6,6 +6,7 @@
 #include <wchar.h>
 #include <ctype.h>
 #include "IndicIMEConstants.h"
+#include "KeyMask128.h"
 
 // Platform compatibility
 #ifndef _WIN32
@@ -59,6 +60,16 @@ void getKeyStringUnicode(UniChar currKey, UniChar *s, getKeyStringResults *resul
 int getKeyPos(UniChar key, UniChar table[], UniChar pKey, UniChar pTable[], UniChar fKey, UniChar fTable[]);
 void clearResults(getKeyStringResults *results);
 
+// Keys that would continue the composition described by results (i.e. would
+// not start a new character). Each distinct state is evaluated once and then
+// served from 'cache'; give every session (or thread) its own. With a NULL
+// cache the state is evaluated on every call.
+typedef struct IndicContinuationCache IndicContinuationCache;
+
+IndicContinuationCache *indicContinuationCacheCreate(void);
+void indicContinuationCacheDestroy(IndicContinuationCache *cache);
+KeyMask128 getContinuationKeys(IndicContinuationCache *cache, const getKeyStringResults *results);
+
 // Language-specific functions
 void getKeyStringUnicodeDevanagariAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
 void startNewSessionDevanagariAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
@@ -78,6 +89,18 @@ void startNewSessionGurmukhiAnjal(UniChar currKey, UniChar *s, getKeyStringResul
 void getKeyStringUnicodeTamilAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
 void startNewSessionTamilAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
 
+void getKeyStringUnicodeBengaliAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
+void startNewSessionBengaliAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
+
+void getKeyStringUnicodeGujaratiAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
+void startNewSessionGujaratiAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
+
+void getKeyStringUnicodeOriyaAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
+void startNewSessionOriyaAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
+
+void getKeyStringUnicodeSinhalaAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
+void startNewSessionSinhalaAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results);
+
 void getKeyStringUnicodeDiacritic(UniChar currKey, UniChar *s, getKeyStringResults *results);
 void startNewSessionDiacritic(UniChar currKey, UniChar *s, getKeyStringResults *results);
 
@@ -0,0 +1,112 @@
+#ifndef INDIC_SESSION_POOL_H
+#define INDIC_SESSION_POOL_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "IndicNotesIMEngine.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Indic engine sessions for servers that run many users at once.
+//
+// getKeyStringResults is the engine's working structure: wchar_t sized
+// fields and ints, 44 bytes with a 32-bit wchar_t. Between keystrokes a
+// session only needs the 16 byte IndicSessionState below, and an
+// IndicSessionPool keeps thousands of those in one slab and runs batches of
+// keystrokes for any mix of sessions in one call.
+//
+// The pool is an array of these states, not a structure of per-field
+// arrays: a keystroke reads and writes every field of one session, which
+// costs one cache line this way and one per field split up. It holds about
+// twice the sessions per byte of plain getKeyStringResults (20 bytes per
+// session with the free list against 44), well short of ten times. Ten
+// times would mean under 5 bytes per session, less than the keys and
+// characters the engine has to carry between keystrokes, whatever the
+// layout.
+
+// Keys and characters above U+FFFF are stored as this; no keymap uses them
+#define INDIC_SESSION_NON_BMP   0xFFFD
+
+// Packed copy of a getKeyStringResults between keystrokes. insertCount and
+// deleteCount are not kept: the engine sets them on every keystroke.
+typedef struct {
+    uint16_t prevKey;
+    uint16_t firstVowelKey;
+    uint16_t firstConsoKey;
+    uint16_t currentBaseChar;
+    uint16_t contextBefore;
+    uint8_t  prevKeyType;
+    uint8_t  prevCharType;
+    uint8_t  imeIndex;          // imeType - kImeTypeDevanagari
+    uint8_t  fixPrevious;
+    uint8_t  generation;        // owned by IndicSessionPool, left alone by pack
+    uint8_t  reserved;
+} IndicSessionState;
+
+void indic_session_state_pack(IndicSessionState* state, const getKeyStringResults* results);
+void indic_session_state_unpack(getKeyStringResults* results, const IndicSessionState* state);
+
+// --- Session pool
+//
+// A pool is not thread safe; give each worker thread its own.
+
+typedef struct IndicSessionPool IndicSessionPool;
+
+// Identifies a session in its pool. Ids of closed sessions are not reused
+// until the slot has been recycled 256 times, so a stale id is rejected
+// rather than reaching another user's session.
+typedef uint32_t IndicSessionId;
+
+#define INDIC_SESSION_INVALID   UINT32_MAX
+#define INDIC_SESSION_MAX_TEXT  8       // longest text a keystroke produces, with room to spare
+
+typedef struct {
+    IndicSessionId session;
+    UniChar        key;
+    UniChar        contextBefore;       // character before the cursor, 0 if unknown
+} IndicKeystroke;
+
+typedef struct {
+    uint8_t insertCount;                // characters of text to insert
+    uint8_t deleteCount;                // characters before the cursor to delete first
+    bool    fixPrevious;                // the previous composition is complete
+    UniChar text[INDIC_SESSION_MAX_TEXT];
+} IndicKeystrokeResult;
+
+// Create a pool with room for 'capacity' sessions (at most 2^24 - 1, so no
+// id can equal INDIC_SESSION_INVALID). Returns NULL if capacity is out of
+// range or out of memory.
+IndicSessionPool* indic_session_pool_create(size_t capacity);
+void indic_session_pool_destroy(IndicSessionPool* pool);
+
+// Number of open sessions
+size_t indic_session_pool_size(const IndicSessionPool* pool);
+
+// Open a session typing with 'imeType' (kImeTypeDevanagari..kImeTypeSinhala).
+// Returns INDIC_SESSION_INVALID if the pool is full or imeType is unknown.
+IndicSessionId indic_session_open(IndicSessionPool* pool, int imeType);
+void indic_session_close(IndicSessionPool* pool, IndicSessionId session);
+
+// Start over, as after the user moves the cursor
+void indic_session_reset(IndicSessionPool* pool, IndicSessionId session);
+
+// Copy a session's state out or in, e.g. to move it to another pool
+bool indic_session_get_state(const IndicSessionPool* pool, IndicSessionId session, IndicSessionState* state);
+bool indic_session_set_state(IndicSessionPool* pool, IndicSessionId session, const IndicSessionState* state);
+
+// Run 'count' keystrokes, in order, writing one result for each. Keystrokes
+// for closed or unknown sessions produce an empty result. Returns the number
+// of keystrokes that reached a session.
+size_t indic_session_process(IndicSessionPool* pool,
+                             const IndicKeystroke* keystrokes,
+                             size_t count,
+                             IndicKeystrokeResult* results);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // INDIC_SESSION_POOL_H
@@ -0,0 +1,60 @@
+#ifndef INDIC_TRANSLITERATOR_H
+#define INDIC_TRANSLITERATOR_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <wchar.h>
+#include "KeyTranslatorMultilingual.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Script to script transliteration between the Indic scripts that share the
+// ISCII derived layout of their Unicode blocks: Devanagari, Bengali,
+// Gurmukhi, Gujarati, Oriya, Tamil, Telugu, Kannada and Malayalam.
+//
+// Letters at the same offset in two blocks are the same letter, so most text
+// converts by adding the distance between the blocks. Letters one script
+// lacks fall back to the nearest one it has (Tamil has no aspirates or voiced
+// stops: ख, ग, घ -> க), script specific letters are spelt out (Malayalam
+// chillus become consonant + virama, precomposed nukta letters become base +
+// nukta) and anything without an equivalent is left in the source script.
+// Characters outside the source block (spaces, Latin, the shared dandas,
+// ZWJ/ZWNJ) are copied unchanged.
+
+// The most characters a single source character expands to
+#define INDIC_TRANSLIT_MAX_EXPANSION    3
+
+// Conversion table for one source/target pair. Build it once with
+// indic_transliterator_init() and reuse it; it is read-only afterwards and
+// can be shared between threads.
+typedef struct {
+    wchar_t  sourceBase;
+    wchar_t  targetBase;
+    wchar_t  single[128];       // the character an offset becomes, 0 if it is not exactly one
+    uint8_t  length[128];       // characters written for each source offset
+    wchar_t  text[128][INDIC_TRANSLIT_MAX_EXPANSION];
+} IndicTransliterator;
+
+// Prepare a table converting from 'source' to 'target'. Returns false if
+// either language is not one of the scripts above (LANG_SINHALA,
+// LANG_DIACRITICS).
+bool indic_transliterator_init(IndicTransliterator* t, SupportedLanguage source, SupportedLanguage target);
+
+// Convert 'length' characters of 'text' into 'out', writing at most
+// 'capacity' characters. Returns the length of the full conversion, which is
+// larger than 'capacity' if the output was cut short; length *
+// INDIC_TRANSLIT_MAX_EXPANSION is always enough. 'out' is not terminated.
+size_t indic_transliterate(const IndicTransliterator* t,
+                           const wchar_t* text,
+                           size_t length,
+                           wchar_t* out,
+                           size_t capacity);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // INDIC_TRANSLITERATOR_H
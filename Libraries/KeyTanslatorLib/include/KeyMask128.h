@@ -0,0 +1,52 @@
+#ifndef KEY_MASK_128_H
+#define KEY_MASK_128_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// One bit per 7-bit ASCII key code. Used to report which keys would
+// continue the current composition (for key highlighting and hit targets).
+typedef struct {
+    uint64_t lo;    // keys 0x00 - 0x3F
+    uint64_t hi;    // keys 0x40 - 0x7F
+} KeyMask128;
+
+static inline KeyMask128 keymask_empty(void)
+{
+    KeyMask128 m = { 0, 0 };
+    return m;
+}
+
+static inline void keymask_set(KeyMask128* m, unsigned key)
+{
+    if (key < 64)       m->lo |= 1ULL << key;
+    else if (key < 128) m->hi |= 1ULL << (key - 64);
+}
+
+static inline bool keymask_test(KeyMask128 m, unsigned key)
+{
+    if (key < 64)  return (m.lo >> key) & 1;
+    if (key < 128) return (m.hi >> (key - 64)) & 1;
+    return false;
+}
+
+static inline KeyMask128 keymask_or(KeyMask128 a, KeyMask128 b)
+{
+    KeyMask128 m = { a.lo | b.lo, a.hi | b.hi };
+    return m;
+}
+
+static inline bool keymask_is_empty(KeyMask128 m)
+{
+    return (m.lo | m.hi) == 0;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KEY_MASK_128_H
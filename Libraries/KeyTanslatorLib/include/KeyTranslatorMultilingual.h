@@ -4,12 +4,14 @@
 #include <wchar.h>
 #include <stdbool.h>
 #include <stdint.h>
+#include "EnglishLexicon.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
-// code to indicate that delete should be sent. the next char to this code indicates the number of deletes
+// code to indicate that delete should be sent. the next char to this code indicates the number of deletes,
+// a digit; more than nine deletes are sent as several such pairs, to be added up
 #define DELCODE         0x2421
 
 // Supported languages
@@ -20,7 +22,11 @@ typedef enum {
     LANG_KANNADA = 3,
     LANG_TELUGU = 4,
     LANG_GURMUKHI = 5,      // Punjabi
-    LANG_DIACRITICS = 6     // Linguistic transcription
+    LANG_DIACRITICS = 6,    // Linguistic transcription
+    LANG_BENGALI = 7,       // Bengali, Assamese
+    LANG_GUJARATI = 8,
+    LANG_ORIYA = 9,
+    LANG_SINHALA = 10
 } SupportedLanguage;
 
 // Keyboard layouts (Tamil-specific)
@@ -40,6 +46,14 @@ typedef enum {
 // Opaque handle for multilingual translator
 typedef struct MultilingualTranslatorHandle* MultilingualTranslatorRef;
 
+// Edit described by a translated key, as in getKeyStringResults: delete
+// deleteCount characters before the cursor, then insert the insertCount
+// characters written to the output buffer
+typedef struct {
+    int insertCount;
+    int deleteCount;
+} MultilingualKeyResult;
+
 // Create translator for specific language and keyboard layout
 MultilingualTranslatorRef multilingual_translator_create(SupportedLanguage language, 
                                                         KeyboardLayout layout);
@@ -47,13 +61,31 @@ MultilingualTranslatorRef multilingual_translator_create(SupportedLanguage langu
 // Destroy translator
 void multilingual_translator_destroy(MultilingualTranslatorRef translator);
 
-// Translate key for current language
+// Smallest output buffer the translate calls accept, in characters
+#define MULTILINGUAL_MIN_OUTPUT 16
+
+// Translate key for current language. The output starts with DELCODE and
+// digit pairs when earlier text has to be deleted. Returns -1 if the buffer
+// is smaller than MULTILINGUAL_MIN_OUTPUT, the key then being ignored, or if
+// the delete and the text don't fit together.
 int multilingual_translator_translate_key(MultilingualTranslatorRef translator,
                                          int32_t key_code,
                                          bool shifted,
                                          wchar_t* output_buffer,
                                          int buffer_size);
 
+// Translate key for current language, returning the delete count in
+// 'result' instead of encoding it in the text. The output buffer only holds
+// the text to insert, NUL terminated. Returns result->insertCount, or -1
+// without translating the key if the buffer is smaller than
+// MULTILINGUAL_MIN_OUTPUT.
+int multilingual_translator_translate_key_ex(MultilingualTranslatorRef translator,
+                                            int32_t key_code,
+                                            bool shifted,
+                                            wchar_t* output_buffer,
+                                            int buffer_size,
+                                            MultilingualKeyResult* result);
+
 // Switch language while keeping same translator instance
 bool multilingual_translator_set_language(MultilingualTranslatorRef translator, 
                                          SupportedLanguage language);
@@ -70,6 +102,15 @@ int multilingual_translator_get_supported_layouts(MultilingualTranslatorRef tran
                                                  KeyboardLayout* layouts_buffer,
                                                  int buffer_size);
 
+// Let English words typed on the Tamil Anjal layout pass through: when a
+// word ends, if its keystrokes are listed in 'lexicon' (see EnglishLexicon.h)
+// with at least 'min_confidence', the Tamil it was rendered as is deleted
+// and the word inserted as typed. NULL turns it off. The lexicon must
+// outlive its use by the translator.
+void multilingual_translator_set_english_lexicon(MultilingualTranslatorRef translator,
+                                                 const EnglishLexicon* lexicon,
+                                                 int min_confidence);
+
 // Terminate composition
 void multilingual_translator_terminate_composition(MultilingualTranslatorRef translator);
 
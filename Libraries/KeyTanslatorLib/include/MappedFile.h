@@ -0,0 +1,30 @@
+#ifndef MAPPED_FILE_H
+#define MAPPED_FILE_H
+
+#include <stddef.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Read-only memory mapping of a whole file (mmap on POSIX, file mapping on
+// Windows). Pages are shared with the OS page cache, so several keyboard
+// processes loading the same data file only pay for it once.
+typedef struct {
+    const unsigned char* data;
+    size_t               size;
+    void*                platform;  // Windows mapping handle, unused elsewhere
+} MappedFile;
+
+// Map 'path'. Returns false (and leaves 'file' zeroed) on any failure,
+// including an empty file.
+bool mapped_file_open(MappedFile* file, const char* path);
+
+void mapped_file_close(MappedFile* file);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // MAPPED_FILE_H
@@ -0,0 +1,46 @@
+#ifndef TEXT_ORIGIN_DETECTOR_H
+#define TEXT_ORIGIN_DETECTOR_H
+
+#include <wchar.h>
+#include <stdbool.h>
+#include "KeyTranslatorMultilingual.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Where a piece of (pasted) text most likely came from
+typedef enum {
+    TEXT_ORIGIN_UNICODE_TAMIL = 0,  // Unicode Tamil, nothing to convert
+    TEXT_ORIGIN_UNICODE_INDIC = 1,  // Unicode in one of the other Indic blocks
+    TEXT_ORIGIN_TSCII = 2,          // TSCII bytes rendered as Latin-1
+    TEXT_ORIGIN_BAMINI = 3,         // Bamini font encoding rendered as Latin
+    TEXT_ORIGIN_KEYSTROKES = 4,     // Raw keystrokes typed for 'layout'
+    TEXT_ORIGIN_PLAIN = 5           // Plain Latin text (English etc.)
+} TextOrigin;
+
+// One ranked guess. 'layout' is only meaningful for TEXT_ORIGIN_KEYSTROKES
+// and TEXT_ORIGIN_BAMINI. 'score' is in the range 0..1, higher is better.
+typedef struct {
+    TextOrigin     origin;
+    KeyboardLayout layout;
+    float          score;
+} TextOriginGuess;
+
+// Score 'text' against every legacy encoding and keyboard layout and write
+// the guesses, best first, into 'guesses'. Returns the number of guesses
+// written (at most max_guesses). Guesses with a zero score are dropped.
+int text_origin_classify(const wchar_t* text,
+                         int length,
+                         TextOriginGuess* guesses,
+                         int max_guesses);
+
+// Convenience wrapper returning only the best guess. Returns false if
+// nothing scored above zero (e.g. empty or whitespace-only text).
+bool text_origin_best_guess(const wchar_t* text, int length, TextOriginGuess* guess);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // TEXT_ORIGIN_DETECTOR_H
@@ -0,0 +1,28 @@
+#ifndef KEYTRANSLATOR_DELETE_CODE_H
+#define KEYTRANSLATOR_DELETE_CODE_H
+
+// A delete written in front of translated text, for the translate_key calls
+// that return one string: DELCODE followed by the count as a digit, which
+// is what hosts parse. One digit only counts to nine, so a longer delete,
+// such as an English word passed through in place of its Tamil rendering,
+// is written as several DELCODE and digit pairs, which hosts add up.
+
+#include <wchar.h>
+#include "KeyTranslatorMultilingual.h"
+
+// Units the delete takes in front of the text
+static inline int delete_code_length(int delete_count)
+{
+    return delete_count > 0 ? 2 * ((delete_count + 8) / 9) : 0;
+}
+
+// Write the delete to 'out', which has room for delete_code_length() units
+static inline void delete_code_write(wchar_t* out, int delete_count)
+{
+    for (; delete_count > 0; delete_count -= 9) {
+        *out++ = DELCODE;
+        *out++ = (wchar_t)('0' + (delete_count < 9 ? delete_count : 9));
+    }
+}
+
+#endif // KEYTRANSLATOR_DELETE_CODE_H
@@ -0,0 +1,311 @@
+#include "KeyTranslatorMultilingual.h"
+#include "IndicNotesIMEngine.h"
+#include "tamil/KeyTranslatorTamil.h"
+#include "DeleteCode.h"
+#include <stdlib.h>
+#include <string.h>
+#include <wchar.h>
+
+// A handle owns a Tamil context and an Indic engine session and routes keys
+// to one of them through the LanguageOps picked when the language is set,
+// so translating a key never looks at the language. Switching language only
+// swaps the ops and starts a new composition.
+
+typedef struct LanguageOps {
+    // Writes the text to insert and returns its length; *delete_count gets
+    // the characters to delete before it
+    int  (*translate_key)(MultilingualTranslatorRef translator, int32_t key_code, bool shifted,
+                          wchar_t* output_buffer, int buffer_size, int* delete_count);
+    void (*activate)(MultilingualTranslatorRef translator);
+    void (*terminate_composition)(MultilingualTranslatorRef translator);
+} LanguageOps;
+
+struct MultilingualTranslatorHandle {
+    const LanguageOps* ops;
+    SupportedLanguage language;
+    KeyboardLayout layout;              // Tamil layout, kept while another language is in use
+    int32_t prev_key_code;
+    bool prev_key_was_backspace;
+    TamilTranslatorHandle* tamil;
+    getKeyStringResults indic;
+};
+
+#define LANGUAGE_COUNT  (LANG_SINHALA + 1)
+#define LAYOUT_COUNT    (KBD_TN_TYPEWRITER + 1)
+
+static const char* const language_names[LANGUAGE_COUNT] = {
+    [LANG_TAMIL]      = "Tamil",
+    [LANG_DEVANAGARI] = "Devanagari",
+    [LANG_MALAYALAM]  = "Malayalam",
+    [LANG_KANNADA]    = "Kannada",
+    [LANG_TELUGU]     = "Telugu",
+    [LANG_GURMUKHI]   = "Gurmukhi",
+    [LANG_DIACRITICS] = "Diacritics",
+    [LANG_BENGALI]    = "Bengali",
+    [LANG_GUJARATI]   = "Gujarati",
+    [LANG_ORIYA]      = "Oriya",
+    [LANG_SINHALA]    = "Sinhala",
+};
+
+static const char* const layout_names[LAYOUT_COUNT] = {
+    [KBD_ANJAL]          = "Anjal",
+    [KBD_TAMIL99]        = "Tamil 99",
+    [KBD_TAMIL97]        = "Tamil 97",
+    [KBD_MYLAI]          = "Mylai",
+    [KBD_TYPEWRITER_NEW] = "Typewriter (New)",
+    [KBD_TYPEWRITER_OLD] = "Typewriter (Old)",
+    [KBD_ANJAL_INDIC]    = "Anjal Indic",
+    [KBD_MURASU6]        = "Murasu 6",
+    [KBD_BAMINI]         = "Bamini",
+    [KBD_TN_TYPEWRITER]  = "TN Typewriter",
+};
+
+// Indic engine for each language, 0 for Tamil which has its own translator
+static const int ime_types[LANGUAGE_COUNT] = {
+    [LANG_DEVANAGARI] = kImeTypeDevanagari,
+    [LANG_MALAYALAM]  = kImeTypeMalayalam,
+    [LANG_KANNADA]    = kImeTypeKannada,
+    [LANG_TELUGU]     = kImeTypeTelugu,
+    [LANG_GURMUKHI]   = kImeTypeGurmukhi,
+    [LANG_DIACRITICS] = kImeTypeDiacritic,
+    [LANG_BENGALI]    = kImeTypeBengali,
+    [LANG_GUJARATI]   = kImeTypeGujarati,
+    [LANG_ORIYA]      = kImeTypeOriya,
+    [LANG_SINHALA]    = kImeTypeSinhala,
+};
+
+static bool valid_language(SupportedLanguage language) {
+    return (unsigned)language < LANGUAGE_COUNT;
+}
+
+// --- Tamil
+
+static int tamil_translate_key(MultilingualTranslatorRef translator, int32_t key_code, bool shifted,
+                               wchar_t* output_buffer, int buffer_size, int* delete_count) {
+    return tamil_translator_translate_key_ex(translator->tamil, key_code, translator->prev_key_code, shifted,
+                                             translator->prev_key_was_backspace, output_buffer, buffer_size,
+                                             delete_count);
+}
+
+static void tamil_activate(MultilingualTranslatorRef translator) {
+    tamil_translator_activate(translator->tamil);
+}
+
+static void tamil_terminate_composition(MultilingualTranslatorRef translator) {
+    tamil_translator_terminate_composition(translator->tamil);
+}
+
+static const LanguageOps tamil_ops = {
+    tamil_translate_key,
+    tamil_activate,
+    tamil_terminate_composition,
+};
+
+// --- Indic
+
+static int indic_translate_key(MultilingualTranslatorRef translator, int32_t key_code, bool shifted,
+                               wchar_t* output_buffer, int buffer_size, int* delete_count) {
+    (void)shifted;  // the Indic keymaps tell case from the key code
+    UniChar text[MULTILINGUAL_MIN_OUTPUT];
+    getKeyStringUnicode((UniChar)key_code, text, &translator->indic);
+
+    // can't happen with a buffer of MULTILINGUAL_MIN_OUTPUT, but never truncate
+    int len = translator->indic.insertCount;
+    if (len >= buffer_size)
+        return -1;
+    for (int i = 0; i < len; i++)
+        output_buffer[i] = (wchar_t)text[i];
+    output_buffer[len] = 0;
+    *delete_count = translator->indic.deleteCount;
+    return len;
+}
+
+static void indic_terminate_composition(MultilingualTranslatorRef translator) {
+    int ime_type = translator->indic.imeType;
+    clearResults(&translator->indic);
+    translator->indic.imeType = ime_type;
+}
+
+static void indic_activate(MultilingualTranslatorRef translator) {
+    clearResults(&translator->indic);
+    translator->indic.imeType = ime_types[translator->language];
+}
+
+static const LanguageOps indic_ops = {
+    indic_translate_key,
+    indic_activate,
+    indic_terminate_composition,
+};
+
+// --- Translator
+
+MultilingualTranslatorRef multilingual_translator_create(SupportedLanguage language,
+                                                        KeyboardLayout layout) {
+    if (!valid_language(language) || !multilingual_is_layout_supported_for_language(language, layout)) {
+        return NULL;
+    }
+
+    MultilingualTranslatorRef translator = calloc(1, sizeof(struct MultilingualTranslatorHandle));
+    if (!translator) return NULL;
+
+    // the Tamil layout is remembered while typing other languages
+    translator->layout = language == LANG_TAMIL ? layout : KBD_ANJAL;
+    translator->tamil = tamil_translator_create(translator->layout);
+    if (!translator->tamil) {
+        free(translator);
+        return NULL;
+    }
+
+    multilingual_translator_set_language(translator, language);
+    return translator;
+}
+
+void multilingual_translator_destroy(MultilingualTranslatorRef translator) {
+    if (translator) {
+        tamil_translator_destroy(translator->tamil);
+        free(translator);
+    }
+}
+
+int multilingual_translator_translate_key_ex(MultilingualTranslatorRef translator,
+                                            int32_t key_code,
+                                            bool shifted,
+                                            wchar_t* output_buffer,
+                                            int buffer_size,
+                                            MultilingualKeyResult* result) {
+    result->insertCount = 0;
+    result->deleteCount = 0;
+    if (!translator || !output_buffer || buffer_size < 1) {
+        return 0;
+    }
+    output_buffer[0] = 0;
+    // refused before the engines see the key, so it isn't lost
+    if (buffer_size < MULTILINGUAL_MIN_OUTPUT) {
+        return -1;
+    }
+
+    // Backspace is applied by the caller; the engines only need to know
+    // that the next key follows one
+    if (key_code == BACKSPACEKEY) {
+        translator->prev_key_was_backspace = true;
+        translator->prev_key_code = key_code;
+        translator->indic.prevKey = BACKSPACEKEY;
+        return 0;
+    }
+
+    int delete_count = 0;
+    int len = translator->ops->translate_key(translator, key_code, shifted, output_buffer, buffer_size,
+                                             &delete_count);
+    if (len < 0) {
+        return -1;
+    }
+    translator->prev_key_code = key_code;
+    translator->prev_key_was_backspace = false;
+
+    result->insertCount = len;
+    result->deleteCount = delete_count;
+    return len;
+}
+
+int multilingual_translator_translate_key(MultilingualTranslatorRef translator,
+                                         int32_t key_code,
+                                         bool shifted,
+                                         wchar_t* output_buffer,
+                                         int buffer_size) {
+    MultilingualKeyResult result;
+    int len = multilingual_translator_translate_key_ex(translator, key_code, shifted, output_buffer,
+                                                       buffer_size, &result);
+    if (len < 0) {
+        return -1;
+    }
+
+    // Put the delete instruction in front of the text
+    int prefix = delete_code_length(result.deleteCount);
+    if (prefix > 0) {
+        if (len + prefix >= buffer_size) {
+            return -1;
+        }
+        memmove(output_buffer + prefix, output_buffer, (len + 1) * sizeof(wchar_t));
+        delete_code_write(output_buffer, result.deleteCount);
+    }
+    return len + prefix;
+}
+
+bool multilingual_translator_set_language(MultilingualTranslatorRef translator,
+                                         SupportedLanguage language) {
+    if (!translator || !valid_language(language)) {
+        return false;
+    }
+
+    translator->language = language;
+    translator->ops = language == LANG_TAMIL ? &tamil_ops : &indic_ops;
+    translator->prev_key_code = 0;
+    translator->prev_key_was_backspace = false;
+    translator->ops->activate(translator);
+    return true;
+}
+
+bool multilingual_translator_set_layout(MultilingualTranslatorRef translator,
+                                       KeyboardLayout layout) {
+    if (!translator || !multilingual_is_layout_supported_for_language(translator->language, layout)) {
+        return false;
+    }
+
+    if (translator->language == LANG_TAMIL && layout != translator->layout) {
+        translator->layout = layout;
+        tamil_translator_set_layout(translator->tamil, layout);
+    }
+    return true;
+}
+
+SupportedLanguage multilingual_translator_get_language(MultilingualTranslatorRef translator) {
+    return translator ? translator->language : LANG_TAMIL;
+}
+
+int multilingual_translator_get_supported_layouts(MultilingualTranslatorRef translator,
+                                                 KeyboardLayout* layouts_buffer,
+                                                 int buffer_size) {
+    if (!translator || !layouts_buffer) {
+        return 0;
+    }
+
+    int count = 0;
+    for (int layout = 0; layout < LAYOUT_COUNT && count < buffer_size; layout++) {
+        if (multilingual_is_layout_supported_for_language(translator->language, (KeyboardLayout)layout))
+            layouts_buffer[count++] = (KeyboardLayout)layout;
+    }
+    return count;
+}
+
+void multilingual_translator_set_english_lexicon(MultilingualTranslatorRef translator,
+                                                 const EnglishLexicon* lexicon,
+                                                 int min_confidence) {
+    if (translator) {
+        tamil_translator_set_english_lexicon(translator->tamil, lexicon, min_confidence);
+    }
+}
+
+void multilingual_translator_terminate_composition(MultilingualTranslatorRef translator) {
+    if (translator) {
+        translator->prev_key_code = 0;
+        translator->prev_key_was_backspace = false;
+        translator->ops->terminate_composition(translator);
+    }
+}
+
+const char* multilingual_get_language_name(SupportedLanguage language) {
+    return valid_language(language) ? language_names[language] : "Unknown";
+}
+
+const char* multilingual_get_layout_name(KeyboardLayout layout) {
+    return (unsigned)layout < LAYOUT_COUNT ? layout_names[layout] : "Unknown";
+}
+
+bool multilingual_is_layout_supported_for_language(SupportedLanguage language,
+                                                   KeyboardLayout layout) {
+    if (!valid_language(language) || (unsigned)layout >= LAYOUT_COUNT) {
+        return false;
+    }
+    // the other languages only have the Anjal phonetic layout
+    return language == LANG_TAMIL || layout == KBD_ANJAL;
+}
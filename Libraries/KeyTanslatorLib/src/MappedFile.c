@@ -0,0 +1,70 @@
+#include "MappedFile.h"
+#include <string.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+bool mapped_file_open(MappedFile* file, const char* path)
+{
+    if (!file) return false;
+    memset(file, 0, sizeof(*file));
+    if (!path) return false;
+
+#ifdef _WIN32
+    HANDLE fh = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                            OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (fh == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(fh, &size) || size.QuadPart == 0) {
+        CloseHandle(fh);
+        return false;
+    }
+    HANDLE mapping = CreateFileMappingA(fh, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(fh);
+    if (!mapping) return false;
+
+    void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    if (!view) {
+        CloseHandle(mapping);
+        return false;
+    }
+    file->data = (const unsigned char*)view;
+    file->size = (size_t)size.QuadPart;
+    file->platform = mapping;
+#else
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return false;
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || st.st_size <= 0) {
+        close(fd);
+        return false;
+    }
+    void* view = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (view == MAP_FAILED) return false;
+
+    file->data = (const unsigned char*)view;
+    file->size = (size_t)st.st_size;
+#endif
+    return true;
+}
+
+void mapped_file_close(MappedFile* file)
+{
+    if (!file || !file->data) return;
+#ifdef _WIN32
+    UnmapViewOfFile((LPCVOID)file->data);
+    if (file->platform) CloseHandle((HANDLE)file->platform);
+#else
+    munmap((void*)file->data, file->size);
+#endif
+    memset(file, 0, sizeof(*file));
+}
@@ -0,0 +1,126 @@
+// Generated by tools/gen_akshara_classes.py - do not edit.
+// Unicode 14.0.0
+
+#ifndef AKSHARA_CLASSES_H
+#define AKSHARA_CLASSES_H
+
+#include <stdint.h>
+
+enum {
+    AK_OTHER = 0,           // not part of an akshara: punctuation, digits, Latin
+    AK_CONSONANT = 1,       // takes nukta, virama, vowel signs
+    AK_VOWEL = 2,           // independent vowel or other stand-alone letter
+    AK_VOWEL_SIGN = 3,      // dependent vowel sign or length mark
+    AK_VIRAMA = 4,          // virama that joins the next consonant into a conjunct
+    AK_VIRAMA_FINAL = 5,    // visible virama ending the akshara (Tamil pulli)
+    AK_VIRAMA_ZWJ = 6,      // virama joining only through ZWJ (Sinhala al-lakuna)
+    AK_NUKTA = 7,
+    AK_MODIFIER = 8,        // anusvara, candrabindu, visarga
+    AK_EXTEND = 9,          // any other combining mark
+    AK_ZWJ = 10,
+    AK_ZWNJ = 11,
+    AK_CR = 12,
+    AK_LF = 13,
+    AK_REPH = 14,           // Malayalam dot reph, joins the following consonant
+    AK_TAMIL_KA = 15,       // Tamil KA, which joins SSA across the pulli
+    AK_TAMIL_SSA = 16,
+    AK_CLASS_COUNT = 17
+};
+
+#define AKSHARA_TABLE_FIRST 0x0900
+#define AKSHARA_TABLE_SIZE  0x0500
+
+static const uint8_t aksharaClasses[AKSHARA_TABLE_SIZE] = {
+    // U+0900
+     8, 8, 8, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+     2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 3, 3, 7, 2, 3, 3,
+     3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 3, 4, 3, 3,
+     2, 9, 9, 9, 9, 3, 3, 3, 1, 1, 1, 1, 1, 1, 1, 1,
+     2, 2, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 2, 2, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1,
+    // U+0980
+     2, 8, 8, 8, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+     2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+     1, 0, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 7, 2, 3, 3,
+     3, 3, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 4, 1, 0,
+     0, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 1, 1, 0, 1,
+     2, 2, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 0, 9, 0,
+    // U+0A00
+     0, 8, 8, 8, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 2,
+     2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+     1, 0, 1, 1, 0, 1, 1, 0, 1, 1, 0, 0, 7, 0, 3, 3,
+     3, 3, 3, 0, 0, 0, 0, 3, 3, 0, 0, 3, 3, 4, 0, 0,
+     0, 9, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 1, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     8, 8, 2, 2, 2, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // U+0A80
+     0, 8, 8, 8, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2,
+     2, 2, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+     1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 7, 2, 3, 3,
+     3, 3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 4, 0, 0,
+     2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     2, 2, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 9, 9, 9, 7, 7, 7,
+    // U+0B00
+     0, 8, 8, 8, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 2,
+     2, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+     1, 0, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 7, 2, 3, 3,
+     3, 3, 3, 3, 3, 0, 0, 3, 3, 0, 0, 3, 3, 4, 0, 0,
+     0, 0, 0, 0, 0, 9, 3, 3, 0, 0, 0, 0, 1, 1, 0, 1,
+     2, 2, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // U+0B80
+     0, 0, 8, 2, 0, 2, 2, 2, 2, 2, 2, 0, 0, 0, 2, 2,
+     2, 0, 2, 2, 2,15, 0, 0, 0, 1, 1, 0, 1, 0, 1, 1,
+     0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1,
+     1, 1, 1, 1, 1, 1, 1,16, 1, 1, 0, 0, 0, 0, 3, 3,
+     3, 3, 3, 0, 0, 0, 3, 3, 3, 0, 3, 3, 3, 5, 0, 0,
+     2, 0, 0, 0, 0, 0, 0, 3, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // U+0C00
+     8, 8, 8, 8, 8, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+     2, 0, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 7, 2, 3, 3,
+     3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 4, 0, 0,
+     0, 0, 0, 0, 0, 3, 3, 0, 1, 1, 1, 0, 0, 2, 0, 0,
+     2, 2, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // U+0C80
+     2, 8, 8, 8, 0, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+     2, 0, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 0, 1, 1, 1, 1, 1, 0, 0, 7, 2, 3, 3,
+     3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 4, 0, 0,
+     0, 0, 0, 0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 2, 1, 0,
+     2, 2, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+    // U+0D00
+     8, 8, 8, 8, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 2, 2,
+     2, 0, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 5, 5, 2, 3, 3,
+     3, 3, 3, 3, 3, 0, 3, 3, 3, 0, 3, 3, 3, 4,14, 0,
+     0, 0, 0, 0, 2, 2, 2, 3, 0, 0, 0, 0, 0, 0, 0, 1,
+     2, 2, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 2, 2, 2, 2,
+    // U+0D80
+     0, 8, 8, 8, 0, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2,
+     2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 1, 1, 1, 1, 1, 1,
+     1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1,
+     1, 1, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 1, 0, 0,
+     1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 6, 0, 0, 0, 0, 3,
+     3, 3, 3, 3, 3, 0, 3, 0, 3, 3, 3, 3, 3, 3, 3, 3,
+     0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+     0, 0, 3, 3, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+};
+
+#endif // AKSHARA_CLASSES_H
@@ -0,0 +1,231 @@
+// Akshara segmentation
+//
+// Each character is mapped to one of the classes in AksharaClasses.h and a
+// small DFA over those classes decides whether it continues the current
+// akshara. The class table covers the Indic blocks; the few characters
+// outside them that matter (ZWJ, ZWNJ, CR, LF, the combining mark blocks) are
+// classified by range.
+
+
+#include "AksharaSegmenter.h"
+#include "AksharaClasses.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+
+// How far akshara_previous_length() looks back for a position that must
+// start an akshara. Real aksharas are well under this; a longer run of marks
+// is split somewhere inside but never past the cursor.
+#define AKSHARA_MAX_LOOKBACK    64
+
+// DFA states. 0 is "no transition": the character starts a new akshara.
+// Combining marks and ZWJ attach in every state but CR.
+enum {
+    S_BREAK = 0,
+    S_OTHER,            // a character outside any akshara, takes only combining marks
+    S_CONSO,            // consonant, possibly with nukta
+    S_HALANT,           // consonant + virama, expecting a conjunct
+    S_HALANT_ZWJ,       // consonant + virama + ZWJ, half form
+    S_MATRA,            // after a vowel sign
+    S_VOWEL,            // independent vowel
+    S_BINDU,            // after anusvara / candrabindu / visarga
+    S_END,              // the akshara is complete, only combining marks follow
+    S_CR,
+    S_SINHALA_HALANT,   // consonant + al-lakuna, joins only through ZWJ
+    S_KA,               // Tamil KA, which can take SSA after the pulli
+    S_KA_PULLI,         // Tamil KA + pulli
+    S_REPH,             // Malayalam dot reph, joins the next consonant
+    STATE_COUNT
+};
+
+// Consonant classes as seen from a state that joins the next consonant
+#define JOINS_CONSONANT \
+    [AK_CONSONANT] = S_CONSO, [AK_TAMIL_SSA] = S_CONSO, [AK_TAMIL_KA] = S_KA
+
+#define TAKES_MARKS \
+    [AK_NUKTA] = S_CONSO, [AK_VIRAMA] = S_HALANT, [AK_VIRAMA_ZWJ] = S_SINHALA_HALANT, \
+    [AK_VOWEL_SIGN] = S_MATRA, [AK_MODIFIER] = S_BINDU, [AK_EXTEND] = S_CONSO, \
+    [AK_ZWJ] = S_CONSO, [AK_ZWNJ] = S_CONSO
+
+static const uint8_t transitions[STATE_COUNT][AK_CLASS_COUNT] = {
+    [S_OTHER]          = { [AK_ZWJ] = S_OTHER, [AK_EXTEND] = S_OTHER },
+    [S_CONSO]          = { TAKES_MARKS, [AK_VIRAMA_FINAL] = S_END },
+    [S_KA]             = { TAKES_MARKS, [AK_VIRAMA_FINAL] = S_KA_PULLI },
+    [S_HALANT]         = { JOINS_CONSONANT, [AK_ZWJ] = S_HALANT_ZWJ, [AK_ZWNJ] = S_END,
+                           [AK_MODIFIER] = S_BINDU, [AK_EXTEND] = S_HALANT },
+    [S_HALANT_ZWJ]     = { JOINS_CONSONANT, [AK_ZWJ] = S_HALANT_ZWJ, [AK_EXTEND] = S_HALANT_ZWJ },
+    [S_SINHALA_HALANT] = { [AK_ZWJ] = S_HALANT_ZWJ, [AK_ZWNJ] = S_END, [AK_EXTEND] = S_SINHALA_HALANT },
+    [S_KA_PULLI]       = { [AK_TAMIL_SSA] = S_CONSO, [AK_ZWJ] = S_END, [AK_ZWNJ] = S_END,
+                           [AK_EXTEND] = S_KA_PULLI },
+    [S_MATRA]          = { [AK_VOWEL_SIGN] = S_MATRA, [AK_MODIFIER] = S_BINDU, [AK_NUKTA] = S_MATRA,
+                           [AK_ZWJ] = S_MATRA, [AK_EXTEND] = S_MATRA },
+    [S_VOWEL]          = { [AK_VOWEL_SIGN] = S_MATRA, [AK_MODIFIER] = S_BINDU, [AK_NUKTA] = S_VOWEL,
+                           [AK_ZWJ] = S_VOWEL, [AK_EXTEND] = S_VOWEL },
+    [S_BINDU]          = { [AK_MODIFIER] = S_BINDU, [AK_ZWJ] = S_BINDU, [AK_EXTEND] = S_BINDU },
+    [S_END]            = { [AK_ZWJ] = S_END, [AK_EXTEND] = S_END },
+    [S_CR]             = { [AK_LF] = S_END },
+    [S_REPH]           = { JOINS_CONSONANT, [AK_ZWJ] = S_REPH, [AK_EXTEND] = S_REPH },
+};
+
+// State after the first character of an akshara
+static const uint8_t startStates[AK_CLASS_COUNT] = {
+    [AK_OTHER]        = S_OTHER,
+    [AK_CONSONANT]    = S_CONSO,
+    [AK_VOWEL]        = S_VOWEL,
+    [AK_VOWEL_SIGN]   = S_MATRA,        // a stray sign still takes anusvara after it
+    [AK_VIRAMA]       = S_END,
+    [AK_VIRAMA_FINAL] = S_END,
+    [AK_VIRAMA_ZWJ]   = S_END,
+    [AK_NUKTA]        = S_OTHER,
+    [AK_MODIFIER]     = S_BINDU,
+    [AK_EXTEND]       = S_OTHER,
+    [AK_ZWJ]          = S_OTHER,
+    [AK_ZWNJ]         = S_OTHER,
+    [AK_CR]           = S_CR,
+    [AK_LF]           = S_END,
+    [AK_REPH]         = S_REPH,
+    [AK_TAMIL_KA]     = S_KA,
+    [AK_TAMIL_SSA]    = S_CONSO,
+};
+
+static inline int classOf(wchar_t c)
+{
+    uint32_t u = (uint32_t)c;
+
+    if (u - AKSHARA_TABLE_FIRST < AKSHARA_TABLE_SIZE)
+        return aksharaClasses[u - AKSHARA_TABLE_FIRST];
+    if (u < 0x0300)
+        return u == '\r' ? AK_CR : u == '\n' ? AK_LF : AK_OTHER;
+    if (u == 0x200D)
+        return AK_ZWJ;
+    if (u == 0x200C)
+        return AK_ZWNJ;
+    if ((u >= 0x0300 && u <= 0x036F) ||        // combining diacritical marks
+        (u >= 0x1AB0 && u <= 0x1AFF) ||
+        (u >= 0x1CD0 && u <= 0x1CFF) ||        // Vedic extensions
+        (u >= 0x1DC0 && u <= 0x1DFF) ||
+        (u >= 0x20D0 && u <= 0x20FF) ||
+        (u >= 0xA8E0 && u <= 0xA8F1) ||        // Devanagari extended cantillation
+        (u >= 0xFE20 && u <= 0xFE2F))
+        return AK_EXTEND;
+    return AK_OTHER;
+}
+
+// End of the akshara that starts at text[start]
+static size_t aksharaEnd(const wchar_t* text, size_t length, size_t start)
+{
+    unsigned state = startStates[classOf(text[start])];
+    size_t i = start + 1;
+
+    while (i < length) {
+        unsigned next = transitions[state][classOf(text[i])];
+        if (next == S_BREAK)
+            break;
+        state = next;
+        i++;
+    }
+    return i;
+}
+
+// Number of printable ASCII characters at text[i] that are each a whole
+// akshara: 8 if the next 8 are and nothing after them attaches to the last
+// one, otherwise 0. Written without branches so the compiler vectorises it.
+static inline size_t asciiRun(const wchar_t* text, size_t length, size_t i)
+{
+    if (length - i < 8)
+        return 0;
+
+    uint32_t outside = 0;
+    for (int k = 0; k < 8; k++)
+        outside |= ((uint32_t)text[i + k] - 0x20) >= 0x5F;
+    if (outside)
+        return 0;
+    if (i + 8 < length && transitions[S_OTHER][classOf(text[i + 8])] != S_BREAK)
+        return 0;
+    return 8;
+}
+
+size_t akshara_next_length(const wchar_t* text, size_t length)
+{
+    if (length == 0)
+        return 0;
+    return aksharaEnd(text, length, 0);
+}
+
+// True if no state continues the akshara with text[i], so it starts one
+static bool startsAkshara(const wchar_t* text, size_t i)
+{
+    int cls = classOf(text[i]);
+
+    switch (cls) {
+        case AK_OTHER:
+        case AK_VOWEL:
+        case AK_CR:
+        case AK_REPH:
+            return true;
+        case AK_LF:
+            return i == 0 || classOf(text[i - 1]) != AK_CR;
+        case AK_CONSONANT:
+        case AK_TAMIL_KA:
+        case AK_TAMIL_SSA:
+            if (i == 0)
+                return true;
+            switch (classOf(text[i - 1])) {
+                case AK_VIRAMA:
+                case AK_VIRAMA_FINAL:
+                case AK_ZWJ:
+                case AK_REPH:
+                case AK_EXTEND:     // the marks may sit between virama and consonant
+                    return false;
+                default:
+                    return true;
+            }
+        default:
+            return false;
+    }
+}
+
+size_t akshara_previous_length(const wchar_t* text, size_t length)
+{
+    if (length == 0)
+        return 0;
+
+    // Back up to a character that has to start an akshara, then walk
+    // forward to find where the last one before the cursor begins.
+    size_t floor = length > AKSHARA_MAX_LOOKBACK ? length - AKSHARA_MAX_LOOKBACK : 0;
+    size_t start = length - 1;
+    while (start > floor && !startsAkshara(text, start))
+        start--;
+
+    size_t last = start;
+    for (size_t i = start; i < length; i = aksharaEnd(text, length, i))
+        last = i;
+    return length - last;
+}
+
+size_t akshara_boundaries(const wchar_t* text, size_t length, size_t* starts, size_t capacity)
+{
+    size_t count = 0;
+    size_t i = 0;
+
+    while (i < length) {
+        size_t run = asciiRun(text, length, i);
+        if (run) {
+            for (size_t k = 0; k < run; k++, count++)
+                if (count < capacity)
+                    starts[count] = i + k;
+            i += run;
+            continue;
+        }
+        if (count < capacity)
+            starts[count] = i;
+        count++;
+        i = aksharaEnd(text, length, i);
+    }
+    return count;
+}
+
+size_t akshara_count(const wchar_t* text, size_t length)
+{
+    return akshara_boundaries(text, length, NULL, 0);
+}
@@ -0,0 +1,82 @@
+// Anjal phonetic keymap for Bengali (Bangla, Assamese)
+//
+// Follows the Devanagari keymap key for key; sounds Bengali does not encode
+// (short e/o, candra e/o, the nukta-only letters) are left out, 'v' gives
+// ba as in the script, 'Y' gives antastha ya and "tx" khanda ta.
+
+
+#include "IndicPhoneticEngine.h"
+
+
+// Lookup tables
+
+// The *Keys tables are input to tools/gen_keypos_hash.py, not compiled: the
+// engine looks them up through IndicKeyPosHash.c, so rerun the generator
+// after changing them. The engine itself is in IndicPhoneticEngine.c, this
+// file only describes the script.
+
+// Vowel keystrokes
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar BengUV1Keys[] = { 'a','i','u','e','a','o','a',  'R','L','A','I','U',  'M','H','q','Q','O','E', 0 };  // first keystroke
+static UniChar BengUV2Keys[] = { 'a','i','u','*','i','*','u',  'r','l','*','*','*',  '*','*','q','*','*','*', 0 };  // second keystroke
+static UniChar BengUV3Keys[] = { '*','*','*','*','*','*','*',  '*','*','*','*','*',  '*','*','q','*','*','*', 0 };  // third keystroke
+#endif
+
+// vowel chars
+static UniChar BengUV1Char[] = { 0x0985,0x0987,0x0989,0x098F,0x0985,0x0993,0x0985, 0x098B,0x098C,0x0986,0x0988,0x098A, 0x0982,0x0983,0x09CD,0x0981,0x0993,0x098F };  // first keystroke
+static UniChar BengUV2Char[] = { 0x0986,0x0988,0x098A,0x0980,0x0990,0x0980,0x0994, 0x09E0,0x09E1,0x0980,0x0980,0x0980, 0x0980,0x0980,0x09BC,0x0980,0x0980,0x0980 };  // second keystroke
+static UniChar BengUV3Char[] = { 0x0980,0x0980,0x0980,0x0980,0x0980,0x0980,0x0980, 0x0980,0x0980,0x0980,0x0980,0x0980, 0x0980,0x0980,0x0981,0x0980,0x0980,0x0980 };  // third keystroke
+
+// vowel sign chars
+static UniChar BengUVS1Char[]= { 0x0008,0x09BF,0x09C1,0x09C7,0x0008,0x09CB,0x0008, 0x09C3,0x09E2,0x09BE,0x09C0,0x09C2, 0x0982,0x0983,0x09CD,0x0981,0x09CB,0x09C7 };  // first keystroke
+static UniChar BengUVS2Char[]= { 0x09BE,0x09C0,0x09C2,0x0980,0x09C8,0x0980,0x09CC, 0x09C4,0x09E3,0x0980,0x0980,0x0980, 0x0980,0x0980,0x09BC,0x0980,0x0980,0x0980 };  // second keystroke
+static UniChar BengUVS3Char[]= { 0x0980,0x0980,0x0980,0x0980,0x0980,0x0980,0x0980, 0x0980,0x0980,0x0980,0x0980,0x0980, 0x0980,0x0980,0x0981,0x0980,0x0980,0x0980 };  // third keystroke
+
+// conso keystrokes
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar BengUC1Keys[] = { 'k','g','n','c','j','T','D','n','N',  't','d','n','p','b','m','y','r',  'l','z','v','s','S','h',  'Y','t', 0 };
+static UniChar BengUC2Keys[] = { 'h','h','g','h','h','h','h','y','*',  'h','h','*','h','h','*','*','*',  '*','*','*','h','*','*',  '*','x', 0 };
+static UniChar BengUC3Keys[] = { '*','*','*','*','*','*','*','*','*',  '*','*','*','*','*','*','*','*',  '*','*','*','*','*','*',  '*','*', 0 };
+#endif
+
+// conso chars
+static UniChar BengUC1Char[] = { 0x0995,0x0997,0x09A8,0x099A,0x099C,0x099F,0x09A1,0x09A8,0x09A3,  0x09A4,0x09A6,0x09A8,0x09AA,0x09AC,0x09AE,0x09AF,0x09B0,  0x09B2,0x09B6,0x09AC,0x09B8,0x09B7,0x09B9,  0x09DF,0x09A4, 0};
+static UniChar BengUC2Char[] = { 0x0996,0x0998,0x0999,0x099B,0x099D,0x09A0,0x09A2,0x099E,0x0980,  0x09A5,0x09A7,0x0980,0x09AB,0x09AD,0x0980,0x0980,0x0980,  0x0980,0x0980,0x0980,0x09B6,0x0980,0x0980,  0x0980,0x09CE, 0};
+static UniChar BengUC3Char[] = { 0x0980,0x0980,0x0980,0x0980,0x0980,0x0980,0x0980,0x0980,0x0980,  0x0980,0x0980,0x0980,0x0980,0x0980,0x0980,0x0980,0x0980,  0x0980,0x0980,0x0980,0x0980,0x0980,0x0980,  0x0980,0x0980, 0};
+
+// numeric keystrokes
+static UniChar BengUNChar[] = {0x09E6,0x09E7,0x09E8,0x09E9,0x09EA,0x09EB,0x09EC,0x09ED,0x09EE,0x09EF};
+
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar BengUNuktaBase[] = {0x09A1,0x09A2,0x09AF}; // base chars whose nukta forms are encoded
+#endif
+static UniChar BengUNuktaForm[] = {0x09DC,0x09DD,0x09DF}; // corresponding nukta forms
+
+const IndicScript indicScriptBengali = {
+    .name = "Bengali",
+    .imeType = kImeTypeBengali,
+    .flags = INDIC_TRACKS_BASE_CHAR | INDIC_RESETS_ON_OTHER_KEYS | INDIC_EARLY_AVAGRAHA,
+    .vowelKeys = { &BengUV1Hash, &BengUV2Hash, &BengUV3Hash },
+    .vowelChar = { BengUV1Char, BengUV2Char, BengUV3Char },
+    .vowelSignChar = { BengUVS1Char, BengUVS2Char, BengUVS3Char },
+    .consoKeys = { &BengUC1Hash, &BengUC2Hash, &BengUC3Hash },
+    .consoChar = { BengUC1Char, BengUC2Char, BengUC3Char },
+    .digits = BengUNChar,
+    .danda = 0x0964,        // the danda is shared with Devanagari
+    .doubleDanda = 0x0965,
+    .avagrahaKey = '#',
+    .avagrahaChar = 0x09BD,
+    .nuktaKey = 'q',        // qq
+    .nuktaBase = &BengUNuktaHash,
+    .nuktaForm = BengUNuktaForm,
+};
+
+void getKeyStringUnicodeBengaliAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results)
+{
+    indicPhoneticGetKeyString(&indicScriptBengali, currKey, s, results);
+}
+
+void startNewSessionBengaliAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results)
+{
+    indicPhoneticStartNewSession(&indicScriptBengali, currKey, s, results);
+}
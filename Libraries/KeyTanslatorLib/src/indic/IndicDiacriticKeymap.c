@@ -0,0 +1,168 @@
+// Anjal phonetic keymap for linguistic transcription (ISO 15919)
+//
+// Types romanised Indic text with the usual Anjal keystrokes: doubled or
+// capital vowels are long ("aa", "A" -> ā), capital consonants are
+// retroflex ("T" -> ṭ), "sh" -> ś, "ng" -> ṅ, "ny" -> ñ, 'z' -> ḻ, and a
+// trailing 'x' gives the nukta / Dravidian forms ("Dx" -> ṛ, "rx" -> ṟ,
+// "nx" -> ṉ, "lx" -> ḷ). Output is NFC: precomposed letters where Unicode
+// has them, base + combining marks (r̥, l̥, m̐, k͟h) where it does not.
+//
+// Latin has no inherent vowel or vowel signs, so each keystroke simply
+// replaces the text the previous keystroke of the same sequence produced.
+
+
+#include "IndicNotesIMEngine.h"
+#include "IndicKeyPosHash.h"
+#include <string.h>
+
+
+#define DIAC_TEXT_MAX   4
+
+// Lookup tables
+
+// The *Keys tables are input to tools/gen_keypos_hash.py, not compiled: the
+// engine looks them up through IndicKeyPosHash.c, so rerun the generator
+// after changing them. A row's earlier texts must match what the earlier
+// keystrokes produced, since that is what gets deleted.
+
+// Vowel keystrokes
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar DiacUV1Keys[] = { 'a','i','u','e','o',  'A','I','U','E','O',  'R','L','M','H', 0 };  // first keystroke
+static UniChar DiacUV2Keys[] = { 'a','i','u','e','o',  '*','*','*','*','*',  'R','L','M','*', 0 };  // second keystroke
+static UniChar DiacUV3Keys[] = { '*','*','*','*','*',  '*','*','*','*','*',  '*','*','*','*', 0 };  // third keystroke
+#endif
+
+// vowel texts
+static const UniChar DiacUV1Text[][DIAC_TEXT_MAX] = {
+    {'a'}, {'i'}, {'u'}, {'e'}, {'o'},
+    {0x0101}, {0x012B}, {0x016B}, {0x0113}, {0x014D},
+    {'r',0x0325}, {'l',0x0325}, {0x1E41}, {0x1E25},
+};
+static const UniChar DiacUV2Text[][DIAC_TEXT_MAX] = {
+    {0x0101}, {0x012B}, {0x016B}, {0x0113}, {0x014D},
+    {0}, {0}, {0}, {0}, {0},
+    {'r',0x0325,0x0304}, {'l',0x0325,0x0304}, {'m',0x0310}, {0},
+};
+static const UniChar DiacUV3Text[][DIAC_TEXT_MAX] = {
+    {0}, {0}, {0}, {0}, {0},
+    {0}, {0}, {0}, {0}, {0},
+    {0}, {0}, {0}, {0},
+};
+
+// conso keystrokes
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar DiacUC1Keys[] = { 'T','D','D','N','S','z',  's','n','n','n','r','l',  'k','g','y', 0 };
+static UniChar DiacUC2Keys[] = { '*','h','x','*','*','*',  'h','g','y','x','x','x',  'h','x','x', 0 };
+static UniChar DiacUC3Keys[] = { '*','x','*','*','*','*',  '*','*','*','*','*','*',  'x','*','*', 0 };
+#endif
+
+// conso texts
+static const UniChar DiacUC1Text[][DIAC_TEXT_MAX] = {
+    {0x1E6D}, {0x1E0D}, {0x1E0D}, {0x1E47}, {0x1E63}, {0x1E3B},
+    {'s'}, {'n'}, {'n'}, {'n'}, {'r'}, {'l'},
+    {'k'}, {'g'}, {'y'},
+};
+static const UniChar DiacUC2Text[][DIAC_TEXT_MAX] = {
+    {0}, {0x1E0D,'h'}, {0x1E5B}, {0}, {0}, {0},
+    {0x015B}, {0x1E45}, {0x00F1}, {0x1E49}, {0x1E5F}, {0x1E37},
+    {'k','h'}, {0x1E21}, {0x1E8F},
+};
+static const UniChar DiacUC3Text[][DIAC_TEXT_MAX] = {
+    {0}, {0x1E5B,'h'}, {0}, {0}, {0}, {0},
+    {0}, {0}, {0}, {0}, {0}, {0},
+    {'k',0x035F,'h'}, {0}, {0},
+};
+
+static int textLength(const UniChar* text)
+{
+    int length = 0;
+    while (length < DIAC_TEXT_MAX && text[length]) length++;
+    return length;
+}
+
+// Send text in place of the previous keystroke's text and move to state
+static void sendText(const UniChar* text, const UniChar* replaced, UniChar state, UniChar* s,
+                     getKeyStringResults* results)
+{
+    int length = textLength(text);
+    memcpy(s, text, length * sizeof(UniChar));
+    s[length] = '\0';
+    results->insertCount = length;
+    results->deleteCount = replaced ? textLength(replaced) : 0;
+    results->prevKeyType = state;
+}
+
+void getKeyStringUnicodeDiacritic(UniChar currKey, UniChar *s, getKeyStringResults *results)
+{
+    int vpos;
+
+    // Assume no conversions are going to be done
+    results->deleteCount = 0;
+    results->insertCount = 0;
+    results->fixPrevious = false;
+
+    switch (results->prevKeyType) {
+        case FIRST_VOWEL_KEYTYPE:
+            if ((vpos = keyPosLookup(&DiacUV2Hash, currKey, results->prevKey, 0)) >= 0)
+                sendText(DiacUV2Text[vpos], DiacUV1Text[vpos], SECOND_VOWEL_KEYTYPE, s, results);
+            else
+                startNewSessionDiacritic(currKey, s, results);
+            break;
+
+        case SECOND_VOWEL_KEYTYPE:
+            if ((vpos = keyPosLookup(&DiacUV3Hash, currKey, results->prevKey, results->firstVowelKey)) >= 0)
+                sendText(DiacUV3Text[vpos], DiacUV2Text[vpos], THIRD_VOWEL_KEYTYPE, s, results);
+            else
+                startNewSessionDiacritic(currKey, s, results);
+            break;
+
+        case FIRST_CONSO_KEYTYPE:
+            if ((vpos = keyPosLookup(&DiacUC2Hash, currKey, results->prevKey, 0)) >= 0)
+                sendText(DiacUC2Text[vpos], DiacUC1Text[vpos], SECOND_CONSO_KEYTYPE, s, results);
+            else
+                startNewSessionDiacritic(currKey, s, results);
+            break;
+
+        case SECOND_CONSO_KEYTYPE:
+            if ((vpos = keyPosLookup(&DiacUC3Hash, currKey, results->prevKey, results->firstConsoKey)) >= 0)
+                sendText(DiacUC3Text[vpos], DiacUC2Text[vpos], THIRD_CONSO_KEYTYPE, s, results);
+            else
+                startNewSessionDiacritic(currKey, s, results);
+            break;
+
+        default:
+            startNewSessionDiacritic(currKey, s, results);
+            break;
+    }
+
+    results->prevKey = currKey;
+}
+
+void startNewSessionDiacritic(UniChar currKey, UniChar *s, getKeyStringResults *results)
+{
+    int vpos;
+
+    if ((vpos = keyPosLookup(&DiacUC1Hash, currKey, 0, 0)) >= 0) {
+        sendText(DiacUC1Text[vpos], NULL, FIRST_CONSO_KEYTYPE, s, results);
+        results->prevCharType = CONSO_CHARTYPE;
+        results->firstConsoKey = currKey;
+        results->fixPrevious = true;    // the start of a new composition fixes the previous one
+
+    } else if ((vpos = keyPosLookup(&DiacUV1Hash, currKey, 0, 0)) >= 0) {
+        sendText(DiacUV1Text[vpos], NULL, FIRST_VOWEL_KEYTYPE, s, results);
+        results->prevCharType = VOWEL_CHARTYPE;
+        results->firstVowelKey = currKey;
+        results->fixPrevious = true;
+
+    } else {
+        // everything else is plain Latin text and is sent as typed
+        clearResults(results);
+        s[0] = currKey;
+        s[1] = '\0';
+        results->insertCount = 1;
+        results->prevKeyType = isspace(currKey) ? WHITE_SPACE_KEYTYPE : CHARACTER_END_KEYTYPE;
+        results->prevCharType = NON_INDIC_CHARTYPE;
+        results->fixPrevious = true;
+        results->prevKey = currKey;
+    }
+}
@@ -0,0 +1,74 @@
+// Anjal phonetic keymap for Gujarati
+//
+// Follows the Devanagari keymap key for key; Gujarati has the candra e/o
+// ("ee", "oo") but no short e/o, so the third e/o keystroke is dropped, and
+// it has no precomposed nukta letters.
+
+
+#include "IndicPhoneticEngine.h"
+
+
+// Lookup tables
+
+// The *Keys tables are input to tools/gen_keypos_hash.py, not compiled: the
+// engine looks them up through IndicKeyPosHash.c, so rerun the generator
+// after changing them. The engine itself is in IndicPhoneticEngine.c, this
+// file only describes the script.
+
+// Vowel keystrokes
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar GujrUV1Keys[] = { 'a','i','u','e','a','o','a',  'R','L','A','I','U',  'M','H','q','Q','O','E', 0 };  // first keystroke
+static UniChar GujrUV2Keys[] = { 'a','i','u','e','i','o','u',  'r','l','*','*','*',  '*','*','q','*','M','*', 0 };  // second keystroke
+static UniChar GujrUV3Keys[] = { '*','*','*','*','*','*','*',  '*','*','*','*','*',  '*','*','q','*','*','*', 0 };  // third keystroke
+#endif
+
+// vowel chars
+static UniChar GujrUV1Char[] = { 0x0A85,0x0A87,0x0A89,0x0A8F,0x0A85,0x0A93,0x0A85, 0x0A8B,0x0A8C,0x0A86,0x0A88,0x0A8A, 0x0A82,0x0A83,0x0ACD,0x0A81,0x0A93,0x0A8F };  // first keystroke
+static UniChar GujrUV2Char[] = { 0x0A86,0x0A88,0x0A8A,0x0A8D,0x0A90,0x0A91,0x0A94, 0x0AE0,0x0AE1,0x0A80,0x0A80,0x0A80, 0x0A80,0x0A80,0x0ABC,0x0A80,0x0AD0,0x0A80 };  // second keystroke
+static UniChar GujrUV3Char[] = { 0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80, 0x0A80,0x0A80,0x0A80,0x0A80,0x0A80, 0x0A80,0x0A80,0x0A81,0x0A80,0x0A80,0x0A80 };  // third keystroke
+
+// vowel sign chars
+static UniChar GujrUVS1Char[]= { 0x0008,0x0ABF,0x0AC1,0x0AC7,0x0008,0x0ACB,0x0008, 0x0AC3,0x0AE2,0x0ABE,0x0AC0,0x0AC2, 0x0A82,0x0A83,0x0ACD,0x0A81,0x0ACB,0x0AC7 };  // first keystroke
+static UniChar GujrUVS2Char[]= { 0x0ABE,0x0AC0,0x0AC2,0x0AC5,0x0AC8,0x0AC9,0x0ACC, 0x0AC4,0x0AE3,0x0A80,0x0A80,0x0A80, 0x0A80,0x0A80,0x0ABC,0x0A80,0x0AD0,0x0A80 };  // second keystroke
+static UniChar GujrUVS3Char[]= { 0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80, 0x0A80,0x0A80,0x0A80,0x0A80,0x0A80, 0x0A80,0x0A80,0x0A81,0x0A80,0x0A80,0x0A80 };  // third keystroke
+
+// conso keystrokes
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar GujrUC1Keys[] = { 'k','g','n','c','j','T','D','n','N',  't','d','n','p','b','m','y','r',  'l','z','v','s','S','h',  0 };
+static UniChar GujrUC2Keys[] = { 'h','h','g','h','h','h','h','y','*',  'h','h','*','h','h','*','*','*',  'l','*','*','h','*','*',  0 };
+static UniChar GujrUC3Keys[] = { '*','*','*','*','*','*','*','*','*',  '*','*','*','*','*','*','*','*',  '*','*','*','*','*','*',  0 };
+#endif
+
+// conso chars
+static UniChar GujrUC1Char[] = { 0x0A95,0x0A97,0x0AA8,0x0A9A,0x0A9C,0x0A9F,0x0AA1,0x0AA8,0x0AA3,  0x0AA4,0x0AA6,0x0AA8,0x0AAA,0x0AAC,0x0AAE,0x0AAF,0x0AB0,  0x0AB2,0x0AB6,0x0AB5,0x0AB8,0x0AB7,0x0AB9, 0};
+static UniChar GujrUC2Char[] = { 0x0A96,0x0A98,0x0A99,0x0A9B,0x0A9D,0x0AA0,0x0AA2,0x0A9E,0x0A80,  0x0AA5,0x0AA7,0x0A80,0x0AAB,0x0AAD,0x0A80,0x0A80,0x0A80,  0x0AB3,0x0A80,0x0A80,0x0AB6,0x0A80,0x0A80, 0};
+static UniChar GujrUC3Char[] = { 0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,  0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,  0x0A80,0x0A80,0x0A80,0x0A80,0x0A80,0x0A80, 0};
+
+// numeric keystrokes
+static UniChar GujrUNChar[] = {0x0AE6,0x0AE7,0x0AE8,0x0AE9,0x0AEA,0x0AEB,0x0AEC,0x0AED,0x0AEE,0x0AEF};
+
+const IndicScript indicScriptGujarati = {
+    .name = "Gujarati",
+    .imeType = kImeTypeGujarati,
+    .flags = INDIC_TRACKS_BASE_CHAR | INDIC_RESETS_ON_OTHER_KEYS | INDIC_EARLY_AVAGRAHA,
+    .vowelKeys = { &GujrUV1Hash, &GujrUV2Hash, &GujrUV3Hash },
+    .vowelChar = { GujrUV1Char, GujrUV2Char, GujrUV3Char },
+    .vowelSignChar = { GujrUVS1Char, GujrUVS2Char, GujrUVS3Char },
+    .consoKeys = { &GujrUC1Hash, &GujrUC2Hash, &GujrUC3Hash },
+    .consoChar = { GujrUC1Char, GujrUC2Char, GujrUC3Char },
+    .digits = GujrUNChar,
+    .danda = 0x0964,        // the danda is shared with Devanagari
+    .doubleDanda = 0x0965,
+    .avagrahaKey = '#',
+    .avagrahaChar = 0x0ABD,
+};
+
+void getKeyStringUnicodeGujaratiAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results)
+{
+    indicPhoneticGetKeyString(&indicScriptGujarati, currKey, s, results);
+}
+
+void startNewSessionGujaratiAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results)
+{
+    indicPhoneticStartNewSession(&indicScriptGujarati, currKey, s, results);
+}
@@ -0,0 +1,57 @@
+#ifndef INDIC_KEYPOS_H
+#define INDIC_KEYPOS_H
+
+// O(1) replacement for getKeyPos() on the fixed keymap tables.
+//
+// tools/gen_keypos_hash.py turns each key table (together with its previous-
+// and first-key tables) into a minimal perfect hash over every lookup that
+// can succeed. keyPosLookup() returns exactly what getKeyPos() returns for
+// the same table set, with a single probe instead of a linear scan.
+// Regenerate IndicKeyPosHash.{h,c} after editing any *Keys table.
+
+#include <stdint.h>
+#include "IndicNotesIMEngine.h"
+
+typedef struct {
+    const uint16_t* seeds;      // per-bucket displacement seed
+    const uint32_t* slots;      // composite key stored in each slot
+    const int8_t*   index;      // getKeyPos() result for that key
+    uint32_t        bucketCount;
+    uint32_t        slotCount;
+} KeyPosHash;
+
+#define KEYPOS_BUCKET_SEED 0x2545F491u
+
+static inline uint32_t keyPosMix(uint32_t k, uint32_t seed)
+{
+    k ^= seed;
+    k *= 0x9E3779B1u;
+    k ^= k >> 15;
+    k *= 0x85EBCA77u;
+    k ^= k >> 13;
+    return k;
+}
+
+static inline uint32_t keyPosReduce(uint32_t h, uint32_t n)
+{
+    return (uint32_t)(((uint64_t)h * n) >> 32);
+}
+
+// Same arguments as getKeyPos() minus the tables: pKey == 0 ignores the
+// previous key (and fKey), fKey == 0 ignores the first key.
+static inline int keyPosLookup(const KeyPosHash* hash, UniChar key, UniChar pKey, UniChar fKey)
+{
+    if (key == '*' || key == 0 || (uint32_t)key > 0xFFFF || hash->slotCount == 0)
+        return -1;
+    if (pKey == 0)
+        fKey = 0;
+    if ((uint32_t)pKey >= 128 || (uint32_t)fKey >= 128)
+        return -1;      // the previous/first key tables only hold ASCII keys
+
+    uint32_t k = (uint32_t)key | ((uint32_t)pKey << 16) | ((uint32_t)fKey << 23);
+    uint32_t bucket = keyPosReduce(keyPosMix(k, KEYPOS_BUCKET_SEED), hash->bucketCount);
+    uint32_t slot = keyPosReduce(keyPosMix(k, hash->seeds[bucket]), hash->slotCount);
+    return hash->slots[slot] == k ? hash->index[slot] : -1;
+}
+
+#endif // INDIC_KEYPOS_H
@@ -0,0 +1,1938 @@
+// Generated by tools/gen_keypos_hash.py - do not edit.
+
+#include "IndicKeyPosHash.h"
+
+static const uint16_t DevaUV1Seeds[] = {
+    2, 8, 89, 0, 9, 1, 0, 233
+};
+
+static const uint32_t DevaUV1Slots[] = {
+    0x00000049, 0x00000048, 0x0000004C, 0x00000041, 0x00000071, 0x00000051,
+    0x00000045, 0x0000004F, 0x00000052, 0x00000065, 0x00000061, 0x0000004D,
+    0x0000006F, 0x00000069, 0x00000055, 0x00000075
+};
+
+static const int8_t DevaUV1Index[] = {
+    10, 13, 8, 9, 14, 15, 17, 16, 7, 3, 0, 12,
+    5, 1, 11, 2
+};
+
+const KeyPosHash DevaUV1Hash = { DevaUV1Seeds, DevaUV1Slots, DevaUV1Index, 8, 16 };
+
+static const uint16_t DevaUV2Seeds[] = {
+    2, 6, 1, 1, 13, 3, 15, 0, 6, 24
+};
+
+static const uint32_t DevaUV2Slots[] = {
+    0x00610069, 0x00690069, 0x00000065, 0x00000071, 0x00000072, 0x0000006C,
+    0x00610075, 0x004F004D, 0x00000075, 0x004C006C, 0x0000006F, 0x0000004D,
+    0x006F006F, 0x00000061, 0x00610061, 0x00520072, 0x00000069, 0x00750075,
+    0x00650065, 0x00710071
+};
+
+static const int8_t DevaUV2Index[] = {
+    4, 1, 3, 14, 7, 8, 6, 16, 2, 8, 5, 16,
+    5, 0, 0, 7, 1, 2, 3, 14
+};
+
+const KeyPosHash DevaUV2Hash = { DevaUV2Seeds, DevaUV2Slots, DevaUV2Index, 10, 20 };
+
+static const uint16_t DevaUV3Seeds[] = {
+    2, 2, 21, 19, 0
+};
+
+static const uint32_t DevaUV3Slots[] = {
+    0x00000071, 0x006F006F, 0x00000065, 0x32E50065, 0x00650065, 0x37EF006F,
+    0x38F10071, 0x00710071, 0x0000006F
+};
+
+static const int8_t DevaUV3Index[] = {
+    14, 5, 3, 3, 3, 5, 14, 14, 5
+};
+
+const KeyPosHash DevaUV3Hash = { DevaUV3Seeds, DevaUV3Slots, DevaUV3Index, 5, 9 };
+
+static const uint16_t DevaUC1Seeds[] = {
+    1, 17, 3, 13, 2, 0, 71, 0, 18, 68, 3
+};
+
+static const uint32_t DevaUC1Slots[] = {
+    0x00000054, 0x00000072, 0x0000006A, 0x0000004E, 0x00000073, 0x00000062,
+    0x0000006D, 0x0000006C, 0x00000074, 0x0000007A, 0x00000067, 0x00000063,
+    0x00000044, 0x00000068, 0x00000064, 0x00000076, 0x0000006B, 0x00000079,
+    0x00000070, 0x00000053, 0x0000006E
+};
+
+static const int8_t DevaUC1Index[] = {
+    5, 16, 4, 8, 20, 13, 14, 17, 9, 18, 1, 3,
+    6, 22, 10, 19, 0, 15, 12, 21, 2
+};
+
+const KeyPosHash DevaUC1Hash = { DevaUC1Seeds, DevaUC1Slots, DevaUC1Index, 11, 21 };
+
+static const uint16_t DevaUC2Seeds[] = {
+    22, 2, 2, 12, 0, 19, 5, 1, 0, 7, 12, 5
+};
+
+static const uint32_t DevaUC2Slots[] = {
+    0x00000067, 0x006A0068, 0x00000079, 0x00000068, 0x00540068, 0x00620068,
+    0x00630068, 0x00740068, 0x00440068, 0x006E0067, 0x00720072, 0x006B0068,
+    0x0000006E, 0x006C006C, 0x00640068, 0x0000006C, 0x007A0068, 0x00670068,
+    0x006E0079, 0x00730068, 0x00000072, 0x00700068, 0x006E006E
+};
+
+static const int8_t DevaUC2Index[] = {
+    2, 4, 7, 0, 5, 13, 3, 9, 6, 2, 16, 0,
+    11, 17, 10, 17, 18, 1, 7, 20, 16, 12, 11
+};
+
+const KeyPosHash DevaUC2Hash = { DevaUC2Seeds, DevaUC2Slots, DevaUC2Index, 12, 23 };
+
+static const uint16_t DevaUC3Seeds[] = {
+    2, 2
+};
+
+static const uint32_t DevaUC3Slots[] = {
+    0x006C006C, 0x0000006C, 0x366C006C
+};
+
+static const int8_t DevaUC3Index[] = {
+    17, 17, 17
+};
+
+const KeyPosHash DevaUC3Hash = { DevaUC3Seeds, DevaUC3Slots, DevaUC3Index, 2, 3 };
+
+static const uint16_t DevaUNuktaSeeds[] = {
+    14, 1, 1, 10
+};
+
+static const uint32_t DevaUNuktaSlots[] = {
+    0x00000916, 0x00000915, 0x0000092F, 0x00000922, 0x00000921, 0x0000092B,
+    0x00000917, 0x0000091C
+};
+
+static const int8_t DevaUNuktaIndex[] = {
+    1, 0, 7, 5, 4, 6, 2, 3
+};
+
+const KeyPosHash DevaUNuktaHash = { DevaUNuktaSeeds, DevaUNuktaSlots, DevaUNuktaIndex, 4, 8 };
+
+static const uint16_t MalUV1Seeds[] = {
+    1, 10, 2, 12
+};
+
+static const uint32_t MalUV1Slots[] = {
+    0x00000075, 0x0000004D, 0x00000048, 0x0000006F, 0x00000061, 0x00000065,
+    0x00000069, 0x00000071
+};
+
+static const int8_t MalUV1Index[] = {
+    2, 12, 3, 9, 0, 7, 1, 11
+};
+
+const KeyPosHash MalUV1Hash = { MalUV1Seeds, MalUV1Slots, MalUV1Index, 4, 8 };
+
+static const uint16_t MalUV2Seeds[] = {
+    1, 9, 63, 1, 11, 3, 74, 1, 4, 4, 4, 3,
+    9
+};
+
+static const uint32_t MalUV2Slots[] = {
+    0x0000004C, 0x00000061, 0x00710071, 0x00480052, 0x00480072, 0x004D004D,
+    0x00690069, 0x00000075, 0x00610075, 0x00480048, 0x0000006C, 0x00000048,
+    0x006F006F, 0x00000071, 0x0000006F, 0x00000052, 0x0048004C, 0x00650065,
+    0x0048006C, 0x00610069, 0x00000065, 0x00000069, 0x00000072, 0x0000004D,
+    0x00610061, 0x00750075
+};
+
+static const int8_t MalUV2Index[] = {
+    6, 0, 11, 4, 3, 12, 1, 2, 10, 13, 5, 13,
+    9, 11, 9, 4, 6, 7, 5, 8, 7, 1, 3, 12,
+    0, 2
+};
+
+const KeyPosHash MalUV2Hash = { MalUV2Seeds, MalUV2Slots, MalUV2Index, 13, 26 };
+
+static const uint16_t MalUV3Seeds[] = {
+    0, 1, 34
+};
+
+static const uint32_t MalUV3Slots[] = {
+    0x24480048, 0x004D004D, 0x0000004D, 0x00000048, 0x26CD004D, 0x00480048
+};
+
+static const int8_t MalUV3Index[] = {
+    13, 12, 12, 13, 12, 13
+};
+
+const KeyPosHash MalUV3Hash = { MalUV3Seeds, MalUV3Slots, MalUV3Index, 3, 6 };
+
+static const uint16_t MalUC1Seeds[] = {
+    33, 136, 3, 3, 160, 0, 0, 9, 0, 1, 72, 3
+};
+
+static const uint32_t MalUC1Slots[] = {
+    0x0000004C, 0x00000068, 0x00000072, 0x0000004E, 0x00000062, 0x00000063,
+    0x00000053, 0x00000076, 0x0000006C, 0x00000074, 0x0000007A, 0x00000067,
+    0x0000006D, 0x00000044, 0x00000054, 0x00000064, 0x00000073, 0x0000006B,
+    0x0000006A, 0x00000079, 0x00000070, 0x00000052, 0x0000006E
+};
+
+static const int8_t MalUC1Index[] = {
+    19, 24, 16, 8, 13, 3, 22, 21, 18, 9, 20, 1,
+    14, 7, 6, 10, 23, 0, 4, 15, 12, 17, 2
+};
+
+const KeyPosHash MalUC1Hash = { MalUC1Seeds, MalUC1Slots, MalUC1Index, 12, 23 };
+
+static const uint16_t MalUC2Seeds[] = {
+    7, 1, 0, 16, 63, 3, 26, 3, 0, 0, 7, 2
+};
+
+static const uint32_t MalUC2Slots[] = {
+    0x004C0077, 0x00720077, 0x006B0077, 0x00630068, 0x006E0077, 0x00740068,
+    0x00640068, 0x00000077, 0x00000068, 0x00000067, 0x006C0077, 0x00670068,
+    0x00540068, 0x00520077, 0x004E0077, 0x00730068, 0x006B0068, 0x006A0068,
+    0x00440068, 0x0000006A, 0x00700068, 0x006E0067, 0x00620068, 0x006E006A
+};
+
+static const int8_t MalUC2Index[] = {
+    30, 28, 31, 3, 26, 9, 10, 25, 0, 2, 29, 1,
+    6, 27, 25, 23, 0, 4, 7, 5, 12, 2, 13, 5
+};
+
+const KeyPosHash MalUC2Hash = { MalUC2Seeds, MalUC2Slots, MalUC2Index, 12, 24 };
+
+static const uint16_t MalUC3Seeds[] = {
+    0
+};
+
+static const uint32_t MalUC3Slots[] = {
+    0x00000000
+};
+
+static const int8_t MalUC3Index[] = {
+    0
+};
+
+const KeyPosHash MalUC3Hash = { MalUC3Seeds, MalUC3Slots, MalUC3Index, 0, 0 };
+
+static const uint16_t KanUV1Seeds[] = {
+    1, 10, 2, 12
+};
+
+static const uint32_t KanUV1Slots[] = {
+    0x00000075, 0x0000004D, 0x00000048, 0x0000006F, 0x00000061, 0x00000065,
+    0x00000069, 0x00000071
+};
+
+static const int8_t KanUV1Index[] = {
+    2, 12, 3, 9, 0, 7, 1, 11
+};
+
+const KeyPosHash KanUV1Hash = { KanUV1Seeds, KanUV1Slots, KanUV1Index, 4, 8 };
+
+static const uint16_t KanUV2Seeds[] = {
+    1, 9, 63, 1, 11, 3, 74, 1, 4, 4, 4, 3,
+    9
+};
+
+static const uint32_t KanUV2Slots[] = {
+    0x0000004C, 0x00000061, 0x00710071, 0x00480052, 0x00480072, 0x004D004D,
+    0x00690069, 0x00000075, 0x00610075, 0x00480048, 0x0000006C, 0x00000048,
+    0x006F006F, 0x00000071, 0x0000006F, 0x00000052, 0x0048004C, 0x00650065,
+    0x0048006C, 0x00610069, 0x00000065, 0x00000069, 0x00000072, 0x0000004D,
+    0x00610061, 0x00750075
+};
+
+static const int8_t KanUV2Index[] = {
+    6, 0, 11, 4, 3, 12, 1, 2, 10, 13, 5, 13,
+    9, 11, 9, 4, 6, 7, 5, 8, 7, 1, 3, 12,
+    0, 2
+};
+
+const KeyPosHash KanUV2Hash = { KanUV2Seeds, KanUV2Slots, KanUV2Index, 13, 26 };
+
+static const uint16_t KanUV3Seeds[] = {
+    0, 1, 34
+};
+
+static const uint32_t KanUV3Slots[] = {
+    0x24480048, 0x004D004D, 0x0000004D, 0x00000048, 0x26CD004D, 0x00480048
+};
+
+static const int8_t KanUV3Index[] = {
+    13, 12, 12, 13, 12, 13
+};
+
+const KeyPosHash KanUV3Hash = { KanUV3Seeds, KanUV3Slots, KanUV3Index, 3, 6 };
+
+static const uint16_t KanUC1Seeds[] = {
+    3, 15, 1, 32, 13, 0, 0, 2, 0, 132, 129, 26
+};
+
+static const uint32_t KanUC1Slots[] = {
+    0x0000006B, 0x00000044, 0x00000074, 0x00000073, 0x00000070, 0x00000067,
+    0x00000076, 0x00000072, 0x0000006E, 0x0000006A, 0x0000006C, 0x00000062,
+    0x00000063, 0x00000054, 0x00000053, 0x00000079, 0x00000052, 0x0000006D,
+    0x00000066, 0x00000068, 0x0000004E, 0x00000064, 0x0000004C
+};
+
+static const int8_t KanUC1Index[] = {
+    0, 7, 9, 22, 12, 1, 20, 16, 2, 4, 18, 13,
+    3, 6, 21, 15, 17, 14, 24, 23, 8, 10, 19
+};
+
+const KeyPosHash KanUC1Hash = { KanUC1Seeds, KanUC1Slots, KanUC1Index, 12, 23 };
+
+static const uint16_t KanUC2Seeds[] = {
+    1, 4, 6, 3, 1, 4, 65, 17
+};
+
+static const uint32_t KanUC2Slots[] = {
+    0x006A0068, 0x006E006A, 0x00540068, 0x00630068, 0x00640068, 0x00440068,
+    0x006E0067, 0x00000067, 0x0000006A, 0x00700068, 0x00000068, 0x00670068,
+    0x00740068, 0x00730068, 0x00620068, 0x006B0068
+};
+
+static const int8_t KanUC2Index[] = {
+    4, 5, 6, 3, 10, 7, 2, 2, 5, 12, 0, 1,
+    9, 22, 13, 0
+};
+
+const KeyPosHash KanUC2Hash = { KanUC2Seeds, KanUC2Slots, KanUC2Index, 8, 16 };
+
+static const uint16_t KanUC3Seeds[] = {
+    0
+};
+
+static const uint32_t KanUC3Slots[] = {
+    0x00000000
+};
+
+static const int8_t KanUC3Index[] = {
+    0
+};
+
+const KeyPosHash KanUC3Hash = { KanUC3Seeds, KanUC3Slots, KanUC3Index, 0, 0 };
+
+static const uint16_t TelUV1Seeds[] = {
+    1, 2, 2, 4, 4
+};
+
+static const uint32_t TelUV1Slots[] = {
+    0x0000004D, 0x00000075, 0x00000051, 0x00000048, 0x00000071, 0x00000061,
+    0x00000065, 0x00000069, 0x0000006F
+};
+
+static const int8_t TelUV1Index[] = {
+    12, 2, 14, 3, 11, 0, 7, 1, 9
+};
+
+const KeyPosHash TelUV1Hash = { TelUV1Seeds, TelUV1Slots, TelUV1Index, 5, 9 };
+
+static const uint16_t TelUV2Seeds[] = {
+    1, 9, 63, 1, 11, 3, 74, 1, 4, 4, 4, 3,
+    9
+};
+
+static const uint32_t TelUV2Slots[] = {
+    0x0000004C, 0x00000061, 0x00710071, 0x00480052, 0x00480072, 0x004D004D,
+    0x00690069, 0x00000075, 0x00610075, 0x00480048, 0x0000006C, 0x00000048,
+    0x006F006F, 0x00000071, 0x0000006F, 0x00000052, 0x0048004C, 0x00650065,
+    0x0048006C, 0x00610069, 0x00000065, 0x00000069, 0x00000072, 0x0000004D,
+    0x00610061, 0x00750075
+};
+
+static const int8_t TelUV2Index[] = {
+    6, 0, 11, 4, 3, 12, 1, 2, 10, 13, 5, 13,
+    9, 11, 9, 4, 6, 7, 5, 8, 7, 1, 3, 12,
+    0, 2
+};
+
+const KeyPosHash TelUV2Hash = { TelUV2Seeds, TelUV2Slots, TelUV2Index, 13, 26 };
+
+static const uint16_t TelUV3Seeds[] = {
+    0, 1, 34
+};
+
+static const uint32_t TelUV3Slots[] = {
+    0x24480048, 0x004D004D, 0x0000004D, 0x00000048, 0x26CD004D, 0x00480048
+};
+
+static const int8_t TelUV3Index[] = {
+    13, 12, 12, 13, 12, 13
+};
+
+const KeyPosHash TelUV3Hash = { TelUV3Seeds, TelUV3Slots, TelUV3Index, 3, 6 };
+
+static const uint16_t TelUC1Seeds[] = {
+    33, 136, 3, 3, 160, 0, 0, 9, 0, 1, 72, 3
+};
+
+static const uint32_t TelUC1Slots[] = {
+    0x0000004C, 0x00000068, 0x00000072, 0x0000004E, 0x00000062, 0x00000063,
+    0x00000053, 0x00000076, 0x0000006C, 0x00000074, 0x0000007A, 0x00000067,
+    0x0000006D, 0x00000044, 0x00000054, 0x00000064, 0x00000073, 0x0000006B,
+    0x0000006A, 0x00000079, 0x00000070, 0x00000052, 0x0000006E
+};
+
+static const int8_t TelUC1Index[] = {
+    19, 24, 16, 8, 13, 3, 22, 21, 18, 9, 20, 1,
+    14, 7, 6, 10, 23, 0, 4, 15, 12, 17, 2
+};
+
+const KeyPosHash TelUC1Hash = { TelUC1Seeds, TelUC1Slots, TelUC1Index, 12, 23 };
+
+static const uint16_t TelUC2Seeds[] = {
+    1, 4, 6, 3, 1, 4, 65, 17
+};
+
+static const uint32_t TelUC2Slots[] = {
+    0x006A0068, 0x006E006A, 0x00540068, 0x00630068, 0x00640068, 0x00440068,
+    0x006E0067, 0x00000067, 0x0000006A, 0x00700068, 0x00000068, 0x00670068,
+    0x00740068, 0x00730068, 0x00620068, 0x006B0068
+};
+
+static const int8_t TelUC2Index[] = {
+    4, 5, 6, 3, 10, 7, 2, 2, 5, 12, 0, 1,
+    9, 23, 13, 0
+};
+
+const KeyPosHash TelUC2Hash = { TelUC2Seeds, TelUC2Slots, TelUC2Index, 8, 16 };
+
+static const uint16_t TelUC3Seeds[] = {
+    0
+};
+
+static const uint32_t TelUC3Slots[] = {
+    0x00000000
+};
+
+static const int8_t TelUC3Index[] = {
+    0
+};
+
+const KeyPosHash TelUC3Hash = { TelUC3Seeds, TelUC3Slots, TelUC3Index, 0, 0 };
+
+static const uint16_t GrmkUV1Seeds[] = {
+    1, 64, 3, 1, 84
+};
+
+static const uint32_t GrmkUV1Slots[] = {
+    0x00000048, 0x00000065, 0x00000051, 0x00000071, 0x00000075, 0x0000004D,
+    0x00000061, 0x0000006F, 0x00000069, 0x00000078
+};
+
+static const int8_t GrmkUV1Index[] = {
+    9, 3, 11, 10, 2, 8, 0, 5, 1, 7
+};
+
+const KeyPosHash GrmkUV1Hash = { GrmkUV1Seeds, GrmkUV1Slots, GrmkUV1Index, 5, 10 };
+
+static const uint16_t GrmkUV2Seeds[] = {
+    8, 1, 10, 3, 34, 1, 0, 49, 0
+};
+
+static const uint32_t GrmkUV2Slots[] = {
+    0x00610064, 0x00710071, 0x0000006D, 0x00750075, 0x00000075, 0x00000071,
+    0x0000006E, 0x00690069, 0x00000069, 0x00000064, 0x00000061, 0x00610075,
+    0x00510071, 0x00610061, 0x004D006D, 0x00610069, 0x006F006E
+};
+
+static const int8_t GrmkUV2Index[] = {
+    13, 10, 8, 2, 2, 10, 12, 1, 1, 13, 0, 6,
+    11, 0, 8, 4, 12
+};
+
+const KeyPosHash GrmkUV2Hash = { GrmkUV2Seeds, GrmkUV2Slots, GrmkUV2Index, 9, 17 };
+
+static const uint16_t GrmkUV3Seeds[] = {
+    23, 1, 10
+};
+
+static const uint32_t GrmkUV3Slots[] = {
+    0x006E006B, 0x00000071, 0x38F10071, 0x0000006B, 0x37EE006B, 0x00710071
+};
+
+static const int8_t GrmkUV3Index[] = {
+    12, 10, 10, 12, 12, 10
+};
+
+const KeyPosHash GrmkUV3Hash = { GrmkUV3Seeds, GrmkUV3Slots, GrmkUV3Index, 3, 6 };
+
+static const uint16_t GrmkUC1Seeds[] = {
+    11, 42, 5, 67, 113, 109, 0, 3, 13, 0, 167, 67,
+    2
+};
+
+static const uint32_t GrmkUC1Slots[] = {
+    0x00000047, 0x00000074, 0x00000044, 0x00000066, 0x0000004C, 0x00000072,
+    0x00000063, 0x00000068, 0x0000004B, 0x0000006A, 0x00000067, 0x0000004E,
+    0x00000064, 0x00000076, 0x0000006C, 0x00000054, 0x00000062, 0x0000007A,
+    0x00000073, 0x00000070, 0x0000006D, 0x0000006E, 0x0000006B, 0x00000059,
+    0x00000052, 0x00000079
+};
+
+static const int8_t GrmkUC1Index[] = {
+    23, 9, 6, 26, 18, 16, 3, 21, 22, 4, 1, 8,
+    10, 19, 17, 5, 13, 24, 20, 12, 14, 2, 0, 27,
+    25, 15
+};
+
+const KeyPosHash GrmkUC1Hash = { GrmkUC1Seeds, GrmkUC1Slots, GrmkUC1Index, 13, 26 };
+
+static const uint16_t GrmkUC2Seeds[] = {
+    2, 2, 12, 15, 1, 4, 8, 3
+};
+
+static const uint32_t GrmkUC2Slots[] = {
+    0x006A0068, 0x00000079, 0x00540068, 0x00620068, 0x00630068, 0x00440068,
+    0x006E0067, 0x00000067, 0x00740068, 0x00000068, 0x006E0079, 0x00640068,
+    0x00670068, 0x00730068, 0x00700068, 0x006B0068
+};
+
+static const int8_t GrmkUC2Index[] = {
+    4, 7, 5, 13, 3, 6, 2, 2, 9, 0, 7, 10,
+    1, 20, 12, 0
+};
+
+const KeyPosHash GrmkUC2Hash = { GrmkUC2Seeds, GrmkUC2Slots, GrmkUC2Index, 8, 16 };
+
+static const uint16_t GrmkUC3Seeds[] = {
+    0
+};
+
+static const uint32_t GrmkUC3Slots[] = {
+    0x00000000
+};
+
+static const int8_t GrmkUC3Index[] = {
+    0
+};
+
+const KeyPosHash GrmkUC3Hash = { GrmkUC3Seeds, GrmkUC3Slots, GrmkUC3Index, 0, 0 };
+
+static const uint16_t GrmkUNuktaSeeds[] = {
+    14, 1, 1, 10
+};
+
+static const uint32_t GrmkUNuktaSlots[] = {
+    0x00000916, 0x00000915, 0x0000092F, 0x00000922, 0x00000921, 0x0000092B,
+    0x00000917, 0x0000091C
+};
+
+static const int8_t GrmkUNuktaIndex[] = {
+    1, 0, 7, 5, 4, 6, 2, 3
+};
+
+const KeyPosHash GrmkUNuktaHash = { GrmkUNuktaSeeds, GrmkUNuktaSlots, GrmkUNuktaIndex, 4, 8 };
+
+static const uint16_t AnjalUV1Seeds[] = {
+    70, 11, 38, 6, 0, 0
+};
+
+static const uint32_t AnjalUV1Slots[] = {
+    0x00000055, 0x00000071, 0x00000045, 0x00000065, 0x00000041, 0x0000006F,
+    0x00000061, 0x0000004F, 0x00000069, 0x00000075, 0x00000049
+};
+
+static const int8_t AnjalUV1Index[] = {
+    10, 7, 11, 3, 8, 5, 0, 12, 1, 2, 9
+};
+
+const KeyPosHash AnjalUV1Hash = { AnjalUV1Seeds, AnjalUV1Slots, AnjalUV1Index, 6, 11 };
+
+static const uint16_t AnjalUV2Seeds[] = {
+    2, 2, 1, 7, 3, 9, 2, 98
+};
+
+static const uint32_t AnjalUV2Slots[] = {
+    0x00610069, 0x00000065, 0x00710071, 0x00650065, 0x00000061, 0x004F004D,
+    0x00690069, 0x00000075, 0x0000006F, 0x006F006F, 0x00000071, 0x00610061,
+    0x0000004D, 0x00000069, 0x00610075, 0x00750075
+};
+
+static const int8_t AnjalUV2Index[] = {
+    4, 3, 7, 3, 0, 12, 1, 2, 5, 5, 7, 0,
+    12, 1, 6, 2
+};
+
+const KeyPosHash AnjalUV2Hash = { AnjalUV2Seeds, AnjalUV2Slots, AnjalUV2Index, 8, 16 };
+
+static const uint16_t AnjalUV3Seeds[] = {
+    0
+};
+
+static const uint32_t AnjalUV3Slots[] = {
+    0x00000000
+};
+
+static const int8_t AnjalUV3Index[] = {
+    0
+};
+
+const KeyPosHash AnjalUV3Hash = { AnjalUV3Seeds, AnjalUV3Slots, AnjalUV3Index, 0, 0 };
+
+static const uint16_t AnjalUC1Seeds[] = {
+    1, 199, 1, 12, 42, 0, 0, 1, 0, 34, 73, 6
+};
+
+static const uint32_t AnjalUC1Slots[] = {
+    0x0000004E, 0x00000063, 0x00000076, 0x0000004C, 0x00000070, 0x00000057,
+    0x00000062, 0x00000073, 0x0000006E, 0x00000053, 0x00000077, 0x0000006B,
+    0x00000067, 0x00000074, 0x0000006C, 0x00000068, 0x00000079, 0x0000006A,
+    0x00000078, 0x00000064, 0x00000052, 0x00000072, 0x0000006D, 0x0000007A
+};
+
+static const int8_t AnjalUC1Index[] = {
+    16, 2, 11, 13, 5, 27, 6, 21, 14, 22, 17, 0,
+    1, 4, 10, 23, 8, 20, 24, 3, 7, 9, 18, 12
+};
+
+const KeyPosHash AnjalUC1Hash = { AnjalUC1Seeds, AnjalUC1Slots, AnjalUC1Index, 12, 24 };
+
+static const uint16_t AnjalUC2Seeds[] = {
+    4, 2, 4, 15, 2, 0, 1, 7
+};
+
+static const uint32_t AnjalUC2Slots[] = {
+    0x00730068, 0x0000003D, 0x006E002D, 0x00730072, 0x00000072, 0x0077002D,
+    0x006E0067, 0x00630068, 0x00000068, 0x00000067, 0x00740068, 0x0000002D,
+    0x0000006A, 0x006E003D, 0x006E006A
+};
+
+static const int8_t AnjalUC2Index[] = {
+    21, 26, 19, 25, 25, 17, 14, 2, 2, 14, 4, 17,
+    15, 26, 15
+};
+
+const KeyPosHash AnjalUC2Hash = { AnjalUC2Seeds, AnjalUC2Slots, AnjalUC2Index, 8, 15 };
+
+static const uint16_t AnjalUC3Seeds[] = {
+    2, 1
+};
+
+static const uint32_t AnjalUC3Slots[] = {
+    0x00720069, 0x39F20069, 0x00000069
+};
+
+static const int8_t AnjalUC3Index[] = {
+    25, 25, 25
+};
+
+const KeyPosHash AnjalUC3Hash = { AnjalUC3Seeds, AnjalUC3Slots, AnjalUC3Index, 2, 3 };
+
+static const uint16_t BengUV1Seeds[] = {
+    2, 8, 89, 0, 9, 1, 0, 233
+};
+
+static const uint32_t BengUV1Slots[] = {
+    0x00000049, 0x00000048, 0x0000004C, 0x00000041, 0x00000071, 0x00000051,
+    0x00000045, 0x0000004F, 0x00000052, 0x00000065, 0x00000061, 0x0000004D,
+    0x0000006F, 0x00000069, 0x00000055, 0x00000075
+};
+
+static const int8_t BengUV1Index[] = {
+    10, 13, 8, 9, 14, 15, 17, 16, 7, 3, 0, 12,
+    5, 1, 11, 2
+};
+
+const KeyPosHash BengUV1Hash = { BengUV1Seeds, BengUV1Slots, BengUV1Index, 8, 16 };
+
+static const uint16_t BengUV2Seeds[] = {
+    1, 1, 1, 3, 6, 2, 5
+};
+
+static const uint32_t BengUV2Slots[] = {
+    0x00610069, 0x00000071, 0x00750075, 0x00000072, 0x00610075, 0x00690069,
+    0x004C006C, 0x00520072, 0x00000061, 0x0000006C, 0x00610061, 0x00000069,
+    0x00000075, 0x00710071
+};
+
+static const int8_t BengUV2Index[] = {
+    4, 14, 2, 7, 6, 1, 8, 7, 0, 8, 0, 1,
+    2, 14
+};
+
+const KeyPosHash BengUV2Hash = { BengUV2Seeds, BengUV2Slots, BengUV2Index, 7, 14 };
+
+static const uint16_t BengUV3Seeds[] = {
+    3, 3
+};
+
+static const uint32_t BengUV3Slots[] = {
+    0x00710071, 0x00000071, 0x38F10071
+};
+
+static const int8_t BengUV3Index[] = {
+    14, 14, 14
+};
+
+const KeyPosHash BengUV3Hash = { BengUV3Seeds, BengUV3Slots, BengUV3Index, 2, 3 };
+
+static const uint16_t BengUC1Seeds[] = {
+    81, 42, 3, 15, 3, 0, 22, 0, 66, 85, 2
+};
+
+static const uint32_t BengUC1Slots[] = {
+    0x00000053, 0x00000074, 0x00000044, 0x00000054, 0x00000068, 0x0000006B,
+    0x00000073, 0x0000006A, 0x00000067, 0x0000004E, 0x00000072, 0x0000006C,
+    0x00000063, 0x00000076, 0x0000007A, 0x00000064, 0x00000062, 0x0000006D,
+    0x00000079, 0x00000070, 0x00000059, 0x0000006E
+};
+
+static const int8_t BengUC1Index[] = {
+    21, 9, 6, 5, 22, 0, 20, 4, 1, 8, 16, 17,
+    3, 19, 18, 10, 13, 14, 15, 12, 23, 2
+};
+
+const KeyPosHash BengUC1Hash = { BengUC1Seeds, BengUC1Slots, BengUC1Index, 11, 22 };
+
+static const uint16_t BengUC2Seeds[] = {
+    10, 2, 25, 0, 2, 1, 0, 1, 12
+};
+
+static const uint32_t BengUC2Slots[] = {
+    0x00000068, 0x006A0068, 0x00000079, 0x00540068, 0x00740078, 0x00000078,
+    0x00440068, 0x006E0067, 0x00620068, 0x006E0079, 0x00670068, 0x00640068,
+    0x00740068, 0x00630068, 0x00000067, 0x00730068, 0x00700068, 0x006B0068
+};
+
+static const int8_t BengUC2Index[] = {
+    0, 4, 7, 5, 24, 24, 6, 2, 13, 7, 1, 10,
+    9, 3, 2, 20, 12, 0
+};
+
+const KeyPosHash BengUC2Hash = { BengUC2Seeds, BengUC2Slots, BengUC2Index, 9, 18 };
+
+static const uint16_t BengUC3Seeds[] = {
+    0
+};
+
+static const uint32_t BengUC3Slots[] = {
+    0x00000000
+};
+
+static const int8_t BengUC3Index[] = {
+    0
+};
+
+const KeyPosHash BengUC3Hash = { BengUC3Seeds, BengUC3Slots, BengUC3Index, 0, 0 };
+
+static const uint16_t BengUNuktaSeeds[] = {
+    5, 1
+};
+
+static const uint32_t BengUNuktaSlots[] = {
+    0x000009A2, 0x000009A1, 0x000009AF
+};
+
+static const int8_t BengUNuktaIndex[] = {
+    1, 0, 2
+};
+
+const KeyPosHash BengUNuktaHash = { BengUNuktaSeeds, BengUNuktaSlots, BengUNuktaIndex, 2, 3 };
+
+static const uint16_t GujrUV1Seeds[] = {
+    2, 8, 89, 0, 9, 1, 0, 233
+};
+
+static const uint32_t GujrUV1Slots[] = {
+    0x00000049, 0x00000048, 0x0000004C, 0x00000041, 0x00000071, 0x00000051,
+    0x00000045, 0x0000004F, 0x00000052, 0x00000065, 0x00000061, 0x0000004D,
+    0x0000006F, 0x00000069, 0x00000055, 0x00000075
+};
+
+static const int8_t GujrUV1Index[] = {
+    10, 13, 8, 9, 14, 15, 17, 16, 7, 3, 0, 12,
+    5, 1, 11, 2
+};
+
+const KeyPosHash GujrUV1Hash = { GujrUV1Seeds, GujrUV1Slots, GujrUV1Index, 8, 16 };
+
+static const uint16_t GujrUV2Seeds[] = {
+    2, 6, 1, 1, 13, 3, 15, 0, 6, 24
+};
+
+static const uint32_t GujrUV2Slots[] = {
+    0x00610069, 0x00690069, 0x00000065, 0x00000071, 0x00000072, 0x0000006C,
+    0x00610075, 0x004F004D, 0x00000075, 0x004C006C, 0x0000006F, 0x0000004D,
+    0x006F006F, 0x00000061, 0x00610061, 0x00520072, 0x00000069, 0x00750075,
+    0x00650065, 0x00710071
+};
+
+static const int8_t GujrUV2Index[] = {
+    4, 1, 3, 14, 7, 8, 6, 16, 2, 8, 5, 16,
+    5, 0, 0, 7, 1, 2, 3, 14
+};
+
+const KeyPosHash GujrUV2Hash = { GujrUV2Seeds, GujrUV2Slots, GujrUV2Index, 10, 20 };
+
+static const uint16_t GujrUV3Seeds[] = {
+    3, 3
+};
+
+static const uint32_t GujrUV3Slots[] = {
+    0x00710071, 0x00000071, 0x38F10071
+};
+
+static const int8_t GujrUV3Index[] = {
+    14, 14, 14
+};
+
+const KeyPosHash GujrUV3Hash = { GujrUV3Seeds, GujrUV3Slots, GujrUV3Index, 2, 3 };
+
+static const uint16_t GujrUC1Seeds[] = {
+    1, 17, 3, 13, 2, 0, 71, 0, 18, 68, 3
+};
+
+static const uint32_t GujrUC1Slots[] = {
+    0x00000054, 0x00000072, 0x0000006A, 0x0000004E, 0x00000073, 0x00000062,
+    0x0000006D, 0x0000006C, 0x00000074, 0x0000007A, 0x00000067, 0x00000063,
+    0x00000044, 0x00000068, 0x00000064, 0x00000076, 0x0000006B, 0x00000079,
+    0x00000070, 0x00000053, 0x0000006E
+};
+
+static const int8_t GujrUC1Index[] = {
+    5, 16, 4, 8, 20, 13, 14, 17, 9, 18, 1, 3,
+    6, 22, 10, 19, 0, 15, 12, 21, 2
+};
+
+const KeyPosHash GujrUC1Hash = { GujrUC1Seeds, GujrUC1Slots, GujrUC1Index, 11, 21 };
+
+static const uint16_t GujrUC2Seeds[] = {
+    15, 2, 20, 5, 3, 1, 0, 6, 5
+};
+
+static const uint32_t GujrUC2Slots[] = {
+    0x00000067, 0x006A0068, 0x00000079, 0x00540068, 0x00640068, 0x00620068,
+    0x00440068, 0x006E0067, 0x00630068, 0x00670068, 0x00740068, 0x0000006C,
+    0x00000068, 0x006C006C, 0x006E0079, 0x00730068, 0x00700068, 0x006B0068
+};
+
+static const int8_t GujrUC2Index[] = {
+    2, 4, 7, 5, 10, 13, 6, 2, 3, 1, 9, 17,
+    0, 17, 7, 20, 12, 0
+};
+
+const KeyPosHash GujrUC2Hash = { GujrUC2Seeds, GujrUC2Slots, GujrUC2Index, 9, 18 };
+
+static const uint16_t GujrUC3Seeds[] = {
+    0
+};
+
+static const uint32_t GujrUC3Slots[] = {
+    0x00000000
+};
+
+static const int8_t GujrUC3Index[] = {
+    0
+};
+
+const KeyPosHash GujrUC3Hash = { GujrUC3Seeds, GujrUC3Slots, GujrUC3Index, 0, 0 };
+
+static const uint16_t OryaUV1Seeds[] = {
+    2, 8, 89, 0, 9, 1, 0, 233
+};
+
+static const uint32_t OryaUV1Slots[] = {
+    0x00000049, 0x00000048, 0x0000004C, 0x00000041, 0x00000071, 0x00000051,
+    0x00000045, 0x0000004F, 0x00000052, 0x00000065, 0x00000061, 0x0000004D,
+    0x0000006F, 0x00000069, 0x00000055, 0x00000075
+};
+
+static const int8_t OryaUV1Index[] = {
+    10, 13, 8, 9, 14, 15, 17, 16, 7, 3, 0, 12,
+    5, 1, 11, 2
+};
+
+const KeyPosHash OryaUV1Hash = { OryaUV1Seeds, OryaUV1Slots, OryaUV1Index, 8, 16 };
+
+static const uint16_t OryaUV2Seeds[] = {
+    1, 1, 1, 3, 6, 2, 5
+};
+
+static const uint32_t OryaUV2Slots[] = {
+    0x00610069, 0x00000071, 0x00750075, 0x00000072, 0x00610075, 0x00690069,
+    0x004C006C, 0x00520072, 0x00000061, 0x0000006C, 0x00610061, 0x00000069,
+    0x00000075, 0x00710071
+};
+
+static const int8_t OryaUV2Index[] = {
+    4, 14, 2, 7, 6, 1, 8, 7, 0, 8, 0, 1,
+    2, 14
+};
+
+const KeyPosHash OryaUV2Hash = { OryaUV2Seeds, OryaUV2Slots, OryaUV2Index, 7, 14 };
+
+static const uint16_t OryaUV3Seeds[] = {
+    3, 3
+};
+
+static const uint32_t OryaUV3Slots[] = {
+    0x00710071, 0x00000071, 0x38F10071
+};
+
+static const int8_t OryaUV3Index[] = {
+    14, 14, 14
+};
+
+const KeyPosHash OryaUV3Hash = { OryaUV3Seeds, OryaUV3Slots, OryaUV3Index, 2, 3 };
+
+static const uint16_t OryaUC1Seeds[] = {
+    75, 9, 3, 32, 199, 0, 0, 16, 0, 67, 117, 3
+};
+
+static const uint32_t OryaUC1Slots[] = {
+    0x00000072, 0x00000059, 0x00000076, 0x0000004E, 0x00000053, 0x00000074,
+    0x0000006A, 0x00000077, 0x0000006C, 0x00000062, 0x0000007A, 0x00000067,
+    0x00000073, 0x00000044, 0x00000054, 0x00000063, 0x0000006B, 0x00000068,
+    0x0000006D, 0x00000079, 0x00000070, 0x00000064, 0x0000006E
+};
+
+static const int8_t OryaUC1Index[] = {
+    16, 24, 19, 8, 21, 9, 4, 23, 17, 13, 18, 1,
+    20, 6, 5, 3, 0, 22, 14, 15, 12, 10, 2
+};
+
+const KeyPosHash OryaUC1Hash = { OryaUC1Seeds, OryaUC1Slots, OryaUC1Index, 12, 23 };
+
+static const uint16_t OryaUC2Seeds[] = {
+    15, 2, 20, 5, 3, 1, 0, 6, 5
+};
+
+static const uint32_t OryaUC2Slots[] = {
+    0x00000067, 0x006A0068, 0x00000079, 0x00540068, 0x00640068, 0x00620068,
+    0x00440068, 0x006E0067, 0x00630068, 0x00670068, 0x00740068, 0x0000006C,
+    0x00000068, 0x006C006C, 0x006E0079, 0x00730068, 0x00700068, 0x006B0068
+};
+
+static const int8_t OryaUC2Index[] = {
+    2, 4, 7, 5, 10, 13, 6, 2, 3, 1, 9, 17,
+    0, 17, 7, 20, 12, 0
+};
+
+const KeyPosHash OryaUC2Hash = { OryaUC2Seeds, OryaUC2Slots, OryaUC2Index, 9, 18 };
+
+static const uint16_t OryaUC3Seeds[] = {
+    0
+};
+
+static const uint32_t OryaUC3Slots[] = {
+    0x00000000
+};
+
+static const int8_t OryaUC3Index[] = {
+    0
+};
+
+const KeyPosHash OryaUC3Hash = { OryaUC3Seeds, OryaUC3Slots, OryaUC3Index, 0, 0 };
+
+static const uint16_t OryaUNuktaSeeds[] = {
+    5
+};
+
+static const uint32_t OryaUNuktaSlots[] = {
+    0x00000B22, 0x00000B21
+};
+
+static const int8_t OryaUNuktaIndex[] = {
+    1, 0
+};
+
+const KeyPosHash OryaUNuktaHash = { OryaUNuktaSeeds, OryaUNuktaSlots, OryaUNuktaIndex, 1, 2 };
+
+static const uint16_t SinhUV1Seeds[] = {
+    7, 4, 2, 2, 1, 103, 32
+};
+
+static const uint32_t SinhUV1Slots[] = {
+    0x00000049, 0x00000041, 0x0000004F, 0x00000075, 0x00000071, 0x00000061,
+    0x00000052, 0x00000069, 0x00000055, 0x00000065, 0x00000048, 0x0000006F,
+    0x00000045, 0x0000004D
+};
+
+static const int8_t SinhUV1Index[] = {
+    10, 9, 13, 3, 16, 0, 8, 2, 11, 4, 15, 6,
+    12, 14
+};
+
+const KeyPosHash SinhUV1Hash = { SinhUV1Seeds, SinhUV1Slots, SinhUV1Index, 7, 14 };
+
+static const uint16_t SinhUV2Seeds[] = {
+    6, 21, 34, 2, 7, 0, 3, 97
+};
+
+static const uint32_t SinhUV2Slots[] = {
+    0x00000065, 0x00750075, 0x0000006F, 0x00410065, 0x00000061, 0x00000069,
+    0x00610065, 0x00000075, 0x00650065, 0x00690069, 0x006F006F, 0x00610061,
+    0x00000052, 0x00610069, 0x00520052, 0x00610075
+};
+
+static const int8_t SinhUV2Index[] = {
+    1, 3, 6, 9, 0, 2, 1, 3, 4, 2, 6, 0,
+    8, 5, 8, 7
+};
+
+const KeyPosHash SinhUV2Hash = { SinhUV2Seeds, SinhUV2Slots, SinhUV2Index, 8, 16 };
+
+static const uint16_t SinhUV3Seeds[] = {
+    0
+};
+
+static const uint32_t SinhUV3Slots[] = {
+    0x00000000
+};
+
+static const int8_t SinhUV3Index[] = {
+    0
+};
+
+const KeyPosHash SinhUV3Hash = { SinhUV3Seeds, SinhUV3Slots, SinhUV3Index, 0, 0 };
+
+static const uint16_t SinhUC1Seeds[] = {
+    9, 15, 1, 8, 175, 0, 0, 2, 0, 374, 36, 26
+};
+
+static const uint32_t SinhUC1Slots[] = {
+    0x00000073, 0x00000044, 0x00000074, 0x00000077, 0x00000070, 0x00000067,
+    0x00000076, 0x00000072, 0x0000006E, 0x0000006A, 0x0000006C, 0x00000068,
+    0x00000064, 0x00000054, 0x00000053, 0x00000079, 0x00000066, 0x00000063,
+    0x0000006D, 0x00000062, 0x0000004E, 0x0000006B, 0x0000004C
+};
+
+static const int8_t SinhUC1Index[] = {
+    20, 6, 9, 19, 11, 1, 18, 15, 2, 4, 16, 22,
+    10, 5, 21, 14, 23, 3, 13, 12, 8, 0, 17
+};
+
+const KeyPosHash SinhUC1Hash = { SinhUC1Seeds, SinhUC1Slots, SinhUC1Index, 12, 23 };
+
+static const uint16_t SinhUC2Seeds[] = {
+    2, 6, 7, 4, 9, 3, 18, 1, 8, 0, 5, 20
+};
+
+static const uint32_t SinhUC2Slots[] = {
+    0x00440078, 0x006A0068, 0x006E0067, 0x00000079, 0x00540068, 0x00000078,
+    0x00640068, 0x006B0068, 0x00440068, 0x00670068, 0x00700068, 0x00630068,
+    0x00670078, 0x00620068, 0x00000068, 0x0000006E, 0x00620078, 0x006A006E,
+    0x00640078, 0x006A0078, 0x00730068, 0x00000067, 0x00740068, 0x006E0079
+};
+
+static const int8_t SinhUC2Index[] = {
+    26, 4, 2, 7, 5, 24, 10, 0, 6, 1, 11, 3,
+    24, 12, 0, 29, 28, 29, 27, 25, 20, 2, 9, 7
+};
+
+const KeyPosHash SinhUC2Hash = { SinhUC2Seeds, SinhUC2Slots, SinhUC2Index, 12, 24 };
+
+static const uint16_t SinhUC3Seeds[] = {
+    0
+};
+
+static const uint32_t SinhUC3Slots[] = {
+    0x00000000
+};
+
+static const int8_t SinhUC3Index[] = {
+    0
+};
+
+const KeyPosHash SinhUC3Hash = { SinhUC3Seeds, SinhUC3Slots, SinhUC3Index, 0, 0 };
+
+static const uint16_t DiacUV1Seeds[] = {
+    7, 4, 38, 1, 1, 103, 2
+};
+
+static const uint32_t DiacUV1Slots[] = {
+    0x00000049, 0x00000041, 0x0000004C, 0x00000075, 0x00000052, 0x00000061,
+    0x00000065, 0x00000069, 0x00000055, 0x0000004F, 0x00000048, 0x0000006F,
+    0x00000045, 0x0000004D
+};
+
+static const int8_t DiacUV1Index[] = {
+    6, 5, 11, 2, 10, 0, 3, 1, 7, 9, 13, 4,
+    8, 12
+};
+
+const KeyPosHash DiacUV1Hash = { DiacUV1Seeds, DiacUV1Slots, DiacUV1Index, 7, 14 };
+
+static const uint16_t DiacUV2Seeds[] = {
+    7, 2, 4, 6, 3, 4, 25, 1
+};
+
+static const uint32_t DiacUV2Slots[] = {
+    0x0000004C, 0x00000065, 0x004D004D, 0x00650065, 0x00000061, 0x00000052,
+    0x0000004D, 0x00000075, 0x00000069, 0x006F006F, 0x00690069, 0x00610061,
+    0x00520052, 0x0000006F, 0x004C004C, 0x00750075
+};
+
+static const int8_t DiacUV2Index[] = {
+    11, 3, 12, 3, 0, 10, 12, 2, 1, 4, 1, 0,
+    10, 4, 11, 2
+};
+
+const KeyPosHash DiacUV2Hash = { DiacUV2Seeds, DiacUV2Slots, DiacUV2Index, 8, 16 };
+
+static const uint16_t DiacUV3Seeds[] = {
+    0
+};
+
+static const uint32_t DiacUV3Slots[] = {
+    0x00000000
+};
+
+static const int8_t DiacUV3Index[] = {
+    0
+};
+
+const KeyPosHash DiacUV3Hash = { DiacUV3Seeds, DiacUV3Slots, DiacUV3Index, 0, 0 };
+
+static const uint16_t DiacUC1Seeds[] = {
+    0, 17, 2, 14, 0, 2
+};
+
+static const uint32_t DiacUC1Slots[] = {
+    0x00000054, 0x00000044, 0x00000073, 0x0000006E, 0x00000067, 0x0000004E,
+    0x0000006C, 0x0000006B, 0x0000007A, 0x00000079, 0x00000053, 0x00000072
+};
+
+static const int8_t DiacUC1Index[] = {
+    0, 1, 6, 7, 13, 3, 11, 12, 5, 14, 4, 10
+};
+
+const KeyPosHash DiacUC1Hash = { DiacUC1Seeds, DiacUC1Slots, DiacUC1Index, 6, 12 };
+
+static const uint16_t DiacUC2Seeds[] = {
+    4, 4, 5, 12, 1, 72, 0, 3
+};
+
+static const uint32_t DiacUC2Slots[] = {
+    0x00440078, 0x00000078, 0x006C0078, 0x00000079, 0x00670078, 0x00440068,
+    0x006E0067, 0x00000067, 0x00000068, 0x006E0079, 0x00790078, 0x00720078,
+    0x00730068, 0x006E0078, 0x006B0068
+};
+
+static const int8_t DiacUC2Index[] = {
+    2, 2, 11, 8, 13, 1, 7, 7, 1, 8, 14, 10,
+    6, 9, 12
+};
+
+const KeyPosHash DiacUC2Hash = { DiacUC2Seeds, DiacUC2Slots, DiacUC2Index, 8, 15 };
+
+static const uint16_t DiacUC3Seeds[] = {
+    9, 2
+};
+
+static const uint32_t DiacUC3Slots[] = {
+    0x00680078, 0x35E80078, 0x22680078, 0x00000078
+};
+
+static const int8_t DiacUC3Index[] = {
+    1, 12, 1, 1
+};
+
+const KeyPosHash DiacUC3Hash = { DiacUC3Seeds, DiacUC3Slots, DiacUC3Index, 2, 4 };
+
+#ifdef KEYPOS_HASH_SOURCES
+
+static const UniChar DevaUV1SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar DevaUV2SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0069, 0x006F, 0x0075, 0x0072, 0x006C, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x004D, 0x002A, 0x0000
+};
+
+static const UniChar DevaUV2SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar DevaUV3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x0065, 0x002A, 0x006F, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar DevaUV3SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0069, 0x006F, 0x0075, 0x0072, 0x006C, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x004D, 0x002A, 0x0000
+};
+
+static const UniChar DevaUV3SourceFirstKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar DevaUC1SourceKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0000
+};
+
+static const UniChar DevaUC2SourceKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x006E,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x0072, 0x006C, 0x0068, 0x002A, 0x0068, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar DevaUC2SourcePrevKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0000
+};
+
+static const UniChar DevaUC3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x006C, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar DevaUC3SourcePrevKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x006E,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x0072, 0x006C, 0x0068, 0x002A, 0x0068, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar DevaUC3SourceFirstKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0000
+};
+
+static const UniChar DevaUNuktaSourceKeys[] = {
+    0x0915, 0x0916, 0x0917, 0x091C, 0x0921, 0x0922, 0x092B, 0x092F, 0x0000
+};
+
+static const UniChar MalUV1SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0048, 0x0048, 0x0048, 0x0048, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar MalUV2SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0072, 0x0052, 0x006C, 0x004C, 0x0065, 0x0069, 0x006F, 0x0075, 0x0071,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar MalUV2SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0048, 0x0048, 0x0048, 0x0048, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar MalUV3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar MalUV3SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0072, 0x0052, 0x006C, 0x004C, 0x0065, 0x0069, 0x006F, 0x0075, 0x0071,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar MalUV3SourceFirstKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0048, 0x0048, 0x0048, 0x0048, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar MalUC1SourceKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x006E, 0x0054, 0x0044, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x0052, 0x006C, 0x004C, 0x007A, 0x0076, 0x0053, 0x0073,
+    0x0068, 0x004E, 0x006E, 0x0052, 0x0072, 0x006C, 0x004C, 0x006B, 0x0000
+};
+
+static const UniChar MalUC2SourceKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x006A, 0x0068, 0x0068, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068,
+    0x002A, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0000
+};
+
+static const UniChar MalUC2SourcePrevKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x006E, 0x0054, 0x0044, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x0052, 0x006C, 0x004C, 0x007A, 0x0076, 0x0053, 0x0073,
+    0x0068, 0x004E, 0x006E, 0x0052, 0x0072, 0x006C, 0x004C, 0x006B, 0x0000
+};
+
+static const UniChar MalUC3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar MalUC3SourcePrevKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x006A, 0x0068, 0x0068, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068,
+    0x002A, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0077, 0x0000
+};
+
+static const UniChar MalUC3SourceFirstKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x006E, 0x0054, 0x0044, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x0052, 0x006C, 0x004C, 0x007A, 0x0076, 0x0053, 0x0073,
+    0x0068, 0x004E, 0x006E, 0x0052, 0x0072, 0x006C, 0x004C, 0x006B, 0x0000
+};
+
+static const UniChar KanUV1SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0048, 0x0048, 0x0048, 0x0048, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar KanUV2SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0072, 0x0052, 0x006C, 0x004C, 0x0065, 0x0069, 0x006F, 0x0075, 0x0071,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar KanUV2SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0048, 0x0048, 0x0048, 0x0048, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar KanUV3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar KanUV3SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0072, 0x0052, 0x006C, 0x004C, 0x0065, 0x0069, 0x006F, 0x0075, 0x0071,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar KanUV3SourceFirstKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0048, 0x0048, 0x0048, 0x0048, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar KanUC1SourceKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x006E, 0x0054, 0x0044, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x0052, 0x006C, 0x004C, 0x0076, 0x0053, 0x0073, 0x0068,
+    0x0066, 0x0000
+};
+
+static const UniChar KanUC2SourceKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x006A, 0x0068, 0x0068, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068, 0x002A,
+    0x002A, 0x0000
+};
+
+static const UniChar KanUC2SourcePrevKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x006E, 0x0054, 0x0044, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x0052, 0x006C, 0x004C, 0x0076, 0x0053, 0x0073, 0x0068,
+    0x0066, 0x0000
+};
+
+static const UniChar KanUC3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x0000
+};
+
+static const UniChar KanUC3SourcePrevKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x006A, 0x0068, 0x0068, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068, 0x002A,
+    0x002A, 0x0000
+};
+
+static const UniChar KanUC3SourceFirstKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x006E, 0x0054, 0x0044, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x0052, 0x006C, 0x004C, 0x0076, 0x0053, 0x0073, 0x0068,
+    0x0066, 0x0000
+};
+
+static const UniChar TelUV1SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0048, 0x0048, 0x0048, 0x0048, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071,
+    0x004D, 0x0048, 0x0051, 0x0000
+};
+
+static const UniChar TelUV2SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0072, 0x0052, 0x006C, 0x004C, 0x0065, 0x0069, 0x006F, 0x0075, 0x0071,
+    0x004D, 0x0048, 0x002A, 0x0000
+};
+
+static const UniChar TelUV2SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0048, 0x0048, 0x0048, 0x0048, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071,
+    0x004D, 0x0048, 0x0051, 0x0000
+};
+
+static const UniChar TelUV3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x004D, 0x0048, 0x002A, 0x0000
+};
+
+static const UniChar TelUV3SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0072, 0x0052, 0x006C, 0x004C, 0x0065, 0x0069, 0x006F, 0x0075, 0x0071,
+    0x004D, 0x0048, 0x002A, 0x0000
+};
+
+static const UniChar TelUV3SourceFirstKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0048, 0x0048, 0x0048, 0x0048, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071,
+    0x004D, 0x0048, 0x0051, 0x0000
+};
+
+static const UniChar TelUC1SourceKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x006E, 0x0054, 0x0044, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x0052, 0x006C, 0x004C, 0x007A, 0x0076, 0x0053, 0x0073,
+    0x0068, 0x0000
+};
+
+static const UniChar TelUC2SourceKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x006A, 0x0068, 0x0068, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068,
+    0x002A, 0x0000
+};
+
+static const UniChar TelUC2SourcePrevKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x006E, 0x0054, 0x0044, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x0052, 0x006C, 0x004C, 0x007A, 0x0076, 0x0053, 0x0073,
+    0x0068, 0x0000
+};
+
+static const UniChar TelUC3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x0000
+};
+
+static const UniChar TelUC3SourcePrevKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x006A, 0x0068, 0x0068, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068,
+    0x002A, 0x0000
+};
+
+static const UniChar TelUC3SourceFirstKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x006E, 0x0054, 0x0044, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x0052, 0x006C, 0x004C, 0x007A, 0x0076, 0x0053, 0x0073,
+    0x0068, 0x0000
+};
+
+static const UniChar GrmkUV1SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0078, 0x004D, 0x0048, 0x0071, 0x0051,
+    0x006F, 0x0061, 0x0000
+};
+
+static const UniChar GrmkUV2SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x002A, 0x0069, 0x002A, 0x0075, 0x002A, 0x006D, 0x002A, 0x0071, 0x0071,
+    0x006E, 0x0064, 0x0000
+};
+
+static const UniChar GrmkUV2SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0078, 0x004D, 0x0048, 0x0071, 0x0051,
+    0x006F, 0x0061, 0x0000
+};
+
+static const UniChar GrmkUV3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0071, 0x002A,
+    0x006B, 0x002A, 0x0000
+};
+
+static const UniChar GrmkUV3SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x002A, 0x0069, 0x002A, 0x0075, 0x002A, 0x006D, 0x002A, 0x0071, 0x0071,
+    0x006E, 0x0064, 0x0000
+};
+
+static const UniChar GrmkUV3SourceFirstKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0078, 0x004D, 0x0048, 0x0071, 0x0051,
+    0x006F, 0x0061, 0x0000
+};
+
+static const UniChar GrmkUC1SourceKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x004C, 0x0076, 0x0073, 0x0068, 0x004B, 0x0047,
+    0x007A, 0x0052, 0x0066, 0x0059, 0x0000
+};
+
+static const UniChar GrmkUC2SourceKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar GrmkUC2SourcePrevKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x004C, 0x0076, 0x0073, 0x0068, 0x004B, 0x0047,
+    0x007A, 0x0052, 0x0066, 0x0059, 0x0000
+};
+
+static const UniChar GrmkUC3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar GrmkUC3SourcePrevKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar GrmkUC3SourceFirstKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x004C, 0x0076, 0x0073, 0x0068, 0x004B, 0x0047,
+    0x007A, 0x0052, 0x0066, 0x0059, 0x0000
+};
+
+static const UniChar GrmkUNuktaSourceKeys[] = {
+    0x0915, 0x0916, 0x0917, 0x091C, 0x0921, 0x0922, 0x092B, 0x092F, 0x0000
+};
+
+static const UniChar AnjalUV1SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071, 0x0041, 0x0049, 0x0055, 0x0045,
+    0x004F, 0x0000
+};
+
+static const UniChar AnjalUV2SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0069, 0x006F, 0x0075, 0x0071, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x004D, 0x0000
+};
+
+static const UniChar AnjalUV2SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071, 0x0041, 0x0049, 0x0055, 0x0045,
+    0x004F, 0x0000
+};
+
+static const UniChar AnjalUV3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x0000
+};
+
+static const UniChar AnjalUV3SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0069, 0x006F, 0x0075, 0x0071, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x004D, 0x0000
+};
+
+static const UniChar AnjalUV3SourceFirstKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0071, 0x0041, 0x0049, 0x0055, 0x0045,
+    0x004F, 0x0000
+};
+
+static const UniChar AnjalUC1SourceKeys[] = {
+    0x006B, 0x0067, 0x0063, 0x0064, 0x0074, 0x0070, 0x0062, 0x0052, 0x0079, 0x0072, 0x006C, 0x0076,
+    0x007A, 0x004C, 0x006E, 0x006E, 0x004E, 0x0077, 0x006D, 0x006E, 0x006A, 0x0073, 0x0053, 0x0068,
+    0x0078, 0x0073, 0x006E, 0x0057, 0x0000
+};
+
+static const UniChar AnjalUC2SourceKeys[] = {
+    0x002A, 0x002A, 0x0068, 0x002A, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0067, 0x006A, 0x002A, 0x002D, 0x002A, 0x002D, 0x002A, 0x0068, 0x002A, 0x002A,
+    0x002A, 0x0072, 0x003D, 0x002A, 0x0000
+};
+
+static const UniChar AnjalUC2SourcePrevKeys[] = {
+    0x006B, 0x0067, 0x0063, 0x0064, 0x0074, 0x0070, 0x0062, 0x0052, 0x0079, 0x0072, 0x006C, 0x0076,
+    0x007A, 0x004C, 0x006E, 0x006E, 0x004E, 0x0077, 0x006D, 0x006E, 0x006A, 0x0073, 0x0053, 0x0068,
+    0x0078, 0x0073, 0x006E, 0x0057, 0x0000
+};
+
+static const UniChar AnjalUC3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x0069, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar AnjalUC3SourcePrevKeys[] = {
+    0x002A, 0x002A, 0x0068, 0x002A, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0067, 0x006A, 0x002A, 0x002D, 0x002A, 0x002D, 0x002A, 0x0068, 0x002A, 0x002A,
+    0x002A, 0x0072, 0x003D, 0x002A, 0x0000
+};
+
+static const UniChar AnjalUC3SourceFirstKeys[] = {
+    0x006B, 0x0067, 0x0063, 0x0064, 0x0074, 0x0070, 0x0062, 0x0052, 0x0079, 0x0072, 0x006C, 0x0076,
+    0x007A, 0x004C, 0x006E, 0x006E, 0x004E, 0x0077, 0x006D, 0x006E, 0x006A, 0x0073, 0x0053, 0x0068,
+    0x0078, 0x0073, 0x006E, 0x0057, 0x0000
+};
+
+static const UniChar BengUV1SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar BengUV2SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x002A, 0x0069, 0x002A, 0x0075, 0x0072, 0x006C, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar BengUV2SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar BengUV3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar BengUV3SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x002A, 0x0069, 0x002A, 0x0075, 0x0072, 0x006C, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar BengUV3SourceFirstKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar BengUC1SourceKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0059,
+    0x0074, 0x0000
+};
+
+static const UniChar BengUC2SourceKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068, 0x002A, 0x002A, 0x002A,
+    0x0078, 0x0000
+};
+
+static const UniChar BengUC2SourcePrevKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0059,
+    0x0074, 0x0000
+};
+
+static const UniChar BengUC3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x0000
+};
+
+static const UniChar BengUC3SourcePrevKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068, 0x002A, 0x002A, 0x002A,
+    0x0078, 0x0000
+};
+
+static const UniChar BengUC3SourceFirstKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0059,
+    0x0074, 0x0000
+};
+
+static const UniChar BengUNuktaSourceKeys[] = {
+    0x09A1, 0x09A2, 0x09AF, 0x0000
+};
+
+static const UniChar GujrUV1SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar GujrUV2SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0069, 0x006F, 0x0075, 0x0072, 0x006C, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x004D, 0x002A, 0x0000
+};
+
+static const UniChar GujrUV2SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar GujrUV3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar GujrUV3SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0069, 0x006F, 0x0075, 0x0072, 0x006C, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x004D, 0x002A, 0x0000
+};
+
+static const UniChar GujrUV3SourceFirstKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar GujrUC1SourceKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0000
+};
+
+static const UniChar GujrUC2SourceKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x006C, 0x002A, 0x002A, 0x0068, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar GujrUC2SourcePrevKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0000
+};
+
+static const UniChar GujrUC3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar GujrUC3SourcePrevKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x006C, 0x002A, 0x002A, 0x0068, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar GujrUC3SourceFirstKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0000
+};
+
+static const UniChar OryaUV1SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar OryaUV2SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x002A, 0x0069, 0x002A, 0x0075, 0x0072, 0x006C, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar OryaUV2SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar OryaUV3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar OryaUV3SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x002A, 0x0069, 0x002A, 0x0075, 0x0072, 0x006C, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0071, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar OryaUV3SourceFirstKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x004C, 0x0041, 0x0049, 0x0055,
+    0x004D, 0x0048, 0x0071, 0x0051, 0x004F, 0x0045, 0x0000
+};
+
+static const UniChar OryaUC1SourceKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0077,
+    0x0059, 0x0000
+};
+
+static const UniChar OryaUC2SourceKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x006C, 0x002A, 0x002A, 0x0068, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x0000
+};
+
+static const UniChar OryaUC2SourcePrevKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0077,
+    0x0059, 0x0000
+};
+
+static const UniChar OryaUC3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x0000
+};
+
+static const UniChar OryaUC3SourcePrevKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x002A,
+    0x0068, 0x0068, 0x002A, 0x002A, 0x002A, 0x006C, 0x002A, 0x002A, 0x0068, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x0000
+};
+
+static const UniChar OryaUC3SourceFirstKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x006E,
+    0x0070, 0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x007A, 0x0076, 0x0073, 0x0053, 0x0068, 0x0077,
+    0x0059, 0x0000
+};
+
+static const UniChar OryaUNuktaSourceKeys[] = {
+    0x0B21, 0x0B22, 0x0000
+};
+
+static const UniChar SinhUV1SourceKeys[] = {
+    0x0061, 0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x0041, 0x0049, 0x0055,
+    0x0045, 0x004F, 0x004D, 0x0048, 0x0071, 0x0000
+};
+
+static const UniChar SinhUV2SourceKeys[] = {
+    0x0061, 0x0065, 0x0069, 0x0075, 0x0065, 0x0069, 0x006F, 0x0075, 0x0052, 0x0065, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar SinhUV2SourcePrevKeys[] = {
+    0x0061, 0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x0041, 0x0049, 0x0055,
+    0x0045, 0x004F, 0x004D, 0x0048, 0x0071, 0x0000
+};
+
+static const UniChar SinhUV3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar SinhUV3SourcePrevKeys[] = {
+    0x0061, 0x0065, 0x0069, 0x0075, 0x0065, 0x0069, 0x006F, 0x0075, 0x0052, 0x0065, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar SinhUV3SourceFirstKeys[] = {
+    0x0061, 0x0061, 0x0069, 0x0075, 0x0065, 0x0061, 0x006F, 0x0061, 0x0052, 0x0041, 0x0049, 0x0055,
+    0x0045, 0x004F, 0x004D, 0x0048, 0x0071, 0x0000
+};
+
+static const UniChar SinhUC1SourceKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x0070,
+    0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x004C, 0x0076, 0x0077, 0x0073, 0x0053, 0x0068, 0x0066,
+    0x0067, 0x006A, 0x0044, 0x0064, 0x0062, 0x006A, 0x0000
+};
+
+static const UniChar SinhUC2SourceKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068, 0x002A, 0x002A, 0x002A,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x006E, 0x0000
+};
+
+static const UniChar SinhUC2SourcePrevKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x0070,
+    0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x004C, 0x0076, 0x0077, 0x0073, 0x0053, 0x0068, 0x0066,
+    0x0067, 0x006A, 0x0044, 0x0064, 0x0062, 0x006A, 0x0000
+};
+
+static const UniChar SinhUC3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar SinhUC3SourcePrevKeys[] = {
+    0x0068, 0x0068, 0x0067, 0x0068, 0x0068, 0x0068, 0x0068, 0x0079, 0x002A, 0x0068, 0x0068, 0x0068,
+    0x0068, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0068, 0x002A, 0x002A, 0x002A,
+    0x0078, 0x0078, 0x0078, 0x0078, 0x0078, 0x006E, 0x0000
+};
+
+static const UniChar SinhUC3SourceFirstKeys[] = {
+    0x006B, 0x0067, 0x006E, 0x0063, 0x006A, 0x0054, 0x0044, 0x006E, 0x004E, 0x0074, 0x0064, 0x0070,
+    0x0062, 0x006D, 0x0079, 0x0072, 0x006C, 0x004C, 0x0076, 0x0077, 0x0073, 0x0053, 0x0068, 0x0066,
+    0x0067, 0x006A, 0x0044, 0x0064, 0x0062, 0x006A, 0x0000
+};
+
+static const UniChar DiacUV1SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x006F, 0x0041, 0x0049, 0x0055, 0x0045, 0x004F, 0x0052, 0x004C,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar DiacUV2SourceKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x006F, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0052, 0x004C,
+    0x004D, 0x002A, 0x0000
+};
+
+static const UniChar DiacUV2SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x006F, 0x0041, 0x0049, 0x0055, 0x0045, 0x004F, 0x0052, 0x004C,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar DiacUV3SourceKeys[] = {
+    0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x002A, 0x002A, 0x0000
+};
+
+static const UniChar DiacUV3SourcePrevKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x006F, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x0052, 0x004C,
+    0x004D, 0x002A, 0x0000
+};
+
+static const UniChar DiacUV3SourceFirstKeys[] = {
+    0x0061, 0x0069, 0x0075, 0x0065, 0x006F, 0x0041, 0x0049, 0x0055, 0x0045, 0x004F, 0x0052, 0x004C,
+    0x004D, 0x0048, 0x0000
+};
+
+static const UniChar DiacUC1SourceKeys[] = {
+    0x0054, 0x0044, 0x0044, 0x004E, 0x0053, 0x007A, 0x0073, 0x006E, 0x006E, 0x006E, 0x0072, 0x006C,
+    0x006B, 0x0067, 0x0079, 0x0000
+};
+
+static const UniChar DiacUC2SourceKeys[] = {
+    0x002A, 0x0068, 0x0078, 0x002A, 0x002A, 0x002A, 0x0068, 0x0067, 0x0079, 0x0078, 0x0078, 0x0078,
+    0x0068, 0x0078, 0x0078, 0x0000
+};
+
+static const UniChar DiacUC2SourcePrevKeys[] = {
+    0x0054, 0x0044, 0x0044, 0x004E, 0x0053, 0x007A, 0x0073, 0x006E, 0x006E, 0x006E, 0x0072, 0x006C,
+    0x006B, 0x0067, 0x0079, 0x0000
+};
+
+static const UniChar DiacUC3SourceKeys[] = {
+    0x002A, 0x0078, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A, 0x002A,
+    0x0078, 0x002A, 0x002A, 0x0000
+};
+
+static const UniChar DiacUC3SourcePrevKeys[] = {
+    0x002A, 0x0068, 0x0078, 0x002A, 0x002A, 0x002A, 0x0068, 0x0067, 0x0079, 0x0078, 0x0078, 0x0078,
+    0x0068, 0x0078, 0x0078, 0x0000
+};
+
+static const UniChar DiacUC3SourceFirstKeys[] = {
+    0x0054, 0x0044, 0x0044, 0x004E, 0x0053, 0x007A, 0x0073, 0x006E, 0x006E, 0x006E, 0x0072, 0x006C,
+    0x006B, 0x0067, 0x0079, 0x0000
+};
+
+const KeyPosHashSource keyPosHashSources[] = {
+    { "DevaUV1", &DevaUV1Hash, DevaUV1SourceKeys, NULL, NULL },
+    { "DevaUV2", &DevaUV2Hash, DevaUV2SourceKeys, DevaUV2SourcePrevKeys, NULL },
+    { "DevaUV3", &DevaUV3Hash, DevaUV3SourceKeys, DevaUV3SourcePrevKeys, DevaUV3SourceFirstKeys },
+    { "DevaUC1", &DevaUC1Hash, DevaUC1SourceKeys, NULL, NULL },
+    { "DevaUC2", &DevaUC2Hash, DevaUC2SourceKeys, DevaUC2SourcePrevKeys, NULL },
+    { "DevaUC3", &DevaUC3Hash, DevaUC3SourceKeys, DevaUC3SourcePrevKeys, DevaUC3SourceFirstKeys },
+    { "DevaUNukta", &DevaUNuktaHash, DevaUNuktaSourceKeys, NULL, NULL },
+    { "MalUV1", &MalUV1Hash, MalUV1SourceKeys, NULL, NULL },
+    { "MalUV2", &MalUV2Hash, MalUV2SourceKeys, MalUV2SourcePrevKeys, NULL },
+    { "MalUV3", &MalUV3Hash, MalUV3SourceKeys, MalUV3SourcePrevKeys, MalUV3SourceFirstKeys },
+    { "MalUC1", &MalUC1Hash, MalUC1SourceKeys, NULL, NULL },
+    { "MalUC2", &MalUC2Hash, MalUC2SourceKeys, MalUC2SourcePrevKeys, NULL },
+    { "MalUC3", &MalUC3Hash, MalUC3SourceKeys, MalUC3SourcePrevKeys, MalUC3SourceFirstKeys },
+    { "KanUV1", &KanUV1Hash, KanUV1SourceKeys, NULL, NULL },
+    { "KanUV2", &KanUV2Hash, KanUV2SourceKeys, KanUV2SourcePrevKeys, NULL },
+    { "KanUV3", &KanUV3Hash, KanUV3SourceKeys, KanUV3SourcePrevKeys, KanUV3SourceFirstKeys },
+    { "KanUC1", &KanUC1Hash, KanUC1SourceKeys, NULL, NULL },
+    { "KanUC2", &KanUC2Hash, KanUC2SourceKeys, KanUC2SourcePrevKeys, NULL },
+    { "KanUC3", &KanUC3Hash, KanUC3SourceKeys, KanUC3SourcePrevKeys, KanUC3SourceFirstKeys },
+    { "TelUV1", &TelUV1Hash, TelUV1SourceKeys, NULL, NULL },
+    { "TelUV2", &TelUV2Hash, TelUV2SourceKeys, TelUV2SourcePrevKeys, NULL },
+    { "TelUV3", &TelUV3Hash, TelUV3SourceKeys, TelUV3SourcePrevKeys, TelUV3SourceFirstKeys },
+    { "TelUC1", &TelUC1Hash, TelUC1SourceKeys, NULL, NULL },
+    { "TelUC2", &TelUC2Hash, TelUC2SourceKeys, TelUC2SourcePrevKeys, NULL },
+    { "TelUC3", &TelUC3Hash, TelUC3SourceKeys, TelUC3SourcePrevKeys, TelUC3SourceFirstKeys },
+    { "GrmkUV1", &GrmkUV1Hash, GrmkUV1SourceKeys, NULL, NULL },
+    { "GrmkUV2", &GrmkUV2Hash, GrmkUV2SourceKeys, GrmkUV2SourcePrevKeys, NULL },
+    { "GrmkUV3", &GrmkUV3Hash, GrmkUV3SourceKeys, GrmkUV3SourcePrevKeys, GrmkUV3SourceFirstKeys },
+    { "GrmkUC1", &GrmkUC1Hash, GrmkUC1SourceKeys, NULL, NULL },
+    { "GrmkUC2", &GrmkUC2Hash, GrmkUC2SourceKeys, GrmkUC2SourcePrevKeys, NULL },
+    { "GrmkUC3", &GrmkUC3Hash, GrmkUC3SourceKeys, GrmkUC3SourcePrevKeys, GrmkUC3SourceFirstKeys },
+    { "GrmkUNukta", &GrmkUNuktaHash, GrmkUNuktaSourceKeys, NULL, NULL },
+    { "AnjalUV1", &AnjalUV1Hash, AnjalUV1SourceKeys, NULL, NULL },
+    { "AnjalUV2", &AnjalUV2Hash, AnjalUV2SourceKeys, AnjalUV2SourcePrevKeys, NULL },
+    { "AnjalUV3", &AnjalUV3Hash, AnjalUV3SourceKeys, AnjalUV3SourcePrevKeys, AnjalUV3SourceFirstKeys },
+    { "AnjalUC1", &AnjalUC1Hash, AnjalUC1SourceKeys, NULL, NULL },
+    { "AnjalUC2", &AnjalUC2Hash, AnjalUC2SourceKeys, AnjalUC2SourcePrevKeys, NULL },
+    { "AnjalUC3", &AnjalUC3Hash, AnjalUC3SourceKeys, AnjalUC3SourcePrevKeys, AnjalUC3SourceFirstKeys },
+    { "BengUV1", &BengUV1Hash, BengUV1SourceKeys, NULL, NULL },
+    { "BengUV2", &BengUV2Hash, BengUV2SourceKeys, BengUV2SourcePrevKeys, NULL },
+    { "BengUV3", &BengUV3Hash, BengUV3SourceKeys, BengUV3SourcePrevKeys, BengUV3SourceFirstKeys },
+    { "BengUC1", &BengUC1Hash, BengUC1SourceKeys, NULL, NULL },
+    { "BengUC2", &BengUC2Hash, BengUC2SourceKeys, BengUC2SourcePrevKeys, NULL },
+    { "BengUC3", &BengUC3Hash, BengUC3SourceKeys, BengUC3SourcePrevKeys, BengUC3SourceFirstKeys },
+    { "BengUNukta", &BengUNuktaHash, BengUNuktaSourceKeys, NULL, NULL },
+    { "GujrUV1", &GujrUV1Hash, GujrUV1SourceKeys, NULL, NULL },
+    { "GujrUV2", &GujrUV2Hash, GujrUV2SourceKeys, GujrUV2SourcePrevKeys, NULL },
+    { "GujrUV3", &GujrUV3Hash, GujrUV3SourceKeys, GujrUV3SourcePrevKeys, GujrUV3SourceFirstKeys },
+    { "GujrUC1", &GujrUC1Hash, GujrUC1SourceKeys, NULL, NULL },
+    { "GujrUC2", &GujrUC2Hash, GujrUC2SourceKeys, GujrUC2SourcePrevKeys, NULL },
+    { "GujrUC3", &GujrUC3Hash, GujrUC3SourceKeys, GujrUC3SourcePrevKeys, GujrUC3SourceFirstKeys },
+    { "OryaUV1", &OryaUV1Hash, OryaUV1SourceKeys, NULL, NULL },
+    { "OryaUV2", &OryaUV2Hash, OryaUV2SourceKeys, OryaUV2SourcePrevKeys, NULL },
+    { "OryaUV3", &OryaUV3Hash, OryaUV3SourceKeys, OryaUV3SourcePrevKeys, OryaUV3SourceFirstKeys },
+    { "OryaUC1", &OryaUC1Hash, OryaUC1SourceKeys, NULL, NULL },
+    { "OryaUC2", &OryaUC2Hash, OryaUC2SourceKeys, OryaUC2SourcePrevKeys, NULL },
+    { "OryaUC3", &OryaUC3Hash, OryaUC3SourceKeys, OryaUC3SourcePrevKeys, OryaUC3SourceFirstKeys },
+    { "OryaUNukta", &OryaUNuktaHash, OryaUNuktaSourceKeys, NULL, NULL },
+    { "SinhUV1", &SinhUV1Hash, SinhUV1SourceKeys, NULL, NULL },
+    { "SinhUV2", &SinhUV2Hash, SinhUV2SourceKeys, SinhUV2SourcePrevKeys, NULL },
+    { "SinhUV3", &SinhUV3Hash, SinhUV3SourceKeys, SinhUV3SourcePrevKeys, SinhUV3SourceFirstKeys },
+    { "SinhUC1", &SinhUC1Hash, SinhUC1SourceKeys, NULL, NULL },
+    { "SinhUC2", &SinhUC2Hash, SinhUC2SourceKeys, SinhUC2SourcePrevKeys, NULL },
+    { "SinhUC3", &SinhUC3Hash, SinhUC3SourceKeys, SinhUC3SourcePrevKeys, SinhUC3SourceFirstKeys },
+    { "DiacUV1", &DiacUV1Hash, DiacUV1SourceKeys, NULL, NULL },
+    { "DiacUV2", &DiacUV2Hash, DiacUV2SourceKeys, DiacUV2SourcePrevKeys, NULL },
+    { "DiacUV3", &DiacUV3Hash, DiacUV3SourceKeys, DiacUV3SourcePrevKeys, DiacUV3SourceFirstKeys },
+    { "DiacUC1", &DiacUC1Hash, DiacUC1SourceKeys, NULL, NULL },
+    { "DiacUC2", &DiacUC2Hash, DiacUC2SourceKeys, DiacUC2SourcePrevKeys, NULL },
+    { "DiacUC3", &DiacUC3Hash, DiacUC3SourceKeys, DiacUC3SourcePrevKeys, DiacUC3SourceFirstKeys },
+};
+
+const int keyPosHashSourceCount = (int)(sizeof(keyPosHashSources) / sizeof(keyPosHashSources[0]));
+#endif
@@ -0,0 +1,94 @@
+// Generated by tools/gen_keypos_hash.py - do not edit.
+
+#ifndef INDIC_KEYPOS_HASH_H
+#define INDIC_KEYPOS_HASH_H
+
+#include "IndicKeyPos.h"
+
+extern const KeyPosHash DevaUV1Hash;
+extern const KeyPosHash DevaUV2Hash;
+extern const KeyPosHash DevaUV3Hash;
+extern const KeyPosHash DevaUC1Hash;
+extern const KeyPosHash DevaUC2Hash;
+extern const KeyPosHash DevaUC3Hash;
+extern const KeyPosHash DevaUNuktaHash;
+extern const KeyPosHash MalUV1Hash;
+extern const KeyPosHash MalUV2Hash;
+extern const KeyPosHash MalUV3Hash;
+extern const KeyPosHash MalUC1Hash;
+extern const KeyPosHash MalUC2Hash;
+extern const KeyPosHash MalUC3Hash;
+extern const KeyPosHash KanUV1Hash;
+extern const KeyPosHash KanUV2Hash;
+extern const KeyPosHash KanUV3Hash;
+extern const KeyPosHash KanUC1Hash;
+extern const KeyPosHash KanUC2Hash;
+extern const KeyPosHash KanUC3Hash;
+extern const KeyPosHash TelUV1Hash;
+extern const KeyPosHash TelUV2Hash;
+extern const KeyPosHash TelUV3Hash;
+extern const KeyPosHash TelUC1Hash;
+extern const KeyPosHash TelUC2Hash;
+extern const KeyPosHash TelUC3Hash;
+extern const KeyPosHash GrmkUV1Hash;
+extern const KeyPosHash GrmkUV2Hash;
+extern const KeyPosHash GrmkUV3Hash;
+extern const KeyPosHash GrmkUC1Hash;
+extern const KeyPosHash GrmkUC2Hash;
+extern const KeyPosHash GrmkUC3Hash;
+extern const KeyPosHash GrmkUNuktaHash;
+extern const KeyPosHash AnjalUV1Hash;
+extern const KeyPosHash AnjalUV2Hash;
+extern const KeyPosHash AnjalUV3Hash;
+extern const KeyPosHash AnjalUC1Hash;
+extern const KeyPosHash AnjalUC2Hash;
+extern const KeyPosHash AnjalUC3Hash;
+extern const KeyPosHash BengUV1Hash;
+extern const KeyPosHash BengUV2Hash;
+extern const KeyPosHash BengUV3Hash;
+extern const KeyPosHash BengUC1Hash;
+extern const KeyPosHash BengUC2Hash;
+extern const KeyPosHash BengUC3Hash;
+extern const KeyPosHash BengUNuktaHash;
+extern const KeyPosHash GujrUV1Hash;
+extern const KeyPosHash GujrUV2Hash;
+extern const KeyPosHash GujrUV3Hash;
+extern const KeyPosHash GujrUC1Hash;
+extern const KeyPosHash GujrUC2Hash;
+extern const KeyPosHash GujrUC3Hash;
+extern const KeyPosHash OryaUV1Hash;
+extern const KeyPosHash OryaUV2Hash;
+extern const KeyPosHash OryaUV3Hash;
+extern const KeyPosHash OryaUC1Hash;
+extern const KeyPosHash OryaUC2Hash;
+extern const KeyPosHash OryaUC3Hash;
+extern const KeyPosHash OryaUNuktaHash;
+extern const KeyPosHash SinhUV1Hash;
+extern const KeyPosHash SinhUV2Hash;
+extern const KeyPosHash SinhUV3Hash;
+extern const KeyPosHash SinhUC1Hash;
+extern const KeyPosHash SinhUC2Hash;
+extern const KeyPosHash SinhUC3Hash;
+extern const KeyPosHash DiacUV1Hash;
+extern const KeyPosHash DiacUV2Hash;
+extern const KeyPosHash DiacUV3Hash;
+extern const KeyPosHash DiacUC1Hash;
+extern const KeyPosHash DiacUC2Hash;
+extern const KeyPosHash DiacUC3Hash;
+
+#ifdef KEYPOS_HASH_SOURCES
+// Every generated table with the key tables it was built from, for
+// tools that check the hashes; not part of the library
+typedef struct {
+    const char*       name;
+    const KeyPosHash* hash;
+    const UniChar*    keys;
+    const UniChar*    prevKeys;     // NULL for single-table lookups
+    const UniChar*    firstKeys;    // NULL unless a three-table lookup
+} KeyPosHashSource;
+
+extern const KeyPosHashSource keyPosHashSources[];
+extern const int keyPosHashSourceCount;
+#endif
+
+#endif // INDIC_KEYPOS_HASH_H
@@ -8,28 +8,32 @@
 
 #include "IndicNotesIMEngine.h"
 #include <ctype.h>
+#include <stdlib.h>
+#include <string.h>
 
-#include "IndicNotesIMEngine.h"
 
+typedef void (*KeyStringFunction)(UniChar currKey, UniChar *s, getKeyStringResults *results);
+
+// Engine for each imeType, indexed from kImeTypeDevanagari
+static const KeyStringFunction keyStringFunctions[] = {
+	[kImeTypeDevanagari - kImeTypeDevanagari] = getKeyStringUnicodeDevanagariAnjal,
+	[kImeTypeTamil      - kImeTypeDevanagari] = getKeyStringUnicodeTamilAnjal,
+	[kImeTypeMalayalam  - kImeTypeDevanagari] = getKeyStringUnicodeMalayalamAnjal,
+	[kImeTypeGurmukhi   - kImeTypeDevanagari] = getKeyStringUnicodeGurmukhiAnjal,
+	[kImeTypeTelugu     - kImeTypeDevanagari] = getKeyStringUnicodeTeluguAnjal,
+	[kImeTypeKannada    - kImeTypeDevanagari] = getKeyStringUnicodeKannadaAnjal,
+	[kImeTypeDiacritic  - kImeTypeDevanagari] = getKeyStringUnicodeDiacritic,
+	[kImeTypeBengali    - kImeTypeDevanagari] = getKeyStringUnicodeBengaliAnjal,
+	[kImeTypeGujarati   - kImeTypeDevanagari] = getKeyStringUnicodeGujaratiAnjal,
+	[kImeTypeOriya      - kImeTypeDevanagari] = getKeyStringUnicodeOriyaAnjal,
+	[kImeTypeSinhala    - kImeTypeDevanagari] = getKeyStringUnicodeSinhalaAnjal,
+};
 
 void  getKeyStringUnicode(UniChar currKey, UniChar *s,  getKeyStringResults *results)
 {
-	// --- Call the appropriate getKeyStringUnicode based on inputMode
-	if ( results->imeType == kImeTypeDevanagari )
-		getKeyStringUnicodeDevanagariAnjal(currKey, s, results);
-	else if ( results->imeType == kImeTypeTamil )
-        // TODO: This was used in the IndicNotes key translator. Check if it can be removed.
-		getKeyStringUnicodeTamilAnjal(currKey, s, results);
-	//else if ( results->imeType == kImeTypeDiacritic )
-	//	getKeyStringUnicodeDiacritic(currKey, s, results);
-	else if ( results->imeType == kImeTypeMalayalam )
-		getKeyStringUnicodeMalayalamAnjal(currKey, s, results);
-	else if ( results->imeType == kImeTypeGurmukhi )
-		getKeyStringUnicodeGurmukhiAnjal(currKey, s, results);
-	else if ( results->imeType == kImeTypeTelugu )
-		getKeyStringUnicodeTeluguAnjal(currKey, s, results);
-	else if ( results->imeType == kImeTypeKannada )
-		getKeyStringUnicodeKannadaAnjal(currKey, s, results);
+	unsigned index = (unsigned)(results->imeType - kImeTypeDevanagari);
+	if ( index < sizeof(keyStringFunctions) / sizeof(keyStringFunctions[0]) && keyStringFunctions[index] )
+		keyStringFunctions[index](currKey, s, results);
 }
 
 int getKeyPos(UniChar key, UniChar table[], UniChar pKey, UniChar pTable[], UniChar fKey,
@@ -103,3 +107,114 @@ void clearResults(getKeyStringResults *results)
     results->contextBefore      = 0;
     //results->aTyped             = 0;
 }
+
+// --- Continuation keys
+//
+// The keymaps differ in their special cases (nukta, chillus, dandas...), so
+// rather than re-deriving each one from its tables, every printable key is
+// run through the engine once per distinct state and the answers are cached.
+// A key continues the composition if it neither fixes the previous one nor
+// leaves the engine outside a composing state (digits, punctuation).
+//
+// The reachable states run to tens of thousands per script, too many to
+// evaluate up front, so each session caches the few it actually visits.
+
+#define CONTINUATION_CACHE_SIZE 256     // power of 2
+
+typedef struct {
+    bool       used;
+    int        imeType;
+    UniChar    prevKey;
+    UniChar    prevKeyType;
+    UniChar    prevCharType;
+    UniChar    firstVowelKey;
+    UniChar    firstConsoKey;
+    UniChar    currentBaseChar;
+    UniChar    contextBefore;
+    KeyMask128 mask;
+} ContinuationCacheEntry;
+
+struct IndicContinuationCache {
+    ContinuationCacheEntry entries[CONTINUATION_CACHE_SIZE];
+};
+
+IndicContinuationCache *indicContinuationCacheCreate(void)
+{
+    return calloc(1, sizeof(IndicContinuationCache));
+}
+
+void indicContinuationCacheDestroy(IndicContinuationCache *cache)
+{
+    free(cache);
+}
+
+static bool sameContinuationState(const ContinuationCacheEntry *e, const getKeyStringResults *r)
+{
+    return e->imeType == r->imeType && e->prevKey == r->prevKey &&
+           e->prevKeyType == r->prevKeyType && e->prevCharType == r->prevCharType &&
+           e->firstVowelKey == r->firstVowelKey && e->firstConsoKey == r->firstConsoKey &&
+           e->currentBaseChar == r->currentBaseChar && e->contextBefore == r->contextBefore;
+}
+
+static KeyMask128 computeContinuationKeys(const getKeyStringResults *results)
+{
+    KeyMask128 mask = keymask_empty();
+    UniChar s[16];
+
+    for (UniChar key = 0x21; key < 0x7F; key++) {
+        getKeyStringResults r = *results;
+        s[0] = 0;
+        getKeyStringUnicode(key, s, &r);
+
+        if (r.fixPrevious)
+            continue;
+        if (r.deleteCount > 0 ||
+            (r.prevKeyType >= FIRST_VOWEL_KEYTYPE && r.prevKeyType <= INDIC_DEAD_KEYTYPE))
+            keymask_set(&mask, key);
+    }
+    return mask;
+}
+
+KeyMask128 getContinuationKeys(IndicContinuationCache *cache, const getKeyStringResults *results)
+{
+    if (!results)
+        return keymask_empty();
+
+    // nothing continues after a finished character or white space
+    if (results->prevKeyType == CHARACTER_END_KEYTYPE || results->prevKeyType == WHITE_SPACE_KEYTYPE)
+        return keymask_empty();
+
+    if (!cache)
+        return computeContinuationKeys(results);
+
+    unsigned h = (unsigned)results->imeType;
+    h = h * 31u + results->prevKey;
+    h = h * 31u + results->prevKeyType;
+    h = h * 31u + results->prevCharType;
+    h = h * 31u + results->firstVowelKey;
+    h = h * 31u + results->firstConsoKey;
+    h = h * 31u + results->currentBaseChar;
+    h = h * 31u + results->contextBefore;
+
+    for (int probe = 0; probe < 8; probe++) {
+        ContinuationCacheEntry *e = &cache->entries[(h + probe) & (CONTINUATION_CACHE_SIZE - 1)];
+        if (e->used && sameContinuationState(e, results))
+            return e->mask;
+        if (!e->used) {
+            e->mask = computeContinuationKeys(results);
+            e->imeType = results->imeType;
+            e->prevKey = results->prevKey;
+            e->prevKeyType = results->prevKeyType;
+            e->prevCharType = results->prevCharType;
+            e->firstVowelKey = results->firstVowelKey;
+            e->firstConsoKey = results->firstConsoKey;
+            e->currentBaseChar = results->currentBaseChar;
+            e->contextBefore = results->contextBefore;
+            e->used = true;
+            return e->mask;
+        }
+    }
+
+    // neighbourhood full - answer without caching
+    return computeContinuationKeys(results);
+}
@@ -0,0 +1,82 @@
+// Anjal phonetic keymap for Oriya (Odia)
+//
+// Follows the Devanagari keymap key for key; sounds Oriya does not encode
+// (short and candra e/o, nnna, rra, llla) are left out, 'w' gives wa and
+// 'Y' gives yya.
+
+
+#include "IndicPhoneticEngine.h"
+
+
+// Lookup tables
+
+// The *Keys tables are input to tools/gen_keypos_hash.py, not compiled: the
+// engine looks them up through IndicKeyPosHash.c, so rerun the generator
+// after changing them. The engine itself is in IndicPhoneticEngine.c, this
+// file only describes the script.
+
+// Vowel keystrokes
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar OryaUV1Keys[] = { 'a','i','u','e','a','o','a',  'R','L','A','I','U',  'M','H','q','Q','O','E', 0 };  // first keystroke
+static UniChar OryaUV2Keys[] = { 'a','i','u','*','i','*','u',  'r','l','*','*','*',  '*','*','q','*','*','*', 0 };  // second keystroke
+static UniChar OryaUV3Keys[] = { '*','*','*','*','*','*','*',  '*','*','*','*','*',  '*','*','q','*','*','*', 0 };  // third keystroke
+#endif
+
+// vowel chars
+static UniChar OryaUV1Char[] = { 0x0B05,0x0B07,0x0B09,0x0B0F,0x0B05,0x0B13,0x0B05, 0x0B0B,0x0B0C,0x0B06,0x0B08,0x0B0A, 0x0B02,0x0B03,0x0B4D,0x0B01,0x0B13,0x0B0F };  // first keystroke
+static UniChar OryaUV2Char[] = { 0x0B06,0x0B08,0x0B0A,0x0B00,0x0B10,0x0B00,0x0B14, 0x0B60,0x0B61,0x0B00,0x0B00,0x0B00, 0x0B00,0x0B00,0x0B3C,0x0B00,0x0B00,0x0B00 };  // second keystroke
+static UniChar OryaUV3Char[] = { 0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00, 0x0B00,0x0B00,0x0B00,0x0B00,0x0B00, 0x0B00,0x0B00,0x0B01,0x0B00,0x0B00,0x0B00 };  // third keystroke
+
+// vowel sign chars
+static UniChar OryaUVS1Char[]= { 0x0008,0x0B3F,0x0B41,0x0B47,0x0008,0x0B4B,0x0008, 0x0B43,0x0B62,0x0B3E,0x0B40,0x0B42, 0x0B02,0x0B03,0x0B4D,0x0B01,0x0B4B,0x0B47 };  // first keystroke
+static UniChar OryaUVS2Char[]= { 0x0B3E,0x0B40,0x0B42,0x0B00,0x0B48,0x0B00,0x0B4C, 0x0B44,0x0B63,0x0B00,0x0B00,0x0B00, 0x0B00,0x0B00,0x0B3C,0x0B00,0x0B00,0x0B00 };  // second keystroke
+static UniChar OryaUVS3Char[]= { 0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00, 0x0B00,0x0B00,0x0B00,0x0B00,0x0B00, 0x0B00,0x0B00,0x0B01,0x0B00,0x0B00,0x0B00 };  // third keystroke
+
+// conso keystrokes
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar OryaUC1Keys[] = { 'k','g','n','c','j','T','D','n','N',  't','d','n','p','b','m','y','r',  'l','z','v','s','S','h',  'w','Y', 0 };
+static UniChar OryaUC2Keys[] = { 'h','h','g','h','h','h','h','y','*',  'h','h','*','h','h','*','*','*',  'l','*','*','h','*','*',  '*','*', 0 };
+static UniChar OryaUC3Keys[] = { '*','*','*','*','*','*','*','*','*',  '*','*','*','*','*','*','*','*',  '*','*','*','*','*','*',  '*','*', 0 };
+#endif
+
+// conso chars
+static UniChar OryaUC1Char[] = { 0x0B15,0x0B17,0x0B28,0x0B1A,0x0B1C,0x0B1F,0x0B21,0x0B28,0x0B23,  0x0B24,0x0B26,0x0B28,0x0B2A,0x0B2C,0x0B2E,0x0B2F,0x0B30,  0x0B32,0x0B36,0x0B35,0x0B38,0x0B37,0x0B39,  0x0B71,0x0B5F, 0};
+static UniChar OryaUC2Char[] = { 0x0B16,0x0B18,0x0B19,0x0B1B,0x0B1D,0x0B20,0x0B22,0x0B1E,0x0B00,  0x0B25,0x0B27,0x0B00,0x0B2B,0x0B2D,0x0B00,0x0B00,0x0B00,  0x0B33,0x0B00,0x0B00,0x0B36,0x0B00,0x0B00,  0x0B00,0x0B00, 0};
+static UniChar OryaUC3Char[] = { 0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,  0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,  0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,0x0B00,  0x0B00,0x0B00, 0};
+
+// numeric keystrokes
+static UniChar OryaUNChar[] = {0x0B66,0x0B67,0x0B68,0x0B69,0x0B6A,0x0B6B,0x0B6C,0x0B6D,0x0B6E,0x0B6F};
+
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar OryaUNuktaBase[] = {0x0B21,0x0B22}; // base chars whose nukta forms are encoded
+#endif
+static UniChar OryaUNuktaForm[] = {0x0B5C,0x0B5D}; // corresponding nukta forms
+
+const IndicScript indicScriptOriya = {
+    .name = "Oriya",
+    .imeType = kImeTypeOriya,
+    .flags = INDIC_TRACKS_BASE_CHAR | INDIC_RESETS_ON_OTHER_KEYS | INDIC_EARLY_AVAGRAHA,
+    .vowelKeys = { &OryaUV1Hash, &OryaUV2Hash, &OryaUV3Hash },
+    .vowelChar = { OryaUV1Char, OryaUV2Char, OryaUV3Char },
+    .vowelSignChar = { OryaUVS1Char, OryaUVS2Char, OryaUVS3Char },
+    .consoKeys = { &OryaUC1Hash, &OryaUC2Hash, &OryaUC3Hash },
+    .consoChar = { OryaUC1Char, OryaUC2Char, OryaUC3Char },
+    .digits = OryaUNChar,
+    .danda = 0x0964,        // the danda is shared with Devanagari
+    .doubleDanda = 0x0965,
+    .avagrahaKey = '#',
+    .avagrahaChar = 0x0B3D,
+    .nuktaKey = 'q',        // qq
+    .nuktaBase = &OryaUNuktaHash,
+    .nuktaForm = OryaUNuktaForm,
+};
+
+void getKeyStringUnicodeOriyaAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results)
+{
+    indicPhoneticGetKeyString(&indicScriptOriya, currKey, s, results);
+}
+
+void startNewSessionOriyaAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results)
+{
+    indicPhoneticStartNewSession(&indicScriptOriya, currKey, s, results);
+}
@@ -0,0 +1,334 @@
+//
+//  IndicPhoneticEngine.c
+//
+//  The Anjal phonetic state machine, shared by every Indic script. It used
+//  to be repeated in each Indic*Keymap.c around that script's tables; the
+//  keymaps now only describe their script (see IndicPhoneticEngine.h).
+//
+
+#include "IndicPhoneticEngine.h"
+#include <ctype.h>
+#include <string.h>
+
+static void setText(UniChar* s, const UniChar* text, int length)
+{
+    memcpy(s, text, length * sizeof(UniChar));
+    s[length] = '\0';
+}
+
+static void applyExpansion(const IndicScript* script, UniChar state, UniChar* s,
+                           getKeyStringResults* results)
+{
+    for (int i = 0; i < script->expansionCount; i++) {
+        const IndicExpansion* e = &script->expansions[i];
+        if (e->state != state || s[0] != e->placeholder)
+            continue;
+        int length = 0;
+        while (length < INDIC_RULE_TEXT_MAX && e->text[length]) length++;
+        setText(s, e->text, length);
+        results->insertCount = length;
+        if (e->deleteCount >= 0)
+            results->deleteCount = e->deleteCount;
+        return;
+    }
+}
+
+static bool applySpecialRule(const IndicScript* script, UniChar currKey, UniChar* s,
+                             getKeyStringResults* results)
+{
+    for (int i = 0; i < script->ruleCount; i++) {
+        const IndicSpecialRule* r = &script->rules[i];
+        if (r->state != results->prevKeyType || r->key != currKey || r->prevKey != results->prevKey)
+            continue;
+        if (r->firstKey && r->firstKey != results->firstConsoKey)
+            continue;
+        int length = 0;
+        while (length < INDIC_RULE_TEXT_MAX && r->text[length]) length++;
+        setText(s, r->text, length);
+        results->insertCount = r->insertCount;
+        results->deleteCount = r->deleteCount;
+        results->prevKeyType = r->nextState;
+        return true;
+    }
+    return false;
+}
+
+// Digits, danda and (for some scripts) avagraha do not take part in
+// composition and are answered before the state machine.
+static bool handleEarlyKey(const IndicScript* script, UniChar currKey, UniChar* s,
+                           getKeyStringResults* results)
+{
+    if (script->digits && isdigit((int)currKey)) {
+        s[0] = script->digits[currKey - '0'];
+        results->deleteCount = 0;
+    } else if (script->danda && currKey == '|') {
+        s[0] = results->prevKey == '|' ? script->doubleDanda : script->danda;
+        results->deleteCount = results->prevKey == '|' ? 1 : 0;
+    } else if ((script->flags & INDIC_EARLY_AVAGRAHA) && currKey == script->avagrahaKey) {
+        s[0] = script->avagrahaChar;
+        results->deleteCount = 0;
+    } else {
+        return false;
+    }
+
+    s[1] = '\0';
+    results->insertCount = 1;
+    results->prevKeyType = NON_INDIC_CHARTYPE;
+    results->prevKey = currKey;
+    results->currentBaseChar = 0;
+    return true;
+}
+
+// A vowel key after a consonant: send its sign, or nothing for 'a'
+static void sendVowelSign(const IndicScript* script, int vpos, UniChar currKey, UniChar* s,
+                          getKeyStringResults* results)
+{
+    if (currKey != 'a') {
+        s[0] = script->vowelSignChar[0][vpos];
+        s[1] = '\0';
+        results->insertCount = 1;
+    } else {
+        s[0] = '\0';    // nothing happens with akaram
+        results->insertCount = 0;
+    }
+    // the vowel sign replaces the virama that was sent with the consonant
+    results->deleteCount = script->virama ? 1 : 0;
+    results->prevKeyType = FIRST_VOWELSIGN_KEYTYPE;
+}
+
+// A second or third consonant key replacing the consonant before it
+static void sendConsonant(const IndicScript* script, UniChar currKey, UniChar ch, int stage, UniChar* s,
+                          getKeyStringResults* results)
+{
+    if (script->flags & INDIC_TRACKS_BASE_CHAR)
+        results->currentBaseChar = ch;
+
+    s[0] = ch;
+    if (script->virama) {
+        s[1] = script->virama;
+        s[2] = '\0';
+        results->insertCount = 2;
+        results->deleteCount = 2;   // the previous consonant and its virama
+        if (stage == SECOND_CONSO_KEYTYPE && currKey == script->chilluKey) {
+            s[1] = '\0';               // chillus are final forms, no virama
+            results->insertCount = 1;
+        } else if (stage == SECOND_CONSO_KEYTYPE && (script->flags & INDIC_SECOND_CONSO_DROPS_VIRAMA)) {
+            results->insertCount = 1;
+        }
+    } else {
+        s[1] = '\0';
+        results->insertCount = 1;
+        results->deleteCount = 1;
+    }
+    results->prevKeyType = stage;
+    applyExpansion(script, stage, s, results);
+}
+
+void indicPhoneticGetKeyString(const IndicScript* script, UniChar currKey, UniChar* s,
+                               getKeyStringResults* results)
+{
+    int vpos;
+    bool contextReplaced = false;
+
+    // Assume no conversions are going to be done
+    results->deleteCount = 0;
+    results->insertCount = 0;
+    results->fixPrevious = false;
+
+    if (handleEarlyKey(script, currKey, s, results))
+        return;
+
+    if (script->contextKey && currKey == script->contextKey &&
+        results->contextBefore >= script->contextFirst && results->contextBefore <= script->contextLast) {
+        currKey = script->contextReplacement;
+        contextReplaced = true;
+    }
+
+    if (applySpecialRule(script, currKey, s, results)) {
+        results->prevKey = contextReplaced ? script->contextKey : currKey;
+        return;
+    }
+
+    switch (results->prevKeyType) {
+        case FIRST_VOWEL_KEYTYPE:
+        case FIRST_VOWELSIGN_KEYTYPE:
+            // nukta typed after a consonant with a precomposed nukta form
+            if (script->nuktaBase && currKey == script->nuktaKey && results->prevKey == script->nuktaKey) {
+                vpos = keyPosLookup(script->nuktaBase, results->currentBaseChar, 0, 0);
+                if (vpos >= 0) {
+                    results->currentBaseChar = script->nuktaForm[vpos];
+                    s[0] = results->currentBaseChar;
+                    s[1] = '\0';
+                    results->insertCount = 1;
+                    results->prevKeyType = SECOND_VOWEL_KEYTYPE;
+                    results->deleteCount = 2;   // the first nukta key sent a virama
+                    break;
+                }
+            }
+
+            if ((vpos = keyPosLookup(script->vowelKeys[1], currKey, results->prevKey, 0)) >= 0) {
+                // a second vowel key - replace the previous vowel (sign)
+                if (results->prevKeyType == FIRST_VOWEL_KEYTYPE) {
+                    s[0] = script->vowelChar[1][vpos];
+                    results->prevKeyType = SECOND_VOWEL_KEYTYPE;
+                    results->deleteCount = 1;
+                } else {
+                    s[0] = script->vowelSignChar[1][vpos];
+                    results->prevKeyType = SECOND_VOWELSIGN_KEYTYPE;
+                    // 'a' after a consonant sent nothing, so there is nothing to replace
+                    if (script->flags & INDIC_SIGN_AFTER_A_KEEPS)
+                        results->deleteCount = results->prevKey == 'a' ? 0 : 1;
+                    else if (currKey == 'a' || (results->prevKey == 'a' && (currKey == 'i' || currKey == 'u')))
+                        results->deleteCount = 0;
+                    else
+                        results->deleteCount = 1;
+                }
+                s[1] = '\0';
+                results->insertCount = 1;
+                break;
+            }
+
+            indicPhoneticStartNewSession(script, currKey, s, results);
+            break;
+
+        case SECOND_VOWEL_KEYTYPE:
+        case SECOND_VOWELSIGN_KEYTYPE:
+            if ((vpos = keyPosLookup(script->vowelKeys[2], currKey, results->prevKey, results->firstVowelKey)) >= 0) {
+                // a third vowel key - replace the previous vowel (sign)
+                if (results->prevKeyType == SECOND_VOWEL_KEYTYPE) {
+                    s[0] = script->vowelChar[2][vpos];
+                    results->prevKeyType = THIRD_VOWEL_KEYTYPE;
+                } else {
+                    s[0] = script->vowelSignChar[2][vpos];
+                    results->prevKeyType = THIRD_VOWELSIGN_KEYTYPE;
+                }
+                s[1] = '\0';
+                results->insertCount = 1;
+                results->deleteCount = 1;
+                results->prevCharType = VOWEL_CHARTYPE;
+                break;
+            }
+
+            indicPhoneticStartNewSession(script, currKey, s, results);
+            break;
+
+        case FIRST_CONSO_KEYTYPE:
+            if ((vpos = keyPosLookup(script->consoKeys[1], currKey, results->prevKey, 0)) >= 0)
+                sendConsonant(script, currKey, script->consoChar[1][vpos], SECOND_CONSO_KEYTYPE, s, results);
+            else if ((vpos = keyPosLookup(script->vowelKeys[0], currKey, 0, 0)) >= 0)
+                sendVowelSign(script, vpos, currKey, s, results);
+            else
+                indicPhoneticStartNewSession(script, currKey, s, results);
+            break;
+
+        case SECOND_CONSO_KEYTYPE:
+            if ((vpos = keyPosLookup(script->consoKeys[2], currKey, results->prevKey, results->firstConsoKey)) >= 0)
+                sendConsonant(script, currKey, script->consoChar[2][vpos], THIRD_CONSO_KEYTYPE, s, results);
+            else if ((vpos = keyPosLookup(script->vowelKeys[0], currKey, 0, 0)) >= 0)
+                sendVowelSign(script, vpos, currKey, s, results);
+            else
+                indicPhoneticStartNewSession(script, currKey, s, results);
+            break;
+
+        case THIRD_CONSO_KEYTYPE:
+            if ((vpos = keyPosLookup(script->vowelKeys[0], currKey, 0, 0)) >= 0)
+                sendVowelSign(script, vpos, currKey, s, results);
+            else
+                indicPhoneticStartNewSession(script, currKey, s, results);
+            break;
+
+        default:
+            // CHARACTER_END_KEYTYPE and anything else: the previous character is complete
+            indicPhoneticStartNewSession(script, currKey, s, results);
+            break;
+    }
+
+    results->prevKey = contextReplaced ? script->contextKey : currKey;
+}
+
+void indicPhoneticStartNewSession(const IndicScript* script, UniChar currKey, UniChar* s,
+                                  getKeyStringResults* results)
+{
+    int vpos;
+
+    if ((vpos = keyPosLookup(script->consoKeys[0], currKey, 0, 0)) >= 0) {
+        int i = 0;
+
+        // a consonant starts a new composition
+        if (currKey == script->wordInitialKey && results->prevKey != BACKSPACEKEY &&
+            (results->prevKeyType == 0 || results->prevKeyType == WHITE_SPACE_KEYTYPE))
+            s[i++] = script->wordInitialChar;
+        else
+            s[i++] = script->consoChar[0][vpos];
+        if (script->flags & INDIC_TRACKS_BASE_CHAR)
+            results->currentBaseChar = s[0];
+        if (script->virama)
+            s[i++] = script->virama;
+        s[i] = '\0';
+
+        results->insertCount = i;
+        results->deleteCount = 0;
+        results->prevKeyType = FIRST_CONSO_KEYTYPE;
+        results->prevCharType = CONSO_CHARTYPE;
+        results->firstConsoKey = currKey;
+        results->fixPrevious = true;    // the start of a new composition fixes the previous one
+        applyExpansion(script, FIRST_CONSO_KEYTYPE, s, results);
+
+    } else if ((vpos = keyPosLookup(script->vowelKeys[0], currKey, 0, 0)) >= 0) {
+        s[0] = script->vowelChar[0][vpos];
+        s[1] = '\0';
+
+        results->insertCount = 1;
+        results->deleteCount = 0;
+        results->prevKeyType = FIRST_VOWEL_KEYTYPE;
+        results->prevCharType = VOWEL_CHARTYPE;
+        results->firstVowelKey = currKey;
+        results->fixPrevious = true;    // independent vowels fix the previous composition
+        if (script->flags & INDIC_TRACKS_BASE_CHAR)
+            results->currentBaseChar = '\0';
+
+    } else {
+        // out-of-matrix key
+        if (script->flags & INDIC_RESETS_ON_OTHER_KEYS)
+            clearResults(results);
+
+        results->firstConsoKey = 0;
+        results->prevKeyType = CHARACTER_END_KEYTYPE;
+        results->prevCharType = NON_INDIC_CHARTYPE;
+        results->deleteCount = 0;
+        results->fixPrevious = true;    // non convertible characters fix the previous composition
+        results->prevKey = currKey;
+
+        if (script->avagrahaKey && currKey == script->avagrahaKey) {
+            s[0] = script->avagrahaChar;
+            s[1] = '\0';
+            results->insertCount = 1;
+        } else if (isalpha(currKey)) {
+            // Don't send Roman alphabets while in Indic mode
+            results->insertCount = 0;
+        } else {
+            s[0] = currKey;
+            s[1] = '\0';
+            results->insertCount = 1;
+            if ((script->flags & INDIC_RESETS_ON_OTHER_KEYS) && isspace(currKey))
+                results->prevKeyType = WHITE_SPACE_KEYTYPE;
+        }
+    }
+}
+
+const IndicScript* indicScriptForImeType(int imeType)
+{
+    switch (imeType) {
+        case kImeTypeDevanagari:    return &indicScriptDevanagari;
+        case kImeTypeTamil:         return &indicScriptTamil;
+        case kImeTypeMalayalam:     return &indicScriptMalayalam;
+        case kImeTypeGurmukhi:      return &indicScriptGurmukhi;
+        case kImeTypeTelugu:        return &indicScriptTelugu;
+        case kImeTypeKannada:       return &indicScriptKannada;
+        case kImeTypeBengali:       return &indicScriptBengali;
+        case kImeTypeGujarati:      return &indicScriptGujarati;
+        case kImeTypeOriya:         return &indicScriptOriya;
+        case kImeTypeSinhala:       return &indicScriptSinhala;
+        default:                    return NULL;
+    }
+}
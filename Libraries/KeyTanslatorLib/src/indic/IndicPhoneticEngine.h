@@ -0,0 +1,125 @@
+#ifndef INDIC_PHONETIC_ENGINE_H
+#define INDIC_PHONETIC_ENGINE_H
+
+// Table-driven Anjal phonetic engine shared by every Indic script.
+//
+// A script is described by an IndicScript: its vowel and consonant key
+// tables (compiled to perfect hashes, see IndicKeyPos.h) with the characters
+// they produce, the out-of-matrix keys (digits, danda, avagraha, nukta) and
+// the few script specific rules. indicPhoneticGetKeyString() runs the same
+// state machine for all of them.
+
+#include "IndicNotesIMEngine.h"
+#include "IndicKeyPosHash.h"
+
+// --- IndicScript.flags
+
+// currentBaseChar follows the consonant being composed (needed for nukta)
+#define INDIC_TRACKS_BASE_CHAR          0x0001
+// keys outside the matrix reset the composition state; white space is
+// reported as WHITE_SPACE_KEYTYPE
+#define INDIC_RESETS_ON_OTHER_KEYS      0x0002
+// the avagraha key is handled before the state machine, like digits
+#define INDIC_EARLY_AVAGRAHA            0x0004
+// a second vowel sign typed after 'a' never deletes (the 'a' sent nothing);
+// otherwise only 'aa', 'ai' and 'au' keep the previous text
+#define INDIC_SIGN_AFTER_A_KEEPS        0x0008
+// second consonants report only the consonant, not the virama written after
+// it (legacy Kannada behaviour, kept so existing text edits stay the same)
+#define INDIC_SECOND_CONSO_DROPS_VIRAMA 0x0010
+
+#define INDIC_RULE_TEXT_MAX 5
+
+// Replaces the regular lookup when the state, keys and (optionally) the
+// first consonant key match.
+typedef struct {
+    UniChar state;              // prevKeyType the rule applies in
+    UniChar firstKey;           // firstConsoKey, 0 = any
+    UniChar prevKey;
+    UniChar key;
+    UniChar text[INDIC_RULE_TEXT_MAX];
+    int8_t  insertCount;
+    int8_t  deleteCount;
+    UniChar nextState;
+} IndicSpecialRule;
+
+// A placeholder in a consonant table that stands for a longer sequence
+typedef struct {
+    UniChar placeholder;
+    UniChar state;              // FIRST/SECOND/THIRD_CONSO_KEYTYPE it is produced in
+    UniChar text[INDIC_RULE_TEXT_MAX];
+    int8_t  deleteCount;        // -1 keeps the regular delete count
+} IndicExpansion;
+
+typedef struct {
+    const char* name;
+    int         imeType;
+    unsigned    flags;
+
+    // vowel keystrokes: independent vowels and vowel signs, 1st..3rd key
+    const KeyPosHash* vowelKeys[3];
+    const UniChar*    vowelChar[3];
+    const UniChar*    vowelSignChar[3];
+
+    // consonant keystrokes, 1st..3rd key
+    const KeyPosHash* consoKeys[3];
+    const UniChar*    consoChar[3];
+
+    // written after every consonant so it shows as a dead consonant, and
+    // removed again by the vowel sign; 0 for scripts showing the inherent vowel
+    UniChar virama;
+    // second consonant key producing a chillu, which takes no virama
+    UniChar chilluKey;
+
+    // out-of-matrix keys; 0 / NULL where the script has none
+    const UniChar* digits;      // for '0'..'9'
+    UniChar danda;              // '|', a second '|' turns it into doubleDanda
+    UniChar doubleDanda;
+    UniChar avagrahaKey;
+    UniChar avagrahaChar;
+
+    // nukta: nuktaKey typed twice after a consonant with a precomposed form
+    UniChar           nuktaKey;
+    const KeyPosHash* nuktaBase;
+    const UniChar*    nuktaForm;
+
+    // a consonant started by wordInitialKey at the start of a word uses
+    // wordInitialChar (Tamil dental na)
+    UniChar wordInitialKey;
+    UniChar wordInitialChar;
+
+    // contextKey typed after a character in contextFirst..contextLast is
+    // treated as contextReplacement (Tamil 'n' after editing is alveolar)
+    UniChar contextKey;
+    UniChar contextReplacement;
+    UniChar contextFirst;
+    UniChar contextLast;
+
+    const IndicSpecialRule* rules;
+    int                     ruleCount;
+    const IndicExpansion*   expansions;
+    int                     expansionCount;
+} IndicScript;
+
+// Process one key for script. Same contract as getKeyStringUnicode().
+void indicPhoneticGetKeyString(const IndicScript* script, UniChar currKey, UniChar* s,
+                               getKeyStringResults* results);
+void indicPhoneticStartNewSession(const IndicScript* script, UniChar currKey, UniChar* s,
+                                  getKeyStringResults* results);
+
+// Script descriptors, defined in the Indic*Keymap.c files
+extern const IndicScript indicScriptDevanagari;
+extern const IndicScript indicScriptTamil;
+extern const IndicScript indicScriptMalayalam;
+extern const IndicScript indicScriptGurmukhi;
+extern const IndicScript indicScriptTelugu;
+extern const IndicScript indicScriptKannada;
+extern const IndicScript indicScriptBengali;
+extern const IndicScript indicScriptGujarati;
+extern const IndicScript indicScriptOriya;
+extern const IndicScript indicScriptSinhala;
+
+// Descriptor for an imeType, NULL if it is not a phonetic script
+const IndicScript* indicScriptForImeType(int imeType);
+
+#endif // INDIC_PHONETIC_ENGINE_H
@@ -0,0 +1,217 @@
+// Packed engine sessions and the session pool
+//
+// The pool is one allocation holding two parallel arrays: the 16 byte states
+// the keystroke loop works on, and the free list, which is only touched when
+// sessions open and close. A keystroke reads and writes a single state - the
+// id check uses the generation kept inside it - and four states share a cache
+// line. A batch unpacks each state into a getKeyStringResults on the stack
+// just for the engine call.
+
+
+#include "IndicSessionPool.h"
+#include <stdlib.h>
+#include <string.h>
+
+
+#define SLOT_BITS           24
+#define SLOT_MASK           ((1u << SLOT_BITS) - 1)
+#define CLOSED_IME_INDEX    0xFF
+
+// Engines that a session can be opened with
+#define IME_INDEX_COUNT     (kImeTypeSinhala - kImeTypeDevanagari + 1)
+
+_Static_assert(sizeof(IndicSessionState) == 16, "IndicSessionState must stay 16 bytes");
+
+struct IndicSessionPool {
+    IndicSessionState* states;          // generation is bumped on close so stale ids are refused
+    uint32_t*          nextFree;
+    uint32_t           capacity;
+    uint32_t           freeHead;        // capacity when the pool is full
+    uint32_t           size;
+};
+
+static inline uint16_t narrow(UniChar c)
+{
+    return (uint32_t)c > 0xFFFF ? INDIC_SESSION_NON_BMP : (uint16_t)c;
+}
+
+void indic_session_state_pack(IndicSessionState* state, const getKeyStringResults* results)
+{
+    state->prevKey         = narrow(results->prevKey);
+    state->firstVowelKey   = narrow(results->firstVowelKey);
+    state->firstConsoKey   = narrow(results->firstConsoKey);
+    state->currentBaseChar = narrow(results->currentBaseChar);
+    state->contextBefore   = narrow(results->contextBefore);
+    state->prevKeyType     = (uint8_t)results->prevKeyType;
+    state->prevCharType    = (uint8_t)results->prevCharType;
+    state->imeIndex        = (uint8_t)(results->imeType - kImeTypeDevanagari);
+    state->fixPrevious     = results->fixPrevious;
+}
+
+void indic_session_state_unpack(getKeyStringResults* results, const IndicSessionState* state)
+{
+    results->prevKey         = state->prevKey;
+    results->firstVowelKey   = state->firstVowelKey;
+    results->firstConsoKey   = state->firstConsoKey;
+    results->currentBaseChar = state->currentBaseChar;
+    results->contextBefore   = state->contextBefore;
+    results->prevKeyType     = state->prevKeyType;
+    results->prevCharType    = state->prevCharType;
+    results->imeType         = state->imeIndex + kImeTypeDevanagari;
+    results->insertCount     = 0;
+    results->deleteCount     = 0;
+    results->fixPrevious     = state->fixPrevious;
+}
+
+// Clear everything but the slot's generation
+static void resetState(IndicSessionState* state, uint8_t imeIndex)
+{
+    uint8_t generation = state->generation;
+    memset(state, 0, sizeof(*state));
+    state->imeIndex = imeIndex;
+    state->generation = generation;
+}
+
+IndicSessionPool* indic_session_pool_create(size_t capacity)
+{
+    if (capacity == 0 || capacity > SLOT_MASK)
+        return NULL;
+
+    // states first: the slab comes from malloc, so they are 16 byte aligned
+    // and never straddle a cache line
+    size_t statesSize = capacity * sizeof(IndicSessionState);
+    size_t nextFreeSize = capacity * sizeof(uint32_t);
+    IndicSessionPool* pool = malloc(sizeof(IndicSessionPool));
+    char* slab = malloc(statesSize + nextFreeSize);
+    if (!pool || !slab) {
+        free(pool);
+        free(slab);
+        return NULL;
+    }
+
+    pool->states = (IndicSessionState*)slab;
+    pool->nextFree = (uint32_t*)(slab + statesSize);
+    pool->capacity = (uint32_t)capacity;
+    pool->freeHead = 0;
+    pool->size = 0;
+
+    memset(pool->states, 0, statesSize);
+    for (uint32_t i = 0; i < pool->capacity; i++) {
+        pool->states[i].imeIndex = CLOSED_IME_INDEX;
+        pool->nextFree[i] = i + 1;
+    }
+    return pool;
+}
+
+void indic_session_pool_destroy(IndicSessionPool* pool)
+{
+    if (!pool)
+        return;
+    free(pool->states);
+    free(pool);
+}
+
+size_t indic_session_pool_size(const IndicSessionPool* pool)
+{
+    return pool->size;
+}
+
+// The state of an open session, or NULL if the id is stale or invalid
+static inline IndicSessionState* sessionState(const IndicSessionPool* pool, IndicSessionId session)
+{
+    uint32_t slot = session & SLOT_MASK;
+    if (slot >= pool->capacity)
+        return NULL;
+    IndicSessionState* state = &pool->states[slot];
+    if (state->generation != (uint8_t)(session >> SLOT_BITS) || state->imeIndex == CLOSED_IME_INDEX)
+        return NULL;
+    return state;
+}
+
+IndicSessionId indic_session_open(IndicSessionPool* pool, int imeType)
+{
+    unsigned imeIndex = (unsigned)(imeType - kImeTypeDevanagari);
+    if (imeIndex >= IME_INDEX_COUNT || pool->freeHead == pool->capacity)
+        return INDIC_SESSION_INVALID;
+
+    uint32_t slot = pool->freeHead;
+    pool->freeHead = pool->nextFree[slot];
+    pool->size++;
+    resetState(&pool->states[slot], (uint8_t)imeIndex);
+    return slot | (uint32_t)pool->states[slot].generation << SLOT_BITS;
+}
+
+void indic_session_close(IndicSessionPool* pool, IndicSessionId session)
+{
+    IndicSessionState* state = sessionState(pool, session);
+    if (!state)
+        return;
+
+    uint32_t slot = session & SLOT_MASK;
+    state->imeIndex = CLOSED_IME_INDEX;
+    state->generation++;
+    pool->nextFree[slot] = pool->freeHead;
+    pool->freeHead = slot;
+    pool->size--;
+}
+
+void indic_session_reset(IndicSessionPool* pool, IndicSessionId session)
+{
+    IndicSessionState* state = sessionState(pool, session);
+    if (state)
+        resetState(state, state->imeIndex);
+}
+
+bool indic_session_get_state(const IndicSessionPool* pool, IndicSessionId session, IndicSessionState* state)
+{
+    const IndicSessionState* current = sessionState(pool, session);
+    if (!current)
+        return false;
+    *state = *current;
+    return true;
+}
+
+bool indic_session_set_state(IndicSessionPool* pool, IndicSessionId session, const IndicSessionState* state)
+{
+    IndicSessionState* current = sessionState(pool, session);
+    if (!current || state->imeIndex >= IME_INDEX_COUNT)
+        return false;
+    uint8_t generation = current->generation;
+    *current = *state;
+    current->generation = generation;
+    return true;
+}
+
+size_t indic_session_process(IndicSessionPool* pool,
+                             const IndicKeystroke* keystrokes,
+                             size_t count,
+                             IndicKeystrokeResult* results)
+{
+    size_t processed = 0;
+
+    for (size_t i = 0; i < count; i++) {
+        IndicKeystrokeResult* out = &results[i];
+        IndicSessionState* state = sessionState(pool, keystrokes[i].session);
+        if (!state) {
+            memset(out, 0, sizeof(*out));
+            continue;
+        }
+
+        // the engine writes at most INDIC_RULE_TEXT_MAX characters and a
+        // terminator; the scratch buffer leaves room for keymaps that grow
+        UniChar text[2 * INDIC_SESSION_MAX_TEXT];
+        getKeyStringResults session;
+        indic_session_state_unpack(&session, state);
+        session.contextBefore = keystrokes[i].contextBefore;
+        getKeyStringUnicode(keystrokes[i].key, text, &session);
+        indic_session_state_pack(state, &session);
+
+        int length = session.insertCount < INDIC_SESSION_MAX_TEXT ? session.insertCount : INDIC_SESSION_MAX_TEXT;
+        out->insertCount = (uint8_t)length;
+        out->deleteCount = (uint8_t)session.deleteCount;
+        out->fixPrevious = session.fixPrevious;
+        memcpy(out->text, text, length * sizeof(UniChar));
+        processed++;
+    }
+    return processed;
+}
@@ -0,0 +1,68 @@
+// Anjal phonetic keymap for Sinhala
+//
+// Consonants carry their inherent vowel as in Devanagari; 'q' writes the
+// al-lakuna. "ae" / "Ae" give ae / aae, and a consonant followed by 'x'
+// gives its prenasalised (sanyaka) letter: gx, jx, Dx, dx, bx.
+
+
+#include "IndicPhoneticEngine.h"
+
+
+// Lookup tables
+
+// The *Keys tables are input to tools/gen_keypos_hash.py, not compiled: the
+// engine looks them up through IndicKeyPosHash.c, so rerun the generator
+// after changing them. The engine itself is in IndicPhoneticEngine.c, this
+// file only describes the script.
+
+// Vowel keystrokes
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar SinhUV1Keys[] = { 'a','a','i','u','e','a','o','a',  'R','A','I','U','E','O',  'M','H','q', 0 };  // first keystroke
+static UniChar SinhUV2Keys[] = { 'a','e','i','u','e','i','o','u',  'R','e','*','*','*','*',  '*','*','*', 0 };  // second keystroke
+static UniChar SinhUV3Keys[] = { '*','*','*','*','*','*','*','*',  '*','*','*','*','*','*',  '*','*','*', 0 };  // third keystroke
+#endif
+
+// vowel chars
+static UniChar SinhUV1Char[] = { 0x0D85,0x0D85,0x0D89,0x0D8B,0x0D91,0x0D85,0x0D94,0x0D85, 0x0D8D,0x0D86,0x0D8A,0x0D8C,0x0D92,0x0D95, 0x0D82,0x0D83,0x0DCA };  // first keystroke
+static UniChar SinhUV2Char[] = { 0x0D86,0x0D87,0x0D8A,0x0D8C,0x0D92,0x0D93,0x0D95,0x0D96, 0x0D8E,0x0D88,0x0D80,0x0D80,0x0D80,0x0D80, 0x0D80,0x0D80,0x0D80 };  // second keystroke
+static UniChar SinhUV3Char[] = { 0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80, 0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80, 0x0D80,0x0D80,0x0D80 };  // third keystroke
+
+// vowel sign chars
+static UniChar SinhUVS1Char[]= { 0x0008,0x0008,0x0DD2,0x0DD4,0x0DD9,0x0008,0x0DDC,0x0008, 0x0DD8,0x0DCF,0x0DD3,0x0DD6,0x0DDA,0x0DDD, 0x0D82,0x0D83,0x0DCA };  // first keystroke
+static UniChar SinhUVS2Char[]= { 0x0DCF,0x0DD0,0x0DD3,0x0DD6,0x0DDA,0x0DDB,0x0DDD,0x0DDE, 0x0DF2,0x0DD1,0x0D80,0x0D80,0x0D80,0x0D80, 0x0D80,0x0D80,0x0D80 };  // second keystroke
+static UniChar SinhUVS3Char[]= { 0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80, 0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80, 0x0D80,0x0D80,0x0D80 };  // third keystroke
+
+// conso keystrokes
+#ifdef KEYPOS_GENERATOR_INPUT
+static UniChar SinhUC1Keys[] = { 'k','g','n','c','j','T','D','n','N',  't','d','p','b','m','y','r',  'l','L','v','w','s','S','h','f',  'g','j','D','d','b','j', 0 };
+static UniChar SinhUC2Keys[] = { 'h','h','g','h','h','h','h','y','*',  'h','h','h','h','*','*','*',  '*','*','*','*','h','*','*','*',  'x','x','x','x','x','n', 0 };
+static UniChar SinhUC3Keys[] = { '*','*','*','*','*','*','*','*','*',  '*','*','*','*','*','*','*',  '*','*','*','*','*','*','*','*',  '*','*','*','*','*','*', 0 };
+#endif
+
+// conso chars
+static UniChar SinhUC1Char[] = { 0x0D9A,0x0D9C,0x0DB1,0x0DA0,0x0DA2,0x0DA7,0x0DA9,0x0DB1,0x0DAB,  0x0DAD,0x0DAF,0x0DB4,0x0DB6,0x0DB8,0x0DBA,0x0DBB,  0x0DBD,0x0DC5,0x0DC0,0x0DC0,0x0DC3,0x0DC2,0x0DC4,0x0DC6,  0x0D9C,0x0DA2,0x0DA9,0x0DAF,0x0DB6,0x0DA2, 0};
+static UniChar SinhUC2Char[] = { 0x0D9B,0x0D9D,0x0D9E,0x0DA1,0x0DA3,0x0DA8,0x0DAA,0x0DA4,0x0D80,  0x0DAE,0x0DB0,0x0DB5,0x0DB7,0x0D80,0x0D80,0x0D80,  0x0D80,0x0D80,0x0D80,0x0D80,0x0DC1,0x0D80,0x0D80,0x0D80,  0x0D9F,0x0DA6,0x0DAC,0x0DB3,0x0DB9,0x0DA5, 0};
+static UniChar SinhUC3Char[] = { 0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,  0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,  0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,  0x0D80,0x0D80,0x0D80,0x0D80,0x0D80,0x0D80, 0};
+
+// Sinhala has no script digits or danda in everyday use; those keys pass
+// through unchanged.
+const IndicScript indicScriptSinhala = {
+    .name = "Sinhala",
+    .imeType = kImeTypeSinhala,
+    .flags = INDIC_RESETS_ON_OTHER_KEYS | INDIC_SIGN_AFTER_A_KEEPS,
+    .vowelKeys = { &SinhUV1Hash, &SinhUV2Hash, &SinhUV3Hash },
+    .vowelChar = { SinhUV1Char, SinhUV2Char, SinhUV3Char },
+    .vowelSignChar = { SinhUVS1Char, SinhUVS2Char, SinhUVS3Char },
+    .consoKeys = { &SinhUC1Hash, &SinhUC2Hash, &SinhUC3Hash },
+    .consoChar = { SinhUC1Char, SinhUC2Char, SinhUC3Char },
+};
+
+void getKeyStringUnicodeSinhalaAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results)
+{
+    indicPhoneticGetKeyString(&indicScriptSinhala, currKey, s, results);
+}
+
+void startNewSessionSinhalaAnjal(UniChar currKey, UniChar *s, getKeyStringResults *results)
+{
+    indicPhoneticStartNewSession(&indicScriptSinhala, currKey, s, results);
+}
@@ -0,0 +1,267 @@
+//
+//  IndicTransliterator.c
+//
+//  Script to script transliteration over the parallel Indic Unicode blocks.
+//  indic_transliterator_init() resolves every offset of the source block to
+//  what it becomes in the target script; indic_transliterate() then only
+//  looks offsets up, eight characters at a time while none of them expands.
+//
+
+#include "IndicTransliterator.h"
+#include <string.h>
+
+typedef struct {
+    SupportedLanguage language;
+    wchar_t           base;
+    uint64_t          assigned[2];  // code points assigned in the block (Unicode 14), see below
+} ScriptBlock;
+
+// Malayalam's 0x3C is the circular virama, not a nukta, so its bit is left
+// clear: a nukta is dropped on the way into Malayalam and the sign is spelt
+// as a virama on the way out.
+
+static const ScriptBlock scriptBlocks[] = {
+    { LANG_DEVANAGARI, 0x0900, { 0xFFFFFFFFFFFFFFFFULL, 0xFFFFFFFFFFFFFFFFULL } },
+    { LANG_BENGALI,    0x0980, { 0xF3C5FDFFFFF99FEFULL, 0x7FFFFFCFB080799FULL } },
+    { LANG_GURMUKHI,   0x0A00, { 0xD36DFDFFFFF987EEULL, 0x007FFFC05E023987ULL } },
+    { LANG_GUJARATI,   0x0A80, { 0xF3EDFDFFFFFBBFEEULL, 0xFE03FFCF00013BBFULL } },
+    { LANG_ORIYA,      0x0B00, { 0xF3EDFDFFFFF99FEEULL, 0x00FFFFCFB0E0399FULL } },
+    { LANG_TAMIL,      0x0B80, { 0xC3FFC718D63DC7ECULL, 0x07FFFFC000813DC7ULL } },
+    { LANG_TELUGU,     0x0C00, { 0xF3FFFDFFFFFDDFFFULL, 0xFF80FFCF27603DDFULL } },
+    { LANG_KANNADA,    0x0C80, { 0xF3EFFDFFFFFDDFFFULL, 0x0006FFCF60603DDFULL } },
+    { LANG_MALAYALAM,  0x0D00, { 0xEFFFFFFFFFFDDFFFULL, 0xFFFFFFCFFFF0FDDFULL } },
+};
+
+#define SCRIPT_BLOCK_COUNT  (sizeof(scriptBlocks) / sizeof(scriptBlocks[0]))
+
+// --- Offsets
+//
+// Vowels, consonants, vowel signs, virama, OM, the vocalic ll forms and the
+// digits sit at the same offset in every block. Everything above 0x50
+// (nukta letters, length marks, chillus, script signs) differs between
+// scripts and is only converted through the tables below.
+
+#define OFFSET_NUKTA    0x3C
+#define OFFSET_VIRAMA   0x4D
+#define DROP            0x80    // spelling that writes nothing
+
+static bool isCommonOffset(int offset)
+{
+    return (offset >= 0x01 && offset <= 0x03) || (offset >= 0x05 && offset <= 0x39) ||
+           (offset >= 0x3C && offset <= 0x4D) || offset == 0x50 || (offset >= 0x60 && offset <= 0x6F);
+}
+
+static bool isAssigned(const ScriptBlock* block, int offset)
+{
+    return (block->assigned[offset >> 6] >> (offset & 63)) & 1;
+}
+
+// Nearest letter(s) for a common offset the target script lacks, tried in
+// turn until the target has them
+static const uint8_t fallbacks[128][INDIC_TRANSLIT_MAX_EXPANSION] = {
+    [0x01] = { 0x02 },                  // candrabindu -> anusvara
+    [0x0B] = { 0x30, 0x41 },            // vocalic r -> ru
+    [0x0D] = { 0x0F }, [0x0E] = { 0x0F },       // candra / short e -> e
+    [0x11] = { 0x13 }, [0x12] = { 0x13 },       // candra / short o -> o
+    [0x16] = { 0x15 }, [0x17] = { 0x15 }, [0x18] = { 0x15 },    // Tamil: no aspirated or voiced stops
+    [0x1B] = { 0x1A }, [0x1D] = { 0x1C },
+    [0x20] = { 0x1F }, [0x21] = { 0x1F }, [0x22] = { 0x1F },
+    [0x25] = { 0x24 }, [0x26] = { 0x24 }, [0x27] = { 0x24 },
+    [0x2B] = { 0x2A }, [0x2C] = { 0x2A }, [0x2D] = { 0x2A },
+    [0x29] = { 0x28 },                  // nnna -> na
+    [0x31] = { 0x30 },                  // rra -> ra
+    [0x33] = { 0x32 },                  // lla -> la
+    [0x34] = { 0x33 },                  // llla -> lla
+    [0x35] = { 0x2C },                  // va -> ba (Bengali)
+    [0x36] = { 0x38 }, [0x37] = { 0x38 },       // sha, ssa -> sa
+    [0x3C] = { DROP },                  // nukta
+    [0x43] = { OFFSET_VIRAMA, 0x30, 0x41 },     // vocalic r sign -> virama + ru
+    [0x44] = { OFFSET_VIRAMA, 0x30, 0x42 },
+    [0x45] = { 0x47 }, [0x46] = { 0x47 },       // candra / short e sign -> e sign
+    [0x49] = { 0x4B }, [0x4A] = { 0x4B },       // candra / short o sign -> o sign
+    [0x60] = { 0x30, 0x42 },            // vocalic rr -> ruu
+};
+
+// Source letters outside the common offsets, spelt with common offsets
+typedef struct {
+    SupportedLanguage language;
+    uint8_t           offset;
+    uint8_t           spelling[INDIC_TRANSLIT_MAX_EXPANSION];
+} SourceSpelling;
+
+static const SourceSpelling sourceSpellings[] = {
+    // precomposed nukta letters (all excluded from composition, so the
+    // decomposed form is also the normalised one)
+    { LANG_DEVANAGARI, 0x58, { 0x15, OFFSET_NUKTA } }, { LANG_DEVANAGARI, 0x59, { 0x16, OFFSET_NUKTA } },
+    { LANG_DEVANAGARI, 0x5A, { 0x17, OFFSET_NUKTA } }, { LANG_DEVANAGARI, 0x5B, { 0x1C, OFFSET_NUKTA } },
+    { LANG_DEVANAGARI, 0x5C, { 0x21, OFFSET_NUKTA } }, { LANG_DEVANAGARI, 0x5D, { 0x22, OFFSET_NUKTA } },
+    { LANG_DEVANAGARI, 0x5E, { 0x2B, OFFSET_NUKTA } }, { LANG_DEVANAGARI, 0x5F, { 0x2F, OFFSET_NUKTA } },
+    { LANG_DEVANAGARI, 0x04, { 0x05 } },                        // short a
+    { LANG_BENGALI,    0x5C, { 0x21, OFFSET_NUKTA } }, { LANG_BENGALI, 0x5D, { 0x22, OFFSET_NUKTA } },
+    { LANG_BENGALI,    0x5F, { 0x2F, OFFSET_NUKTA } },
+    { LANG_BENGALI,    0x4E, { 0x24, OFFSET_VIRAMA } },         // khanda ta
+    { LANG_BENGALI,    0x70, { 0x30 } }, { LANG_BENGALI, 0x71, { 0x35 } },  // Assamese ra, wa
+    { LANG_GURMUKHI,   0x59, { 0x16, OFFSET_NUKTA } }, { LANG_GURMUKHI, 0x5A, { 0x17, OFFSET_NUKTA } },
+    { LANG_GURMUKHI,   0x5B, { 0x1C, OFFSET_NUKTA } }, { LANG_GURMUKHI, 0x5C, { 0x21, OFFSET_NUKTA } },
+    { LANG_GURMUKHI,   0x5E, { 0x2B, OFFSET_NUKTA } },
+    { LANG_GURMUKHI,   0x70, { 0x02 } },                        // tippi
+    { LANG_ORIYA,      0x5C, { 0x21, OFFSET_NUKTA } }, { LANG_ORIYA, 0x5D, { 0x22, OFFSET_NUKTA } },
+    { LANG_ORIYA,      0x5F, { 0x2F } }, { LANG_ORIYA, 0x71, { 0x35 } },   // yya, wa
+    { LANG_TELUGU,     0x58, { 0x1A } }, { LANG_TELUGU, 0x59, { 0x1C } }, { LANG_TELUGU, 0x5A, { 0x31 } },
+    { LANG_TELUGU,     0x5D, { 0x28, OFFSET_VIRAMA } },
+    { LANG_KANNADA,    0x5E, { 0x34 } },                        // llla
+    { LANG_KANNADA,    0x5D, { 0x28, OFFSET_VIRAMA } },
+    // chillus are dead consonants
+    { LANG_MALAYALAM,  0x7A, { 0x23, OFFSET_VIRAMA } }, { LANG_MALAYALAM, 0x7B, { 0x28, OFFSET_VIRAMA } },
+    { LANG_MALAYALAM,  0x7C, { 0x30, OFFSET_VIRAMA } }, { LANG_MALAYALAM, 0x7D, { 0x32, OFFSET_VIRAMA } },
+    { LANG_MALAYALAM,  0x7E, { 0x33, OFFSET_VIRAMA } }, { LANG_MALAYALAM, 0x7F, { 0x15, OFFSET_VIRAMA } },
+    { LANG_MALAYALAM,  0x54, { 0x2E, OFFSET_VIRAMA } }, { LANG_MALAYALAM, 0x55, { 0x2F, OFFSET_VIRAMA } },
+    { LANG_MALAYALAM,  0x56, { 0x34, OFFSET_VIRAMA } },
+    { LANG_MALAYALAM,  0x4E, { 0x30, OFFSET_VIRAMA } },         // dot reph
+    { LANG_MALAYALAM,  0x3B, { OFFSET_VIRAMA } },               // vertical bar virama
+    { LANG_MALAYALAM,  0x3C, { OFFSET_VIRAMA } },               // circular virama
+};
+
+// Common offsets a target encodes elsewhere in its block
+typedef struct {
+    SupportedLanguage language;
+    uint8_t           offset;
+    uint8_t           targetOffset;
+} TargetPlacement;
+
+static const TargetPlacement targetPlacements[] = {
+    { LANG_KANNADA, 0x34, 0x5E },       // llla
+};
+
+static const ScriptBlock* findBlock(SupportedLanguage language)
+{
+    for (size_t i = 0; i < SCRIPT_BLOCK_COUNT; i++)
+        if (scriptBlocks[i].language == language)
+            return &scriptBlocks[i];
+    return NULL;
+}
+
+static void append(wchar_t* text, int* length, wchar_t c)
+{
+    if (*length < INDIC_TRANSLIT_MAX_EXPANSION)
+        text[(*length)++] = c;
+}
+
+// Write what common offset 'offset' of 'source' becomes in 'target'
+static void resolveTarget(const ScriptBlock* source, const ScriptBlock* target, int offset, int depth,
+                          wchar_t* text, int* length)
+{
+    for (size_t i = 0; i < sizeof(targetPlacements) / sizeof(targetPlacements[0]); i++) {
+        if (targetPlacements[i].language == target->language && targetPlacements[i].offset == offset) {
+            append(text, length, target->base + targetPlacements[i].targetOffset);
+            return;
+        }
+    }
+
+    if (isCommonOffset(offset) && isAssigned(target, offset)) {
+        append(text, length, target->base + offset);
+        return;
+    }
+
+    const uint8_t* fallback = fallbacks[offset];
+    if (fallback[0] == DROP)
+        return;
+    if (fallback[0] == 0 || depth >= INDIC_TRANSLIT_MAX_EXPANSION) {
+        append(text, length, source->base + offset);    // no equivalent, keep the letter
+        return;
+    }
+    for (int i = 0; i < INDIC_TRANSLIT_MAX_EXPANSION && fallback[i]; i++)
+        resolveTarget(source, target, fallback[i], depth + 1, text, length);
+}
+
+bool indic_transliterator_init(IndicTransliterator* t, SupportedLanguage source, SupportedLanguage target)
+{
+    const ScriptBlock* from = findBlock(source);
+    const ScriptBlock* to = findBlock(target);
+    if (!t || !from || !to)
+        return false;
+
+    memset(t, 0, sizeof(*t));
+    t->sourceBase = from->base;
+    t->targetBase = to->base;
+
+    for (int offset = 0; offset < 128; offset++) {
+        wchar_t* text = t->text[offset];
+        int length = 0;
+
+        const uint8_t* spelling = NULL;
+        for (size_t i = 0; i < sizeof(sourceSpellings) / sizeof(sourceSpellings[0]); i++) {
+            if (sourceSpellings[i].language == source && sourceSpellings[i].offset == offset) {
+                spelling = sourceSpellings[i].spelling;
+                break;
+            }
+        }
+
+        if (source == target) {
+            append(text, &length, from->base + offset);
+        } else if (spelling) {
+            for (int i = 0; i < INDIC_TRANSLIT_MAX_EXPANSION && spelling[i]; i++)
+                resolveTarget(from, to, spelling[i], 0, text, &length);
+        } else if (isCommonOffset(offset) && isAssigned(from, offset)) {
+            resolveTarget(from, to, offset, 0, text, &length);
+        } else {
+            append(text, &length, from->base + offset);
+        }
+
+        t->length[offset] = (uint8_t)length;
+        t->single[offset] = length == 1 ? text[0] : 0;
+    }
+    return true;
+}
+
+size_t indic_transliterate(const IndicTransliterator* t,
+                           const wchar_t* text,
+                           size_t length,
+                           wchar_t* out,
+                           size_t capacity)
+{
+    const uint32_t base = (uint32_t)t->sourceBase;
+    size_t i = 0, n = 0;
+
+    while (i < length) {
+        size_t end = i + 1;
+
+        // eight characters at a time when each becomes exactly one; the
+        // loop has no branches, so compilers can vectorise it
+        if (i + 8 <= length && n + 8 <= capacity) {
+            wchar_t chunk[8];
+            uint32_t expands = 0;
+            for (int k = 0; k < 8; k++) {
+                uint32_t c = (uint32_t)text[i + k];
+                uint32_t offset = c - base;
+                wchar_t m = offset < 128 ? t->single[offset & 127] : (wchar_t)c;
+                expands |= (m == 0);
+                chunk[k] = m;
+            }
+            if (!expands) {
+                memcpy(out + n, chunk, sizeof(chunk));
+                i += 8;
+                n += 8;
+                continue;
+            }
+            end = i + 8;
+        }
+
+        // otherwise character by character through the table
+        for (; i < end; i++) {
+            wchar_t c = text[i];
+            uint32_t offset = (uint32_t)c - base;
+            if (offset < 128) {
+                int count = t->length[offset];
+                for (int k = 0; k < count; k++, n++)
+                    if (n < capacity)
+                        out[n] = t->text[offset][k];
+            } else {
+                if (n < capacity)
+                    out[n] = c;
+                n++;
+            }
+        }
+    }
+    return n;
+}
@@ -31,6 +31,7 @@
 //#include "DebugOut.h"
 
 #include "AnjalKeyMapLookup.h"
+#include "KeyMask128.h"
 
 #define FRESH_SEQ           1
 #define FIRST_VOWEL         2
@@ -1291,6 +1292,123 @@ int GetUnmappedCharStringForKey(WCHAR key, WCHAR* s, WCHAR prevChar, bool isShif
     return delCount;
 }
 
+// Added : 2026-10-18
+// Read-only access to a layout's matrix table (tableId is one of Conso1stKeys
+// ... outOfMatrixChar). Used by analysers that work on the tables directly.
+const char* GetLayoutTable(int layout, int tableId)
+{
+    if (layout < 0 || layout >= MAX_KBDTYPES || tableId < 0 || tableId >= MAX_TABLES)
+        return "";
+
+    return kbdTable[layout][tableId];
+}
+
+// Added : 2026-10-18
+// Continuation keys: the set of keys that would extend the current
+// composition instead of starting a fresh sequence. Rather than mirroring
+// the decisions in GetCharStringForKey above, every printable key is run
+// through it from the current state and the answers are cached per state,
+// so the UI can ask on every keystroke. A key continues if it does not start
+// a fresh sequence and either rewrites the previous output or attaches a
+// vowel sign to it.
+#define CONT_CACHE_SIZE     1024    // power of 2
+
+typedef struct {
+    WCHAR prevKey;
+    WCHAR wytiwygVowelLeftHalf;
+    WORD  prevKeyType;
+    WORD  firstConsoKey;
+    char  lastConsoChar;
+    char  vowelChar;
+    bool  T99PulliHandled;
+    bool  autoPulliEnabled;
+} KeyState;
+
+typedef struct {
+    bool       used;
+    KeyState   state;
+    KeyMask128 mask;
+} ContCacheEntry;
+
+static ContCacheEntry contCache[CONT_CACHE_SIZE];
+static int            contCacheLayout = kbdNone;
+static bool           quietDebug = false;
+
+static void SaveKeyState(KeyState* k, WCHAR prevKey)
+{
+    memset(k, 0, sizeof(*k));   // states are compared with memcmp
+    k->prevKey = prevKey;
+    k->wytiwygVowelLeftHalf = wytiwygVowelLeftHalf;
+    k->prevKeyType = prevKeyType;
+    k->firstConsoKey = firstConsoKey;
+    k->lastConsoChar = lastConsoChar;
+    k->vowelChar = vowelChar;
+    k->T99PulliHandled = T99PulliHandled;
+    k->autoPulliEnabled = autoPulliEnabled;
+}
+
+static void RestoreKeyState(const KeyState* k)
+{
+    wytiwygVowelLeftHalf = k->wytiwygVowelLeftHalf;
+    prevKeyType = k->prevKeyType;
+    firstConsoKey = k->firstConsoKey;
+    lastConsoChar = k->lastConsoChar;
+    vowelChar = k->vowelChar;
+    T99PulliHandled = k->T99PulliHandled;
+}
+
+static KeyMask128 ComputeContinuationKeys(const KeyState* state)
+{
+    KeyMask128 mask = keymask_empty();
+    bool       freshSaved = startFreshSeq;
+
+    quietDebug = true;
+    for (WCHAR key = 0x21; key < 0x7F; key++) {
+        WCHAR s[20] = { 0 };
+
+        RestoreKeyState(state);
+        int del = GetCharStringForKey(key, state->prevKey, s, false);
+        if (!startFreshSeq && (del != KSR_DELETE_NONE || (s[0] != 0 && IsDependantVowel(s[0]))))
+            keymask_set(&mask, key);
+    }
+    quietDebug = false;
+
+    RestoreKeyState(state);
+    startFreshSeq = freshSaved;
+    return mask;
+}
+
+KeyMask128 GetContinuationKeys(WCHAR prevKey)
+{
+    if (contCacheLayout != kbdType) {
+        memset(contCache, 0, sizeof(contCache));
+        contCacheLayout = kbdType;
+    }
+
+    KeyState state;
+    SaveKeyState(&state, prevKey);
+
+    const unsigned char* p = (const unsigned char*)&state;
+    unsigned h = 2166136261u;
+    for (size_t i = 0; i < sizeof(state); i++)
+        h = (h ^ p[i]) * 16777619u;
+
+    for (int probe = 0; probe < 8; probe++) {
+        ContCacheEntry* e = &contCache[(h + probe) & (CONT_CACHE_SIZE - 1)];
+        if (e->used && memcmp(&e->state, &state, sizeof(state)) == 0)
+            return e->mask;
+        if (!e->used) {
+            e->mask = ComputeContinuationKeys(&state);
+            e->state = state;
+            e->used = true;
+            return e->mask;
+        }
+    }
+
+    // neighbourhood full - answer without caching
+    return ComputeContinuationKeys(&state);
+}
+
 void doDebug(const char* log)
 {
     /*
@@ -1306,7 +1424,8 @@ void doDebug(const char* log)
     }
     //*/
 
-    printf("Debug: %s", log);
+    if (!quietDebug)
+        printf("Debug: %s", log);
 }
 
 void doDebug1(const char* log)
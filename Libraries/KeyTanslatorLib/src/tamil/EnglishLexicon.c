@@ -0,0 +1,195 @@
+#include "EnglishLexicon.h"
+#include "MappedFile.h"
+#include <stdlib.h>
+#include <string.h>
+
+struct EnglishLexicon {
+    MappedFile                 file;      // unused for in-memory lexicons
+    const unsigned char*       data;
+    size_t                     size;
+    const EnglishLexiconHeader* header;
+    const uint64_t*            bloom;
+    const EnglishLexiconNode*  nodes;
+    const uint32_t*            edges;
+    uint32_t                   bloomMask;
+};
+
+static bool sectionFits(size_t size, uint32_t offset, uint64_t count, size_t itemSize)
+{
+    return (offset % 8) == 0 && offset <= size && count <= (size - offset) / itemSize;
+}
+
+static EnglishLexicon* attachLexicon(EnglishLexicon* lex, const unsigned char* data, size_t size)
+{
+    if (size < sizeof(EnglishLexiconHeader) || ((uintptr_t)data % 8) != 0)
+        return NULL;
+
+    const EnglishLexiconHeader* h = (const EnglishLexiconHeader*)data;
+    if (memcmp(h->magic, ENGLISH_LEXICON_MAGIC, 4) != 0 || h->version != ENGLISH_LEXICON_VERSION)
+        return NULL;
+    if (h->bloomWords == 0 || (h->bloomWords & (h->bloomWords - 1)) != 0 || h->bloomWords > (1u << 28))
+        return NULL;
+    if (h->bloomHashes == 0 || h->bloomHashes > 6 || h->nodeCount == 0)
+        return NULL;
+    if (!sectionFits(size, h->bloomOffset, h->bloomWords, sizeof(uint64_t)) ||
+        !sectionFits(size, h->nodesOffset, h->nodeCount, sizeof(EnglishLexiconNode)) ||
+        !sectionFits(size, h->edgesOffset, h->edgeCount, sizeof(uint32_t)))
+        return NULL;
+
+    lex->data = data;
+    lex->size = size;
+    lex->header = h;
+    lex->bloom = (const uint64_t*)(data + h->bloomOffset);
+    lex->nodes = (const EnglishLexiconNode*)(data + h->nodesOffset);
+    lex->edges = (const uint32_t*)(data + h->edgesOffset);
+    lex->bloomMask = h->bloomWords - 1;
+    return lex;
+}
+
+EnglishLexicon* english_lexicon_open(const char* path)
+{
+    EnglishLexicon* lex = calloc(1, sizeof(EnglishLexicon));
+    if (!lex) return NULL;
+
+    if (!mapped_file_open(&lex->file, path) || !attachLexicon(lex, lex->file.data, lex->file.size)) {
+        mapped_file_close(&lex->file);
+        free(lex);
+        return NULL;
+    }
+    return lex;
+}
+
+EnglishLexicon* english_lexicon_open_memory(const void* data, size_t size)
+{
+    EnglishLexicon* lex = calloc(1, sizeof(EnglishLexicon));
+    if (!lex) return NULL;
+
+    if (!data || !attachLexicon(lex, (const unsigned char*)data, size)) {
+        free(lex);
+        return NULL;
+    }
+    return lex;
+}
+
+void english_lexicon_close(EnglishLexicon* lexicon)
+{
+    if (lexicon) {
+        mapped_file_close(&lexicon->file);
+        free(lexicon);
+    }
+}
+
+size_t english_lexicon_size(const EnglishLexicon* lexicon)
+{
+    return lexicon ? lexicon->size : 0;
+}
+
+static bool bloomMayContain(const EnglishLexicon* lex, uint32_t hash, int length)
+{
+    uint64_t key = english_lexicon_bloom_key(hash, length);
+    uint64_t word = lex->bloom[key & lex->bloomMask];
+
+    for (int i = 0; i < lex->header->bloomHashes; i++) {
+        if (!(word & (1ULL << ((key >> (28 + 6 * i)) & 63))))
+            return false;
+    }
+    return true;
+}
+
+// Walk the automaton. Edges of a node are sorted by letter and there are
+// at most 26 of them, so a linear scan beats a binary search here.
+static int automatonLookup(const EnglishLexicon* lex, const char* word, int length)
+{
+    uint32_t node = 0;
+
+    for (int i = 0; i < length; i++) {
+        const EnglishLexiconNode* n = &lex->nodes[node];
+        const uint32_t* e = lex->edges + n->firstEdge;
+        uint8_t c = (uint8_t)word[i];
+        uint32_t next = UINT32_MAX;
+
+        if (n->firstEdge + n->edgeCount > lex->header->edgeCount)
+            return 0;
+        for (int j = 0; j < n->edgeCount; j++) {
+            uint8_t label = (uint8_t)(e[j] & 0xFF);
+            if (label == c) {
+                next = e[j] >> 8;
+                break;
+            }
+            if (label > c)
+                break;
+        }
+        if (next >= lex->header->nodeCount)
+            return 0;
+        node = next;
+    }
+    return lex->nodes[node].confidence;
+}
+
+int english_lexicon_lookup(const EnglishLexicon* lexicon, const char* word, int length)
+{
+    if (!lexicon || !word)
+        return 0;
+    if (length < 0)
+        length = (int)strlen(word);
+    if (length < ENGLISH_LEXICON_MIN_WORD || length > lexicon->header->maxWordLength)
+        return 0;
+
+    uint32_t hash = ENGLISH_LEXICON_HASH_SEED;
+    for (int i = 0; i < length; i++)
+        hash = english_lexicon_hash_step(hash, word[i]);
+
+    if (!bloomMayContain(lexicon, hash, length))
+        return 0;
+    return automatonLookup(lexicon, word, length);
+}
+
+void english_lexicon_state_reset(EnglishLexiconState* state)
+{
+    if (state) {
+        state->hash = ENGLISH_LEXICON_HASH_SEED;
+        state->length = 0;
+        state->rejected = false;
+        state->typed[0] = 0;
+        state->folded[0] = 0;
+    }
+}
+
+bool english_lexicon_state_push(EnglishLexiconState* state, int key)
+{
+    if (!state || state->rejected)
+        return false;
+
+    char c;
+    if (key >= 'a' && key <= 'z')
+        c = (char)key;
+    else if (key >= 'A' && key <= 'Z' && state->length == 0)
+        c = (char)(key - 'A' + 'a');
+    else
+        c = 0;
+
+    if (c == 0 || state->length >= ENGLISH_LEXICON_MAX_WORD) {
+        state->rejected = true;
+        return false;
+    }
+
+    state->typed[state->length] = (char)key;
+    state->folded[state->length] = c;
+    state->length++;
+    state->typed[state->length] = 0;
+    state->folded[state->length] = 0;
+    state->hash = english_lexicon_hash_step(state->hash, c);
+    return true;
+}
+
+int english_lexicon_state_match(const EnglishLexicon* lexicon, const EnglishLexiconState* state)
+{
+    if (!lexicon || !state || state->rejected)
+        return 0;
+    if (state->length < ENGLISH_LEXICON_MIN_WORD || state->length > lexicon->header->maxWordLength)
+        return 0;
+
+    if (!bloomMayContain(lexicon, state->hash, state->length))
+        return 0;
+    return automatonLookup(lexicon, state->folded, state->length);
+}
@@ -1,18 +1,27 @@
+#include "KeyTranslatorTamil.h"
 #include "KeyTranslatorMultilingual.h"
 #include "AnjalKeyMap.h"
 #include "EncodingTamil.h"
+#include "EnglishLexicon.h"
+#include "../DeleteCode.h"
 #include <stdlib.h>
 #include <string.h>
 #include <wchar.h>
 
 // Tamil-specific translator handle
-typedef struct TamilTranslatorHandle {
+struct TamilTranslatorHandle {
     int32_t keyboard_layout;
     int32_t prev_key_code;
     wchar_t prev_translation[10];
     bool prev_key_was_backspace;
     bool wysiwyg_delete_reverse;
-} TamilTranslatorHandle;
+
+    // Optional English passthrough (Anjal only)
+    const EnglishLexicon* english_lexicon;
+    int english_min_confidence;
+    EnglishLexiconState english_word;
+    int word_output_length;     // Tamil characters emitted for the current word
+};
 
 // Tamil-specific functions
 TamilTranslatorHandle* tamil_translator_create(int32_t keyboard_layout) {
@@ -24,6 +33,10 @@ TamilTranslatorHandle* tamil_translator_create(int32_t keyboard_layout) {
     translator->prev_translation[0] = 0;
     translator->prev_key_was_backspace = false;
     translator->wysiwyg_delete_reverse = false;
+    translator->english_lexicon = NULL;
+    translator->english_min_confidence = 0;
+    english_lexicon_state_reset(&translator->english_word);
+    translator->word_output_length = 0;
     
     // Initialize the C keyboard system
     SetKeyboardLayout(keyboard_layout);
@@ -38,16 +51,23 @@ void tamil_translator_destroy(TamilTranslatorHandle* translator) {
     }
 }
 
-int tamil_translator_translate_key(TamilTranslatorHandle* translator,
+static int translate_key_anjal_engine(TamilTranslatorHandle* translator,
                                  int32_t key_code,
                                  int32_t prev_key_code,
                                  bool shifted,
                                  bool prev_key_was_backspace,
                                  wchar_t* output_buffer,
-                                 int buffer_size) {
-    if (!translator || !output_buffer || buffer_size < 10) {
+                                 int buffer_size,
+                                 int* delete_count) {
+    (void)shifted;  // the Anjal engine tells case from the key code
+    *delete_count = 0;
+    if (!translator || !output_buffer) {
         return 0;
     }
+    // the engine writes up to 9 characters and a terminator
+    if (buffer_size < 10) {
+        return -1;
+    }
     
     wchar_t translated_string[10] = {0};
     
@@ -57,74 +77,141 @@ int tamil_translator_translate_key(TamilTranslatorHandle* translator,
                                    translated_string, 
                                    prev_key_was_backspace);
     
-    // Handle deletion count if needed
     if (result > 0) {
         // result > 0 means delete 'result' number of characters
-        // We need to encode this information somehow
-        // For now, we'll use a special character to indicate deletion
-        output_buffer[0] = DELCODE;  // Deletion indicator
-        output_buffer[1] = (wchar_t)('0' + result); // Number to delete
-        
-        int len = 2;
-        // Copy the translated characters after the delete instruction
-        int i = 0;
-        while (len < buffer_size - 1 && translated_string[i] != 0) {
-            output_buffer[len] = translated_string[i];
-            len++;
-            i++;
-        }
-        output_buffer[len] = 0;
-        
-        // Update state
-        translator->prev_key_code = key_code;
-        wcsncpy(translator->prev_translation, translated_string, 10);
-        translator->prev_key_was_backspace = prev_key_was_backspace;
-        
-        return len;
+        *delete_count = result;
     } else if (result == KSR_DELETE_PREV_KS_LENGTH) {
         // Delete previous key string length
-        int delete_count = (int)wcslen(translator->prev_translation);
-        
-        output_buffer[0] = DELCODE;
-        output_buffer[1] = (wchar_t)('0' + delete_count);
-        
-        int len = 2;
-        int i = 0;
-        while (len < buffer_size - 1 && translated_string[i] != 0) {
-            output_buffer[len] = translated_string[i];
-            len++;
-            i++;
-        }
-        output_buffer[len] = 0;
-        
-        // Update state
-        translator->prev_key_code = key_code;
-        wcsncpy(translator->prev_translation, translated_string, 10);
-        translator->prev_key_was_backspace = prev_key_was_backspace;
-        
+        *delete_count = (int)wcslen(translator->prev_translation);
+    }
+    
+    int len = 0;
+    while (len < buffer_size - 1 && translated_string[len] != 0) {
+        output_buffer[len] = translated_string[len];
+        len++;
+    }
+    output_buffer[len] = 0;
+    
+    // Update state
+    translator->prev_key_code = key_code;
+    wcsncpy(translator->prev_translation, translated_string, 10);
+    translator->prev_key_was_backspace = prev_key_was_backspace;
+    
+    return len;
+}
+
+// If the word that 'key_code' terminates is a listed English word, replace
+// its Tamil rendering with the Latin keystrokes. 'output' already holds the
+// engine's translation of the terminating key.
+static int apply_english_passthrough(TamilTranslatorHandle* translator,
+                                     wchar_t* output_buffer,
+                                     int len,
+                                     int buffer_size,
+                                     int* delete_count)
+{
+    const EnglishLexiconState* word = &translator->english_word;
+    int confidence = english_lexicon_state_match(translator->english_lexicon, word);
+
+    if (confidence == 0 || confidence < translator->english_min_confidence)
+        return len;
+    // keep it simple if the terminating key rewrote earlier output itself
+    if (*delete_count > 0)
+        return len;
+    if (word->length + len >= buffer_size)
+        return len;
+
+    memmove(output_buffer + word->length, output_buffer, (len + 1) * sizeof(wchar_t));
+    for (int i = 0; i < word->length; i++)
+        output_buffer[i] = (wchar_t)word->typed[i];
+    *delete_count = translator->word_output_length;
+
+    wcsncpy(translator->prev_translation, output_buffer + word->length, 10);
+    translator->prev_translation[9] = 0;
+    return word->length + len;
+}
+
+int tamil_translator_translate_key_ex(TamilTranslatorHandle* translator,
+                                      int32_t key_code,
+                                      int32_t prev_key_code,
+                                      bool shifted,
+                                      bool prev_key_was_backspace,
+                                      wchar_t* output_buffer,
+                                      int buffer_size,
+                                      int* delete_count) {
+    int len = translate_key_anjal_engine(translator, key_code, prev_key_code, shifted,
+                                         prev_key_was_backspace, output_buffer, buffer_size, delete_count);
+
+    if (len < 0 || !translator || !translator->english_lexicon || translator->keyboard_layout != kbdAnjal)
         return len;
-    } else {
-        // Normal translation, no deletion needed
-        int len = 0;
-        while (len < buffer_size - 1 && translated_string[len] != 0) {
-            output_buffer[len] = translated_string[len];
-            len++;
-        }
-        output_buffer[len] = 0;
-        
-        // Update state
-        translator->prev_key_code = key_code;
-        wcsncpy(translator->prev_translation, translated_string, 10);
-        translator->prev_key_was_backspace = prev_key_was_backspace;
-        
+
+    // The word buffer can't follow edits made with backspace
+    if (prev_key_was_backspace) {
+        english_lexicon_state_reset(&translator->english_word);
+        translator->word_output_length = 0;
+        translator->english_word.rejected = true;
+    }
+
+    bool letter = (key_code >= 'a' && key_code <= 'z') || (key_code >= 'A' && key_code <= 'Z');
+    if (letter) {
+        english_lexicon_state_push(&translator->english_word, key_code);
+        translator->word_output_length += len - *delete_count;
         return len;
     }
+
+    // Any other key ends the word
+    if (translator->english_word.length > 0)
+        len = apply_english_passthrough(translator, output_buffer, len, buffer_size, delete_count);
+    english_lexicon_state_reset(&translator->english_word);
+    translator->word_output_length = 0;
+    return len;
+}
+
+int tamil_translator_translate_key(TamilTranslatorHandle* translator,
+                                 int32_t key_code,
+                                 int32_t prev_key_code,
+                                 bool shifted,
+                                 bool prev_key_was_backspace,
+                                 wchar_t* output_buffer,
+                                 int buffer_size) {
+    if (!output_buffer || buffer_size < 1) {
+        return 0;
+    }
+
+    int delete_count;
+    int len = tamil_translator_translate_key_ex(translator, key_code, prev_key_code, shifted,
+                                                prev_key_was_backspace, output_buffer, buffer_size,
+                                                &delete_count);
+    if (len < 0)
+        return -1;
+
+    // Put the delete instruction in front of the text
+    int prefix = delete_code_length(delete_count);
+    if (prefix > 0) {
+        if (len + prefix >= buffer_size)
+            return -1;
+        memmove(output_buffer + prefix, output_buffer, (len + 1) * sizeof(wchar_t));
+        delete_code_write(output_buffer, delete_count);
+    }
+    return len + prefix;
+}
+
+void tamil_translator_set_english_lexicon(TamilTranslatorHandle* translator,
+                                          const EnglishLexicon* lexicon,
+                                          int min_confidence) {
+    if (translator) {
+        translator->english_lexicon = lexicon;
+        translator->english_min_confidence = min_confidence;
+        english_lexicon_state_reset(&translator->english_word);
+        translator->word_output_length = 0;
+    }
 }
 
 void tamil_translator_terminate_composition(TamilTranslatorHandle* translator) {
     if (translator) {
         translator->prev_key_code = 0;
         translator->prev_translation[0] = 0;
+        english_lexicon_state_reset(&translator->english_word);
+        translator->word_output_length = 0;
         ResetKeyStringGlobals();
     }
 }
@@ -136,10 +223,27 @@ void tamil_translator_set_layout(TamilTranslatorHandle* translator, int32_t layo
     }
 }
 
+void tamil_translator_activate(TamilTranslatorHandle* translator) {
+    if (translator) {
+        // the layout switch drops the cached continuation masks, skip it
+        // when the engine already has this layout
+        if (GetKeyboardLayout() != translator->keyboard_layout)
+            SetKeyboardLayout(translator->keyboard_layout);
+        tamil_translator_terminate_composition(translator);
+    }
+}
+
 int32_t tamil_translator_get_layout(TamilTranslatorHandle* translator) {
     return translator ? translator->keyboard_layout : 0;
 }
 
+KeyMask128 tamil_translator_get_continuation_keys(TamilTranslatorHandle* translator) {
+    if (!translator) {
+        return keymask_empty();
+    }
+    return GetContinuationKeys((WCHAR)translator->prev_key_code);
+}
+
 void tamil_translator_update_after_delete(TamilTranslatorHandle* translator, wchar_t last_char) {
     if (translator) {
         UpdatePrevKeyTypesForLastChar(last_char);
@@ -0,0 +1,74 @@
+#ifndef KEYTRANSLATOR_TAMIL_H
+#define KEYTRANSLATOR_TAMIL_H
+
+// Tamil translator context behind the multilingual translator. Private to
+// the library: the platform front ends call the Anjal engine directly.
+//
+// The Anjal engine in AnjalKeyMap.c keeps its composition state and current
+// layout in globals, so every Tamil context shares them.
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <wchar.h>
+#include "EnglishLexicon.h"
+#include "KeyMask128.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct TamilTranslatorHandle TamilTranslatorHandle;
+
+TamilTranslatorHandle* tamil_translator_create(int32_t keyboard_layout);
+void tamil_translator_destroy(TamilTranslatorHandle* translator);
+
+// Translate a key into the text to insert, returning its length. The
+// characters to delete before the cursor first are stored in *delete_count.
+// Returns -1, leaving the key untranslated, if buffer_size is under 10.
+int tamil_translator_translate_key_ex(TamilTranslatorHandle* translator,
+                                      int32_t key_code,
+                                      int32_t prev_key_code,
+                                      bool shifted,
+                                      bool prev_key_was_backspace,
+                                      wchar_t* output_buffer,
+                                      int buffer_size,
+                                      int* delete_count);
+
+// As above, with a delete encoded in front of the text as DELCODE and digit
+// pairs (see DeleteCode.h). Returns -1 if the buffer has no room for both.
+int tamil_translator_translate_key(TamilTranslatorHandle* translator,
+                                   int32_t key_code,
+                                   int32_t prev_key_code,
+                                   bool shifted,
+                                   bool prev_key_was_backspace,
+                                   wchar_t* output_buffer,
+                                   int buffer_size);
+
+void tamil_translator_set_english_lexicon(TamilTranslatorHandle* translator,
+                                          const EnglishLexicon* lexicon,
+                                          int min_confidence);
+void tamil_translator_terminate_composition(TamilTranslatorHandle* translator);
+void tamil_translator_set_layout(TamilTranslatorHandle* translator, int32_t layout);
+int32_t tamil_translator_get_layout(TamilTranslatorHandle* translator);
+
+// Make the context's layout the engine's current one and start a new
+// composition, e.g. when switching back to Tamil
+void tamil_translator_activate(TamilTranslatorHandle* translator);
+KeyMask128 tamil_translator_get_continuation_keys(TamilTranslatorHandle* translator);
+void tamil_translator_update_after_delete(TamilTranslatorHandle* translator, wchar_t last_char);
+void tamil_translator_set_wysiwyg_delete_reverse(TamilTranslatorHandle* translator, bool reverse_order);
+
+int tamil_translator_delete_last_char(TamilTranslatorHandle* translator,
+                                      const wchar_t* input_string,
+                                      wchar_t* output_buffer,
+                                      int buffer_size);
+int tamil_translator_cleanup_stray_vowel(TamilTranslatorHandle* translator,
+                                         const wchar_t* input_string,
+                                         wchar_t* output_buffer,
+                                         int buffer_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // KEYTRANSLATOR_TAMIL_H
@@ -0,0 +1,394 @@
+//
+//  TextOriginDetector.c
+//
+//  Guesses where pasted text came from (Unicode, TSCII, Bamini or raw
+//  keystrokes for one of the Tamil layouts) so that the host can offer a
+//  conversion inline.
+//
+//  The text is reduced to a byte histogram and an ASCII bigram histogram
+//  in a single pass. Every layout then scores the distinct bigrams through
+//  a per-layout key class map built from kbdTable and a tiny class
+//  transition model, so the per-layout cost depends on the number of
+//  distinct bigrams and not on the length of the text.
+//
+
+#include "TextOriginDetector.h"
+#include "AnjalKeyMap.h"
+#include <string.h>
+
+#ifndef _WIN32
+#include <pthread.h>
+#endif
+
+// Key classes used by the transition model
+#define KC_SPACE        0   // white space, digits and unmapped punctuation
+#define KC_CONSO        1   // starts (or is) a consonant
+#define KC_VOWEL        2   // vowel (phonetic layouts: also vowel signs)
+#define KC_SIGN         3   // WYTIWYG vowel sign / modifier key
+#define KC_SECOND       4   // only valid as a 2nd or 3rd key of a sequence
+#define KC_UNMAPPED     5   // letter the layout does not map
+#define KC_COUNT        6
+
+#define ASCII_FIRST     0x20
+#define ASCII_LAST      0x7E
+#define ASCII_RANGE     (ASCII_LAST - ASCII_FIRST + 1)
+
+// Indic Unicode blocks from U+0900 (Devanagari) to U+0DFF (Sinhala)
+#define INDIC_FIRST     0x0900
+#define INDIC_BLOCKS    10
+#define TAMIL_BLOCK     5   // U+0B80
+
+#define MAX_GUESSES     (MAX_KBDTYPES + 4)
+
+// Log probabilities P(next class | class) for layouts where vowel keys also
+// produce vowel signs (Anjal, Tamil99, Tamil97, Murasu6)
+static const float phoneticModel[KC_COUNT][KC_COUNT] = {
+    {  -2.30f,  -0.60f,  -1.20f,  -4.61f,  -3.91f,  -3.91f },
+    {  -2.53f,  -1.20f,  -0.69f,  -4.61f,  -2.41f,  -3.91f },
+    {  -1.39f,  -0.51f,  -2.30f,  -4.61f,  -3.91f,  -3.91f },
+    {  -1.61f,  -1.20f,  -1.20f,  -3.00f,  -2.30f,  -3.00f },
+    {  -1.90f,  -1.61f,  -0.69f,  -4.61f,  -2.30f,  -3.22f },
+    {  -1.20f,  -1.61f,  -1.61f,  -3.00f,  -3.00f,  -1.61f },
+};
+
+// Same for WYTIWYG layouts, where vowel signs have their own keys and the
+// left half signs are typed before the consonant
+static const float wytiwygModel[KC_COUNT][KC_COUNT] = {
+    {  -2.30f,  -0.60f,  -2.12f,  -1.71f,  -3.91f,  -3.51f },
+    {  -1.71f,  -1.05f,  -3.91f,  -0.92f,  -3.91f,  -3.51f },
+    {  -1.39f,  -0.51f,  -3.91f,  -2.53f,  -3.91f,  -3.51f },
+    {  -1.61f,  -0.43f,  -3.91f,  -2.53f,  -3.91f,  -3.51f },
+    {  -1.61f,  -0.92f,  -2.30f,  -1.61f,  -3.00f,  -3.00f },
+    {  -1.20f,  -1.61f,  -1.90f,  -1.90f,  -3.00f,  -1.90f },
+};
+
+// Mean log probability of typical text under the models. Text that scores
+// this well (or better) gets a pattern score of 1.
+#define MODEL_REFERENCE_LP  -1.05f
+
+// The most frequent English words. Used to recognise plain text, which
+// otherwise looks a lot like Anjal romanised Tamil.
+static const char* stopWords[] = {
+    "the", "and", "of", "to", "in", "is", "it", "that", "for", "you", "was",
+    "with", "on", "are", "this", "be", "have", "not", "as", "at", "by", "from",
+    "or", "an", "we", "they", "but", "will", "can", "my", NULL
+};
+
+// TSCII 1.7 bytes, as they show up when the text is read as Latin-1
+#define TS_NONE         0   // digits, quotes, symbols and unassigned bytes
+#define TS_CONSO        1   // consonant, with or without pulli / u / uu / i
+#define TS_VOWEL        2   // independent vowel or aytham
+#define TS_POST_SIGN    3   // vowel sign written after its consonant
+#define TS_PRE_SIGN     4   // vowel sign written before its consonant
+
+// Built from kbdTable on first use, once for all threads
+static unsigned char keyClasses[MAX_KBDTYPES][ASCII_RANGE];
+
+#ifdef _WIN32
+static INIT_ONCE keyClassesOnce = INIT_ONCE_STATIC_INIT;
+#else
+static pthread_once_t keyClassesOnce = PTHREAD_ONCE_INIT;
+#endif
+
+static bool is_wytiwyg_layout(int layout)
+{
+    return layout == kbdMylai || layout == kbdTWNew || layout == kbdTWOld ||
+           layout == kbdBamini || layout == kbdTNTWriter;
+}
+
+static void mark_keys(unsigned char* classes, const char* keys, unsigned char keyClass)
+{
+    for (int i = 0; keys[i] != 0; i++) {
+        int c = (unsigned char)keys[i];
+        if (c == '*' || c < ASCII_FIRST || c > ASCII_LAST)
+            continue;
+        // first table to claim a key wins, the tables are marked in priority order
+        if (classes[c - ASCII_FIRST] == KC_UNMAPPED)
+            classes[c - ASCII_FIRST] = keyClass;
+    }
+}
+
+static void build_key_classes(void)
+{
+    for (int layout = 0; layout < MAX_KBDTYPES; layout++) {
+        unsigned char* classes = keyClasses[layout];
+
+        memset(classes, KC_UNMAPPED, ASCII_RANGE);
+
+        if (is_wytiwyg_layout(layout)) {
+            mark_keys(classes, GetLayoutTable(layout, Conso1stKeys), KC_CONSO);   // base consos
+            mark_keys(classes, GetLayoutTable(layout, Conso3rdKeys), KC_CONSO);   // ukara consos
+            mark_keys(classes, GetLayoutTable(layout, Conso2ndKeys), KC_VOWEL);   // uyir
+            mark_keys(classes, GetLayoutTable(layout, Vowel1stKeys), KC_SIGN);    // modifiers
+            mark_keys(classes, GetLayoutTable(layout, Vowel2ndKeys), KC_SIGN);    // modifying modifiers
+        } else {
+            mark_keys(classes, GetLayoutTable(layout, Conso1stKeys), KC_CONSO);
+            mark_keys(classes, GetLayoutTable(layout, Vowel1stKeys), KC_VOWEL);
+            mark_keys(classes, GetLayoutTable(layout, Vowel2ndKeys), KC_VOWEL);
+            mark_keys(classes, GetLayoutTable(layout, Conso2ndKeys), KC_SECOND);
+            mark_keys(classes, GetLayoutTable(layout, Conso3rdKeys), KC_SECOND);
+        }
+        // out of matrix keys are symbols, treat them like punctuation
+        mark_keys(classes, GetLayoutTable(layout, OutOfMatrixKeys), KC_SPACE);
+
+        // whatever is still unmapped and not a letter is plain punctuation
+        for (int c = ASCII_FIRST; c <= ASCII_LAST; c++) {
+            bool letter = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+            if (!letter && classes[c - ASCII_FIRST] == KC_UNMAPPED)
+                classes[c - ASCII_FIRST] = KC_SPACE;
+        }
+        classes[' ' - ASCII_FIRST] = KC_SPACE;
+        for (int c = '0'; c <= '9'; c++) {
+            if (classes[c - ASCII_FIRST] == KC_UNMAPPED)
+                classes[c - ASCII_FIRST] = KC_SPACE;
+        }
+    }
+}
+
+#ifdef _WIN32
+static BOOL CALLBACK build_key_classes_once(PINIT_ONCE once, PVOID param, PVOID* context)
+{
+    (void)once; (void)param; (void)context;
+    build_key_classes();
+    return TRUE;
+}
+#endif
+
+static void ensure_key_classes(void)
+{
+#ifdef _WIN32
+    InitOnceExecuteOnce(&keyClassesOnce, build_key_classes_once, NULL, NULL);
+#else
+    pthread_once(&keyClassesOnce, build_key_classes);
+#endif
+}
+
+// Only the bytes TSCII gives to Tamil letters count; the rest of 0x80..0xFF
+// (digits, quotes, symbols) says nothing about the encoding
+static int tscii_class(wchar_t c)
+{
+    if ((c >= 0x82 && c <= 0x8C) ||     // grantha consonants, with pulli
+        (c >= 0x99 && c <= 0x9C) ||     // ngu, nyu, nguu, nyuu
+        (c >= 0xB8 && c <= 0xC9) ||     // consonants
+        (c >= 0xCA && c <= 0xFD))       // ti, tii, u and uu forms, pulli forms
+        return TS_CONSO;
+    if (c >= 0xAB && c <= 0xB7)
+        return TS_VOWEL;
+    if ((c >= 0xA1 && c <= 0xA5) || c == 0xAA)
+        return TS_POST_SIGN;
+    if (c >= 0xA6 && c <= 0xA8)
+        return TS_PRE_SIGN;
+    return TS_NONE;
+}
+
+static bool is_stop_word(const char* word)
+{
+    for (int i = 0; stopWords[i] != NULL; i++) {
+        if (strcmp(word, stopWords[i]) == 0)
+            return true;
+    }
+    return false;
+}
+
+static float clamp_score(float score)
+{
+    if (score < 0.0f) return 0.0f;
+    if (score > 1.0f) return 1.0f;
+    return score;
+}
+
+static void add_guess(TextOriginGuess* list, int* count, TextOrigin origin, int layout, float score)
+{
+    if (score <= 0.0f || *count >= MAX_GUESSES)
+        return;
+
+    // keep the list sorted, best first
+    int pos = *count;
+    while (pos > 0 && list[pos - 1].score < score) {
+        list[pos] = list[pos - 1];
+        pos--;
+    }
+    list[pos].origin = origin;
+    list[pos].layout = (KeyboardLayout)layout;
+    list[pos].score = score;
+    (*count)++;
+}
+
+int text_origin_classify(const wchar_t* text, int length, TextOriginGuess* guesses, int max_guesses)
+{
+    if (!text || !guesses || max_guesses <= 0)
+        return 0;
+    if (length < 0)
+        length = (int)wcslen(text);
+
+    ensure_key_classes();
+
+    // --- Pass 1: histograms
+    unsigned int   bigrams[ASCII_RANGE * ASCII_RANGE];
+    unsigned short seenPairs[ASCII_RANGE * ASCII_RANGE];
+    unsigned int   byteHist[ASCII_LAST + 1];
+    unsigned int   indicBlocks[INDIC_BLOCKS];
+    unsigned int   highLatin = 0, otherUnicode = 0, nonSpace = 0;
+    unsigned int   tsciiLetters = 0, tsciiFormed = 0;
+    int            prevTscii = TS_NONE;
+    bool           prevFormed = false;
+    unsigned int   words = 0, stopWordHits = 0;
+    int            pairCount = 0;
+    char           word[8];
+    int            wordLen = 0;
+    int            prev = ' ';
+
+    memset(bigrams, 0, sizeof(bigrams));
+    memset(byteHist, 0, sizeof(byteHist));
+    memset(indicBlocks, 0, sizeof(indicBlocks));
+
+    for (int i = 0; i <= length; i++) {
+        wchar_t c = (i < length) ? text[i] : ' ';   // flush the last word and pair
+        int curr;
+
+        int tscii = TS_NONE;
+
+        if (c < 0x80) {
+            curr = (c > ' ' && c <= ASCII_LAST) ? (int)c : ' ';
+            byteHist[curr]++;
+        } else {
+            curr = ' ';
+            if (c < 0x100) {
+                highLatin++;
+                tscii = tscii_class(c);
+            }
+            else if (c >= INDIC_FIRST && c < INDIC_FIRST + INDIC_BLOCKS * 0x80)
+                indicBlocks[(c - INDIC_FIRST) >> 7]++;
+            else
+                otherUnicode++;
+        }
+        if (i < length && (curr != ' ' || c >= 0x80))
+            nonSpace++;
+
+        // TSCII Tamil is written in runs of TSCII letters, with a vowel sign
+        // after a consonant and a prefix sign before one. Accented Latin
+        // letters (é, ü, ñ land on Tamil letters too) sit among ASCII ones.
+        bool asciiLetter = (curr >= 'a' && curr <= 'z') || (curr >= 'A' && curr <= 'Z');
+        if (asciiLetter && prevFormed)
+            tsciiFormed--;
+        prevFormed = false;
+        if (tscii != TS_NONE) {
+            bool formed;
+            if (tscii == TS_POST_SIGN)
+                formed = prevTscii == TS_CONSO;
+            else if (prevTscii == TS_PRE_SIGN)
+                formed = tscii == TS_CONSO;
+            else
+                formed = !(prev >= 'a' && prev <= 'z') && !(prev >= 'A' && prev <= 'Z');
+            tsciiLetters++;
+            if (formed) {
+                tsciiFormed++;
+                prevFormed = true;
+            }
+        }
+        prevTscii = tscii;
+
+        // ASCII bigrams, word boundaries collapse to a single space
+        if (!(prev == ' ' && curr == ' ')) {
+            int pair = (prev - ASCII_FIRST) * ASCII_RANGE + (curr - ASCII_FIRST);
+            if (bigrams[pair]++ == 0)
+                seenPairs[pairCount++] = (unsigned short)pair;
+        }
+
+        // lower cased ASCII words for the plain text model
+        if (asciiLetter) {
+            if (wordLen < (int)sizeof(word) - 1)
+                word[wordLen] = (char)(curr | 0x20);
+            wordLen++;
+        } else if (wordLen > 0) {
+            words++;
+            if (wordLen < (int)sizeof(word)) {
+                word[wordLen] = 0;
+                if (is_stop_word(word))
+                    stopWordHits++;
+            }
+            wordLen = 0;
+        }
+        prev = curr;
+    }
+
+    TextOriginGuess list[MAX_GUESSES];
+    int count = 0;
+
+    if (nonSpace == 0)
+        return 0;
+
+    // --- Unicode and legacy byte encodings
+    unsigned int indicTotal = 0, bestOther = 0;
+    for (int b = 0; b < INDIC_BLOCKS; b++) {
+        indicTotal += indicBlocks[b];
+        if (b != TAMIL_BLOCK && indicBlocks[b] > bestOther)
+            bestOther = indicBlocks[b];
+    }
+    add_guess(list, &count, TEXT_ORIGIN_UNICODE_TAMIL, kbdNone, (float)indicBlocks[TAMIL_BLOCK] / nonSpace);
+    add_guess(list, &count, TEXT_ORIGIN_UNICODE_INDIC, kbdNone, (float)bestOther / nonSpace);
+    // TSCII only when most of its letters are laid out as Tamil
+    if (tsciiFormed * 2 > tsciiLetters)
+        add_guess(list, &count, TEXT_ORIGIN_TSCII, kbdNone, (float)tsciiFormed / nonSpace);
+
+    unsigned int asciiChars = nonSpace - highLatin - indicTotal - otherUnicode;
+    if (asciiChars == 0)
+        goto done;
+
+    float asciiShare = (float)asciiChars / nonSpace;
+
+    // --- Plain text: share of very common English words
+    float plain = (words > 0) ? clamp_score(4.0f * stopWordHits / words) : 0.0f;
+    add_guess(list, &count, TEXT_ORIGIN_PLAIN, kbdNone, plain * asciiShare);
+
+    // --- Keystrokes for each layout
+    for (int layout = 0; layout < MAX_KBDTYPES; layout++) {
+        if (layout == kbdAnjalIndic)
+            continue;   // AnjalIndic has no tables of its own
+
+        const unsigned char* classes = keyClasses[layout];
+        const float (*model)[KC_COUNT] = is_wytiwyg_layout(layout) ? wytiwygModel : phoneticModel;
+        float logProb = 0.0f;
+        unsigned int transitions = 0, mapped = 0, unmapped = 0;
+
+        for (int p = 0; p < pairCount; p++) {
+            int pair = seenPairs[p];
+            unsigned int n = bigrams[pair];
+            int from = classes[pair / ASCII_RANGE];
+            int to = classes[pair % ASCII_RANGE];
+
+            logProb += n * model[from][to];
+            transitions += n;
+        }
+        for (int c = ASCII_FIRST + 1; c <= ASCII_LAST; c++) {
+            if (byteHist[c] == 0)
+                continue;
+            int keyClass = classes[c - ASCII_FIRST];
+            if (keyClass == KC_UNMAPPED)
+                unmapped += byteHist[c];
+            else if (keyClass != KC_SPACE)
+                mapped += byteHist[c];
+        }
+        if (transitions == 0 || mapped == 0)
+            continue;
+
+        float coverage = (float)mapped / (mapped + unmapped);
+        float pattern = clamp_score(1.0f + (logProb / transitions - MODEL_REFERENCE_LP) / 2.0f);
+        // text full of English function words is unlikely to be keystrokes
+        float score = pattern * coverage * coverage * asciiShare * (1.0f - 0.5f * plain);
+
+        // Bamini text is Bamini font bytes, which is what the layout produces
+        add_guess(list, &count, layout == kbdBamini ? TEXT_ORIGIN_BAMINI : TEXT_ORIGIN_KEYSTROKES, layout, score);
+    }
+
+done:
+    if (count > max_guesses)
+        count = max_guesses;
+    memcpy(guesses, list, sizeof(TextOriginGuess) * count);
+    return count;
+}
+
+bool text_origin_best_guess(const wchar_t* text, int length, TextOriginGuess* guess)
+{
+    return text_origin_classify(text, length, guess, 1) == 1;
+}
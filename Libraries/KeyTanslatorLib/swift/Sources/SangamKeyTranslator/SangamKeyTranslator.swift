@@ -33,6 +33,11 @@ public class SangamKeyTranslator {
     private var prevKeyWasBackspace: Bool = false
     private var delInRevTypingOrder: Bool = false
     
+    // English passthrough: the keys typed since the composition started
+    private var englishLexicon: OpaquePointer?
+    private var englishMinConfidence: Int32 = 1
+    private var englishWord = EnglishLexiconState()
+    
     // MARK: - Initialization
     
     public init() {
@@ -55,9 +60,39 @@ public class SangamKeyTranslator {
     
     public func updateKeyStatesAfterDelete(forLastChar lastChar: wchar_t) {
         clearResults()
+        rejectEnglishWord()
         UpdatePrevKeyTypesForLastChar(lastChar)
     }
     
+    /// Let English words typed on the Anjal layout stay in Latin letters.
+    /// The lexicon at `path` is built by tools/build_english_lexicon; a word
+    /// listed there with at least `minConfidence` is what
+    /// `englishWordForComposition()` returns. A nil path turns it off.
+    @discardableResult
+    public func setEnglishLexicon(path: String?, minConfidence: Int32 = 1) -> Bool {
+        if let lexicon = englishLexicon {
+            english_lexicon_close(lexicon)
+            englishLexicon = nil
+        }
+        english_lexicon_state_reset(&englishWord)
+        englishMinConfidence = minConfidence
+        guard let path else { return true }
+        englishLexicon = path.withCString { english_lexicon_open($0) }
+        return englishLexicon != nil
+    }
+    
+    /// The composition's keystrokes as typed, if they spell a listed English
+    /// word and the layout is Anjal. Hosts commit this in place of the
+    /// composition when the word ends.
+    public func englishWordForComposition() -> String? {
+        guard let lexicon = englishLexicon, GetKeyboardLayout() == kbdAnjal else { return nil }
+        let confidence = english_lexicon_state_match(lexicon, &englishWord)
+        guard confidence > 0 && confidence >= englishMinConfidence else { return nil }
+        return withUnsafeBytes(of: englishWord.typed) { bytes in
+            String(cString: bytes.bindMemory(to: CChar.self).baseAddress!)
+        }
+    }
+    
     public func terminateComposition() {
         clearResults()
     }
@@ -89,6 +124,9 @@ public class SangamKeyTranslator {
         
         print("Calling with keyCode \(keyCode), prevKeyCode \(prevKeyCode)")
         
+        // Any key but a letter keeps the word from passing through as English
+        english_lexicon_state_push(&englishWord, keyCode)
+        
         // Call the C function to get the translation
         let ksr = GetCharStringForKey(keyCode, prevKeyCode, &translatedString, prevKeyWasBackspace)
         
@@ -103,9 +141,9 @@ public class SangamKeyTranslator {
             if delCount >= 4 && wcsncmp(prevTranslation, [0x0b95, 0x0bcd, 0x0bb7], 3) != 0 {
                 actualDelCount = 2
             }
-            result += "\(Character(UnicodeScalar(DELCODE)!))\(actualDelCount)"
+            result += deleteCode(actualDelCount)
         } else if ksr > 0 {
-            result += "\(Character(UnicodeScalar(DELCODE)!))\(ksr)"
+            result += deleteCode(Int(ksr))
         }
         
         // If this is க் + ஷ append a ZWNJ first
@@ -128,6 +166,7 @@ public class SangamKeyTranslator {
     }
     
     public func deleteLastChar(in composition: String) -> String {
+        rejectEnglishWord()
         var scalars = Array(composition.unicodeScalars)
         let len = scalars.count
         var shouldResetPrevKeyType = false
@@ -229,7 +268,7 @@ public class SangamKeyTranslator {
         let delCount = GetUnmappedCharStringForKey(keyCode, &unmappedChar, prevChar, shifted)
         
         if delCount > 0 {
-            result += "\(Character(UnicodeScalar(DELCODE)!))\(delCount)"
+            result += deleteCode(Int(delCount))
         }
         
         if let unmappedStr = String(utf32String: unmappedChar) {
@@ -245,11 +284,30 @@ public class SangamKeyTranslator {
         prevKeyCode = 0
         prevTranslation = Array(repeating: 0, count: 10)
         localComposing = ""
+        english_lexicon_state_reset(&englishWord)
         
         // Reset the params in C
         ResetKeyStringGlobals()
     }
     
+    // The keystrokes can't follow an edit of the composition
+    private func rejectEnglishWord() {
+        english_lexicon_state_reset(&englishWord)
+        englishWord.rejected = true
+    }
+    
+    // DELCODE and the count as a digit, which is all hosts read; more than
+    // nine deletes take several such pairs
+    private func deleteCode(_ count: Int) -> String {
+        var code = ""
+        var remaining = count
+        while remaining > 0 {
+            code += "\(Character(UnicodeScalar(DELCODE)!))\(min(remaining, 9))"
+            remaining -= 9
+        }
+        return code
+    }
+    
     private func stringEndsWithKshaPrefix(_ composition: String) -> Bool {
         var checking = composition
         
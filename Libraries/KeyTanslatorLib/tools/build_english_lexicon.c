@@ -0,0 +1,331 @@
+// Builds the memory-mapped English lexicon used for Anjal passthrough.
+//
+//   build_english_lexicon <wordlist.txt> <out.lex> [--exclude <words.txt>]
+//
+// The word list has one word per line, optionally followed by whitespace and
+// a frequency count. Words that are not plain ASCII letters, are shorter than
+// ENGLISH_LEXICON_MIN_WORD or longer than ENGLISH_LEXICON_MAX_WORD are
+// skipped. The exclude list removes words that are common Anjal spellings of
+// Tamil words (e.g. "pin", "man") so they keep transliterating.
+//
+// Confidence is log-scaled from the counts into 15 levels; words without a
+// count get the top level. Coarse levels let more suffixes be shared.
+
+#include "EnglishLexicon.h"
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BLOOM_BITS_PER_WORD   10
+#define BLOOM_HASHES          5
+#define CONFIDENCE_LEVELS     15
+
+typedef struct {
+    char     word[ENGLISH_LEXICON_MAX_WORD + 1];
+    double   count;
+} Entry;
+
+typedef struct {
+    uint32_t* edges;        // (child << 8) | letter, sorted by letter
+    int       edgeCount;
+    int       edgeCap;
+    uint8_t   confidence;
+    uint32_t  registered;   // 1 if in the register
+} BuildNode;
+
+static BuildNode* nodes;
+static uint32_t   nodeCount, nodeCap;
+
+static uint32_t* registerTable;
+static uint32_t  registerCap;
+
+static void* xrealloc(void* p, size_t n)
+{
+    void* r = realloc(p, n);
+    if (!r) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    return r;
+}
+
+static uint32_t newNode(void)
+{
+    if (nodeCount == nodeCap) {
+        nodeCap = nodeCap ? nodeCap * 2 : 1024;
+        nodes = xrealloc(nodes, nodeCap * sizeof(BuildNode));
+    }
+    memset(&nodes[nodeCount], 0, sizeof(BuildNode));
+    return nodeCount++;
+}
+
+static void addEdge(uint32_t node, char c, uint32_t child)
+{
+    BuildNode* n = &nodes[node];
+    if (n->edgeCount == n->edgeCap) {
+        n->edgeCap = n->edgeCap ? n->edgeCap * 2 : 2;
+        n->edges = xrealloc(n->edges, n->edgeCap * sizeof(uint32_t));
+    }
+    n->edges[n->edgeCount++] = (child << 8) | (uint8_t)c;
+}
+
+static uint32_t nodeHash(uint32_t id)
+{
+    const BuildNode* n = &nodes[id];
+    uint32_t h = 2166136261u ^ n->confidence;
+    for (int i = 0; i < n->edgeCount; i++)
+        h = (h ^ n->edges[i]) * 16777619u;
+    return h;
+}
+
+static bool nodesEqual(uint32_t a, uint32_t b)
+{
+    const BuildNode* x = &nodes[a];
+    const BuildNode* y = &nodes[b];
+    return x->confidence == y->confidence && x->edgeCount == y->edgeCount &&
+           memcmp(x->edges, y->edges, x->edgeCount * sizeof(uint32_t)) == 0;
+}
+
+// Returns the registered equivalent of 'id', registering 'id' if it is new.
+static uint32_t registerNode(uint32_t id)
+{
+    if (registerCap < nodeCount * 2) {
+        uint32_t oldCap = registerCap;
+        uint32_t* old = registerTable;
+        registerCap = registerCap ? registerCap : 4096;
+        while (registerCap < nodeCount * 4) registerCap *= 2;
+        registerTable = calloc(registerCap, sizeof(uint32_t));
+        if (!registerTable) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+        for (uint32_t i = 0; i < oldCap; i++) {
+            if (old[i]) {
+                uint32_t slot = nodeHash(old[i] - 1) & (registerCap - 1);
+                while (registerTable[slot]) slot = (slot + 1) & (registerCap - 1);
+                registerTable[slot] = old[i];
+            }
+        }
+        free(old);
+    }
+
+    uint32_t slot = nodeHash(id) & (registerCap - 1);
+    while (registerTable[slot]) {
+        if (nodesEqual(registerTable[slot] - 1, id))
+            return registerTable[slot] - 1;
+        slot = (slot + 1) & (registerCap - 1);
+    }
+    registerTable[slot] = id + 1;
+    nodes[id].registered = 1;
+    return id;
+}
+
+// Minimise the path of the previous word below depth 'downTo'
+// (Daciuk et al., incremental construction from sorted input).
+static uint32_t pathNodes[ENGLISH_LEXICON_MAX_WORD + 1];
+static int      pathLength;
+
+static void minimise(int downTo)
+{
+    while (pathLength > downTo) {
+        uint32_t parent = pathNodes[pathLength - 1];
+        BuildNode* p = &nodes[parent];
+        uint32_t child = p->edges[p->edgeCount - 1] >> 8;
+        uint32_t kept = registerNode(child);
+        if (kept != child) {
+            p->edges[p->edgeCount - 1] = (kept << 8) | (p->edges[p->edgeCount - 1] & 0xFF);
+            free(nodes[child].edges);
+            nodes[child].edges = NULL;
+            nodes[child].edgeCount = 0;
+        }
+        pathLength--;
+    }
+}
+
+static int compareEntries(const void* a, const void* b)
+{
+    return strcmp(((const Entry*)a)->word, ((const Entry*)b)->word);
+}
+
+static bool normaliseWord(const char* in, char* out)
+{
+    int len = 0;
+    for (; in[len]; len++) {
+        char c = in[len];
+        if (c >= 'A' && c <= 'Z') c = (char)(c - 'A' + 'a');
+        if (c < 'a' || c > 'z' || len >= ENGLISH_LEXICON_MAX_WORD) return false;
+        out[len] = c;
+    }
+    out[len] = 0;
+    return len >= ENGLISH_LEXICON_MIN_WORD;
+}
+
+static Entry* readWords(const char* path, int* count)
+{
+    FILE* f = fopen(path, "r");
+    if (!f) {
+        fprintf(stderr, "cannot open %s\n", path);
+        exit(1);
+    }
+    Entry* entries = NULL;
+    int n = 0, cap = 0;
+    char line[512], word[256];
+    while (fgets(line, sizeof(line), f)) {
+        double freq = -1;
+        int fields = sscanf(line, "%255s %lf", word, &freq);
+        if (fields < 1) continue;
+        if (n == cap) {
+            cap = cap ? cap * 2 : 4096;
+            entries = xrealloc(entries, cap * sizeof(Entry));
+        }
+        if (!normaliseWord(word, entries[n].word)) continue;
+        entries[n].count = fields == 2 ? freq : -1;
+        n++;
+    }
+    fclose(f);
+    *count = n;
+    return entries;
+}
+
+static void writeAligned(FILE* f, const void* data, size_t size, uint32_t* offset)
+{
+    static const char zeros[8] = {0};
+    long pos = ftell(f);
+    if (pos % 8) fwrite(zeros, 1, 8 - pos % 8, f);
+    *offset = (uint32_t)ftell(f);
+    if (size) fwrite(data, 1, size, f);
+}
+
+int main(int argc, char** argv)
+{
+    if (argc != 3 && !(argc == 5 && strcmp(argv[3], "--exclude") == 0)) {
+        fprintf(stderr, "usage: %s <wordlist.txt> <out.lex> [--exclude <words.txt>]\n", argv[0]);
+        return 2;
+    }
+
+    int count = 0, excludeCount = 0;
+    Entry* entries = readWords(argv[1], &count);
+    Entry* excludes = argc == 5 ? readWords(argv[4], &excludeCount) : NULL;
+
+    qsort(entries, count, sizeof(Entry), compareEntries);
+    if (excludes) qsort(excludes, excludeCount, sizeof(Entry), compareEntries);
+
+    // Drop duplicates (keep the highest count) and excluded words
+    double maxCount = 1;
+    int unique = 0;
+    for (int i = 0; i < count; i++) {
+        if (excludes && bsearch(&entries[i], excludes, excludeCount, sizeof(Entry), compareEntries))
+            continue;
+        if (unique > 0 && strcmp(entries[unique - 1].word, entries[i].word) == 0) {
+            if (entries[i].count > entries[unique - 1].count)
+                entries[unique - 1].count = entries[i].count;
+            continue;
+        }
+        entries[unique++] = entries[i];
+    }
+    for (int i = 0; i < unique; i++)
+        if (entries[i].count > maxCount) maxCount = entries[i].count;
+
+    // Build the minimal automaton
+    uint32_t root = newNode();
+    pathLength = 0;
+    const char* prev = "";
+    for (int i = 0; i < unique; i++) {
+        const char* w = entries[i].word;
+        int common = 0;
+        while (w[common] && w[common] == prev[common]) common++;
+        minimise(common);
+
+        uint32_t node = common == 0 ? root : nodes[pathNodes[common - 1]].edges[nodes[pathNodes[common - 1]].edgeCount - 1] >> 8;
+        for (int j = common; w[j]; j++) {
+            uint32_t child = newNode();
+            addEdge(node, w[j], child);
+            pathNodes[pathLength++] = node;
+            node = child;
+        }
+
+        int level = CONFIDENCE_LEVELS;
+        if (entries[i].count >= 0)
+            level = 1 + (int)((CONFIDENCE_LEVELS - 1) * log1p(entries[i].count) / log1p(maxCount) + 0.5);
+        nodes[node].confidence = (uint8_t)(level * (255 / CONFIDENCE_LEVELS));
+        prev = w;
+    }
+    minimise(0);
+
+    // Serialise reachable nodes breadth first so siblings' edges are contiguous
+    uint32_t* newId = malloc(nodeCount * sizeof(uint32_t));
+    uint32_t* queue = malloc(nodeCount * sizeof(uint32_t));
+    for (uint32_t i = 0; i < nodeCount; i++) newId[i] = UINT32_MAX;
+    uint32_t head = 0, tail = 0, outNodes = 0, outEdges = 0;
+    newId[root] = outNodes++;
+    queue[tail++] = root;
+    while (head < tail) {
+        const BuildNode* n = &nodes[queue[head++]];
+        for (int j = 0; j < n->edgeCount; j++) {
+            uint32_t child = n->edges[j] >> 8;
+            if (newId[child] == UINT32_MAX) {
+                newId[child] = outNodes++;
+                queue[tail++] = child;
+            }
+        }
+        outEdges += n->edgeCount;
+    }
+    if (outNodes >= (1u << 24)) {
+        fprintf(stderr, "too many automaton nodes (%u)\n", outNodes);
+        return 1;
+    }
+
+    EnglishLexiconNode* outN = calloc(outNodes, sizeof(EnglishLexiconNode));
+    uint32_t* outE = malloc((outEdges ? outEdges : 1) * sizeof(uint32_t));
+    uint32_t edgePos = 0;
+    for (uint32_t q = 0; q < tail; q++) {
+        const BuildNode* n = &nodes[queue[q]];
+        EnglishLexiconNode* o = &outN[q];
+        o->firstEdge = edgePos;
+        o->edgeCount = (uint8_t)n->edgeCount;
+        o->confidence = n->confidence;
+        for (int j = 0; j < n->edgeCount; j++)
+            outE[edgePos++] = (newId[n->edges[j] >> 8] << 8) | (n->edges[j] & 0xFF);
+    }
+
+    // Blocked Bloom filter
+    uint32_t bloomWords = 1;
+    while (bloomWords * 64ULL < (uint64_t)unique * BLOOM_BITS_PER_WORD) bloomWords *= 2;
+    uint64_t* bloom = calloc(bloomWords, sizeof(uint64_t));
+    for (int i = 0; i < unique; i++) {
+        uint32_t hash = ENGLISH_LEXICON_HASH_SEED;
+        int len = (int)strlen(entries[i].word);
+        for (int j = 0; j < len; j++)
+            hash = english_lexicon_hash_step(hash, entries[i].word[j]);
+        uint64_t key = english_lexicon_bloom_key(hash, len);
+        for (int k = 0; k < BLOOM_HASHES; k++)
+            bloom[key & (bloomWords - 1)] |= 1ULL << ((key >> (28 + 6 * k)) & 63);
+    }
+
+    FILE* out = fopen(argv[2], "wb");
+    if (!out) {
+        fprintf(stderr, "cannot write %s\n", argv[2]);
+        return 1;
+    }
+    EnglishLexiconHeader header;
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, ENGLISH_LEXICON_MAGIC, 4);
+    header.version = ENGLISH_LEXICON_VERSION;
+    header.bloomHashes = BLOOM_HASHES;
+    header.maxWordLength = ENGLISH_LEXICON_MAX_WORD;
+    header.bloomWords = bloomWords;
+    header.nodeCount = outNodes;
+    header.edgeCount = outEdges;
+    fwrite(&header, sizeof(header), 1, out);
+    writeAligned(out, bloom, bloomWords * sizeof(uint64_t), &header.bloomOffset);
+    writeAligned(out, outN, outNodes * sizeof(EnglishLexiconNode), &header.nodesOffset);
+    writeAligned(out, outE, outEdges * sizeof(uint32_t), &header.edgesOffset);
+    fseek(out, 0, SEEK_SET);
+    fwrite(&header, sizeof(header), 1, out);
+    fclose(out);
+
+    printf("%d words, %u nodes, %u edges, %u bloom bytes -> %s\n",
+           unique, outNodes, outEdges, bloomWords * 8, argv[2]);
+    return 0;
+}
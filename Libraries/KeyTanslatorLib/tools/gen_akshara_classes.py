@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""Generate the character class table used by the akshara segmenter.
+
+Classifies every code point of the Indic blocks U+0900..U+0DFF (Devanagari
+to Sinhala) for the DFA in src/indic/AksharaSegmenter.c, from the Unicode
+character names and general categories, and writes src/indic/AksharaClasses.h.
+
+Run from the library root when moving to a newer Unicode version:
+
+    python3 tools/gen_akshara_classes.py
+"""
+
+import os
+import unicodedata
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+OUTPUT = os.path.join(ROOT, "src", "indic", "AksharaClasses.h")
+
+FIRST, LAST = 0x0900, 0x0DFF
+
+# Order is the class number; keep in sync with the DFA in AksharaSegmenter.c
+CLASSES = [
+    ("OTHER",        "not part of an akshara: punctuation, digits, Latin"),
+    ("CONSONANT",    "takes nukta, virama, vowel signs"),
+    ("VOWEL",        "independent vowel or other stand-alone letter"),
+    ("VOWEL_SIGN",   "dependent vowel sign or length mark"),
+    ("VIRAMA",       "virama that joins the next consonant into a conjunct"),
+    ("VIRAMA_FINAL", "visible virama ending the akshara (Tamil pulli)"),
+    ("VIRAMA_ZWJ",   "virama joining only through ZWJ (Sinhala al-lakuna)"),
+    ("NUKTA",        ""),
+    ("MODIFIER",     "anusvara, candrabindu, visarga"),
+    ("EXTEND",       "any other combining mark"),
+    ("ZWJ",          ""),
+    ("ZWNJ",         ""),
+    ("CR",           ""),
+    ("LF",           ""),
+    ("REPH",         "Malayalam dot reph, joins the following consonant"),
+    ("TAMIL_KA",     "Tamil KA, which joins SSA across the pulli"),
+    ("TAMIL_SSA",    ""),
+]
+CLASS = {name: i for i, (name, _) in enumerate(CLASSES)}
+
+BLOCK_VOWELS = set(range(0x04, 0x15)) | {0x60, 0x61}     # ISCII layout
+DEVANAGARI_EXTRA_VOWELS = range(0x0972, 0x0978)           # candra a .. uue
+SINHALA_VOWELS = set(range(0x05, 0x17))
+
+
+def classify(cp):
+    ch = chr(cp)
+    cat = unicodedata.category(ch)
+    name = unicodedata.name(ch, "")
+    offset = cp & 0x7F
+
+    if cat == "Cn":
+        return "OTHER"
+    if cp == 0x0B95:
+        return "TAMIL_KA"
+    if cp == 0x0BB7:
+        return "TAMIL_SSA"
+    if cat in ("Mn", "Mc"):
+        if "VIRAMA" in name or "AL-LAKUNA" in name:
+            if name.startswith("TAMIL") or "VERTICAL BAR" in name or "CIRCULAR" in name:
+                return "VIRAMA_FINAL"
+            if name.startswith("SINHALA"):
+                return "VIRAMA_ZWJ"
+            return "VIRAMA"
+        if "NUKTA" in name:
+            return "NUKTA"
+        if "VOWEL SIGN" in name or "LENGTH MARK" in name:
+            return "VOWEL_SIGN"
+        if any(w in name for w in ("ANUSVARA", "CANDRABINDU", "VISARGA", "TIPPI", "ADDAK", "BINDI")):
+            return "MODIFIER"
+        return "EXTEND"
+    if cat == "Lo":
+        if "DOT REPH" in name:
+            return "REPH"
+        if "LETTER" in name and "CHILLU" not in name and "POLLU" not in name:
+            vowels = SINHALA_VOWELS if cp >= 0x0D80 else BLOCK_VOWELS
+            if offset in vowels or cp in DEVANAGARI_EXTRA_VOWELS or name.endswith((" IRI", " URA")):
+                return "VOWEL"
+            if "VEDIC" not in name:
+                return "CONSONANT"
+        return "VOWEL"      # chillus, OM, avagraha, aytham: stand alone
+    return "OTHER"
+
+
+def main():
+    lines = [
+        "// Generated by tools/gen_akshara_classes.py - do not edit.",
+        "// Unicode %s" % unicodedata.unidata_version,
+        "",
+        "#ifndef AKSHARA_CLASSES_H",
+        "#define AKSHARA_CLASSES_H",
+        "",
+        "#include <stdint.h>",
+        "",
+        "enum {",
+    ]
+    for name, comment in CLASSES:
+        entry = "    AK_%s = %d," % (name, CLASS[name])
+        lines.append(entry + ("%s// %s" % (" " * (28 - len(entry)), comment) if comment else ""))
+    lines += [
+        "    AK_CLASS_COUNT = %d" % len(CLASSES),
+        "};",
+        "",
+        "#define AKSHARA_TABLE_FIRST 0x%04X" % FIRST,
+        "#define AKSHARA_TABLE_SIZE  0x%04X" % (LAST - FIRST + 1),
+        "",
+        "static const uint8_t aksharaClasses[AKSHARA_TABLE_SIZE] = {",
+    ]
+    for block in range(FIRST, LAST + 1, 0x80):
+        lines.append("    // U+%04X" % block)
+        for row in range(block, block + 0x80, 16):
+            lines.append("    " + ",".join("%2d" % CLASS[classify(cp)] for cp in range(row, row + 16)) + ",")
+    lines += [
+        "};",
+        "",
+        "#endif // AKSHARA_CLASSES_H",
+        "",
+    ]
+    with open(OUTPUT, "w", encoding="utf-8") as f:
+        f.write("\n".join(lines))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,241 @@
+#!/usr/bin/env python3
+"""Generate minimal perfect hash tables for the Indic getKeyPos lookups.
+
+Reads the UV1/UV2/UV3 and UC1/UC2/UC3 key tables (and the nukta base tables)
+from the src/indic keymaps and writes src/indic/IndicKeyPosHash.{h,c}.
+
+getKeyPos(key, table, pKey, pTable, fKey, fTable) returns the first index i
+where table[i] == key and, when pKey is non-zero, pTable[i] == pKey and, when
+fKey is also non-zero, fTable[i] == fKey. Every (key, pKey, fKey) that can
+match is stored with the index getKeyPos would return, including the
+pKey == 0 and fKey == 0 forms, so keyPosLookup() answers all of them with
+a single probe.
+
+The key tables in the keymaps are only read here; they sit behind
+KEYPOS_GENERATOR_INPUT, which the build never defines, so the library
+carries just the hashes. The key tables are also written out, behind
+KEYPOS_HASH_SOURCES, for tools/keypos_benchmark to check the hashes against.
+
+Run from the library root after editing a keymap's key tables:
+
+    python3 tools/gen_keypos_hash.py
+"""
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+INDIC = os.path.join(ROOT, "src", "indic")
+
+KEYMAPS = [
+    ("Deva",  "IndicDevanagariKeymap.c"),
+    ("Mal",   "IndicMalayalamKeymap.c"),
+    ("Kan",   "IndicKannadaKeymap.c"),
+    ("Tel",   "IndicTeluguKeymap.c"),
+    ("Grmk",  "IndicGurmukhiKeymap.c"),
+    ("Anjal", "IndicTamilAnjalKeymap.c"),
+    ("Beng",  "IndicBengaliKeymap.c"),
+    ("Gujr",  "IndicGujaratiKeymap.c"),
+    ("Orya",  "IndicOriyaKeymap.c"),
+    ("Sinh",  "IndicSinhalaKeymap.c"),
+    ("Diac",  "IndicDiacriticKeymap.c"),
+]
+
+M32 = 0xFFFFFFFF
+BUCKET_SEED = 0x2545F491     # KEYPOS_BUCKET_SEED in IndicKeyPos.h
+
+
+def mix(k, seed):
+    k = (k ^ seed) & M32
+    k = (k * 0x9E3779B1) & M32
+    k ^= k >> 15
+    k = (k * 0x85EBCA77) & M32
+    k ^= k >> 13
+    return k
+
+
+def reduce(h, n):
+    return (h * n) >> 32
+
+
+def composite(key, p, f):
+    return key | (p << 16) | (f << 23)
+
+
+def parse_tables(path):
+    src = open(path, encoding="utf-8").read()
+    src = re.sub(r"/\*.*?\*/", "", src, flags=re.S)
+    tables = {}
+    for m in re.finditer(r"static\s+UniChar\s+(\w+)\s*\[\]\s*=\s*\{(.*?)\};", src, re.S):
+        items = []
+        body = re.sub(r"//[^\n]*", "", m.group(2))
+        for tok in re.findall(r"'(?:\\.|[^'])'|0x[0-9A-Fa-f]+|\d+", body):
+            if tok.startswith("'"):
+                ch = tok[1:-1]
+                items.append(ord(ch[1]) if ch.startswith("\\") else ord(ch))
+            else:
+                items.append(int(tok, 0))
+        tables[m.group(1)] = items
+    return tables
+
+
+def rows(table):
+    """Rows up to (not including) the zero sentinel."""
+    out = []
+    for v in table:
+        if v == 0:
+            break
+        out.append(v)
+    return out
+
+
+def lookup_entries(table, ptable=None, ftable=None):
+    """(composite key -> index) for every lookup getKeyPos can answer."""
+    entries = {}
+    keys = rows(table)
+    for i, key in enumerate(keys):
+        if key == ord('*'):
+            continue        # getKeyPos never looks up '*'
+        entries.setdefault(composite(key, 0, 0), i)
+        if ptable is None or ptable[i] == 0:
+            continue
+        p = ptable[i]
+        if p >= 128 or key >= 0x10000:
+            sys.exit("key table row %d does not fit the composite key" % i)
+        entries.setdefault(composite(key, p, 0), i)
+        if ftable is None or ftable[i] == 0:
+            continue
+        f = ftable[i]
+        if f >= 128:
+            sys.exit("first key table row %d does not fit the composite key" % i)
+        entries.setdefault(composite(key, p, f), i)
+    return entries
+
+
+def build_hash(entries):
+    """Hash-and-displace minimal perfect hash: one slot per entry."""
+    n = len(entries)
+    if n == 0:
+        return [], [], []
+    bucket_count = max(1, (n + 1) // 2)
+    buckets = [[] for _ in range(bucket_count)]
+    for k in entries:
+        buckets[reduce(mix(k, BUCKET_SEED), bucket_count)].append(k)
+
+    seeds = [0] * bucket_count
+    taken = [None] * n
+    for b in sorted(range(bucket_count), key=lambda b: -len(buckets[b])):
+        if not buckets[b]:
+            continue
+        for seed in range(1, 0x10000):
+            slots = [reduce(mix(k, seed), n) for k in buckets[b]]
+            if len(set(slots)) == len(slots) and all(taken[s] is None for s in slots):
+                for k, s in zip(buckets[b], slots):
+                    taken[s] = k
+                seeds[b] = seed
+                break
+        else:
+            sys.exit("no displacement found for bucket %d" % b)
+    return seeds, taken, [entries[k] for k in taken]
+
+
+def c_array(ctype, name, values, per_line=12, fmt="%d"):
+    if not values:
+        values = [0]
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt % v for v in values[i:i + per_line]))
+    return "static const %s %s[] = {\n%s\n};\n" % (ctype, name, ",\n".join(lines))
+
+
+def main():
+    hashes = []     # (name, (keys, prevKeys, firstKeys))
+    for prefix, filename in KEYMAPS:
+        t = parse_tables(os.path.join(INDIC, filename))
+        for kind in ("UV", "UC"):
+            k1, k2, k3 = (t[prefix + kind + str(i) + "Keys"] for i in (1, 2, 3))
+            hashes.append(("%s%s1" % (prefix, kind), (k1, None, None)))
+            hashes.append(("%s%s2" % (prefix, kind), (k2, k1, None)))
+            hashes.append(("%s%s3" % (prefix, kind), (k3, k2, k1)))
+        if prefix + "UNuktaBase" in t:
+            # no zero sentinel in the source table, take the whole array
+            hashes.append(("%sUNukta" % prefix, (t[prefix + "UNuktaBase"] + [0], None, None)))
+
+    header = [
+        "// Generated by tools/gen_keypos_hash.py - do not edit.",
+        "",
+        "#ifndef INDIC_KEYPOS_HASH_H",
+        "#define INDIC_KEYPOS_HASH_H",
+        "",
+        '#include "IndicKeyPos.h"',
+        "",
+    ]
+    source = [
+        "// Generated by tools/gen_keypos_hash.py - do not edit.",
+        "",
+        '#include "IndicKeyPosHash.h"',
+        "",
+    ]
+    sources = []    # key tables the hashes were built from, tools only
+    registry = []
+
+    for name, (table, ptable, ftable) in hashes:
+        entries = lookup_entries(table, ptable, ftable)
+        seeds, keys, values = build_hash(entries)
+        source.append(c_array("uint16_t", name + "Seeds", seeds))
+        source.append(c_array("uint32_t", name + "Slots", keys, 6, "0x%08X"))
+        source.append(c_array("int8_t", name + "Index", values))
+        source.append("const KeyPosHash %sHash = { %sSeeds, %sSlots, %sIndex, %d, %d };\n"
+                      % (name, name, name, name, len(seeds), len(keys)))
+        header.append("extern const KeyPosHash %sHash;" % name)
+
+        # source tables, kept for verification against getKeyPos
+        src_names = []
+        for suffix, tbl in (("Keys", table), ("PrevKeys", ptable), ("FirstKeys", ftable)):
+            if tbl is None:
+                src_names.append("NULL")
+                continue
+            arr = rows(tbl) + [0]
+            sources.append(c_array("UniChar", "%sSource%s" % (name, suffix), arr, 12, "0x%04X"))
+            src_names.append("%sSource%s" % (name, suffix))
+        registry.append('    { "%s", &%sHash, %s },' % (name, name, ", ".join(src_names)))
+
+    header += [
+        "",
+        "#ifdef KEYPOS_HASH_SOURCES",
+        "// Every generated table with the key tables it was built from, for",
+        "// tools that check the hashes; not part of the library",
+        "typedef struct {",
+        "    const char*       name;",
+        "    const KeyPosHash* hash;",
+        "    const UniChar*    keys;",
+        "    const UniChar*    prevKeys;     // NULL for single-table lookups",
+        "    const UniChar*    firstKeys;    // NULL unless a three-table lookup",
+        "} KeyPosHashSource;",
+        "",
+        "extern const KeyPosHashSource keyPosHashSources[];",
+        "extern const int keyPosHashSourceCount;",
+        "#endif",
+        "",
+        "#endif // INDIC_KEYPOS_HASH_H",
+        "",
+    ]
+    source += ["#ifdef KEYPOS_HASH_SOURCES", ""] + sources + [
+        "const KeyPosHashSource keyPosHashSources[] = {",
+    ] + registry + [
+        "};",
+        "",
+        "const int keyPosHashSourceCount = (int)(sizeof(keyPosHashSources) / sizeof(keyPosHashSources[0]));",
+        "#endif",
+        "",
+    ]
+
+    with open(os.path.join(INDIC, "IndicKeyPosHash.h"), "w", encoding="utf-8") as f:
+        f.write("\n".join(header))
+    with open(os.path.join(INDIC, "IndicKeyPosHash.c"), "w", encoding="utf-8") as f:
+        f.write("\n".join(source))
+
+
+if __name__ == "__main__":
+    main()
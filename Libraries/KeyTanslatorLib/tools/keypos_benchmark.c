@@ -0,0 +1,163 @@
+// Checks the generated getKeyPos hash tables against the linear getKeyPos()
+// and times both on every Indic Anjal engine.
+//
+//   keypos_benchmark [iterations]
+//
+// Verification is exhaustive: every key (ASCII, plus the Indic blocks for
+// the nukta tables) is looked up with every previous and first key the
+// engines can pass. Timing replays the same pseudo-random lookup stream
+// (a mix of one-, two- and three-table lookups, hits and misses) through
+// both implementations.
+
+#include "IndicNotesIMEngine.h"
+#include "IndicKeyPosHash.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define STREAM_LENGTH   4096
+
+typedef struct {
+    const KeyPosHashSource* source;
+    UniChar key, pKey, fKey;
+} Query;
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static int linear_lookup(const KeyPosHashSource* s, UniChar key, UniChar pKey, UniChar fKey)
+{
+    return getKeyPos(key, (UniChar*)s->keys, pKey, (UniChar*)s->prevKeys, fKey, (UniChar*)s->firstKeys);
+}
+
+static int check_one(const KeyPosHashSource* s, UniChar key, UniChar pKey, UniChar fKey)
+{
+    int expected = linear_lookup(s, key, pKey, fKey);
+    int actual = keyPosLookup(s->hash, key, pKey, fKey);
+    if (expected == actual)
+        return 0;
+    fprintf(stderr, "%s: key %04X prev %02X first %02X: getKeyPos %d, hash %d\n",
+            s->name, (unsigned)key, (unsigned)pKey, (unsigned)fKey, expected, actual);
+    return 1;
+}
+
+static int verify(const KeyPosHashSource* s, long* lookups)
+{
+    int errors = 0;
+    UniChar lastKey = strstr(s->name, "Nukta") ? 0x0DFF : 0x7F;
+    for (UniChar key = 0; key <= lastKey; key++) {
+        if (key == 0x80) key = 0x0900;  // skip straight to the Indic blocks
+        errors += check_one(s, key, 0, 0);
+        (*lookups)++;
+        if (!s->prevKeys) continue;
+        for (UniChar p = 1; p < 0x80; p++) {
+            errors += check_one(s, key, p, 0);
+            (*lookups)++;
+            if (!s->firstKeys) continue;
+            for (UniChar f = 1; f < 0x80; f++) {
+                errors += check_one(s, key, p, f);
+                (*lookups)++;
+            }
+        }
+    }
+    return errors;
+}
+
+// Typed keys are mostly letters; prev/first keys come from the tables half
+// the time so the three-table lookups actually hit.
+static UniChar random_key(uint32_t* seed, const UniChar* table)
+{
+    *seed = *seed * 1103515245u + 12345u;
+    uint32_t r = *seed >> 8;
+    if (table && (r & 1)) {
+        int n = 0;
+        while (table[n]) n++;
+        return table[(r >> 1) % n];
+    }
+    return (UniChar)(0x21 + (r >> 1) % 94);
+}
+
+static int build_stream(const char* prefix, Query* stream)
+{
+    const KeyPosHashSource* sources[8];
+    int count = 0;
+    for (int i = 0; i < keyPosHashSourceCount && count < 8; i++) {
+        const char* name = keyPosHashSources[i].name;
+        if (strncmp(name, prefix, strlen(prefix)) == 0 && !strstr(name, "Nukta"))
+            sources[count++] = &keyPosHashSources[i];
+    }
+    if (count == 0) return 0;
+
+    uint32_t seed = 2010;
+    for (int i = 0; i < STREAM_LENGTH; i++) {
+        const KeyPosHashSource* s = sources[i % count];
+        stream[i].source = s;
+        stream[i].key = random_key(&seed, s->keys);
+        stream[i].pKey = s->prevKeys ? random_key(&seed, s->prevKeys) : 0;
+        stream[i].fKey = s->firstKeys ? random_key(&seed, s->firstKeys) : 0;
+    }
+    return count;
+}
+
+int main(int argc, char* argv[])
+{
+    static const char* const engines[][2] = {
+        { "Deva", "Devanagari" }, { "Mal", "Malayalam" }, { "Kan", "Kannada" },
+        { "Tel", "Telugu" }, { "Grmk", "Gurmukhi" }, { "Anjal", "Tamil" },
+        { "Beng", "Bengali" }, { "Gujr", "Gujarati" }, { "Orya", "Oriya" },
+        { "Sinh", "Sinhala" }, { "Diac", "Diacritic" },
+    };
+    long iterations = argc > 1 ? atol(argv[1]) : 500;
+    if (iterations <= 0) {
+        fprintf(stderr, "usage: %s [iterations]\n", argv[0]);
+        return 2;
+    }
+
+    long lookups = 0;
+    int errors = 0;
+    for (int i = 0; i < keyPosHashSourceCount; i++)
+        errors += verify(&keyPosHashSources[i], &lookups);
+    printf("verified %ld lookups over %d tables: %d mismatches\n\n",
+           lookups, keyPosHashSourceCount, errors);
+    if (errors)
+        return 1;
+
+    static Query stream[STREAM_LENGTH];
+    volatile long sink = 0;
+    printf("%-12s %12s %12s %8s\n", "engine", "linear ns", "hash ns", "speedup");
+    for (size_t e = 0; e < sizeof(engines) / sizeof(engines[0]); e++) {
+        if (build_stream(engines[e][0], stream) == 0)
+            continue;
+
+        double start = now_seconds();
+        for (long it = 0; it < iterations; it++) {
+            long acc = 0;
+            for (int i = 0; i < STREAM_LENGTH; i++)
+                acc += linear_lookup(stream[i].source, stream[i].key, stream[i].pKey, stream[i].fKey);
+            sink += acc;
+        }
+        double linear = now_seconds() - start;
+
+        start = now_seconds();
+        for (long it = 0; it < iterations; it++) {
+            long acc = 0;
+            for (int i = 0; i < STREAM_LENGTH; i++)
+                acc += keyPosLookup(stream[i].source->hash, stream[i].key, stream[i].pKey, stream[i].fKey);
+            sink += acc;
+        }
+        double hashed = now_seconds() - start;
+
+        double n = (double)iterations * STREAM_LENGTH;
+        printf("%-12s %12.2f %12.2f %7.1fx\n", engines[e][1],
+               linear * 1e9 / n, hashed * 1e9 / n, linear / hashed);
+    }
+    (void)sink;
+    return 0;
+}
@@ -0,0 +1,715 @@
+// Keystroke efficiency of every Tamil layout and Indic Anjal engine over a
+// Unicode (UTF-8) text corpus.
+//
+//   layout_analyzer [-j threads] <corpus.txt>
+//
+// For each engine the tool reports the minimal number of keystrokes per
+// character needed to type the corpus, the share of those keystrokes that
+// need shift, and the share of key bigrams typed with the same finger on a
+// QWERTY touch-typing layout.
+//
+// How it works:
+//  1. Reverse synthesis (single threaded, the Tamil engine keeps its state in
+//     globals). Key sequences are run through each engine from a fresh state
+//     and every composition unit - the keys that build one character cluster,
+//     including cross-cluster rewrites such as Tamil99 auto-pulli - is
+//     recorded with the text it produces and the continuation keys of the
+//     state it ends in.
+//  2. The corpus is memory-mapped and cut into shards on whitespace. Worker
+//     threads claim shards from an atomic counter, so fast workers simply take
+//     more shards. Each run of script characters is segmented by a shortest
+//     path over the unit outputs; a unit may only follow another if its first
+//     key would not have continued the previous unit.
+//  3. Per-thread counters are merged into the report.
+
+#include "AnjalKeyMap.h"
+#include "IndicNotesIMEngine.h"
+#include "KeyMask128.h"
+#include "MappedFile.h"
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#define MAX_UNIT_KEYS       4
+#define MAX_UNIT_OUTPUT     12
+#define MAX_END_CLASSES     255
+#define MAX_SEGMENT         256
+#define SHARD_SIZE          (8u << 20)
+#define NEUTRAL_PREV_KEY    0x7F        // "some earlier key", not a word start
+#define KEY_COST            64          // keystrokes first, shifts break ties
+#define SKIP_COST           (1u << 20)  // a character no unit produces
+#define NO_COST             UINT32_MAX
+
+typedef enum { ENGINE_TAMIL, ENGINE_INDIC } EngineKind;
+
+typedef struct {
+    uint8_t  keys[MAX_UNIT_KEYS];
+    uint8_t  keyCount;
+    uint8_t  shifts;
+    uint8_t  firstKey;
+    uint8_t  endClass;
+} Unit;
+
+typedef struct {
+    UniChar  output[MAX_UNIT_OUTPUT];
+    int      outputLength;
+    Unit     unit;
+} SynthUnit;
+
+typedef struct {
+    uint32_t firstUnit;
+    uint32_t unitCount;
+} TrieNode;
+
+typedef struct {
+    uint64_t chars;
+    uint64_t keys;
+    uint64_t shifts;
+    uint64_t bigrams;
+    uint64_t sameFinger;
+    uint64_t unreachable;
+} EngineStats;
+
+typedef struct {
+    const char*  name;
+    EngineKind   kind;
+    int          id;            // Tamil layout or Indic imeType
+    UniChar      blockStart;
+    UniChar      blockEnd;
+
+    // end-state continuation masks, class 0 is the fresh state
+    KeyMask128   classes[MAX_END_CLASSES];
+    int          classCount;
+    IndicContinuationCache* continuations;  // Indic engines, while synthesising
+
+    // trie over unit outputs
+    Unit*        units;
+    size_t       unitCount;     // 0 = no key sequence types the script, skipped
+    TrieNode*    nodes;
+    uint32_t     nodeCount;
+    uint64_t*    edgeKeys;      // (node << 32 | char) + 1, 0 = empty
+    uint32_t*    edgeChild;
+    uint32_t     edgeMask;
+
+    EngineStats  total;
+} Engine;
+
+// the remaining fields are filled in by buildEngine()
+#define ENGINE(engineName, engineKind, engineId, first, last) \
+    { .name = (engineName), .kind = (engineKind), .id = (engineId), .blockStart = (first), .blockEnd = (last) }
+
+static Engine engines[] = {
+    ENGINE("Tamil Anjal",            ENGINE_TAMIL, kbdAnjal,      0x0B80, 0x0BFF),
+    ENGINE("Tamil99",                ENGINE_TAMIL, kbdTamil99,    0x0B80, 0x0BFF),
+    ENGINE("Tamil97",                ENGINE_TAMIL, kbdTamil97,    0x0B80, 0x0BFF),
+    ENGINE("Tamil Mylai",            ENGINE_TAMIL, kbdMylai,      0x0B80, 0x0BFF),
+    ENGINE("Tamil Typewriter New",   ENGINE_TAMIL, kbdTWNew,      0x0B80, 0x0BFF),
+    ENGINE("Tamil Typewriter Old",   ENGINE_TAMIL, kbdTWOld,      0x0B80, 0x0BFF),
+    ENGINE("Tamil Anjal Indic",      ENGINE_TAMIL, kbdAnjalIndic, 0x0B80, 0x0BFF),
+    ENGINE("Tamil Murasu6",          ENGINE_TAMIL, kbdMurasu6,    0x0B80, 0x0BFF),
+    ENGINE("Tamil Bamini",           ENGINE_TAMIL, kbdBamini,     0x0B80, 0x0BFF),
+    ENGINE("Tamil TN Typewriter",    ENGINE_TAMIL, kbdTNTWriter,  0x0B80, 0x0BFF),
+    ENGINE("Indic Tamil Anjal",      ENGINE_INDIC, kImeTypeTamil,      0x0B80, 0x0BFF),
+    ENGINE("Indic Devanagari",       ENGINE_INDIC, kImeTypeDevanagari, 0x0900, 0x097F),
+    ENGINE("Indic Gurmukhi",         ENGINE_INDIC, kImeTypeGurmukhi,   0x0A00, 0x0A7F),
+    ENGINE("Indic Telugu",           ENGINE_INDIC, kImeTypeTelugu,     0x0C00, 0x0C7F),
+    ENGINE("Indic Kannada",          ENGINE_INDIC, kImeTypeKannada,    0x0C80, 0x0CFF),
+    ENGINE("Indic Malayalam",        ENGINE_INDIC, kImeTypeMalayalam,  0x0D00, 0x0D7F),
+    ENGINE("Indic Bengali",          ENGINE_INDIC, kImeTypeBengali,    0x0980, 0x09FF),
+    ENGINE("Indic Gujarati",         ENGINE_INDIC, kImeTypeGujarati,   0x0A80, 0x0AFF),
+    ENGINE("Indic Oriya",            ENGINE_INDIC, kImeTypeOriya,      0x0B00, 0x0B7F),
+    ENGINE("Indic Sinhala",          ENGINE_INDIC, kImeTypeSinhala,    0x0D80, 0x0DFF),
+};
+
+#define ENGINE_COUNT ((int)(sizeof(engines) / sizeof(engines[0])))
+
+static signed char fingerOf[128];
+
+static void *xalloc(size_t size)
+{
+    void *p = calloc(1, size ? size : 1);
+    if (!p) {
+        fprintf(stderr, "out of memory\n");
+        exit(1);
+    }
+    return p;
+}
+
+static void initFingers(void)
+{
+    static const char *fingers[8] = {
+        "`1qaz~!QAZ", "2wsx@WSX", "3edc#EDC", "4rfv5tgb$RFV%TGB",
+        "6yhn7ujm^YHN&UJM", "8ik,*IK<", "9ol.(OL>", "0p;/-['=]\\)P:?_{\"+}|"
+    };
+    memset(fingerOf, -1, sizeof(fingerOf));
+    for (int f = 0; f < 8; f++)
+        for (const char *k = fingers[f]; *k; k++)
+            fingerOf[(unsigned char)*k] = (signed char)f;
+}
+
+static bool isShiftedKey(int key)
+{
+    return (key >= 'A' && key <= 'Z') || (key && strchr("~!@#$%^&*()_+{}|:\"<>?", key));
+}
+
+// ---------------------------------------------------------------------------
+// Reverse synthesis
+// ---------------------------------------------------------------------------
+
+// Type 'keys' from a fresh state. Returns the output length, or -1 if a key
+// deleted text typed before the unit.
+static int runSequence(const Engine *e, const uint8_t *keys, int count,
+                       UniChar *out, KeyMask128 *endMask)
+{
+    int length = 0;
+
+    if (e->kind == ENGINE_TAMIL) {
+        WCHAR prevKey = NEUTRAL_PREV_KEY;
+        int prevLength = 0;
+
+        ResetKeyStringGlobals();
+        for (int i = 0; i < count; i++) {
+            WCHAR s[32] = { 0 };
+            int del = GetCharStringForKey(keys[i], prevKey, s, false);
+            if (del == KSR_DELETE_PREV_KS_LENGTH)
+                del = prevLength;
+            if (del > length)
+                return -1;
+            length -= del;
+            prevLength = (int)wcslen(s);
+            if (length + prevLength > MAX_UNIT_OUTPUT)
+                return -1;
+            for (int j = 0; j < prevLength; j++)
+                out[length++] = (UniChar)s[j];
+            prevKey = keys[i];
+        }
+        *endMask = GetContinuationKeys(prevKey);
+    } else {
+        getKeyStringResults r;
+
+        clearResults(&r);
+        r.imeType = e->id;
+        for (int i = 0; i < count; i++) {
+            UniChar s[32] = { 0 };
+            getKeyStringUnicode(keys[i], s, &r);
+            if (r.deleteCount > length)
+                return -1;
+            length -= r.deleteCount;
+            if (length + r.insertCount > MAX_UNIT_OUTPUT)
+                return -1;
+            for (int j = 0; j < r.insertCount; j++)
+                out[length++] = s[j];
+        }
+        *endMask = getContinuationKeys(e->continuations, &r);
+    }
+    return length;
+}
+
+static int endClassFor(Engine *e, KeyMask128 mask)
+{
+    for (int c = 0; c < e->classCount; c++)
+        if (e->classes[c].lo == mask.lo && e->classes[c].hi == mask.hi)
+            return c;
+    if (e->classCount == MAX_END_CLASSES)
+        return -1;
+    e->classes[e->classCount] = mask;
+    return e->classCount++;
+}
+
+typedef struct {
+    SynthUnit *items;
+    size_t     count;
+    size_t     capacity;
+} SynthList;
+
+static void addSynthUnit(Engine *e, SynthList *list, const uint8_t *keys, int keyCount,
+                         const UniChar *out, int outLength, KeyMask128 endMask)
+{
+    // text outside the script is never segmented, so a unit that only
+    // produces such text (e.g. a layout passing keys through) can't be used
+    bool inBlock = false;
+    for (int i = 0; i < outLength && !inBlock; i++)
+        inBlock = out[i] >= e->blockStart && out[i] <= e->blockEnd;
+    if (!inBlock)
+        return;
+
+    int cls = endClassFor(e, endMask);
+    if (cls < 0)
+        return;
+    if (list->count == list->capacity) {
+        list->capacity = list->capacity ? list->capacity * 2 : 4096;
+        list->items = realloc(list->items, list->capacity * sizeof(SynthUnit));
+        if (!list->items) {
+            fprintf(stderr, "out of memory\n");
+            exit(1);
+        }
+    }
+    SynthUnit *u = &list->items[list->count++];
+    memset(u, 0, sizeof(*u));
+    memcpy(u->output, out, outLength * sizeof(UniChar));
+    u->outputLength = outLength;
+    memcpy(u->unit.keys, keys, keyCount);
+    u->unit.keyCount = (uint8_t)keyCount;
+    u->unit.firstKey = keys[0];
+    u->unit.endClass = (uint8_t)cls;
+    for (int i = 0; i < keyCount; i++)
+        u->unit.shifts += isShiftedKey(keys[i]);
+}
+
+// Extend 'keys' (whose output and end state are given) by one more key.
+// Continuation keys are followed to any depth; at depth one every key is
+// tried so that rewrites of the previous cluster are found as well.
+static void synthesise(Engine *e, SynthList *list, uint8_t *keys, int depth,
+                       const UniChar *parentOut, int parentLength, KeyMask128 parentMask)
+{
+    if (depth == MAX_UNIT_KEYS)
+        return;
+
+    for (int key = 0x21; key < 0x7F; key++) {
+        bool continues = keymask_test(parentMask, key);
+        if (depth > 1 && !continues)
+            continue;
+
+        UniChar out[MAX_UNIT_OUTPUT];
+        KeyMask128 mask;
+        keys[depth] = (uint8_t)key;
+        int length = runSequence(e, keys, depth + 1, out, &mask);
+        if (length <= 0)
+            continue;
+
+        if (depth > 0 && !continues) {
+            // only keep it if the key rewrote the previous cluster
+            if (length >= parentLength && memcmp(out, parentOut, parentLength * sizeof(UniChar)) == 0)
+                continue;
+        }
+        addSynthUnit(e, list, keys, depth + 1, out, length, mask);
+        synthesise(e, list, keys, depth + 1, out, length, mask);
+    }
+}
+
+static int compareSynthUnits(const void *a, const void *b)
+{
+    const SynthUnit *x = a, *y = b;
+    int n = x->outputLength < y->outputLength ? x->outputLength : y->outputLength;
+    for (int i = 0; i < n; i++)
+        if (x->output[i] != y->output[i])
+            return x->output[i] < y->output[i] ? -1 : 1;
+    if (x->outputLength != y->outputLength)
+        return x->outputLength - y->outputLength;
+    if (x->unit.firstKey != y->unit.firstKey)
+        return x->unit.firstKey - y->unit.firstKey;
+    if (x->unit.endClass != y->unit.endClass)
+        return x->unit.endClass - y->unit.endClass;
+    int cx = x->unit.keyCount * KEY_COST + x->unit.shifts;
+    int cy = y->unit.keyCount * KEY_COST + y->unit.shifts;
+    return cx - cy;
+}
+
+static uint32_t edgeSlot(const Engine *e, uint64_t key)
+{
+    uint64_t h = key * 0x9E3779B97F4A7C15ULL;
+    return (uint32_t)(h >> 32) & e->edgeMask;
+}
+
+static uint32_t trieChild(const Engine *e, uint32_t node, UniChar c)
+{
+    uint64_t key = (((uint64_t)node << 32) | c) + 1;
+    for (uint32_t slot = edgeSlot(e, key);; slot = (slot + 1) & e->edgeMask) {
+        if (e->edgeKeys[slot] == key)
+            return e->edgeChild[slot];
+        if (e->edgeKeys[slot] == 0)
+            return 0;
+    }
+}
+
+static uint32_t trieInsert(Engine *e, uint32_t node, UniChar c)
+{
+    uint64_t key = (((uint64_t)node << 32) | c) + 1;
+    uint32_t slot = edgeSlot(e, key);
+    for (;; slot = (slot + 1) & e->edgeMask) {
+        if (e->edgeKeys[slot] == key)
+            return e->edgeChild[slot];
+        if (e->edgeKeys[slot] == 0)
+            break;
+    }
+    e->edgeKeys[slot] = key;
+    e->edgeChild[slot] = e->nodeCount;
+    return e->nodeCount++;
+}
+
+static void buildEngine(Engine *e)
+{
+    SynthList list = { 0 };
+    uint8_t keys[MAX_UNIT_KEYS];
+
+    e->classCount = 0;
+    endClassFor(e, keymask_empty());
+
+    if (e->kind == ENGINE_TAMIL)
+        SetKeyboardLayout(e->id);
+    else
+        e->continuations = indicContinuationCacheCreate();
+    synthesise(e, &list, keys, 0, NULL, 0, keymask_empty());
+    indicContinuationCacheDestroy(e->continuations);
+    e->continuations = NULL;
+
+    // keep the cheapest unit per (output, first key, end class)
+    qsort(list.items, list.count, sizeof(SynthUnit), compareSynthUnits);
+    size_t unique = 0;
+    for (size_t i = 0; i < list.count; i++) {
+        if (unique > 0) {
+            SynthUnit *p = &list.items[unique - 1], *c = &list.items[i];
+            if (p->outputLength == c->outputLength &&
+                memcmp(p->output, c->output, c->outputLength * sizeof(UniChar)) == 0 &&
+                p->unit.firstKey == c->unit.firstKey && p->unit.endClass == c->unit.endClass)
+                continue;
+        }
+        list.items[unique++] = list.items[i];
+    }
+
+    size_t maxNodes = 1;
+    for (size_t i = 0; i < unique; i++)
+        maxNodes += list.items[i].outputLength;
+    uint32_t edgeCap = 1024;
+    while (edgeCap < maxNodes * 2)
+        edgeCap *= 2;
+
+    e->unitCount = unique;
+    e->units = xalloc(unique * sizeof(Unit));
+    e->nodes = xalloc(maxNodes * sizeof(TrieNode));
+    e->edgeKeys = xalloc(edgeCap * sizeof(uint64_t));
+    e->edgeChild = xalloc(edgeCap * sizeof(uint32_t));
+    e->edgeMask = edgeCap - 1;
+    e->nodeCount = 1;
+
+    // units are sorted by output, so each node's units are contiguous
+    for (size_t i = 0; i < unique; i++) {
+        const SynthUnit *s = &list.items[i];
+        uint32_t node = 0;
+        for (int j = 0; j < s->outputLength; j++)
+            node = trieInsert(e, node, s->output[j]);
+        if (e->nodes[node].unitCount == 0)
+            e->nodes[node].firstUnit = (uint32_t)i;
+        e->nodes[node].unitCount++;
+        e->units[i] = s->unit;
+    }
+    free(list.items);
+}
+
+// ---------------------------------------------------------------------------
+// Corpus pass
+// ---------------------------------------------------------------------------
+
+typedef struct {
+    uint32_t cost;
+    uint32_t unit;          // UINT32_MAX = skipped character
+    uint16_t from;          // segment position the unit starts at
+    uint8_t  prevClass;
+} DpCell;
+
+typedef struct {
+    const MappedFile *corpus;
+    const size_t     *shardStarts;
+    size_t            shardCount;
+    atomic_size_t    *nextShard;
+    EngineStats       stats[ENGINE_COUNT];
+    DpCell           *dp;
+} Worker;
+
+static void analyseSegment(const Engine *e, const UniChar *text, int n,
+                           DpCell *dp, EngineStats *stats)
+{
+    const int classes = e->classCount;
+
+    for (int i = 0; i <= n; i++)
+        for (int c = 0; c < classes; c++)
+            dp[i * classes + c].cost = NO_COST;
+    dp[0].cost = 0;
+
+    for (int i = 0; i < n; i++) {
+        for (int c = 0; c < classes; c++) {
+            uint32_t base = dp[i * classes + c].cost;
+            if (base == NO_COST)
+                continue;
+
+            // fallback: the character can't be typed at all
+            DpCell *skip = &dp[(i + 1) * classes];
+            if (base + SKIP_COST < skip->cost) {
+                skip->cost = base + SKIP_COST;
+                skip->unit = UINT32_MAX;
+                skip->from = (uint16_t)i;
+                skip->prevClass = (uint8_t)c;
+            }
+
+            uint32_t node = 0;
+            for (int j = i; j < n; j++) {
+                node = trieChild(e, node, text[j]);
+                if (node == 0)
+                    break;
+                const TrieNode *t = &e->nodes[node];
+                for (uint32_t u = t->firstUnit; u < t->firstUnit + t->unitCount; u++) {
+                    const Unit *unit = &e->units[u];
+                    if (keymask_test(e->classes[c], unit->firstKey))
+                        continue;   // would have continued the previous unit
+                    uint32_t cost = base + unit->keyCount * KEY_COST + unit->shifts;
+                    DpCell *cell = &dp[(j + 1) * classes + unit->endClass];
+                    if (cost < cell->cost) {
+                        cell->cost = cost;
+                        cell->unit = u;
+                        cell->from = (uint16_t)i;
+                        cell->prevClass = (uint8_t)c;
+                    }
+                }
+            }
+        }
+    }
+
+    int best = 0;
+    for (int c = 1; c < classes; c++)
+        if (dp[n * classes + c].cost < dp[n * classes + best].cost)
+            best = c;
+
+    // walk back, counting keys and same-finger bigrams (in reverse order)
+    stats->chars += (uint64_t)n;
+    int laterKey = -1;
+    for (int i = n, c = best; i > 0;) {
+        const DpCell *cell = &dp[i * classes + c];
+        if (cell->unit == UINT32_MAX) {
+            stats->unreachable++;
+            laterKey = -1;
+            c = cell->prevClass;
+            i = cell->from;
+            continue;
+        }
+        const Unit *unit = &e->units[cell->unit];
+        stats->keys += unit->keyCount;
+        stats->shifts += unit->shifts;
+        for (int k = unit->keyCount - 1; k >= 0; k--) {
+            int key = unit->keys[k];
+            if (laterKey >= 0) {
+                stats->bigrams++;
+                if (key != laterKey && fingerOf[key] >= 0 && fingerOf[key] == fingerOf[laterKey])
+                    stats->sameFinger++;
+            }
+            laterKey = key;
+        }
+        c = cell->prevClass;
+        i = cell->from;
+    }
+}
+
+// 128 character blocks some engine types, from the engines table
+static bool scriptBlocks[0x10000 >> 7];
+
+static void initScriptBlocks(void)
+{
+    for (int i = 0; i < ENGINE_COUNT; i++)
+        for (int c = engines[i].blockStart; c <= engines[i].blockEnd; c += 0x80)
+            scriptBlocks[c >> 7] = true;
+}
+
+static int engineScript(UniChar c)
+{
+    // returns the block start for script characters, 0 otherwise
+    if (scriptBlocks[c >> 7])
+        return c & ~0x7F;
+    return 0;
+}
+
+static void flushSegment(Worker *w, const UniChar *text, int n, int block)
+{
+    if (n == 0)
+        return;
+    for (int i = 0; i < ENGINE_COUNT; i++)
+        if (engines[i].blockStart == block && engines[i].unitCount > 0)
+            analyseSegment(&engines[i], text, n, w->dp, &w->stats[i]);
+}
+
+static void *workerMain(void *arg)
+{
+    Worker *w = arg;
+    UniChar segment[MAX_SEGMENT];
+
+    for (;;) {
+        size_t shard = atomic_fetch_add(w->nextShard, 1);
+        if (shard >= w->shardCount)
+            break;
+
+        const unsigned char *p = w->corpus->data + w->shardStarts[shard];
+        const unsigned char *end = w->corpus->data + w->shardStarts[shard + 1];
+        int n = 0, block = 0;
+
+        while (p < end) {
+            // decode one UTF-8 character
+            uint32_t c = *p++;
+            if (c >= 0xC0) {
+                int extra = c >= 0xF0 ? 3 : c >= 0xE0 ? 2 : 1;
+                c &= 0x3F >> extra;
+                while (extra-- > 0 && p < end && (*p & 0xC0) == 0x80)
+                    c = (c << 6) | (*p++ & 0x3F);
+            }
+
+            int cblock = c <= 0xFFFF ? engineScript((UniChar)c) : 0;
+            bool joiner = (c == 0x200C || c == 0x200D) && n > 0;
+            if (joiner)
+                cblock = block;
+
+            if (cblock == 0 || cblock != block || n == MAX_SEGMENT) {
+                flushSegment(w, segment, n, block);
+                n = 0;
+            }
+            block = cblock;
+            if (cblock != 0)
+                segment[n++] = (UniChar)c;
+        }
+        flushSegment(w, segment, n, block);
+    }
+    return NULL;
+}
+
+// Shard boundaries are moved forward to just after an ASCII whitespace byte,
+// which can't be inside a UTF-8 sequence or a script run.
+static size_t *makeShards(const MappedFile *corpus, size_t *count)
+{
+    size_t maxShards = corpus->size / SHARD_SIZE + 2;
+    size_t *starts = xalloc((maxShards + 1) * sizeof(size_t));
+    size_t n = 0;
+
+    starts[n++] = 0;
+    for (size_t pos = SHARD_SIZE; pos < corpus->size; pos += SHARD_SIZE) {
+        size_t p = pos;
+        while (p < corpus->size && corpus->data[p] != ' ' && corpus->data[p] != '\n')
+            p++;
+        if (p >= corpus->size)
+            break;
+        if (p + 1 > starts[n - 1])
+            starts[n++] = p + 1;
+    }
+    starts[n] = corpus->size;
+    *count = n;
+    return starts;
+}
+
+// The Tamil engine prints debug output; keep it off the report.
+static int silenceStdout(void)
+{
+    fflush(stdout);
+    int saved = dup(STDOUT_FILENO);
+    int devnull = open("/dev/null", O_WRONLY);
+    if (devnull >= 0) {
+        dup2(devnull, STDOUT_FILENO);
+        close(devnull);
+    }
+    return saved;
+}
+
+static void restoreStdout(int saved)
+{
+    fflush(stdout);
+    if (saved >= 0) {
+        dup2(saved, STDOUT_FILENO);
+        close(saved);
+    }
+}
+
+static void printReport(void)
+{
+    printf("%-22s %12s %10s %8s %8s %12s\n",
+           "engine", "chars", "keys/char", "shift%", "sfb%", "unreachable");
+    for (int i = 0; i < ENGINE_COUNT; i++) {
+        const EngineStats *s = &engines[i].total;
+        if (s->chars == 0)
+            continue;
+        uint64_t typed = s->chars - s->unreachable;
+        printf("%-22s %12llu %10.3f %8.2f %8.2f %12llu\n",
+               engines[i].name,
+               (unsigned long long)s->chars,
+               typed ? (double)s->keys / (double)typed : 0.0,
+               s->keys ? 100.0 * (double)s->shifts / (double)s->keys : 0.0,
+               s->bigrams ? 100.0 * (double)s->sameFinger / (double)s->bigrams : 0.0,
+               (unsigned long long)s->unreachable);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    int threads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    const char *path = NULL;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "-j") == 0 && i + 1 < argc)
+            threads = atoi(argv[++i]);
+        else
+            path = argv[i];
+    }
+    if (!path) {
+        fprintf(stderr, "usage: %s [-j threads] <corpus.txt>\n", argv[0]);
+        return 2;
+    }
+    if (threads < 1)
+        threads = 1;
+
+    MappedFile corpus;
+    if (!mapped_file_open(&corpus, path)) {
+        fprintf(stderr, "cannot map %s\n", path);
+        return 1;
+    }
+
+    initFingers();
+    initScriptBlocks();
+
+    int saved = silenceStdout();
+    int maxClasses = 1;
+    for (int i = 0; i < ENGINE_COUNT; i++) {
+        buildEngine(&engines[i]);
+        if (engines[i].classCount > maxClasses)
+            maxClasses = engines[i].classCount;
+    }
+    restoreStdout(saved);
+    for (int i = 0; i < ENGINE_COUNT; i++)
+        if (engines[i].unitCount == 0)
+            fprintf(stderr, "%s: no key sequence types the script, skipped\n", engines[i].name);
+
+    size_t shardCount;
+    size_t *shardStarts = makeShards(&corpus, &shardCount);
+    atomic_size_t nextShard = 0;
+
+    Worker *workers = xalloc(threads * sizeof(Worker));
+    pthread_t *ids = xalloc(threads * sizeof(pthread_t));
+    for (int t = 0; t < threads; t++) {
+        workers[t].corpus = &corpus;
+        workers[t].shardStarts = shardStarts;
+        workers[t].shardCount = shardCount;
+        workers[t].nextShard = &nextShard;
+        workers[t].dp = xalloc((MAX_SEGMENT + 1) * (size_t)maxClasses * sizeof(DpCell));
+        pthread_create(&ids[t], NULL, workerMain, &workers[t]);
+    }
+    for (int t = 0; t < threads; t++) {
+        pthread_join(ids[t], NULL);
+        for (int i = 0; i < ENGINE_COUNT; i++) {
+            EngineStats *a = &engines[i].total;
+            const EngineStats *b = &workers[t].stats[i];
+            a->chars += b->chars;
+            a->keys += b->keys;
+            a->shifts += b->shifts;
+            a->bigrams += b->bigrams;
+            a->sameFinger += b->sameFinger;
+            a->unreachable += b->unreachable;
+        }
+        free(workers[t].dp);
+    }
+
+    printReport();
+
+    free(workers);
+    free(ids);
+    free(shardStarts);
+    mapped_file_close(&corpus);
+    return 0;
+}
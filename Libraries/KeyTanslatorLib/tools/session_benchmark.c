@@ -0,0 +1,100 @@
+// Runs a stream of keystrokes spread over many sessions through an
+// IndicSessionPool and through one getKeyStringResults per session, checks
+// that both give the same output and reports memory and keystroke rates.
+//
+//   session_benchmark [sessions] [keystrokes]
+//
+// Sessions cycle through every Indic engine; each keystroke goes to a random
+// session and is a random key from the phonetic layouts or a space.
+
+#include "IndicSessionPool.h"
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#define BATCH 4096
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+int main(int argc, char* argv[])
+{
+    static const char keys[] = "aAiIuUeEoOkKgGcCjJtTdDnNpPbBmMyrRlLvwsSzhqx^.  ";
+    long sessions = argc > 1 ? atol(argv[1]) : 100000;
+    long total = argc > 2 ? atol(argv[2]) : 20000000;
+    if (sessions <= 0 || total <= 0) {
+        fprintf(stderr, "usage: %s [sessions] [keystrokes]\n", argv[0]);
+        return 2;
+    }
+
+    IndicSessionPool* pool = indic_session_pool_create((size_t)sessions);
+    IndicSessionId* ids = malloc(sessions * sizeof(IndicSessionId));
+    getKeyStringResults* plain = calloc(sessions, sizeof(getKeyStringResults));
+    IndicKeystroke* batch = malloc(BATCH * sizeof(IndicKeystroke));
+    IndicKeystrokeResult* results = malloc(BATCH * sizeof(IndicKeystrokeResult));
+    uint32_t* targets = malloc(BATCH * sizeof(uint32_t));
+    if (!pool || !ids || !plain || !batch || !results || !targets) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+    }
+
+    for (long i = 0; i < sessions; i++) {
+        int imeType = kImeTypeDevanagari + (int)(i % (kImeTypeSinhala - kImeTypeDevanagari + 1));
+        ids[i] = indic_session_open(pool, imeType);
+        plain[i].imeType = imeType;
+    }
+
+    // the pool, checking every result against the plain sessions
+    uint32_t seed = 2010;
+    double poolSeconds = 0, plainSeconds = 0;
+    for (long done = 0; done < total; done += BATCH) {
+        size_t count = total - done < BATCH ? (size_t)(total - done) : BATCH;
+        for (size_t k = 0; k < count; k++) {
+            seed = seed * 1103515245u + 12345u;
+            targets[k] = (seed >> 4) % (uint32_t)sessions;
+            batch[k].session = ids[targets[k]];
+            batch[k].key = keys[(seed >> 24) % (sizeof(keys) - 1)];
+            batch[k].contextBefore = 0;
+        }
+
+        double start = now_seconds();
+        indic_session_process(pool, batch, count, results);
+        poolSeconds += now_seconds() - start;
+
+        start = now_seconds();
+        for (size_t k = 0; k < count; k++) {
+            UniChar text[16];
+            getKeyStringResults* r = &plain[targets[k]];
+            r->contextBefore = 0;
+            getKeyStringUnicode(batch[k].key, text, r);
+            if (r->insertCount != results[k].insertCount || r->deleteCount != results[k].deleteCount ||
+                r->fixPrevious != results[k].fixPrevious ||
+                memcmp(text, results[k].text, r->insertCount * sizeof(UniChar)) != 0) {
+                fprintf(stderr, "keystroke %ld: pool output differs from the plain session\n", done + (long)k);
+                return 1;
+            }
+        }
+        plainSeconds += now_seconds() - start;     // includes the comparison
+    }
+
+    printf("%ld sessions, %ld keystrokes\n", sessions, total);
+    printf("%-22s %12s %14s\n", "", "bytes/session", "Mkeystrokes/s");
+    printf("%-22s %12zu %14.2f\n", "getKeyStringResults", sizeof(getKeyStringResults), total / plainSeconds / 1e6);
+    printf("%-22s %12zu %14.2f\n", "IndicSessionPool", sizeof(IndicSessionState) + sizeof(uint32_t),
+           total / poolSeconds / 1e6);
+
+    indic_session_pool_destroy(pool);
+    free(ids);
+    free(plain);
+    free(batch);
+    free(results);
+    free(targets);
+    return 0;
+}